@@ -267,6 +267,7 @@ LOCAL_SRC_FILES                                                  := \
     src/core/mac/mac_frame.cpp                                      \
     src/core/mac/mac_links.cpp                                      \
     src/core/mac/mac_types.cpp                                      \
+    src/core/mac/slotted_access.cpp                                 \
     src/core/mac/sub_mac.cpp                                        \
     src/core/mac/sub_mac_callbacks.cpp                              \
     src/core/meshcop/announce_begin_client.cpp                      \
@@ -350,6 +351,7 @@ LOCAL_SRC_FILES                                                  := \
     src/core/thread/network_data_types.cpp                          \
     src/core/thread/network_diagnostic.cpp                          \
     src/core/thread/panid_query_server.cpp                          \
+    src/core/thread/parent_candidates.cpp                           \
     src/core/thread/radio_selector.cpp                              \
     src/core/thread/router_table.cpp                                \
     src/core/thread/src_match_controller.cpp                        \
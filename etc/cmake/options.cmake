@@ -301,6 +301,11 @@ if(OT_NETDATA_PUBLISHER)
     target_compile_definitions(ot-config INTERFACE "OPENTHREAD_CONFIG_NETDATA_PUBLISHER_ENABLE=1")
 endif()
 
+option(OT_NETDIAG_AGGREGATION "enable aggregated network diagnostic queries")
+if(OT_NETDIAG_AGGREGATION)
+    target_compile_definitions(ot-config INTERFACE "OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE=1")
+endif()
+
 option(OT_PING_SENDER "enable ping sender support" ${OT_APP_CLI})
 if(OT_PING_SENDER)
     target_compile_definitions(ot-config INTERFACE "OPENTHREAD_CONFIG_PING_SENDER_ENABLE=1")
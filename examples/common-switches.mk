@@ -75,6 +75,7 @@ MTD_NETDIAG               ?= 0
 MULTIPLE_INSTANCE         ?= 0
 NEIGHBOR_DISCOVERY_AGENT  ?= 0
 NETDATA_PUBLISHER         ?= 0
+NETDIAG_AGGREGATION       ?= 0
 OTNS                      ?= 0
 PING_SENDER               ?= 1
 PLATFORM_UDP              ?= 0
@@ -296,6 +297,10 @@ ifeq ($(NETDATA_PUBLISHER),1)
 COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_NETDATA_PUBLISHER_ENABLE=1
 endif
 
+ifeq ($(NETDIAG_AGGREGATION),1)
+COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE=1
+endif
+
 ifeq ($(PING_SENDER),1)
 COMMONCFLAGS                   += -DOPENTHREAD_CONFIG_PING_SENDER_ENABLE=1
 endif
@@ -50,6 +50,12 @@ void otPlatDsoSend(otPlatDsoConnection *aConnection, otMessage *aMessage)
     OT_UNUSED_VARIABLE(aMessage);
 }
 
+void otPlatDsoSendBatch(otPlatDsoConnection *aConnection, otMessage *aMessage)
+{
+    OT_UNUSED_VARIABLE(aConnection);
+    OT_UNUSED_VARIABLE(aMessage);
+}
+
 void otPlatDsoDisconnect(otPlatDsoConnection *aConnection, otPlatDsoDisconnectMode aMode)
 {
     OT_UNUSED_VARIABLE(aConnection);
@@ -169,6 +169,26 @@
 #define OPENTHREAD_CONFIG_PARENT_SEARCH_ENABLE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+ *
+ * Define to 1 to track scheduling statistics of MAC operations.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+#define OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE 1
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+ *
+ * Define to 1 to support slotted channel access (it is still disabled by default at run-time).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+#define OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_LOG_PLATFORM
  *
@@ -222,6 +242,17 @@
 #define OPENTHREAD_CONFIG_MLE_INFORM_PREVIOUS_PARENT_ON_REATTACH 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+ *
+ * The time window (in milliseconds) over which the Leader coalesces Network Data changes from Server Data
+ * registrations before incrementing the Network Data version(s).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+#define OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW 500
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_UPTIME_ENABLE
  *
@@ -373,6 +373,37 @@ typedef struct otMacCounters
     uint32_t mRxErrOther;
 } otMacCounters;
 
+/**
+ * This enumeration defines the MAC operations tracked by `otLinkGetOperationStats()`.
+ *
+ */
+typedef enum otMacOperation
+{
+    OT_MAC_OPERATION_ACTIVE_SCAN      = 0, ///< Active scan.
+    OT_MAC_OPERATION_ENERGY_SCAN      = 1, ///< Energy scan.
+    OT_MAC_OPERATION_TX_BEACON        = 2, ///< Beacon transmission.
+    OT_MAC_OPERATION_TX_DATA_DIRECT   = 3, ///< Direct data frame transmission.
+    OT_MAC_OPERATION_TX_DATA_POLL     = 4, ///< Data poll transmission.
+    OT_MAC_OPERATION_TX_DATA_INDIRECT = 5, ///< Indirect data frame transmission (FTD only).
+    OT_MAC_OPERATION_TX_DATA_CSL      = 6, ///< CSL data frame transmission (FTD only).
+} otMacOperation;
+
+/**
+ * This structure represents the scheduling statistics of a MAC operation.
+ *
+ * The wait time of an operation is the time from its request until it is started. For a CSL transmission, it is
+ * measured from the scheduled CSL window instead.
+ *
+ */
+typedef struct otMacOperationStats
+{
+    uint32_t mStartCount;    ///< Number of times started (a preempted scan counts again when it resumes).
+    uint32_t mPreemptCount;  ///< Number of times a scan was preempted between channels.
+    uint32_t mBatchCount;    ///< Number of direct transmissions started right after the previous one (no idle).
+    uint32_t mTotalWaitTime; ///< Total wait time (in msec).
+    uint32_t mMaxWaitTime;   ///< Maximum wait time (in msec).
+} otMacOperationStats;
+
 /**
  * This structure represents a received IEEE 802.15.4 Beacon.
  *
@@ -972,6 +1003,31 @@ const otMacCounters *otLinkGetCounters(otInstance *aInstance);
  */
 void otLinkResetCounters(otInstance *aInstance);
 
+/**
+ * This function gets the scheduling statistics of a MAC operation.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE`.
+ *
+ * @param[in]   aInstance   A pointer to an OpenThread instance.
+ * @param[in]   aOperation  The MAC operation.
+ * @param[out]  aStats      A pointer to an `otMacOperationStats` to return the statistics.
+ *
+ * @retval OT_ERROR_NONE          Successfully retrieved the statistics.
+ * @retval OT_ERROR_INVALID_ARGS  @p aOperation is not valid.
+ *
+ */
+otError otLinkGetOperationStats(otInstance *aInstance, otMacOperation aOperation, otMacOperationStats *aStats);
+
+/**
+ * This function resets the scheduling statistics of all MAC operations.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ */
+void otLinkResetOperationStats(otInstance *aInstance);
+
 /**
  * This function pointer is called when an IEEE 802.15.4 frame is received.
  *
@@ -1090,6 +1146,35 @@ uint32_t otLinkCslGetTimeout(otInstance *aInstance);
  */
 otError otLinkCslSetTimeout(otInstance *aInstance, uint32_t aTimeout);
 
+/**
+ * This function indicates whether or not slotted channel access is enabled for direct transmissions.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ *
+ * @retval TRUE   Slotted channel access is enabled.
+ * @retval FALSE  Slotted channel access is disabled.
+ *
+ */
+bool otLinkIsSlottedAccessEnabled(otInstance *aInstance);
+
+/**
+ * This function enables or disables slotted channel access for direct transmissions.
+ *
+ * When enabled, a router synchronized to the network time (see `otNetworkTimeGet()`) starts direct transmissions only
+ * within its own window of a repeating slotframe. The slotframe is divided evenly among the active routers in the order
+ * of their Router IDs. Other devices, or a router which is not synchronized, keep using unslotted CSMA-CA. Slotted
+ * channel access is disabled by default.
+ *
+ * This function requires `OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE`.
+ *
+ * @param[in]  aInstance  A pointer to an OpenThread instance.
+ * @param[in]  aEnabled   TRUE to enable slotted channel access, FALSE to disable.
+ *
+ */
+void otLinkSetSlottedAccessEnabled(otInstance *aInstance, bool aEnabled);
+
 /**
  * This function returns the current CCA (Clear Channel Assessment) failure rate.
  *
@@ -64,6 +64,19 @@ typedef enum otNetDataPublisherEvent
     OT_NETDATA_PUBLISHER_EVENT_ENTRY_REMOVED = 1, ///< Published entry is removed from the Thread Network Data.
 } otNetDataPublisherEvent;
 
+/**
+ * This structure represents the Network Data Publisher counters.
+ *
+ */
+typedef struct otNetDataPublisherCounters
+{
+    uint32_t mPublishRequests;   ///< Number of publish requests (new entries or changes to published entries).
+    uint32_t mUnpublishRequests; ///< Number of unpublish requests.
+    uint32_t mEntryAdds;         ///< Number of times a published entry was added to the Thread Network Data.
+    uint32_t mEntryRemoves;      ///< Number of times a published entry was removed from the Thread Network Data.
+    uint32_t mNetDataScans;      ///< Number of passes over the Thread Network Data to evaluate published entries.
+} otNetDataPublisherCounters;
+
 /**
  * This function pointer type defines the callback used to notify when a "DNS/SRP Service" entry is added to or removed
  * from the Thread Network Data.
@@ -283,6 +296,28 @@ void otNetDataSetPrefixPublisherCallback(otInstance *                     aInsta
  */
 otError otNetDataUnpublishPrefix(otInstance *aInstance, const otIp6Prefix *aPrefix);
 
+/**
+ * Gets the Network Data Publisher counters.
+ *
+ * The counters track the publish/unpublish churn (requests from the users of the Publisher and the resulting
+ * additions/removals of entries in the Thread Network Data) along with the number of passes the Publisher made over
+ * the Thread Network Data to evaluate its entries.
+ *
+ * @param[in] aInstance   A pointer to an OpenThread instance.
+ *
+ * @returns A pointer to the Network Data Publisher counters.
+ *
+ */
+const otNetDataPublisherCounters *otNetDataGetPublisherCounters(otInstance *aInstance);
+
+/**
+ * Resets the Network Data Publisher counters.
+ *
+ * @param[in] aInstance   A pointer to an OpenThread instance.
+ *
+ */
+void otNetDataResetPublisherCounters(otInstance *aInstance);
+
 /**
  * @}
  *
@@ -66,22 +66,26 @@ extern "C" {
 
 enum
 {
-    OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS       = 0,  ///< MAC Extended Address TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS     = 1,  ///< Address16 TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_MODE              = 2,  ///< Mode TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT           = 3,  ///< Timeout TLV (the maximum polling time period for SEDs)
-    OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY      = 4,  ///< Connectivity TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_ROUTE             = 5,  ///< Route64 TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA       = 6,  ///< Leader Data TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA      = 7,  ///< Network Data TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST     = 8,  ///< IPv6 Address List TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS      = 9,  ///< MAC Counters TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL     = 14, ///< Battery Level TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE    = 15, ///< Supply Voltage TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE       = 16, ///< Child Table TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES     = 17, ///< Channel Pages TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_TYPE_LIST         = 18, ///< Type List TLV
-    OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT = 19, ///< Max Child Timeout TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS        = 0,   ///< MAC Extended Address TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS      = 1,   ///< Address16 TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_MODE               = 2,   ///< Mode TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT            = 3,   ///< Timeout TLV (the maximum polling time period for SEDs)
+    OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY       = 4,   ///< Connectivity TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_ROUTE              = 5,   ///< Route64 TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA        = 6,   ///< Leader Data TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA       = 7,   ///< Network Data TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST      = 8,   ///< IPv6 Address List TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS       = 9,   ///< MAC Counters TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL      = 14,  ///< Battery Level TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE     = 15,  ///< Supply Voltage TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE        = 16,  ///< Child Table TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES      = 17,  ///< Channel Pages TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_TYPE_LIST          = 18,  ///< Type List TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT  = 19,  ///< Max Child Timeout TLV
+    OT_NETWORK_DIAGNOSTIC_TLV_CHILD_LINK_QUALITY = 242, ///< Child Link Quality TLV (OpenThread specific)
+    OT_NETWORK_DIAGNOSTIC_TLV_CHILD_VERSION      = 243, ///< Child Thread Version TLV (OpenThread specific)
+    OT_NETWORK_DIAGNOSTIC_TLV_CHILD_SUPERVISION  = 244, ///< Child Supervision TLV (OpenThread specific)
+    OT_NETWORK_DIAGNOSTIC_TLV_CHILD_INFO_AGE     = 245, ///< Child Info Age TLV (OpenThread specific)
 };
 
 typedef uint16_t otNetworkDiagIterator; ///< Used to iterate through Network Diagnostic TLV.
@@ -213,6 +217,34 @@ typedef struct otNetworkDiagChildEntry
     otLinkModeConfig mMode;
 } otNetworkDiagChildEntry;
 
+/**
+ * This structure represents a Network Diagnostic Child Link Quality value.
+ *
+ * The Child Link Quality TLV is reported by a router on behalf of its child (in an aggregated answer).
+ *
+ */
+typedef struct otNetworkDiagChildLinkQuality
+{
+    uint8_t  mLinkQualityIn;    ///< Link quality of frames received from the child (0-3).
+    int8_t   mAverageRssi;      ///< Average RSSI of frames received from the child (in dBm).
+    int8_t   mLastRssi;         ///< RSSI of the last frame received from the child (in dBm).
+    uint16_t mFrameErrorRate;   ///< Frame error rate of frames sent to the child (0xffff represents 100%).
+    uint16_t mMessageErrorRate; ///< Error rate of IPv6 messages sent to the child (0xffff represents 100%).
+} otNetworkDiagChildLinkQuality;
+
+/**
+ * This structure represents a Network Diagnostic Child Info Age value.
+ *
+ * The Child Info Age TLV is reported by a router on behalf of its child (in an aggregated answer) and indicates how
+ * fresh the other reported TLVs are.
+ *
+ */
+typedef struct otNetworkDiagChildInfoAge
+{
+    uint32_t mSecondsSinceLastHeard;  ///< Seconds since the router last heard from the child.
+    uint32_t mSecondsSinceInfoUpdate; ///< Seconds since the child last updated its info (mode, timeout, addresses).
+} otNetworkDiagChildInfoAge;
+
 /**
  * This structure represents a Network Diagnostic TLV.
  *
@@ -226,17 +258,21 @@ typedef struct otNetworkDiagTlv
 
     union
     {
-        otExtAddress              mExtAddress;
-        uint16_t                  mAddr16;
-        otLinkModeConfig          mMode;
-        uint32_t                  mTimeout;
-        otNetworkDiagConnectivity mConnectivity;
-        otNetworkDiagRoute        mRoute;
-        otLeaderData              mLeaderData;
-        otNetworkDiagMacCounters  mMacCounters;
-        uint8_t                   mBatteryLevel;
-        uint16_t                  mSupplyVoltage;
-        uint32_t                  mMaxChildTimeout;
+        otExtAddress                  mExtAddress;
+        uint16_t                      mAddr16;
+        otLinkModeConfig              mMode;
+        uint32_t                      mTimeout;
+        otNetworkDiagConnectivity     mConnectivity;
+        otNetworkDiagRoute            mRoute;
+        otLeaderData                  mLeaderData;
+        otNetworkDiagMacCounters      mMacCounters;
+        uint8_t                       mBatteryLevel;
+        uint16_t                      mSupplyVoltage;
+        uint32_t                      mMaxChildTimeout;
+        otNetworkDiagChildLinkQuality mChildLinkQuality;
+        uint16_t                      mChildVersion;
+        uint16_t                      mChildSupervisionInterval;
+        otNetworkDiagChildInfoAge     mChildInfoAge;
         struct
         {
             uint8_t mCount;
@@ -318,6 +354,37 @@ otError otThreadSendDiagnosticGet(otInstance *                   aInstance,
                                   otReceiveDiagnosticGetCallback aCallback,
                                   void *                         aCallbackContext);
 
+/**
+ * Send an aggregated Network Diagnostic Get query.
+ *
+ * Routers receiving the query answer for themselves and on behalf of their children (from their child table), while
+ * children do not answer. Routers delay their answers by a random jitter and may split them over multiple messages.
+ * @p aCallback is invoked once for every device (router or child) in the received answers.
+ *
+ * Only a subset of the Network Diagnostic TLVs (Extended MAC Address, Address16, Mode, Timeout, Leader Data and IPv6
+ * Address List) is reported for children.
+ *
+ * This function requires `OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE`.
+ *
+ * @param[in]  aInstance         A pointer to an OpenThread instance.
+ * @param[in]  aDestination      A pointer to destination address (typically a multicast address).
+ * @param[in]  aTlvTypes         An array of Network Diagnostic TLV types.
+ * @param[in]  aCount            Number of types in aTlvTypes.
+ * @param[in]  aCallback         A pointer to a function that is called for each device in the received answers
+ *                               or NULL to disable the callback.
+ * @param[in]  aCallbackContext  A pointer to application-specific context.
+ *
+ * @retval OT_ERROR_NONE    Successfully queued the DIAG_GET.qry.
+ * @retval OT_ERROR_NO_BUFS Insufficient message buffers available to send DIAG_GET.qry.
+ *
+ */
+otError otThreadSendAggregatedDiagnosticGet(otInstance *                   aInstance,
+                                            const otIp6Address *           aDestination,
+                                            const uint8_t                  aTlvTypes[],
+                                            uint8_t                        aCount,
+                                            otReceiveDiagnosticGetCallback aCallback,
+                                            void *                         aCallbackContext);
+
 /**
  * Send a Network Diagnostic Reset request.
  *
@@ -55,6 +55,8 @@ extern "C" {
  *
  */
 
+#define OT_PING_SENDER_MAX_PATTERN_LENGTH 16 ///< Max length (in bytes) of a ping payload pattern.
+
 /**
  * This structure represents a ping reply.
  *
@@ -71,6 +73,9 @@ typedef struct otPingSenderReply
 /**
  * This structure represents statistics of a ping request.
  *
+ * The round trip time percentiles are derived from a log-linear histogram and are accurate to within 12.5% (they
+ * report the upper end of the histogram bucket, capped to the max round trip time).
+ *
  */
 typedef struct otPingSenderStatistics
 {
@@ -80,6 +85,12 @@ typedef struct otPingSenderStatistics
     uint16_t mMinRoundTripTime;   ///< The min round trip time among ping requests.
     uint16_t mMaxRoundTripTime;   ///< The max round trip time among ping requests.
     bool     mIsMulticast;        ///< Whether this is a multicast ping request.
+    uint16_t mDuplicateCount;     ///< The number of duplicate ping replies (unicast only).
+    uint16_t mOutOfOrderCount;    ///< The number of ping replies received out of order (unicast only).
+    uint16_t mRoundTripTimeP50;   ///< The 50th percentile (median) round trip time among ping requests.
+    uint16_t mRoundTripTimeP90;   ///< The 90th percentile round trip time among ping requests.
+    uint16_t mRoundTripTimeP99;   ///< The 99th percentile round trip time among ping requests.
+    uint16_t mJitter;             ///< The mean deviation between consecutive round trip times (RFC 3550 estimator).
 } otPingSenderStatistics;
 
 /**
@@ -104,6 +115,13 @@ typedef void (*otPingSenderStatisticsCallback)(const otPingSenderStatistics *aSt
 /**
  * This structure represents a ping request configuration.
  *
+ * In high-rate mode (`mMaxOutstanding` is non-zero) `mInterval` is not used. A new request is sent as soon as fewer
+ * than `mMaxOutstanding` requests are outstanding. A request stays outstanding until its reply is received or
+ * `mTimeout` has passed since it was sent.
+ *
+ * The payload of every request starts with a 4-byte timestamp and a 2-byte request index, so at least 6 bytes are sent.
+ * The rest of the payload is filled by repeating `mPattern`.
+ *
  */
 typedef struct otPingSenderConfig
 {
@@ -120,6 +138,10 @@ typedef struct otPingSenderConfig
                                   ///< Zero to use default.
     uint8_t mHopLimit;            ///< Hop limit (used if `mAllowZeroHopLimit` is false). Zero for default.
     bool    mAllowZeroHopLimit;   ///< Indicates whether hop limit is zero.
+
+    uint16_t mMaxOutstanding; ///< Max number of outstanding requests in high-rate mode. Zero for interval-based mode.
+    uint8_t  mPatternLength;  ///< Length of `mPattern` in bytes. Zero to leave the payload after the header unset.
+    uint8_t  mPattern[OT_PING_SENDER_MAX_PATTERN_LENGTH]; ///< Pattern repeated to fill the payload.
 } otPingSenderConfig;
 
 /**
@@ -130,7 +152,8 @@ typedef struct otPingSenderConfig
  *
  * @retval OT_ERROR_NONE           The ping started successfully.
  * @retval OT_ERROR_BUSY           Could not start since busy with a previous ongoing ping request.
- * @retval OT_ERROR_INVALID_ARGS   The @p aConfig contains invalid parameters (e.g., ping interval is too long).
+ * @retval OT_ERROR_INVALID_ARGS   The @p aConfig contains invalid parameters (e.g., ping interval is too long, or
+ *                                 too many outstanding requests).
 
  *
  */
@@ -141,6 +141,23 @@ extern void otPlatDsoHandleConnected(otPlatDsoConnection *aConnection);
  */
 void otPlatDsoSend(otPlatDsoConnection *aConnection, otMessage *aMessage);
 
+/**
+ * This function sends a batch of one or more DSO messages to the peer on a connection.
+ *
+ * This function is used instead of `otPlatDsoSend()` when `OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE` is enabled.
+ *
+ * This function passes the ownership of the @p aMessage to the DSO platform layer, and the platform implementation is
+ * expected to free the message once it is no longer needed.
+ *
+ * Unlike `otPlatDsoSend()`, the @p aMessage contains one or more DNS messages, each preceded by its two-byte length
+ * field (in network byte order). The content can therefore be written as is to the TLS/TCP layer.
+ *
+ * @param[in] aConnection   The connection to send on.
+ * @param[in] aMessage      The message containing the batch of length-prefixed DNS messages to send.
+ *
+ */
+void otPlatDsoSendBatch(otPlatDsoConnection *aConnection, otMessage *aMessage);
+
 /**
  * This function is a callback from the platform layer to indicate that a DNS message was received over a connection.
  *
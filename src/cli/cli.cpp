@@ -250,6 +250,10 @@ void Interpreter::ProcessLine(char *aBuf)
 
     OT_ASSERT(aBuf != nullptr);
 
+    // The output emitted while processing the command is batched and
+    // delivered to the output callback in larger chunks.
+    StartOutputBuffering();
+
     // Ignore the command if another command is pending.
     VerifyOrExit(!mCommandIsPending, args[0].Clear());
     mCommandIsPending = true;
@@ -280,6 +284,8 @@ exit:
     {
         OutputPrompt();
     }
+
+    StopOutputBuffering();
 }
 
 otError Interpreter::ProcessUserCommands(Arg aArgs[])
@@ -1052,6 +1058,22 @@ template <> otError Interpreter::Process<Cmd("child")>(Arg aArgs[])
     if (isTable || (aArgs[0] == "list"))
     {
         uint16_t maxChildren;
+        uint16_t offset = 0;
+        uint16_t count  = NumericLimits<uint16_t>::kMax;
+
+        // Optional `<offset> [<count>]` arguments select a page of the
+        // attached children (large tables can then be retrieved in
+        // multiple smaller commands).
+
+        if (!aArgs[1].IsEmpty())
+        {
+            SuccessOrExit(error = aArgs[1].ParseAsUint16(offset));
+
+            if (!aArgs[2].IsEmpty())
+            {
+                SuccessOrExit(error = aArgs[2].ParseAsUint16(count));
+            }
+        }
 
         if (isTable)
         {
@@ -1069,7 +1091,7 @@ template <> otError Interpreter::Process<Cmd("child")>(Arg aArgs[])
 
         maxChildren = otThreadGetMaxAllowedChildren(GetInstancePtr());
 
-        for (uint16_t i = 0; i < maxChildren; i++)
+        for (uint16_t i = 0; (i < maxChildren) && (count > 0); i++)
         {
             if ((otThreadGetChildInfoByIndex(GetInstancePtr(), i, &childInfo) != OT_ERROR_NONE) ||
                 childInfo.mIsStateRestoring)
@@ -1077,6 +1099,14 @@ template <> otError Interpreter::Process<Cmd("child")>(Arg aArgs[])
                 continue;
             }
 
+            if (offset > 0)
+            {
+                offset--;
+                continue;
+            }
+
+            count--;
+
             if (isTable)
             {
                 OutputFormat("| %3d ", childInfo.mChildId);
@@ -1307,8 +1337,49 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
     {
         OutputLine("ip");
         OutputLine("mac");
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+        OutputLine("macops");
+#endif
         OutputLine("mle");
     }
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+    else if (aArgs[0] == "macops")
+    {
+        if (aArgs[1].IsEmpty())
+        {
+            static const char *const kOperationNames[] = {
+                "ActiveScan", "EnergyScan", "TxBeacon", "TxDataDirect", "TxDataPoll", "TxDataIndirect", "TxDataCsl",
+            };
+
+            static_assert(OT_MAC_OPERATION_ACTIVE_SCAN == 0, "OT_MAC_OPERATION_ACTIVE_SCAN value is incorrect");
+            static_assert(OT_MAC_OPERATION_TX_DATA_CSL == 6, "OT_MAC_OPERATION_TX_DATA_CSL value is incorrect");
+
+            for (uint8_t operation = 0; operation < OT_ARRAY_LENGTH(kOperationNames); operation++)
+            {
+                otMacOperationStats stats;
+
+                SuccessOrExit(error = otLinkGetOperationStats(GetInstancePtr(), static_cast<otMacOperation>(operation),
+                                                              &stats));
+
+                uint32_t avgWaitTime = (stats.mStartCount == 0) ? 0 : stats.mTotalWaitTime / stats.mStartCount;
+
+                OutputLine("%s: Started %lu, Preempted %lu, Batched %lu, AvgWait %lums, MaxWait %lums",
+                           kOperationNames[operation], static_cast<unsigned long>(stats.mStartCount),
+                           static_cast<unsigned long>(stats.mPreemptCount),
+                           static_cast<unsigned long>(stats.mBatchCount), static_cast<unsigned long>(avgWaitTime),
+                           static_cast<unsigned long>(stats.mMaxWaitTime));
+            }
+        }
+        else if ((aArgs[1] == "reset") && aArgs[2].IsEmpty())
+        {
+            otLinkResetOperationStats(GetInstancePtr());
+        }
+        else
+        {
+            error = OT_ERROR_INVALID_ARGS;
+        }
+    }
+#endif // OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
     else if (aArgs[0] == "mac")
     {
         if (aArgs[1].IsEmpty())
@@ -1455,6 +1526,9 @@ template <> otError Interpreter::Process<Cmd("counters")>(Arg aArgs[])
         error = OT_ERROR_INVALID_ARGS;
     }
 
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+exit:
+#endif
     return error;
 }
 
@@ -3326,6 +3400,20 @@ void Interpreter::HandlePingStatistics(const otPingSenderStatistics *aStatistics
 
     OutputLine("");
 
+    if (aStatistics->mReceivedCount != 0)
+    {
+        OutputFormat("Round-trip p50/p90/p99 = %u/%u/%u ms.", aStatistics->mRoundTripTimeP50,
+                     aStatistics->mRoundTripTimeP90, aStatistics->mRoundTripTimeP99);
+
+        if (!aStatistics->mIsMulticast)
+        {
+            OutputFormat(" Jitter = %u ms. Duplicates = %u. Out-of-order = %u.", aStatistics->mJitter,
+                         aStatistics->mDuplicateCount, aStatistics->mOutOfOrderCount);
+        }
+
+        OutputLine("");
+    }
+
     if (!mPingIsAsync)
     {
         OutputResult(OT_ERROR_NONE);
@@ -3351,27 +3439,45 @@ template <> otError Interpreter::Process<Cmd("ping")>(Arg aArgs[])
 
     memset(&config, 0, sizeof(config));
 
-    if (aArgs[0] == "-I")
+    while (true)
     {
-        SuccessOrExit(error = aArgs[1].ParseAsIp6Address(config.mSource));
-
-#if !OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
+        if (aArgs[0] == "-I")
         {
-            bool                  valid        = false;
-            const otNetifAddress *unicastAddrs = otIp6GetUnicastAddresses(GetInstancePtr());
+            SuccessOrExit(error = aArgs[1].ParseAsIp6Address(config.mSource));
 
-            for (const otNetifAddress *addr = unicastAddrs; addr; addr = addr->mNext)
+#if !OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
             {
-                if (otIp6IsAddressEqual(&addr->mAddress, &config.mSource))
+                bool                  valid        = false;
+                const otNetifAddress *unicastAddrs = otIp6GetUnicastAddresses(GetInstancePtr());
+
+                for (const otNetifAddress *addr = unicastAddrs; addr; addr = addr->mNext)
                 {
-                    valid = true;
-                    break;
+                    if (otIp6IsAddressEqual(&addr->mAddress, &config.mSource))
+                    {
+                        valid = true;
+                        break;
+                    }
                 }
+
+                VerifyOrExit(valid, error = OT_ERROR_INVALID_ARGS);
             }
+#endif
+        }
+        else if (aArgs[0] == "-l")
+        {
+            SuccessOrExit(error = aArgs[1].ParseAsUint16(config.mMaxOutstanding));
+        }
+        else if (aArgs[0] == "-p")
+        {
+            uint16_t patternLength = sizeof(config.mPattern);
 
-            VerifyOrExit(valid, error = OT_ERROR_INVALID_ARGS);
+            SuccessOrExit(error = aArgs[1].ParseAsHexString(patternLength, config.mPattern));
+            config.mPatternLength = static_cast<uint8_t>(patternLength);
+        }
+        else
+        {
+            break;
         }
-#endif
 
         aArgs += 2;
     }
@@ -4136,6 +4242,28 @@ template <> otError Interpreter::Process<Cmd("singleton")>(Arg aArgs[])
     return OT_ERROR_NONE;
 }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+template <> otError Interpreter::Process<Cmd("slottedaccess")>(Arg aArgs[])
+{
+    otError error = OT_ERROR_NONE;
+
+    if (aArgs[0].IsEmpty())
+    {
+        OutputEnabledDisabledStatus(otLinkIsSlottedAccessEnabled(GetInstancePtr()));
+    }
+    else
+    {
+        bool enable;
+
+        SuccessOrExit(error = ParseEnableOrDisable(aArgs[0], enable));
+        otLinkSetSlottedAccessEnabled(GetInstancePtr(), enable);
+    }
+
+exit:
+    return error;
+}
+#endif
+
 #if OPENTHREAD_CONFIG_SNTP_CLIENT_ENABLE
 template <> otError Interpreter::Process<Cmd("sntp")>(Arg aArgs[])
 {
@@ -4844,6 +4972,15 @@ template <> otError Interpreter::Process<Cmd("networkdiagnostic")>(Arg aArgs[])
         SetCommandTimeout(kNetworkDiagnosticTimeoutMsecs);
         error = OT_ERROR_PENDING;
     }
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+    else if (aArgs[0] == "aggregate")
+    {
+        SuccessOrExit(error = otThreadSendAggregatedDiagnosticGet(GetInstancePtr(), &address, tlvTypes, count,
+                                                                  &Interpreter::HandleDiagnosticGetResponse, this));
+        SetCommandTimeout(kNetworkDiagnosticTimeoutMsecs);
+        error = OT_ERROR_PENDING;
+    }
+#endif
     else if (aArgs[0] == "reset")
     {
         IgnoreError(otThreadSendDiagnosticReset(GetInstancePtr(), &address, tlvTypes, count));
@@ -4967,6 +5104,25 @@ void Interpreter::HandleDiagnosticGetResponse(otError                 aError,
         case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
             OutputLine("Max Child Timeout: %u", diagTlv.mData.mMaxChildTimeout);
             break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_LINK_QUALITY:
+            OutputLine("Child Link Quality:");
+            OutputLine(kIndentSize, "LinkQualityIn: %u", diagTlv.mData.mChildLinkQuality.mLinkQualityIn);
+            OutputLine(kIndentSize, "AverageRssi: %d", diagTlv.mData.mChildLinkQuality.mAverageRssi);
+            OutputLine(kIndentSize, "LastRssi: %d", diagTlv.mData.mChildLinkQuality.mLastRssi);
+            OutputLine(kIndentSize, "FrameErrorRate: %u", diagTlv.mData.mChildLinkQuality.mFrameErrorRate);
+            OutputLine(kIndentSize, "MessageErrorRate: %u", diagTlv.mData.mChildLinkQuality.mMessageErrorRate);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_VERSION:
+            OutputLine("Child Version: %u", diagTlv.mData.mChildVersion);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_SUPERVISION:
+            OutputLine("Child Supervision Interval: %u", diagTlv.mData.mChildSupervisionInterval);
+            break;
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_INFO_AGE:
+            OutputLine("Child Info Age:");
+            OutputLine(kIndentSize, "SecondsSinceLastHeard: %u", diagTlv.mData.mChildInfoAge.mSecondsSinceLastHeard);
+            OutputLine(kIndentSize, "SecondsSinceInfoUpdate: %u", diagTlv.mData.mChildInfoAge.mSecondsSinceInfoUpdate);
+            break;
         }
     }
 
@@ -5307,6 +5463,9 @@ otError Interpreter::ProcessCommand(Arg aArgs[])
         CmdEntry("service"),
 #endif
         CmdEntry("singleton"),
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+        CmdEntry("slottedaccess"),
+#endif
 #if OPENTHREAD_CONFIG_SNTP_CLIENT_ENABLE
         CmdEntry("sntp"),
 #endif
@@ -113,6 +113,35 @@
 #define OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_LOG_STRING_SIZE OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE
+ *
+ * The size (in bytes) of the buffer used to batch the output of a CLI command.
+ *
+ * While a command is being processed, its output is formatted into this buffer and delivered to the output callback
+ * in large chunks (instead of invoking the callback for every small formatted fragment). Asynchronous output (e.g.,
+ * from callbacks after a command returns) is never buffered.
+ *
+ * Define as zero to disable output buffering. By default this is enabled on any POSIX based platform
+ * (`OPENTHREAD_POSIX`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE
+#define OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE (OPENTHREAD_POSIX ? 1024 : 0)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_CLI_OUTPUT_FLUSH_THRESHOLD
+ *
+ * The number of buffered output bytes at which the CLI output buffer is flushed (delivered to the output callback).
+ *
+ * This is only used when `OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE` is non-zero, and MUST be smaller than it.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_CLI_OUTPUT_FLUSH_THRESHOLD
+#define OPENTHREAD_CONFIG_CLI_OUTPUT_FLUSH_THRESHOLD (OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE * 3 / 4)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_CLI_PROMPT_ENABLE
  *
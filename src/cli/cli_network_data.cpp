@@ -189,6 +189,49 @@ template <> otError NetworkData::Process<Cmd("publish")>(Arg aArgs[])
 {
     otError error = OT_ERROR_NONE;
 
+    /**
+     * @cli netdata publish counters
+     * @code
+     * netdata publish counters
+     * PublishRequests: 4
+     * UnpublishRequests: 1
+     * EntryAdds: 3
+     * EntryRemoves: 1
+     * NetDataScans: 12
+     * Done
+     * @endcode
+     * @code
+     * netdata publish counters reset
+     * Done
+     * @endcode
+     * @cparam netdata publish counters [@ca{reset}]
+     * @par
+     * Gets or resets the Network Data Publisher counters (publish/unpublish requests, entries added to or removed
+     * from Network Data, and passes over Network Data to evaluate published entries).
+     * @sa otNetDataGetPublisherCounters
+     * @sa otNetDataResetPublisherCounters
+     */
+    if (aArgs[0] == "counters")
+    {
+        if (aArgs[1].IsEmpty())
+        {
+            const otNetDataPublisherCounters *counters = otNetDataGetPublisherCounters(GetInstancePtr());
+
+            OutputLine("PublishRequests: %u", counters->mPublishRequests);
+            OutputLine("UnpublishRequests: %u", counters->mUnpublishRequests);
+            OutputLine("EntryAdds: %u", counters->mEntryAdds);
+            OutputLine("EntryRemoves: %u", counters->mEntryRemoves);
+            OutputLine("NetDataScans: %u", counters->mNetDataScans);
+        }
+        else
+        {
+            VerifyOrExit(aArgs[1] == "reset", error = OT_ERROR_INVALID_ARGS);
+            otNetDataResetPublisherCounters(GetInstancePtr());
+        }
+
+        ExitNow();
+    }
+
 #if OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
     if (aArgs[0] == "dnssrp")
     {
@@ -57,6 +57,10 @@ Output::Output(otInstance *aInstance, otCliOutputCallback aCallback, void *aCall
     , mOutputLength(0)
     , mEmittingCommandOutput(true)
 #endif
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    , mOutputBufferLength(0)
+    , mOutputBuffering(false)
+#endif
 {
 }
 
@@ -247,7 +251,12 @@ void Output::OutputFormatV(const char *aFormat, va_list aArguments)
     va_copy(args, aArguments);
 #endif
 
-    mCallback(mCallbackContext, aFormat, aArguments);
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    if (!mOutputBuffering || !BufferOutputV(aFormat, aArguments))
+#endif
+    {
+        mCallback(mCallbackContext, aFormat, aArguments);
+    }
 
 #if OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_ENABLE
     VerifyOrExit(mEmittingCommandOutput);
@@ -329,6 +338,73 @@ exit:
 #endif // OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_ENABLE
 }
 
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+bool Output::BufferOutputV(const char *aFormat, va_list aArguments)
+{
+    bool    buffered = false;
+    va_list args;
+    int     length;
+
+    va_copy(args, aArguments);
+    length = vsnprintf(&mOutputBuffer[mOutputBufferLength], sizeof(mOutputBuffer) - mOutputBufferLength, aFormat, args);
+    va_end(args);
+
+    if ((length < 0) || (static_cast<uint32_t>(length) >= sizeof(mOutputBuffer) - mOutputBufferLength))
+    {
+        // The formatted string does not fit in the remaining space. We
+        // flush what is already buffered (to keep the output order)
+        // and retry with an empty buffer. A string too long for the
+        // whole buffer is passed directly to the output callback.
+
+        mOutputBuffer[mOutputBufferLength] = '\0';
+        FlushOutputBuffer();
+
+        VerifyOrExit((length >= 0) && (static_cast<uint32_t>(length) < sizeof(mOutputBuffer)));
+
+        va_copy(args, aArguments);
+        vsnprintf(mOutputBuffer, sizeof(mOutputBuffer), aFormat, args);
+        va_end(args);
+    }
+
+    mOutputBufferLength += static_cast<uint16_t>(length);
+    buffered = true;
+
+    if (mOutputBufferLength >= kOutputFlushThreshold)
+    {
+        FlushOutputBuffer();
+    }
+
+exit:
+    return buffered;
+}
+
+void Output::FlushOutputBuffer(void)
+{
+    VerifyOrExit(mOutputBufferLength > 0);
+
+    DeliverOutput("%s", mOutputBuffer);
+    mOutputBufferLength = 0;
+
+exit:
+    return;
+}
+
+void Output::DeliverOutput(const char *aFormat, ...)
+{
+    va_list args;
+
+    va_start(args, aFormat);
+    mCallback(mCallbackContext, aFormat, args);
+    va_end(args);
+}
+
+void Output::StopOutputBuffering(void)
+{
+    FlushOutputBuffer();
+    mOutputBuffering = false;
+}
+#endif // OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+
 #if OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_ENABLE
 void Output::LogInput(const Arg *aArgs)
 {
@@ -435,9 +435,28 @@ protected:
     void SetEmittingCommandOutput(bool) {}
 #endif
 
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    void StartOutputBuffering(void) { mOutputBuffering = true; }
+    void StopOutputBuffering(void);
+#else
+    void StartOutputBuffering(void) {}
+    void StopOutputBuffering(void) {}
+#endif
+
 private:
     static constexpr uint16_t kInputOutputLogStringSize = OPENTHREAD_CONFIG_CLI_LOG_INPUT_OUTPUT_LOG_STRING_SIZE;
 
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    static constexpr uint16_t kOutputBufferSize     = OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE;
+    static constexpr uint16_t kOutputFlushThreshold = OPENTHREAD_CONFIG_CLI_OUTPUT_FLUSH_THRESHOLD;
+
+    static_assert(kOutputFlushThreshold < kOutputBufferSize, "CLI output flush threshold must be below buffer size");
+
+    bool BufferOutputV(const char *aFormat, va_list aArguments);
+    void FlushOutputBuffer(void);
+    void DeliverOutput(const char *aFormat, ...);
+#endif
+
     void OutputTableHeader(uint8_t aNumColumns, const char *const aTitles[], const uint8_t aWidths[]);
     void OutputTableSeparator(uint8_t aNumColumns, const uint8_t aWidths[]);
 
@@ -449,6 +468,11 @@ private:
     uint16_t mOutputLength;
     bool     mEmittingCommandOutput;
 #endif
+#if OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE > 0
+    char     mOutputBuffer[kOutputBufferSize];
+    uint16_t mOutputBufferLength;
+    bool     mOutputBuffering;
+#endif
 };
 
 class OutputWrapper : public OutputBase
@@ -370,6 +370,18 @@ void otLinkResetCounters(otInstance *aInstance)
     AsCoreType(aInstance).Get<Mac::Mac>().ResetCounters();
 }
 
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+otError otLinkGetOperationStats(otInstance *aInstance, otMacOperation aOperation, otMacOperationStats *aStats)
+{
+    return AsCoreType(aInstance).Get<Mac::Mac>().GetOperationStats(aOperation, *aStats);
+}
+
+void otLinkResetOperationStats(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<Mac::Mac>().ResetOperationStats();
+}
+#endif
+
 otError otLinkActiveScan(otInstance *             aInstance,
                          uint32_t                 aScanChannels,
                          uint16_t                 aScanDuration,
@@ -460,6 +472,18 @@ exit:
 
 #endif // OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+bool otLinkIsSlottedAccessEnabled(otInstance *aInstance)
+{
+    return AsCoreType(aInstance).Get<Mac::Mac>().IsSlottedAccessEnabled();
+}
+
+void otLinkSetSlottedAccessEnabled(otInstance *aInstance, bool aEnabled)
+{
+    AsCoreType(aInstance).Get<Mac::Mac>().SetSlottedAccessEnabled(aEnabled);
+}
+#endif
+
 #if OPENTHREAD_CONFIG_REFERENCE_DEVICE_ENABLE
 otError otLinkSendEmptyData(otInstance *aInstance)
 {
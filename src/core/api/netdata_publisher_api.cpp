@@ -109,4 +109,14 @@ otError otNetDataUnpublishPrefix(otInstance *aInstance, const otIp6Prefix *aPref
 
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE
 
+const otNetDataPublisherCounters *otNetDataGetPublisherCounters(otInstance *aInstance)
+{
+    return &AsCoreType(aInstance).Get<NetworkData::Publisher>().GetCounters();
+}
+
+void otNetDataResetPublisherCounters(otInstance *aInstance)
+{
+    AsCoreType(aInstance).Get<NetworkData::Publisher>().ResetCounters();
+}
+
 #endif // OPENTHREAD_CONFIG_NETDATA_PUBLISHER_ENABLE
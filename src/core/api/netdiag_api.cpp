@@ -60,6 +60,19 @@ otError otThreadSendDiagnosticGet(otInstance *                   aInstance,
         AsCoreType(aDestination), aTlvTypes, aCount, aCallback, aCallbackContext);
 }
 
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+otError otThreadSendAggregatedDiagnosticGet(otInstance *                   aInstance,
+                                            const otIp6Address *           aDestination,
+                                            const uint8_t                  aTlvTypes[],
+                                            uint8_t                        aCount,
+                                            otReceiveDiagnosticGetCallback aCallback,
+                                            void *                         aCallbackContext)
+{
+    return AsCoreType(aInstance).Get<NetworkDiagnostic::NetworkDiagnostic>().SendAggregatedDiagnosticGet(
+        AsCoreType(aDestination), aTlvTypes, aCount, aCallback, aCallbackContext);
+}
+#endif
+
 otError otThreadSendDiagnosticReset(otInstance *        aInstance,
                                     const otIp6Address *aDestination,
                                     const uint8_t       aTlvTypes[],
@@ -579,6 +579,10 @@ Message *CoapBase::CopyAndEnqueueMessage(const Message &aMessage, uint16_t aCopy
 
     mPendingRequests.Enqueue(*messageCopy);
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    Get<DataPollSender>().AddPendingRequest();
+#endif
+
 exit:
     FreeAndNullMessageOnError(messageCopy, error);
     return messageCopy;
@@ -588,6 +592,10 @@ void CoapBase::DequeueMessage(Message &aMessage)
 {
     mPendingRequests.Dequeue(aMessage);
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    Get<DataPollSender>().RemovePendingRequest();
+#endif
+
     if (mRetransmissionTimer.IsRunning() && (mPendingRequests.GetHead() == nullptr))
     {
         mRetransmissionTimer.Stop();
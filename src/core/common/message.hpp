@@ -76,6 +76,12 @@ class HmacSha256;
 
 } // namespace Crypto
 
+namespace Dns {
+
+class Name;
+
+} // namespace Dns
+
 /**
  * @addtogroup core-message
  *
@@ -264,6 +270,7 @@ class Message : public otMessage, public Buffer, public GetProvider<Message>
     friend class Crypto::HmacSha256;
     friend class Crypto::Sha256;
     friend class Crypto::AesCcm;
+    friend class Dns::Name;
     friend class MessagePool;
     friend class MessageQueue;
     friend class PriorityQueue;
@@ -156,6 +156,7 @@ const char *SettingsBase::KeyToString(Key aKey)
         "SrpServerInfo",     // (13) kKeySrpServerInfo
         "",                  // (14) Removed (previously NAT64 prefix)
         "BrUlaPrefix",       // (15) kKeyBrUlaPrefix
+        "Dhcp6ServerLeases", // (16) kKeyDhcp6ServerLeases
     };
 
     static_assert(1 == kKeyActiveDataset, "kKeyActiveDataset value is incorrect");
@@ -169,8 +170,9 @@ const char *SettingsBase::KeyToString(Key aKey)
     static_assert(12 == kKeySrpClientInfo, "kKeySrpClientInfo value is incorrect");
     static_assert(13 == kKeySrpServerInfo, "kKeySrpServerInfo value is incorrect");
     static_assert(15 == kKeyBrUlaPrefix, "kKeyBrUlaPrefix value is incorrect");
+    static_assert(16 == kKeyDhcp6ServerLeases, "kKeyDhcp6ServerLeases value is incorrect");
 
-    static_assert(kLastKey == kKeyBrUlaPrefix, "kLastKey is not valid");
+    static_assert(kLastKey == kKeyDhcp6ServerLeases, "kLastKey is not valid");
 
     OT_ASSERT(aKey <= kLastKey);
 
@@ -245,6 +247,48 @@ Error Settings::DeleteOperationalDataset(MeshCoP::Dataset::Type aType)
     return error;
 }
 
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_ENABLE && OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+Error Settings::SaveDhcp6ServerLeases(const Dhcp6ServerLease *aLeases, uint16_t aNumLeases)
+{
+    Error  error;
+    Action action = kActionSave;
+
+    if (aNumLeases == 0)
+    {
+        error  = Get<SettingsDriver>().Delete(kKeyDhcp6ServerLeases);
+        action = kActionDelete;
+    }
+    else
+    {
+        error = Get<SettingsDriver>().Set(kKeyDhcp6ServerLeases, aLeases, aNumLeases * sizeof(Dhcp6ServerLease));
+    }
+
+    Log(action, error, kKeyDhcp6ServerLeases);
+
+    return error;
+}
+
+Error Settings::ReadDhcp6ServerLeases(Dhcp6ServerLease *aLeases, uint16_t &aNumLeases) const
+{
+    Error    error;
+    uint16_t maxLength = aNumLeases * sizeof(Dhcp6ServerLease);
+    uint16_t length    = maxLength;
+
+    aNumLeases = 0;
+
+    SuccessOrExit(error = Get<SettingsDriver>().Get(kKeyDhcp6ServerLeases, aLeases, &length));
+
+    // The saved value may be longer than the passed-in array (e.g.,
+    // saved with a larger lease table), in which case only the
+    // entries that fit in the array are read.
+
+    aNumLeases = OT_MIN(length, maxLength) / sizeof(Dhcp6ServerLease);
+
+exit:
+    return error;
+}
+#endif
+
 #if OPENTHREAD_FTD
 Error Settings::AddChildInfo(const ChildInfo &aChildInfo)
 {
@@ -118,9 +118,10 @@ public:
         kKeySrpClientInfo     = OT_SETTINGS_KEY_SRP_CLIENT_INFO,
         kKeySrpServerInfo     = OT_SETTINGS_KEY_SRP_SERVER_INFO,
         kKeyBrUlaPrefix       = OT_SETTINGS_KEY_BR_ULA_PREFIX,
+        kKeyDhcp6ServerLeases = OT_SETTINGS_KEY_DHCP6_SERVER_LEASES,
     };
 
-    static constexpr Key kLastKey = kKeyBrUlaPrefix; ///< The last (numerically) enumerator value in `Key`.
+    static constexpr Key kLastKey = kKeyDhcp6ServerLeases; ///< The last (numerically) enumerator value in `Key`.
     static_assert(static_cast<uint16_t>(kLastKey) < static_cast<uint16_t>(OT_SETTINGS_KEY_VENDOR_RESERVED_MIN),
                   "Core settings keys overlap with vendor reserved keys");
 
@@ -699,6 +700,85 @@ public:
     } OT_TOOL_PACKED_END;
 #endif // OPENTHREAD_CONFIG_SRP_SERVER_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_PORT_SWITCH_ENABLE
 
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_ENABLE && OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+    /**
+     * This structure represents a DHCPv6 server lease for settings storage.
+     *
+     * The DHCPv6 server lease table is saved as a single settings value containing an array of these entries.
+     *
+     */
+    OT_TOOL_PACKED_BEGIN
+    class Dhcp6ServerLease : private Clearable<Dhcp6ServerLease>
+    {
+        friend class Settings;
+
+    public:
+        static constexpr Key kKey = kKeyDhcp6ServerLeases; ///< The associated key.
+
+        /**
+         * This method initializes the `Dhcp6ServerLease` object.
+         *
+         */
+        void Init(void) { Clear(); }
+
+        /**
+         * This method returns the client extended address (from its DUID).
+         *
+         * @returns The client extended address.
+         *
+         */
+        const Mac::ExtAddress &GetClientAddress(void) const { return mClientAddress; }
+
+        /**
+         * This method sets the client extended address.
+         *
+         * @param[in] aClientAddress  The client extended address.
+         *
+         */
+        void SetClientAddress(const Mac::ExtAddress &aClientAddress) { mClientAddress = aClientAddress; }
+
+        /**
+         * This method returns the client IAID.
+         *
+         * @returns The client IAID.
+         *
+         */
+        uint32_t GetIaid(void) const { return Encoding::LittleEndian::HostSwap32(mIaid); }
+
+        /**
+         * This method sets the client IAID.
+         *
+         * @param[in] aIaid  The client IAID.
+         *
+         */
+        void SetIaid(uint32_t aIaid) { mIaid = Encoding::LittleEndian::HostSwap32(aIaid); }
+
+        /**
+         * This method returns the remaining lease time (in seconds).
+         *
+         * @returns The remaining lease time.
+         *
+         */
+        uint32_t GetRemainingTime(void) const { return Encoding::LittleEndian::HostSwap32(mRemainingTime); }
+
+        /**
+         * This method sets the remaining lease time (in seconds).
+         *
+         * @param[in] aRemainingTime  The remaining lease time.
+         *
+         */
+        void SetRemainingTime(uint32_t aRemainingTime)
+        {
+            mRemainingTime = Encoding::LittleEndian::HostSwap32(aRemainingTime);
+        }
+
+    private:
+        Mac::ExtAddress mClientAddress;
+        uint32_t        mIaid;          // (in little-endian encoding)
+        uint32_t        mRemainingTime; // (in little-endian encoding)
+    } OT_TOOL_PACKED_END;
+#endif // OPENTHREAD_CONFIG_DHCP6_SERVER_ENABLE && OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+
 protected:
     explicit SettingsBase(Instance &aInstance)
         : InstanceLocator(aInstance)
@@ -795,6 +875,36 @@ public:
      */
     Error DeleteOperationalDataset(MeshCoP::Dataset::Type aType);
 
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_ENABLE && OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+    /**
+     * This method saves the DHCPv6 server lease table.
+     *
+     * If @p aNumLeases is zero, the saved lease table is deleted.
+     *
+     * @param[in]   aLeases       A pointer to an array of `Dhcp6ServerLease` entries.
+     * @param[in]   aNumLeases    The number of entries in @p aLeases.
+     *
+     * @retval kErrorNone             Successfully saved the lease table.
+     * @retval kErrorNotImplemented   The platform does not implement settings functionality.
+     *
+     */
+    Error SaveDhcp6ServerLeases(const Dhcp6ServerLease *aLeases, uint16_t aNumLeases);
+
+    /**
+     * This method reads the DHCPv6 server lease table.
+     *
+     * @param[out]    aLeases       A pointer to an array to output the read `Dhcp6ServerLease` entries.
+     * @param[inout]  aNumLeases    On input, the number of entries in @p aLeases. On output, the number of entries
+     *                              read.
+     *
+     * @retval kErrorNone             Successfully read the lease table.
+     * @retval kErrorNotFound         No corresponding value in the setting store.
+     * @retval kErrorNotImplemented   The platform does not implement settings functionality.
+     *
+     */
+    Error ReadDhcp6ServerLeases(Dhcp6ServerLease *aLeases, uint16_t &aNumLeases) const;
+#endif
+
     /**
      * This template method reads a specified settings entry.
      *
@@ -68,6 +68,25 @@ void TrickleTimer::Start(Mode aMode, uint32_t aIntervalMin, uint32_t aIntervalMa
     StartNewInterval();
 }
 
+void TrickleTimer::SetIntervalMax(uint32_t aIntervalMax)
+{
+    OT_ASSERT(aIntervalMax >= mIntervalMin);
+
+    mIntervalMax = aIntervalMax;
+}
+
+TimeMilli TrickleTimer::GetIntervalEndTime(void) const
+{
+    TimeMilli endTime = TimerMilli::GetFireTime();
+
+    if (mPhase == kBeforeRandomTime)
+    {
+        endTime += mInterval - mTimeInInterval;
+    }
+
+    return endTime;
+}
+
 void TrickleTimer::IndicateConsistent(void)
 {
     if (mCounter < kInfiniteRedundancyConstant)
@@ -145,13 +164,14 @@ void TrickleTimer::HandleTimer(void)
 
         case kAfterRandomTime:
             // Interval has expired. Double the interval length and
-            // ensure result is below max.
+            // ensure result is below max (which may have been lowered
+            // during the interval).
 
             if (mInterval == 0)
             {
                 mInterval = 1;
             }
-            else if (mInterval <= mIntervalMax - mInterval)
+            else if ((mInterval < mIntervalMax) && (mInterval <= mIntervalMax - mInterval))
             {
                 mInterval *= 2;
             }
@@ -131,6 +131,34 @@ public:
      */
     void Stop(void) { TimerMilli::Stop(); }
 
+    /**
+     * This method changes the maximum interval of a running trickle timer.
+     *
+     * The current interval is not changed. The new maximum takes effect when the next interval is selected.
+     *
+     * @param[in]  aIntervalMax  The maximum interval in milliseconds (MUST NOT be smaller than the minimum interval).
+     *
+     */
+    void SetIntervalMax(uint32_t aIntervalMax);
+
+    /**
+     * This method gets the end time of the current interval.
+     *
+     * MUST be used only when the timer is running in `kModeTrickle` mode.
+     *
+     * @returns The end time of the current interval.
+     *
+     */
+    TimeMilli GetIntervalEndTime(void) const;
+
+    /**
+     * This method gets the number of 'consistent' events received in the current interval (aka `c`).
+     *
+     * @returns The number of 'consistent' events in the current interval.
+     *
+     */
+    uint16_t GetCounter(void) const { return mCounter; }
+
     /**
      * This method indicates to the trickle timer a 'consistent' event.
      *
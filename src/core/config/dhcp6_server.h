@@ -55,4 +55,38 @@
 #define OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_PREFIXES 4
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_LEASES
+ *
+ * The number of entries in the DHCPv6 server lease table.
+ *
+ * When the table is full, the lease closest to expiring is evicted to make room for a new client.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_LEASES
+#define OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_LEASES 32
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DHCP6_SERVER_LEASE_TIMEOUT
+ *
+ * The time (in seconds) a lease is kept in the DHCPv6 server lease table after the last Solicit from its client.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DHCP6_SERVER_LEASE_TIMEOUT
+#define OPENTHREAD_CONFIG_DHCP6_SERVER_LEASE_TIMEOUT (24 * 60 * 60)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+ *
+ * Define to 1 to save the DHCPv6 server lease table in non-volatile settings so that it is restored after a reset.
+ *
+ * The table is saved when a lease is added or removed (not when an existing lease is renewed).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+#define OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE 1
+#endif
+
 #endif // CONFIG_DHCP6_SERVER_H_
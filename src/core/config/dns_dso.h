@@ -75,4 +75,30 @@
 #define OPENTHREAD_CONFIG_DNS_DSO_MAX_PENDING_REQUESTS 3
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNS_DSO_CONNECTION_HASH_TABLE_SIZE
+ *
+ * Specifies the number of hash buckets used to look up DSO connections by their peer socket address.
+ *
+ * Client and server connections are tracked in separate tables, each with this number of buckets.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_DSO_CONNECTION_HASH_TABLE_SIZE
+#define OPENTHREAD_CONFIG_DNS_DSO_CONNECTION_HASH_TABLE_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+ *
+ * Define to 1 to enable batching of DSO message transmissions.
+ *
+ * When enabled, the DSO messages sent on a connection are queued and all messages queued within the same tasklet run
+ * are passed to the platform together using `otPlatDsoSendBatch()` (instead of `otPlatDsoSend()` per message) so they
+ * can be written to the transport at once. The platform layer MUST implement `otPlatDsoSendBatch()`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+#define OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE 0
+#endif
+
 #endif // CONFIG_DNS_DSO_H_
@@ -75,4 +75,39 @@
 #define OPENTHREAD_CONFIG_DNSSD_QUERY_TIMEOUT 6000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+ *
+ * Define to 1 to enable DNS Push Notifications (RFC 8765) support on DNS-SD server.
+ *
+ * Clients can subscribe (over a DSO session) to changes of records registered on the SRP server. This requires both
+ * `OPENTHREAD_CONFIG_DNS_DSO_ENABLE` and `OPENTHREAD_CONFIG_SRP_SERVER_ENABLE`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+#define OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE \
+    (OPENTHREAD_CONFIG_DNSSD_SERVER_ENABLE && OPENTHREAD_CONFIG_DNS_DSO_ENABLE && OPENTHREAD_CONFIG_SRP_SERVER_ENABLE)
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_MAX_SESSIONS
+ *
+ * Specifies the maximum number of DNS Push sessions (DSO connections from clients) DNS-SD server accepts at a time.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_MAX_SESSIONS
+#define OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_MAX_SESSIONS 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_MAX_SUBSCRIPTIONS
+ *
+ * Specifies the maximum number of DNS Push subscriptions per session. A SUBSCRIBE request beyond this limit is
+ * refused.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_MAX_SUBSCRIPTIONS
+#define OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_MAX_SUBSCRIPTIONS 8
+#endif
+
 #endif // CONFIG_DNSSD_SERVER_H_
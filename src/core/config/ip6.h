@@ -127,6 +127,19 @@
 #define OPENTHREAD_CONFIG_IP6_SLAAC_NUM_ADDRESSES 4
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE
+ *
+ * The number of generated SLAAC IIDs (per prefix and DAD counter) that are remembered, so that an address for a
+ * prefix which is removed and later re-added does not need to be derived again. Define as zero to disable the cache.
+ *
+ * Applicable only if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE is enabled.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE
+#define OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE (2 * OPENTHREAD_CONFIG_IP6_SLAAC_NUM_ADDRESSES)
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MPL_SEED_SET_ENTRIES
  *
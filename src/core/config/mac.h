@@ -325,6 +325,41 @@
 #define OPENTHREAD_CONFIG_MAC_RETX_POLL_PERIOD 1000
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+ *
+ * Define to 1 to enable adaptive data poll period on a sleepy end device.
+ *
+ * When enabled, the data poll sender shortens the poll period while downlink frames are being received (or are
+ * expected based on recent inter-arrival times or outstanding CoAP requests) and backs off towards the default poll
+ * period otherwise. The adaptive period never exceeds the default (or user-specified) poll period.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+#define OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_MIN_PERIOD
+ *
+ * This setting configures the minimum adaptive poll period in milliseconds.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_MIN_PERIOD
+#define OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_MIN_PERIOD 250
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_PENDING_PERIOD
+ *
+ * This setting configures the maximum adaptive poll period in milliseconds while there are outstanding requests
+ * expecting a response (e.g., CoAP requests).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_PENDING_PERIOD
+#define OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_PENDING_PERIOD 1000
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MAC_SOFTWARE_ACK_TIMEOUT_ENABLE
  *
@@ -521,4 +556,42 @@
 #define OPENTHREAD_CONFIG_MAC_OUTGOING_BEACON_PAYLOAD_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+ *
+ * Define to 1 to track scheduling statistics (wait time, preemption, batching) of MAC operations.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+#define OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+ *
+ * Define to 1 to enable support for slotted channel access for direct transmissions of routers.
+ *
+ * When supported and enabled at run-time, a router synchronized to the network time (`TIME_SYNC`) starts direct frame
+ * transmissions only within its own window of a repeating slotframe. The slotframe is divided evenly among the active
+ * routers in the order of their Router IDs, so the schedule follows from the Router ID Set already distributed by the
+ * leader and no additional schedule needs to be exchanged.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+#define OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_SLOTFRAME_DURATION
+ *
+ * The duration of a slotframe (in microseconds) used by slotted channel access.
+ *
+ * This is the maximum delay added to a direct transmission. The window of a router is this duration divided by the
+ * number of active routers, so it MUST be at least one millisecond per router.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_SLOTFRAME_DURATION
+#define OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_SLOTFRAME_DURATION 80000
+#endif
+
 #endif // CONFIG_MAC_H_
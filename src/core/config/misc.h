@@ -201,6 +201,22 @@
 #define OPENTHREAD_CONFIG_DROP_MESSAGE_ON_FRAGMENT_TX_FAILURE 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE
+ *
+ * Define as 1 to enable cut-through forwarding of Mesh Header frames on an FTD.
+ *
+ * When enabled and the direct transmit path is idle, a received Mesh Header frame that is to be forwarded is copied
+ * into a single frame buffer and handed to the MAC directly, instead of being converted into a message and queued in
+ * the send queue. The frame falls back to the queued path whenever the direct transmit path is busy, other direct
+ * messages are waiting, or header IEs need to be added. Cut-through is not used when multiple radio links are
+ * supported.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE
+#define OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE 1
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_6LOWPAN_REASSEMBLY_TIMEOUT
  *
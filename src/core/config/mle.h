@@ -234,6 +234,57 @@
 #define OPENTHREAD_CONFIG_MLE_LONG_ROUTES_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE
+ *
+ * Define as 1 to enable MLE Advertisement suppression and adaptive max advertise interval in large networks.
+ *
+ * When the number of active routers reaches `OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ROUTER_THRESHOLD`, a router
+ * skips its MLE Advertisement in a trickle interval if it has heard enough consistent Advertisements (same partition
+ * and Router ID Set) in that interval and its own Route TLV is unchanged since its last Advertisement. The max
+ * trickle interval also grows with the number of active routers towards
+ * `OPENTHREAD_CONFIG_MLE_ADVERTISE_INTERVAL_MAX_LARGE_NETWORK`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE
+#define OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE !OPENTHREAD_CONFIG_MLE_LONG_ROUTES_ENABLE
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ROUTER_THRESHOLD
+ *
+ * The number of active routers at or above which MLE Advertisement suppression and adaptive max advertise interval
+ * are applied.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ROUTER_THRESHOLD
+#define OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ROUTER_THRESHOLD 16
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ADVERTISE_REDUNDANCY_CONSTANT
+ *
+ * The number of consistent MLE Advertisements heard within a trickle interval for a router to suppress its own
+ * Advertisement (trickle redundancy constant `k`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ADVERTISE_REDUNDANCY_CONSTANT
+#define OPENTHREAD_CONFIG_MLE_ADVERTISE_REDUNDANCY_CONSTANT 3
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_ADVERTISE_INTERVAL_MAX_LARGE_NETWORK
+ *
+ * The max advertise trickle interval (in seconds) used when the number of active routers reaches the max number of
+ * routers.
+ *
+ * It must be small enough that neighbors hear an Advertisement before they age out the router (100 seconds).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_ADVERTISE_INTERVAL_MAX_LARGE_NETWORK
+#define OPENTHREAD_CONFIG_MLE_ADVERTISE_INTERVAL_MAX_LARGE_NETWORK 40
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_MLE_SEND_UNICAST_ANNOUNCE_RESPONSE
  *
@@ -290,4 +341,50 @@
 #define OPENTHREAD_CONFIG_MLE_LINK_METRICS_MAX_SERIES_SUPPORTED OPENTHREAD_CONFIG_MLE_MAX_CHILDREN
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+ *
+ * Define as 1 to keep a table of scored parent candidates (from received Parent Responses) and use the score to select
+ * the parent during attach.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+#define OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_SIZE
+ *
+ * The maximum number of entries in the parent candidate table.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_SIZE
+#define OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_SIZE 4
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_MAX_AGE
+ *
+ * The maximum age (in seconds) of a parent candidate entry for it to be used for fast re-parenting.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_MAX_AGE
+#define OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_MAX_AGE 600
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE
+ *
+ * Define as 1 to enable fast re-parenting.
+ *
+ * When a child loses its parent, it first sends a unicast Parent Request to the best remaining candidate in the
+ * parent candidate table and attaches to it as soon as it responds, instead of going through all the attach phases.
+ * It falls back to a regular attach if the candidate does not respond. This requires
+ * `OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE
+#define OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE 0
+#endif
+
 #endif // CONFIG_MLE_H_
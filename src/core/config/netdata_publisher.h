@@ -160,4 +160,18 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_NETDATA_PUBLISHER_HEAP_PREFIX_ENTRIES_ENABLE
+ *
+ * Define as 1 to allocate the Publisher prefix (on-mesh prefix or external route) entries from heap.
+ *
+ * When enabled, the number of published prefix entries is only limited by the available heap, and the config
+ * `OPENTHREAD_CONFIG_NETDATA_PUBLISHER_MAX_PREFIX_ENTRIES` is not used. By default this is enabled when heap is
+ * provided by the platform (`OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE`).
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_NETDATA_PUBLISHER_HEAP_PREFIX_ENTRIES_ENABLE
+#define OPENTHREAD_CONFIG_NETDATA_PUBLISHER_HEAP_PREFIX_ENTRIES_ENABLE OPENTHREAD_CONFIG_HEAP_EXTERNAL_ENABLE
+#endif
+
 #endif // CONFIG_NETDATA_PUBLISHER_H_
@@ -89,4 +89,15 @@
 #define OPENTHREAD_CONFIG_PING_SENDER_DEFAULT_COUNT 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_PING_SENDER_MAX_OUTSTANDING
+ *
+ * Specifies the max number of outstanding echo requests in high-rate ping mode (max value of `mMaxOutstanding` in
+ * `otPingSenderConfig`). Must not be larger than 31.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_PING_SENDER_MAX_OUTSTANDING
+#define OPENTHREAD_CONFIG_PING_SENDER_MAX_OUTSTANDING 16
+#endif
+
 #endif // CONFIG_PING_SENDER_H_
@@ -229,6 +229,24 @@
 #define OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_DELAY 10
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_HOLD_DOWN_INTERVAL
+ *
+ * Specifies the minimum interval (in msec) between the start of two successive SRP update message transmissions.
+ *
+ * When there is a change that requires an update shortly after an SRP update message was sent, the SRP client waits
+ * until the hold-down interval (measured from the previous update tx) expires before sending the next update. All
+ * changes made in the meantime are coalesced into that single update message. This helps devices that change many
+ * services in bursts (e.g., a bridge registering services one at a time) to avoid a long series of small updates.
+ *
+ * Setting it to zero disables the hold-down, in which case only `OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_DELAY` is
+ * applied.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_HOLD_DOWN_INTERVAL
+#define OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_HOLD_DOWN_INTERVAL 0
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_SRP_CLIENT_MIN_RETRY_WAIT_INTERVAL
  *
@@ -162,6 +162,171 @@
 #define OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_MAX_ALOCS 1
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+ *
+ * The time window (in milliseconds) over which the Leader coalesces Network Data changes from Server Data
+ * registrations (SRV_DATA.ntf) before incrementing the Network Data version(s).
+ *
+ * The changes from all registrations received within the window are applied as they arrive, but are published with a
+ * single version increment (and therefore a single network-wide Network Data propagation) when the window ends. This
+ * avoids a burst of version increments when many Border Routers register at once (e.g., after a partition merge).
+ *
+ * Define as zero to increment the version(s) immediately on every registration.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+#define OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+ *
+ * Define to 1 to enable aggregated TMF network diagnostic queries.
+ *
+ * In an aggregated query, routers answer for themselves and on behalf of their children (from their child table) so
+ * that children do not answer individually. Routers pace their answers and split them over multiple DIAG_GET.ans
+ * messages. The requester reports each device in the answers as a separate response.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+#define OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_MAX_JITTER
+ *
+ * The maximum random delay (in milliseconds) before a router sends its first answer to an aggregated query.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_MAX_JITTER
+#define OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_MAX_JITTER 1000
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_BLOCK_INTERVAL
+ *
+ * The interval (in milliseconds) between consecutive answer messages (blocks) sent by a router for an aggregated
+ * query.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_BLOCK_INTERVAL
+#define OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_BLOCK_INTERVAL 100
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_MAX_BLOCK_SIZE
+ *
+ * The maximum size (in bytes) of an answer message (block) sent by a router for an aggregated query.
+ *
+ * Child entries which do not fit are sent in the next block. A router's own TLVs are always sent in the first block.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_MAX_BLOCK_SIZE
+#define OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_MAX_BLOCK_SIZE 1024
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+ *
+ * Define to 1 for routers to report cached child info in aggregated TMF network diagnostic answers.
+ *
+ * Routers keep track of when each child last updated its info (mode, timeout, registered addresses) in an MLE
+ * exchange. The answers on behalf of a child then include the Child Info Age TLV (freshness of the info) and may
+ * include the Child Link Quality, Child Version and Child Supervision TLVs. Each TLV is only reported when the info is
+ * fresher than the TLV's maximum age (`OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_*`).
+ *
+ * Requires `OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE`.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+#define OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+#endif
+
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE && !OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+#error \
+    "OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE is required for network diagnostic child cache"
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_MODE
+ *
+ * The maximum age (in seconds) of a child's info for its parent to report the Mode TLV on its behalf.
+ *
+ * The age is the time since the child last updated its info in an MLE exchange. Zero disables reporting the TLV on
+ * behalf of children, 0xffffffff means no limit.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_MODE
+#define OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_MODE 0xffffffff
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_TIMEOUT
+ *
+ * The maximum age (in seconds) of a child's info for its parent to report the Timeout TLV on its behalf.
+ *
+ * The age is the time since the child last updated its info in an MLE exchange. Zero disables reporting the TLV on
+ * behalf of children, 0xffffffff means no limit.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_TIMEOUT
+#define OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_TIMEOUT 0xffffffff
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_IP6_ADDR_LIST
+ *
+ * The maximum age (in seconds) of a child's info for its parent to report the IPv6 Address List TLV on its behalf.
+ *
+ * The age is the time since the child last updated its info in an MLE exchange. Zero disables reporting the TLV on
+ * behalf of children, 0xffffffff means no limit.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_IP6_ADDR_LIST
+#define OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_IP6_ADDR_LIST 0xffffffff
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_VERSION
+ *
+ * The maximum age (in seconds) of a child's info for its parent to report the Child Version TLV on its behalf.
+ *
+ * The age is the time since the child last updated its info in an MLE exchange. Zero disables reporting the TLV,
+ * 0xffffffff means no limit.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_VERSION
+#define OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_VERSION 0xffffffff
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_SUPERVISION
+ *
+ * The maximum age (in seconds) of a child's info for its parent to report the Child Supervision TLV on its behalf.
+ *
+ * The age is the time since the child last updated its info in an MLE exchange. Zero disables reporting the TLV,
+ * 0xffffffff means no limit. The TLV is only reported when `OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_SUPERVISION
+#define OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_SUPERVISION 0xffffffff
+#endif
+
+/**
+ * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_LINK_QUALITY
+ *
+ * The maximum age (in seconds) of a child's link info for its parent to report the Child Link Quality TLV on its
+ * behalf.
+ *
+ * The age is the time since the parent last heard from the child. Zero disables reporting the TLV, 0xffffffff means
+ * no limit.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_LINK_QUALITY
+#define OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_LINK_QUALITY 300
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_MTD_ENABLE
  *
@@ -212,6 +377,20 @@
 #error "Thread 1.2 or higher version is required for OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE"
 #endif
 
+/**
+ * @def OPENTHREAD_CONFIG_TMF_PROXY_DUA_MAX_PENDING_REGISTRATIONS
+ *
+ * The maximum number of outstanding DUA.req messages (registrations of its own DUA and the DUAs of its MTD children)
+ * a Thread 1.2 FTD device may have at the same time.
+ *
+ * DUA registrations are pipelined: a new DUA.req is sent as soon as there is room in this window, without waiting
+ * for the responses to the earlier ones.
+ *
+ */
+#ifndef OPENTHREAD_CONFIG_TMF_PROXY_DUA_MAX_PENDING_REGISTRATIONS
+#define OPENTHREAD_CONFIG_TMF_PROXY_DUA_MAX_PENDING_REGISTRATIONS 4
+#endif
+
 /**
  * @def OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
  *
@@ -121,7 +121,7 @@ void AesCcm::Init(uint32_t    aHeaderLength,
     }
 
     // encrypt initial block
-    mEcb.Encrypt(mBlock, mBlock);
+    mKeySchedule->Encrypt(mBlock, mBlock);
 
     // process header
     if (aHeaderLength > 0)
@@ -169,7 +169,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
     {
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -183,7 +183,7 @@ void AesCcm::Header(const void *aHeader, uint32_t aHeaderLength)
         // process remainder
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
         }
 
         mBlockLength = 0;
@@ -210,7 +210,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
                 }
             }
 
-            mEcb.Encrypt(mCtr, mCtrPad);
+            mKeySchedule->Encrypt(mCtr, mCtrPad);
             mCtrLength = 0;
         }
 
@@ -227,7 +227,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
 
         if (mBlockLength == sizeof(mBlock))
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
             mBlockLength = 0;
         }
 
@@ -240,7 +240,7 @@ void AesCcm::Payload(void *aPlainText, void *aCipherText, uint32_t aLength, Mode
     {
         if (mBlockLength != 0)
         {
-            mEcb.Encrypt(mBlock, mBlock);
+            mKeySchedule->Encrypt(mBlock, mBlock);
         }
 
         // reset counter
@@ -269,7 +269,7 @@ void AesCcm::Finalize(void *aTag)
 
     OT_ASSERT(mPlainTextCur == mPlainTextLength);
 
-    mEcb.Encrypt(mCtr, mCtrPad);
+    mKeySchedule->Encrypt(mCtr, mCtrPad);
 
     for (int i = 0; i < mTagLength; i++)
     {
@@ -77,13 +77,26 @@ public:
         kDecrypt, // Decryption mode.
     };
 
+    /**
+     * This constructor initializes the `AesCcm` object.
+     *
+     */
+    AesCcm(void)
+        : mKeySchedule(&mEcb)
+    {
+    }
+
     /**
      * This method sets the key.
      *
      * @param[in]  aKey    Crypto Key used in AES operation
      *
      */
-    void SetKey(const Key &aKey) { mEcb.SetKey(aKey); }
+    void SetKey(const Key &aKey)
+    {
+        mKeySchedule = &mEcb;
+        mEcb.SetKey(aKey);
+    }
 
     /**
      * This method sets the key.
@@ -102,6 +115,16 @@ public:
      */
     void SetKey(const Mac::KeyMaterial &aMacKey);
 
+    /**
+     * This method sets the key, reusing the cached AES key schedule of @p aMacKey instead of expanding the key again.
+     *
+     * The `CachedKeyMaterial` MUST remain unchanged while this `AesCcm` object is in use.
+     *
+     * @param[in]  aMacKey        Key Material (with cached key schedule) for AES operation.
+     *
+     */
+    void SetKey(const Mac::CachedKeyMaterial &aMacKey) { mKeySchedule = &aMacKey.GetKeySchedule(); }
+
     /**
      * This method initializes the AES CCM computation.
      *
@@ -200,6 +223,7 @@ public:
 
 private:
     AesEcb   mEcb;
+    AesEcb * mKeySchedule;
     uint8_t  mBlock[AesEcb::kBlockSize];
     uint8_t  mCtr[AesEcb::kBlockSize];
     uint8_t  mCtrPad[AesEcb::kBlockSize];
@@ -38,6 +38,7 @@
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
 #include "common/message.hpp"
+#include "common/numeric_limits.hpp"
 #include "net/ip6.hpp"
 #include "net/netif.hpp"
 #include "thread/mesh_forwarder.hpp"
@@ -55,6 +56,9 @@ DataPollSender::DataPollSender(Instance &aInstance)
     , mExternalPollPeriod(0)
     , mFastPollsUsers(0)
     , mTimer(aInstance, DataPollSender::HandlePollTimer)
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    , mAdaptivePeriod(kAdaptiveMinPollPeriod, kAdaptivePendingPollPeriod)
+#endif
     , mEnabled(false)
     , mAttachMode(false)
     , mRetxMode(false)
@@ -94,6 +98,10 @@ void DataPollSender::StopPolling(void)
     mRemainingFastPolls   = 0;
     mFastPollsUsers       = 0;
     mEnabled              = false;
+
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    mAdaptivePeriod.Reset();
+#endif
 }
 
 Error DataPollSender::SendDataPoll(void)
@@ -115,7 +123,12 @@ exit:
     {
     case kErrorNone:
         LogDebg("Sending data poll");
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+        mAdaptivePeriod.HandlePollTx(TimerMilli::GetNow(), GetKeepAlivePollPeriod());
+        ScheduleNextPoll(kRecalculatePollPeriod);
+#else
         ScheduleNextPoll(kUsePreviousPollPeriod);
+#endif
         break;
 
     case kErrorInvalidState:
@@ -328,6 +341,11 @@ void DataPollSender::ProcessRxFrame(const Mac::RxFrame &aFrame)
 
     mPollTimeoutCounter = 0;
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    mAdaptivePeriod.HandleRxFrame(TimerMilli::GetNow(), GetKeepAlivePollPeriod());
+    RecalculatePollPeriod();
+#endif
+
     if (aFrame.GetFramePending())
     {
         IgnoreError(SendDataPoll());
@@ -448,6 +466,20 @@ exit:
     return;
 }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+void DataPollSender::AddPendingRequest(void)
+{
+    mAdaptivePeriod.AddPendingRequest();
+    RecalculatePollPeriod();
+}
+
+void DataPollSender::RemovePendingRequest(void)
+{
+    mAdaptivePeriod.RemovePendingRequest();
+    RecalculatePollPeriod();
+}
+#endif
+
 void DataPollSender::ResetKeepAliveTimer(void)
 {
     if (mTimer.IsRunning() && mPollPeriod == GetDefaultPollPeriod())
@@ -524,6 +556,13 @@ uint32_t DataPollSender::CalculatePollPeriod(void) const
         period = OT_MIN(period, mExternalPollPeriod);
     }
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    if (mAdaptivePeriod.GetPeriod() != AdaptivePollPeriod::kNone)
+    {
+        period = OT_MIN(period, mAdaptivePeriod.GetPeriod());
+    }
+#endif
+
     if (period == 0)
     {
         period = kMinPollPeriod;
@@ -628,4 +667,116 @@ exit:
     return frame;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// AdaptivePollPeriod
+
+AdaptivePollPeriod::AdaptivePollPeriod(uint32_t aMinPeriod, uint32_t aPendingPeriod)
+    : mMinPeriod(aMinPeriod)
+    , mPendingPeriod(aPendingPeriod)
+    , mPendingRequests(0)
+{
+    Reset();
+}
+
+void AdaptivePollPeriod::Reset(void)
+{
+    mPeriod     = kNone;
+    mRxInterval = 0;
+    mHasRxTime  = false;
+    mDidRx      = false;
+}
+
+void AdaptivePollPeriod::HandlePollTx(TimeMilli aNow, uint32_t aMaxPeriod)
+{
+    uint32_t ceiling = aMaxPeriod;
+
+    // A learned inter-arrival time bounds the period (we do not back
+    // off beyond the time the next frame is expected) until it
+    // becomes stale.
+
+    if ((mRxInterval != 0) && (aNow - mLastRxTime > kStaleIntervalFactor * mRxInterval))
+    {
+        mRxInterval = 0;
+    }
+
+    if (mRxInterval != 0)
+    {
+        ceiling = OT_MIN(ceiling, OT_MAX(mRxInterval, mMinPeriod));
+    }
+
+    if (!mDidRx && (mPeriod != kNone))
+    {
+        mPeriod += mPeriod / 2;
+    }
+
+    if ((mPeriod == kNone) || (mPeriod >= ceiling))
+    {
+        mPeriod = (ceiling < aMaxPeriod) ? ceiling : kNone;
+    }
+
+    mDidRx = false;
+}
+
+void AdaptivePollPeriod::HandleRxFrame(TimeMilli aNow, uint32_t aMaxPeriod)
+{
+    // Frames received within `mMinPeriod` of each other are treated
+    // as a single burst (e.g., frames retrieved using frame pending).
+    // A shorter interval is adopted right away, a longer one is
+    // smoothed so that a single gap does not undo what was learned.
+
+    if (mHasRxTime && (aNow - mLastRxTime >= mMinPeriod))
+    {
+        uint32_t interval = aNow - mLastRxTime;
+
+        if ((mRxInterval == 0) || (interval < mRxInterval))
+        {
+            mRxInterval = interval;
+        }
+        else
+        {
+            mRxInterval = (3 * mRxInterval + interval) / 4;
+        }
+    }
+
+    mLastRxTime = aNow;
+    mHasRxTime  = true;
+
+    if (!mDidRx)
+    {
+        // First frame retrieved by the last poll, more are likely
+        // to follow.
+
+        mPeriod = OT_MAX(((mPeriod == kNone) ? aMaxPeriod : mPeriod) / kRxPeriodDivisor, mMinPeriod);
+        mDidRx  = true;
+    }
+}
+
+void AdaptivePollPeriod::AddPendingRequest(void)
+{
+    if (mPendingRequests < NumericLimits<uint16_t>::kMax)
+    {
+        mPendingRequests++;
+    }
+}
+
+void AdaptivePollPeriod::RemovePendingRequest(void)
+{
+    if (mPendingRequests > 0)
+    {
+        mPendingRequests--;
+    }
+}
+
+uint32_t AdaptivePollPeriod::GetPeriod(void) const
+{
+    uint32_t period = mPeriod;
+
+    if ((mPendingRequests > 0) && ((period == kNone) || (period > mPendingPeriod)))
+    {
+        period = mPendingPeriod;
+    }
+
+    return period;
+}
+
 } // namespace ot
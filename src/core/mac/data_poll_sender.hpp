@@ -55,6 +55,101 @@ namespace ot {
  * @{
  */
 
+/**
+ * This class implements the adaptive data poll period (used by `DataPollSender`).
+ *
+ * The period is learned from the outcome of recent data polls (whether a poll retrieved any frame from parent), the
+ * inter-arrival time of received frames, and the number of outstanding requests expecting a response. It is divided
+ * by four when a poll retrieves a frame and grows by half otherwise, bounded by the minimum period, the learned
+ * inter-arrival time, and the maximum (default) poll period.
+ *
+ */
+class AdaptivePollPeriod
+{
+public:
+    static constexpr uint32_t kNone = 0; ///< Indicates that no adaptive period is in use.
+
+    /**
+     * This constructor initializes the `AdaptivePollPeriod`.
+     *
+     * @param[in] aMinPeriod      The minimum adaptive poll period (in msec).
+     * @param[in] aPendingPeriod  The maximum adaptive poll period (in msec) while there are pending requests.
+     *
+     */
+    AdaptivePollPeriod(uint32_t aMinPeriod, uint32_t aPendingPeriod);
+
+    /**
+     * This method resets the learned state (the number of pending requests is kept).
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method updates the adaptive period when a new data poll is sent.
+     *
+     * If no frame was received since the previous data poll, the period grows.
+     *
+     * @param[in] aNow        The current time.
+     * @param[in] aMaxPeriod  The maximum poll period (in msec), i.e., the default or user-specified poll period.
+     *
+     */
+    void HandlePollTx(TimeMilli aNow, uint32_t aMaxPeriod);
+
+    /**
+     * This method updates the learned inter-arrival time and the adaptive period when a frame is received from parent.
+     *
+     * The first frame received after a data poll shortens the period.
+     *
+     * @param[in] aNow        The current time.
+     * @param[in] aMaxPeriod  The maximum poll period (in msec), i.e., the default or user-specified poll period.
+     *
+     */
+    void HandleRxFrame(TimeMilli aNow, uint32_t aMaxPeriod);
+
+    /**
+     * This method registers a request expecting a response (downlink frame).
+     *
+     */
+    void AddPendingRequest(void);
+
+    /**
+     * This method unregisters a request expecting a response (response is received or request timed out).
+     *
+     */
+    void RemovePendingRequest(void);
+
+    /**
+     * This method gets the current adaptive poll period.
+     *
+     * @returns The adaptive poll period (in msec), or `kNone` if the default poll period should be used.
+     *
+     */
+    uint32_t GetPeriod(void) const;
+
+    /**
+     * This method gets the learned average inter-arrival time of received frames.
+     *
+     * @returns The average inter-arrival time (in msec), or zero if not known.
+     *
+     */
+    uint32_t GetRxInterval(void) const { return mRxInterval; }
+
+private:
+    // A learned inter-arrival time is dropped when no frame is
+    // received within this factor of it.
+    static constexpr uint8_t kStaleIntervalFactor = 4; // Learned interval is dropped after this many intervals.
+    static constexpr uint8_t kRxPeriodDivisor     = 4; // Period is divided by this when a poll retrieves a frame.
+
+    uint32_t  mMinPeriod;
+    uint32_t  mPendingPeriod;
+    uint32_t  mPeriod;
+    uint32_t  mRxInterval;
+    TimeMilli mLastRxTime;
+    uint16_t  mPendingRequests;
+    bool      mHasRxTime : 1;
+    bool      mDidRx : 1;
+};
+
 /**
  * This class implements the data poll (mac data request command) sender.
  *
@@ -217,6 +312,24 @@ public:
      */
     void StopFastPolls(void);
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    /**
+     * This method informs the data poll sender that a request expecting a response is sent (e.g., a CoAP request).
+     *
+     * While there are outstanding requests, the adaptive poll period is bounded by
+     * `OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_PENDING_PERIOD`. Each call MUST be paired with `RemovePendingRequest()`.
+     *
+     */
+    void AddPendingRequest(void);
+
+    /**
+     * This method informs the data poll sender that a previously added request is finished (response received or
+     * request timed out).
+     *
+     */
+    void RemovePendingRequest(void);
+#endif
+
     /**
      * This method gets the maximum data polling period in use.
      *
@@ -272,6 +385,10 @@ private:
     static constexpr uint32_t kFastPollPeriod       = 188;
     static constexpr uint32_t kMinPollPeriod        = OPENTHREAD_CONFIG_MAC_MINIMUM_POLL_PERIOD;
     static constexpr uint32_t kMaxExternalPeriod    = ((1 << 26) - 1); // ~18.6 hours.
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    static constexpr uint32_t kAdaptiveMinPollPeriod     = OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_MIN_PERIOD;
+    static constexpr uint32_t kAdaptivePendingPollPeriod = OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_PENDING_PERIOD;
+#endif
 
     void            ScheduleNextPoll(PollPeriodSelector aPollPeriodSelector);
     uint32_t        CalculatePollPeriod(void) const;
@@ -290,6 +407,10 @@ private:
 
     TimerMilli mTimer;
 
+#if OPENTHREAD_CONFIG_MAC_ADAPTIVE_POLL_ENABLE
+    AdaptivePollPeriod mAdaptivePeriod;
+#endif
+
     bool    mEnabled : 1;              // Indicates whether data polling is enabled/started.
     bool    mAttachMode : 1;           // Indicates whether in attach mode (to use attach poll period).
     bool    mRetxMode : 1;             // Indicates whether last poll tx failed at mac/radio layer (poll retx mode).
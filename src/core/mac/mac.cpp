@@ -92,6 +92,9 @@ Mac::Mac(Instance &aInstance)
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     , mCslTxFireTime(TimeMilli::kMaxDuration)
 #endif
+#if OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+    , mSlottedTxFireTime(0)
+#endif
 #endif
     , mActiveScanHandler(nullptr) // Initialize `mActiveScanHandler` and `mEnergyScanHandler` union
     , mScanHandlerContext(nullptr)
@@ -103,6 +106,9 @@ Mac::Mac(Instance &aInstance)
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     , mTxError(kErrorNone)
 #endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+    , mSlottedAccess(aInstance)
+#endif
 {
     ExtAddress randomExtAddress;
 
@@ -113,6 +119,9 @@ Mac::Mac(Instance &aInstance)
 
     mCcaSuccessRateTracker.Clear();
     ResetCounters();
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+    ResetOperationStats();
+#endif
 
     SetEnabled(true);
     mLinks.Enable();
@@ -358,7 +367,15 @@ exit:
 void Mac::EnergyScanDone(int8_t aEnergyScanMaxRssi)
 {
     ReportEnergyScanResult(aEnergyScanMaxRssi);
-    PerformEnergyScan();
+
+    if (HasUrgentOperation())
+    {
+        PreemptScan();
+    }
+    else
+    {
+        PerformEnergyScan();
+    }
 }
 
 void Mac::SetRxOnWhenIdle(bool aRxOnWhenIdle)
@@ -497,6 +514,49 @@ exit:
     return;
 }
 #endif
+
+#if OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+void Mac::SetSlottedAccessEnabled(bool aEnabled)
+{
+    VerifyOrExit(aEnabled != mSlottedAccess.IsEnabled());
+
+    mSlottedAccess.SetEnabled(aEnabled);
+    LogInfo("Slotted access %s", aEnabled ? "enabled" : "disabled");
+
+    // Re-evaluate a direct transmission which may be waiting for
+    // its window.
+    StartOperation(kOperationIdle);
+
+exit:
+    return;
+}
+
+bool Mac::IsInDirectTxSlot(void)
+{
+    bool      inSlot = true;
+    TimeMilli now    = TimerMilli::GetNow();
+    uint32_t  delay;
+
+    SuccessOrExit(mSlottedAccess.GetDirectTxDelay(delay));
+
+    mSlottedTxFireTime = now + delay;
+
+#if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
+    // The time just before the CSL window of a child is dedicated to
+    // the CSL transmission. A direct transmission which would overlap
+    // it is deferred until the CSL transmission is done.
+    if (IsPending(kOperationTransmitDataCsl) && (mCslTxFireTime - mSlottedTxFireTime < SlottedAccess::kCslTxGuard))
+    {
+        mSlottedTxFireTime = mCslTxFireTime;
+    }
+#endif
+
+    inSlot = (mSlottedTxFireTime <= now);
+
+exit:
+    return inSlot;
+}
+#endif // OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
 #endif // OPENTHREAD_FTD
 
 Error Mac::RequestDataPollTransmission(void)
@@ -548,6 +608,14 @@ void Mac::UpdateIdleMode(void)
     }
 #endif
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+    if (IsPending(kOperationTransmitDataDirect))
+    {
+        // Direct transmission is waiting for the device's window.
+        mTimer.FireAtIfEarlier(mSlottedTxFireTime);
+    }
+#endif
+
     if (shouldSleep)
     {
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
@@ -579,6 +647,12 @@ void Mac::StartOperation(Operation aOperation)
 {
     if (aOperation != kOperationIdle)
     {
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+        if (!IsPending(aOperation))
+        {
+            RecordOperationRequest(aOperation);
+        }
+#endif
         SetPending(aOperation);
 
         LogDebg("Request to start operation \"%s\"", OperationToString(aOperation));
@@ -633,18 +707,11 @@ void Mac::PerformNextOperation(void)
         mOperation = kOperationTransmitDataCsl;
     }
 #endif
-    else if (IsPending(kOperationActiveScan))
-    {
-        mOperation = kOperationActiveScan;
-    }
-    else if (IsPending(kOperationEnergyScan))
-    {
-        mOperation = kOperationEnergyScan;
-    }
-    else if (IsPending(kOperationTransmitBeacon))
-    {
-        mOperation = kOperationTransmitBeacon;
-    }
+    // Operations with a deadline (a child waiting for an indirect
+    // frame after its poll, or our own poll to the parent) go ahead
+    // of scans. A scan is also held back while an urgent operation
+    // is pending (see `HasUrgentOperation()`), and a running scan
+    // yields to them between channels (see `PreemptScan()`).
 #if OPENTHREAD_FTD
     else if (IsPending(kOperationTransmitDataIndirect))
     {
@@ -655,7 +722,23 @@ void Mac::PerformNextOperation(void)
     {
         mOperation = kOperationTransmitPoll;
     }
+    else if (IsPending(kOperationActiveScan) && !HasUrgentOperation())
+    {
+        mOperation = kOperationActiveScan;
+    }
+    else if (IsPending(kOperationEnergyScan) && !HasUrgentOperation())
+    {
+        mOperation = kOperationEnergyScan;
+    }
+    else if (IsPending(kOperationTransmitBeacon))
+    {
+        mOperation = kOperationTransmitBeacon;
+    }
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+    else if (IsPending(kOperationTransmitDataDirect) && IsInDirectTxSlot())
+#else
     else if (IsPending(kOperationTransmitDataDirect))
+#endif
     {
         mOperation = kOperationTransmitDataDirect;
 
@@ -671,6 +754,9 @@ void Mac::PerformNextOperation(void)
     {
         ClearPending(mOperation);
         LogDebg("Starting operation \"%s\"", OperationToString(mOperation));
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+        RecordOperationStart();
+#endif
         mTimer.Stop(); // Stop the timer before any non-idle operation, have the operation itself be responsible to
                        // start the timer (if it wants to).
     }
@@ -717,6 +803,157 @@ void Mac::FinishOperation(void)
     mOperation = kOperationIdle;
 }
 
+bool Mac::HasUrgentOperation(void) const
+{
+    // Indicates whether there is a pending operation with a deadline
+    // which may be missed if a scan (or the next channel of a running
+    // scan) is started now.
+
+    bool isUrgent = IsPending(kOperationWaitingForData) || IsPending(kOperationTransmitPoll);
+
+#if OPENTHREAD_FTD
+    isUrgent = isUrgent || IsPending(kOperationTransmitDataIndirect);
+
+#if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
+    // The CSL window of a child falls within the scan duration of
+    // the next channel.
+    isUrgent = isUrgent ||
+               (IsPending(kOperationTransmitDataCsl) && (mCslTxFireTime <= TimerMilli::GetNow() + mScanDuration));
+#endif
+#endif
+
+    return isUrgent;
+}
+
+void Mac::PreemptScan(void)
+{
+    // Pauses the current scan operation between channels so that
+    // the urgent operations are performed first. The scan remains
+    // pending and resumes from the next channel in its mask.
+
+    Operation scanOperation = mOperation;
+
+    OT_ASSERT((scanOperation == kOperationActiveScan) || (scanOperation == kOperationEnergyScan));
+
+    LogInfo("Preempting \"%s\" after channel %u", OperationToString(scanOperation), mScanChannel);
+
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+    {
+        uint8_t index;
+
+        if (OperationToStatsIndex(scanOperation, index))
+        {
+            mOperationStats[index].mPreemptCount++;
+        }
+    }
+#endif
+
+    if (scanOperation == kOperationActiveScan)
+    {
+        mLinks.SetPanId(mPanId);
+    }
+
+    FinishOperation();
+    StartOperation(scanOperation);
+    PerformNextOperation();
+}
+
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+bool Mac::OperationToStatsIndex(Operation aOperation, uint8_t &aIndex)
+{
+    bool isTracked = true;
+
+    switch (aOperation)
+    {
+    case kOperationActiveScan:
+        aIndex = OT_MAC_OPERATION_ACTIVE_SCAN;
+        break;
+    case kOperationEnergyScan:
+        aIndex = OT_MAC_OPERATION_ENERGY_SCAN;
+        break;
+    case kOperationTransmitBeacon:
+        aIndex = OT_MAC_OPERATION_TX_BEACON;
+        break;
+    case kOperationTransmitDataDirect:
+        aIndex = OT_MAC_OPERATION_TX_DATA_DIRECT;
+        break;
+    case kOperationTransmitPoll:
+        aIndex = OT_MAC_OPERATION_TX_DATA_POLL;
+        break;
+#if OPENTHREAD_FTD
+    case kOperationTransmitDataIndirect:
+        aIndex = OT_MAC_OPERATION_TX_DATA_INDIRECT;
+        break;
+#if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
+    case kOperationTransmitDataCsl:
+        aIndex = OT_MAC_OPERATION_TX_DATA_CSL;
+        break;
+#endif
+#endif
+    case kOperationIdle:
+    case kOperationWaitingForData:
+        isTracked = false;
+        break;
+    }
+
+    return isTracked;
+}
+
+void Mac::RecordOperationRequest(Operation aOperation)
+{
+    uint8_t index;
+
+    VerifyOrExit(OperationToStatsIndex(aOperation, index));
+    mOperationRequestTime[index] = TimerMilli::GetNow();
+
+exit:
+    return;
+}
+
+void Mac::RecordOperationStart(void)
+{
+    TimeMilli            now = TimerMilli::GetNow();
+    TimeMilli            requestTime;
+    uint32_t             waitTime;
+    uint8_t              index;
+    otMacOperationStats *stats;
+
+    VerifyOrExit(OperationToStatsIndex(mOperation, index));
+
+    requestTime = mOperationRequestTime[index];
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
+    if (mOperation == kOperationTransmitDataCsl)
+    {
+        // A CSL transmission is requested ahead of the CSL window of
+        // the child, so its wait is measured from the window.
+        requestTime = mCslTxFireTime;
+    }
+#endif
+
+    waitTime = (now > requestTime) ? (now - requestTime) : 0;
+
+    stats = &mOperationStats[index];
+    stats->mStartCount++;
+    stats->mTotalWaitTime += waitTime;
+    stats->mMaxWaitTime = OT_MAX(stats->mMaxWaitTime, waitTime);
+
+exit:
+    return;
+}
+
+Error Mac::GetOperationStats(otMacOperation aOperation, otMacOperationStats &aStats) const
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(static_cast<uint8_t>(aOperation) < kNumTrackedOperations, error = kErrorInvalidArgs);
+    aStats = mOperationStats[aOperation];
+
+exit:
+    return error;
+}
+#endif // OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+
 TxFrame *Mac::PrepareBeaconRequest(void)
 {
     TxFrame &frame = mLinks.GetTxFrames().GetBroadcastTxFrame();
@@ -824,9 +1061,10 @@ bool Mac::IsJoinable(void) const
 
 void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
 {
-    KeyManager &      keyManager = Get<KeyManager>();
-    uint8_t           keyIdMode;
-    const ExtAddress *extAddress = nullptr;
+    KeyManager &             keyManager = Get<KeyManager>();
+    uint8_t                  keyIdMode;
+    const ExtAddress *       extAddress = nullptr;
+    const CachedKeyMaterial *aesKey     = nullptr;
 
     VerifyOrExit(aFrame.GetSecurityEnabled());
 
@@ -835,7 +1073,8 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
     switch (keyIdMode)
     {
     case Frame::kKeyIdMode0:
-        aFrame.SetAesKey(keyManager.GetKek());
+        aesKey = &keyManager.GetKek();
+        aFrame.SetAesKey(*aesKey);
         extAddress = &GetExtAddress();
 
         if (!aFrame.IsHeaderUpdated())
@@ -859,7 +1098,8 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
 #endif
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
-        aFrame.SetAesKey(*mLinks.GetCurrentMacKey(aFrame));
+        aesKey = mLinks.GetCurrentMacKey(aFrame);
+        aFrame.SetAesKey(*aesKey);
         extAddress = &GetExtAddress();
 
         // If the frame header is marked as updated, `MeshForwarder` which
@@ -880,7 +1120,8 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
     {
         const uint8_t keySource[] = {0xff, 0xff, 0xff, 0xff};
 
-        aFrame.SetAesKey(mMode2KeyMaterial);
+        aesKey = &mMode2KeyMaterial;
+        aFrame.SetAesKey(*aesKey);
 
         mKeyIdMode2FrameCounter++;
         aFrame.SetFrameCounter(mKeyIdMode2FrameCounter);
@@ -904,7 +1145,7 @@ void Mac::ProcessTransmitSecurity(TxFrame &aFrame)
     VerifyOrExit(aFrame.mInfo.mTxInfo.mCslPresent == 0);
 #endif
 
-    aFrame.ProcessTransmitAesCcm(*extAddress);
+    aFrame.ProcessTransmitAesCcm(*extAddress, aesKey);
 
 exit:
     return;
@@ -1399,7 +1640,20 @@ void Mac::HandleTransmitDone(TxFrame &aFrame, RxFrame *aAckFrame, Error aError)
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
         Get<DataPollSender>().ProcessTxDone(aFrame, aAckFrame, aError);
 #endif
+
+        // Batch the next queued direct frame (if any): it is requested
+        // right away so it starts without returning the radio to idle
+        // and without waiting for the tasklets, unless an operation of
+        // higher priority is pending.
+        Get<MeshForwarder>().ScheduleTransmissionTask();
         PerformNextOperation();
+
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+        if (mOperation == kOperationTransmitDataDirect)
+        {
+            mOperationStats[OT_MAC_OPERATION_TX_DATA_DIRECT].mBatchCount++;
+        }
+#endif
         break;
 
 #if OPENTHREAD_FTD
@@ -1455,7 +1709,14 @@ void Mac::HandleTimer(void)
     switch (mOperation)
     {
     case kOperationActiveScan:
-        PerformActiveScan();
+        if (HasUrgentOperation())
+        {
+            PreemptScan();
+        }
+        else
+        {
+            PerformActiveScan();
+        }
         break;
 
     case kOperationWaitingForData:
@@ -1482,6 +1743,12 @@ void Mac::HandleTimer(void)
         {
             PerformNextOperation();
         }
+#endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+        if (IsPending(kOperationTransmitDataDirect))
+        {
+            PerformNextOperation();
+        }
 #endif
         break;
 
@@ -1492,15 +1759,15 @@ void Mac::HandleTimer(void)
 
 Error Mac::ProcessReceiveSecurity(RxFrame &aFrame, const Address &aSrcAddr, Neighbor *aNeighbor)
 {
-    KeyManager &       keyManager = Get<KeyManager>();
-    Error              error      = kErrorSecurity;
-    uint8_t            securityLevel;
-    uint8_t            keyIdMode;
-    uint32_t           frameCounter;
-    uint8_t            keyid;
-    uint32_t           keySequence = 0;
-    const KeyMaterial *macKey;
-    const ExtAddress * extAddress;
+    KeyManager &             keyManager = Get<KeyManager>();
+    Error                    error      = kErrorSecurity;
+    uint8_t                  securityLevel;
+    uint8_t                  keyIdMode;
+    uint32_t                 frameCounter;
+    uint8_t                  keyid;
+    uint32_t                 keySequence = 0;
+    const CachedKeyMaterial *macKey;
+    const ExtAddress *       extAddress;
 
     VerifyOrExit(aFrame.GetSecurityEnabled(), error = kErrorNone);
 
@@ -1627,17 +1894,17 @@ exit:
 #if OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
 Error Mac::ProcessEnhAckSecurity(TxFrame &aTxFrame, RxFrame &aAckFrame)
 {
-    Error              error = kErrorSecurity;
-    uint8_t            securityLevel;
-    uint8_t            txKeyId;
-    uint8_t            ackKeyId;
-    uint8_t            keyIdMode;
-    uint32_t           frameCounter;
-    Address            srcAddr;
-    Address            dstAddr;
-    Neighbor *         neighbor   = nullptr;
-    KeyManager &       keyManager = Get<KeyManager>();
-    const KeyMaterial *macKey;
+    Error                    error = kErrorSecurity;
+    uint8_t                  securityLevel;
+    uint8_t                  txKeyId;
+    uint8_t                  ackKeyId;
+    uint8_t                  keyIdMode;
+    uint32_t                 frameCounter;
+    Address                  srcAddr;
+    Address                  dstAddr;
+    Neighbor *               neighbor   = nullptr;
+    KeyManager &             keyManager = Get<KeyManager>();
+    const CachedKeyMaterial *macKey;
 
     VerifyOrExit(aAckFrame.GetSecurityEnabled(), error = kErrorNone);
     VerifyOrExit(aAckFrame.IsVersion2015());
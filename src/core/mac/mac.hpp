@@ -50,6 +50,7 @@
 #include "mac/mac_frame.hpp"
 #include "mac/mac_links.hpp"
 #include "mac/mac_types.hpp"
+#include "mac/slotted_access.hpp"
 #include "mac/sub_mac.hpp"
 #include "radio/trel_link.hpp"
 #include "thread/key_manager.hpp"
@@ -222,6 +223,28 @@ public:
     void RequestCslFrameTransmission(uint32_t aDelay);
 #endif
 
+#if OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+    /**
+     * This method indicates whether or not slotted channel access is enabled for direct transmissions.
+     *
+     * @retval TRUE   If slotted channel access is enabled.
+     * @retval FALSE  If slotted channel access is disabled.
+     *
+     */
+    bool IsSlottedAccessEnabled(void) const { return mSlottedAccess.IsEnabled(); }
+
+    /**
+     * This method enables or disables slotted channel access for direct transmissions.
+     *
+     * When enabled, a router synchronized to the network time starts direct transmissions only within its own window
+     * of the slotframe (see `SlottedAccess`).
+     *
+     * @param[in]  aEnabled  TRUE to enable slotted channel access, FALSE to disable.
+     *
+     */
+    void SetSlottedAccessEnabled(bool aEnabled);
+#endif
+
 #endif
 
     /**
@@ -508,6 +531,26 @@ public:
      */
     otMacCounters &GetCounters(void) { return mCounters; }
 
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+    /**
+     * This method gets the scheduling statistics of a MAC operation.
+     *
+     * @param[in]   aOperation  The MAC operation.
+     * @param[out]  aStats      A reference to return the statistics.
+     *
+     * @retval kErrorNone         Successfully retrieved the statistics.
+     * @retval kErrorInvalidArgs  @p aOperation is not valid.
+     *
+     */
+    Error GetOperationStats(otMacOperation aOperation, otMacOperationStats &aStats) const;
+
+    /**
+     * This method resets the scheduling statistics of all MAC operations.
+     *
+     */
+    void ResetOperationStats(void) { memset(mOperationStats, 0, sizeof(mOperationStats)); }
+#endif
+
 #if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
     /**
      * This method returns the MAC retry histogram for direct transmission.
@@ -700,6 +743,9 @@ public:
 private:
     static constexpr int8_t   kInvalidRssiValue  = SubMac::kInvalidRssiValue;
     static constexpr uint16_t kMaxCcaSampleCount = OPENTHREAD_CONFIG_CCA_FAILURE_RATE_AVERAGING_WINDOW;
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+    static constexpr uint8_t kNumTrackedOperations = OT_MAC_OPERATION_TX_DATA_CSL + 1;
+#endif
 
     enum Operation : uint8_t
     {
@@ -755,6 +801,8 @@ private:
     void     StartOperation(Operation aOperation);
     void     FinishOperation(void);
     void     PerformNextOperation(void);
+    bool     HasUrgentOperation(void) const;
+    void     PreemptScan(void);
     TxFrame *PrepareBeaconRequest(void);
     TxFrame *PrepareBeacon(void);
     bool     ShouldSendBeacon(void) const;
@@ -785,8 +833,16 @@ private:
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     void ProcessCsl(const RxFrame &aFrame, const Address &aSrcAddr);
 #endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+    bool IsInDirectTxSlot(void);
+#endif
 #if OPENTHREAD_CONFIG_MLE_LINK_METRICS_SUBJECT_ENABLE
     void ProcessEnhAckProbing(const RxFrame &aFrame, const Neighbor &aNeighbor);
+#endif
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+    static bool OperationToStatsIndex(Operation aOperation, uint8_t &aIndex);
+    void        RecordOperationRequest(Operation aOperation);
+    void        RecordOperationStart(void);
 #endif
     static const char *OperationToString(Operation aOperation);
 
@@ -820,6 +876,9 @@ private:
 #if OPENTHREAD_CONFIG_MAC_CSL_TRANSMITTER_ENABLE
     TimeMilli mCslTxFireTime;
 #endif
+#if OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+    TimeMilli mSlottedTxFireTime;
+#endif
 #endif
 
     union
@@ -840,6 +899,10 @@ private:
 #if OPENTHREAD_CONFIG_MAC_RETRY_SUCCESS_HISTOGRAM_ENABLE
     RetryHistogram mRetryHistogram;
 #endif
+#if OPENTHREAD_CONFIG_MAC_OPERATION_STATS_ENABLE
+    otMacOperationStats mOperationStats[kNumTrackedOperations];
+    TimeMilli           mOperationRequestTime[kNumTrackedOperations];
+#endif
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     RadioTypes mTxPendingRadioLinks;
@@ -851,7 +914,11 @@ private:
     Filter mFilter;
 #endif
 
-    KeyMaterial mMode2KeyMaterial;
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+    SlottedAccess mSlottedAccess;
+#endif
+
+    CachedKeyMaterial mMode2KeyMaterial;
 };
 
 /**
@@ -1168,10 +1168,11 @@ void TxFrame::CopyFrom(const TxFrame &aFromFrame)
 #endif
 }
 
-void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress)
+void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress, const CachedKeyMaterial *aAesKey)
 {
 #if OPENTHREAD_RADIO && !OPENTHREAD_CONFIG_MAC_SOFTWARE_TX_SECURITY_ENABLE
     OT_UNUSED_VARIABLE(aExtAddress);
+    OT_UNUSED_VARIABLE(aAesKey);
 #else
     uint32_t       frameCounter = 0;
     uint8_t        securityLevel;
@@ -1186,7 +1187,16 @@ void TxFrame::ProcessTransmitAesCcm(const ExtAddress &aExtAddress)
 
     Crypto::AesCcm::GenerateNonce(aExtAddress, frameCounter, securityLevel, nonce);
 
-    aesCcm.SetKey(GetAesKey());
+    if (aAesKey != nullptr)
+    {
+        OT_ASSERT(&GetAesKey() == aAesKey);
+        aesCcm.SetKey(*aAesKey);
+    }
+    else
+    {
+        aesCcm.SetKey(GetAesKey());
+    }
+
     tagLength = GetFooterLength() - GetFcsSize();
 
     aesCcm.Init(GetHeaderLength(), GetPayloadLength(), tagLength, nonce, sizeof(nonce));
@@ -1330,7 +1340,7 @@ exit:
 }
 #endif // OPENTHREAD_CONFIG_THREAD_VERSION >= OT_THREAD_VERSION_1_2
 
-Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey)
+Error RxFrame::ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const CachedKeyMaterial &aMacKey)
 {
 #if OPENTHREAD_RADIO
     OT_UNUSED_VARIABLE(aExtAddress);
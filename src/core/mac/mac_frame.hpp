@@ -1162,13 +1162,14 @@ public:
      *
      * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
      *                          for AES CCM computation.
-     * @param[in]  aMacKey      A reference to the MAC key to decrypt the received frame.
+     * @param[in]  aMacKey      A reference to the MAC key to decrypt the received frame. Its cached AES key
+     *                          schedule is reused.
      *
      * @retval kErrorNone      Process of received frame AES CCM succeeded.
      * @retval kErrorSecurity  Received frame MIC check failed.
      *
      */
-    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const KeyMaterial &aMacKey);
+    Error ProcessReceiveAesCcm(const ExtAddress &aExtAddress, const CachedKeyMaterial &aMacKey);
 
 #if OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
     /**
@@ -1312,9 +1313,11 @@ public:
      *
      * @param[in]  aExtAddress  A reference to the extended address, which will be used to generate nonce
      *                          for AES CCM computation.
+     * @param[in]  aAesKey      A pointer to the frame AES key (same as `GetAesKey()`) whose cached AES key schedule
+     *                          is reused, or `nullptr` to expand the frame AES key for this frame only.
      *
      */
-    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress);
+    void ProcessTransmitAesCcm(const ExtAddress &aExtAddress, const CachedKeyMaterial *aAesKey = nullptr);
 
     /**
      * This method indicates whether or not the frame has security processed.
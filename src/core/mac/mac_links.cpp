@@ -169,11 +169,11 @@ void Links::Send(TxFrame &aFrame, RadioTypes aRadioTypes)
 
 #endif // #if OPENTHREAD_CONFIG_MULTI_RADIO
 
-const KeyMaterial *Links::GetCurrentMacKey(const Frame &aFrame) const
+const CachedKeyMaterial *Links::GetCurrentMacKey(const Frame &aFrame) const
 {
     // Gets the security MAC key (for Key Mode 1) based on radio link type of `aFrame`.
 
-    const KeyMaterial *key = nullptr;
+    const CachedKeyMaterial *key = nullptr;
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     RadioType radioType = aFrame.GetRadioType();
 #endif
@@ -202,12 +202,12 @@ exit:
     return key;
 }
 
-const KeyMaterial *Links::GetTemporaryMacKey(const Frame &aFrame, uint32_t aKeySequence) const
+const CachedKeyMaterial *Links::GetTemporaryMacKey(const Frame &aFrame, uint32_t aKeySequence) const
 {
     // Gets the security MAC key (for Key Mode 1) based on radio link
     // type of `aFrame` and given Key Sequence.
 
-    const KeyMaterial *key = nullptr;
+    const CachedKeyMaterial *key = nullptr;
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     RadioType radioType = aFrame.GetRadioType();
 #endif
@@ -630,7 +630,7 @@ public:
      * @returns A reference to the current MAC key.
      *
      */
-    const KeyMaterial *GetCurrentMacKey(const Frame &aFrame) const;
+    const CachedKeyMaterial *GetCurrentMacKey(const Frame &aFrame) const;
 
     /**
      * This method returns a reference to the temporary MAC key (for Key Mode 1) for a given Frame based on a given
@@ -642,7 +642,7 @@ public:
      * @returns A reference to the temporary MAC key.
      *
      */
-    const KeyMaterial *GetTemporaryMacKey(const Frame &aFrame, uint32_t aKeySequence) const;
+    const CachedKeyMaterial *GetTemporaryMacKey(const Frame &aFrame, uint32_t aKeySequence) const;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     /**
@@ -342,5 +342,39 @@ bool KeyMaterial::operator==(const KeyMaterial &aOther) const
 #endif
 }
 
+CachedKeyMaterial &CachedKeyMaterial::operator=(const KeyMaterial &aOther)
+{
+    KeyMaterial::operator=(aOther);
+    mIsExpanded = false;
+
+    return *this;
+}
+
+void CachedKeyMaterial::Clear(void)
+{
+    KeyMaterial::Clear();
+    mIsExpanded = false;
+}
+
+void CachedKeyMaterial::SetFrom(const Key &aKey, bool aIsExportable)
+{
+    KeyMaterial::SetFrom(aKey, aIsExportable);
+    mIsExpanded = false;
+}
+
+Crypto::AesEcb &CachedKeyMaterial::GetKeySchedule(void) const
+{
+    if (!mIsExpanded)
+    {
+        Crypto::Key cryptoKey;
+
+        ConvertToCryptoKey(cryptoKey);
+        mKeySchedule.SetKey(cryptoKey);
+        mIsExpanded = true;
+    }
+
+    return mKeySchedule;
+}
+
 } // namespace Mac
 } // namespace ot
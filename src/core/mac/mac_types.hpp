@@ -46,7 +46,9 @@
 #include "common/clearable.hpp"
 #include "common/data.hpp"
 #include "common/equatable.hpp"
+#include "common/non_copyable.hpp"
 #include "common/string.hpp"
+#include "crypto/aes_ecb.hpp"
 #include "crypto/storage.hpp"
 
 namespace ot {
@@ -552,6 +554,64 @@ private:
     void SetKey(const Key &aKey) { mKeyMaterial.mKey = aKey; }
 };
 
+/**
+ * This class represents a MAC Key Material along with its cached AES key schedule.
+ *
+ * The AES key expansion is done when the key schedule is first used, and is then reused by all frames and messages
+ * secured with the key until the key material is changed (`SetFrom()`, `Clear()` or assignment).
+ *
+ */
+class CachedKeyMaterial : public KeyMaterial, private NonCopyable
+{
+public:
+    /**
+     * This constructor initializes a `CachedKeyMaterial`.
+     *
+     */
+    CachedKeyMaterial(void)
+        : mIsExpanded(false)
+    {
+    }
+
+    /**
+     * This method overrides the assignment operator.
+     *
+     * @param[in] aOther  The other key material to copy from.
+     *
+     * @returns A reference to the current instance.
+     *
+     */
+    CachedKeyMaterial &operator=(const KeyMaterial &aOther);
+
+    /**
+     * This method clears the `CachedKeyMaterial`.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method sets the `CachedKeyMaterial` from a given Key.
+     *
+     * @param[in] aKey            A reference to the key.
+     * @param[in] aIsExportable   Boolean indicating if the key is exportable (this is only applicable under
+     *                            `OPENTHREAD_CONFIG_PLATFORM_KEY_REFERENCES_ENABLE` config).
+     *
+     */
+    void SetFrom(const Key &aKey, bool aIsExportable = false);
+
+    /**
+     * This method gets the AES key schedule of the key material, expanding the key if not already done.
+     *
+     * @returns A reference to an `AesEcb` initialized with the key.
+     *
+     */
+    Crypto::AesEcb &GetKeySchedule(void) const;
+
+private:
+    mutable Crypto::AesEcb mKeySchedule;
+    mutable bool           mIsExpanded;
+};
+
 #if OPENTHREAD_CONFIG_MULTI_RADIO
 
 /**
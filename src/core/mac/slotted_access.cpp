@@ -0,0 +1,110 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file implements slotted channel access of direct transmissions.
+ */
+
+#include "slotted_access.hpp"
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/locator_getters.hpp"
+#include "thread/mle.hpp"
+#include "thread/router_table.hpp"
+#include "thread/time_sync_service.hpp"
+
+namespace ot {
+namespace Mac {
+
+SlottedAccess::SlottedAccess(Instance &aInstance)
+    : InstanceLocator(aInstance)
+    , mEnabled(false)
+{
+}
+
+Error SlottedAccess::GetDirectTxDelay(uint32_t &aDelay) const
+{
+    Error                   error       = kErrorNone;
+    const Mle::RouterIdSet &routerIdSet = Get<RouterTable>().GetRouterIdSet();
+    uint8_t                 routerId    = Mle::Mle::RouterIdFromRloc16(Get<Mle::Mle>().GetRloc16());
+    uint8_t                 window      = 0;
+    uint8_t                 numWindows  = 0;
+    uint64_t                networkTime;
+    uint32_t                delay;
+
+    VerifyOrExit(mEnabled, error = kErrorInvalidState);
+    VerifyOrExit(Get<Mle::Mle>().IsRouterOrLeader(), error = kErrorInvalidState);
+    VerifyOrExit(Get<TimeSync>().GetTime(networkTime) == OT_NETWORK_TIME_SYNCHRONIZED, error = kErrorInvalidState);
+
+    // The window of a router is given by its rank in the Router ID Set.
+
+    for (uint8_t id = 0; id <= Mle::kMaxRouterId; id++)
+    {
+        if (routerIdSet.Contains(id))
+        {
+            window += (id < routerId) ? 1 : 0;
+            numWindows++;
+        }
+    }
+
+    VerifyOrExit(routerIdSet.Contains(routerId), error = kErrorInvalidState);
+
+    delay = CalculateDelayToWindow(networkTime, window, numWindows);
+
+    // Round up so that the (msec) timer never fires before the window starts.
+    aDelay = (delay + 999) / 1000;
+
+exit:
+    return error;
+}
+
+uint32_t SlottedAccess::CalculateDelayToWindow(uint64_t aNetworkTime, uint8_t aWindow, uint8_t aNumWindows)
+{
+    uint32_t offset = static_cast<uint32_t>(aNetworkTime % kSlotframeDuration);
+    uint32_t start  = kSlotframeDuration / aNumWindows * aWindow;
+    uint32_t delay  = 0;
+
+    OT_ASSERT(aWindow < aNumWindows);
+
+    VerifyOrExit((offset < start) || (offset - start >= kSlotframeDuration / aNumWindows));
+
+    delay = (start + kSlotframeDuration - offset) % kSlotframeDuration;
+
+exit:
+    return delay;
+}
+
+} // namespace Mac
+} // namespace ot
+
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
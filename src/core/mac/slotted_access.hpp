@@ -0,0 +1,158 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/**
+ * @file
+ *   This file includes definitions for slotted channel access of direct transmissions.
+ */
+
+#ifndef SLOTTED_ACCESS_HPP_
+#define SLOTTED_ACCESS_HPP_
+
+#include "openthread-core-config.h"
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+
+#if !OPENTHREAD_CONFIG_TIME_SYNC_ENABLE
+#error "OPENTHREAD_CONFIG_TIME_SYNC_ENABLE is required for OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE."
+#endif
+
+#include <stdint.h>
+
+#include "common/error.hpp"
+#include "common/locator.hpp"
+#include "common/non_copyable.hpp"
+#include "thread/mle_types.hpp"
+
+namespace ot {
+namespace Mac {
+
+/**
+ * @addtogroup core-mac
+ *
+ * @{
+ *
+ */
+
+/**
+ * This class implements the slotted channel access schedule for direct transmissions.
+ *
+ * The network time (maintained by `TimeSync`) is divided into slotframes of `kSlotframeDuration`. Each slotframe is
+ * divided evenly among the active routers in the order of their Router IDs, and a router only starts a direct
+ * transmission within its own window. Since the Router ID Set is distributed by the leader, every router derives the
+ * same schedule without exchanging it. CSMA-CA is still used within a window, so a frame extending past the end of a
+ * window defers (rather than collides with) the transmission of the next router.
+ *
+ * A device which is not a router, or is not synchronized to the network time, uses unslotted channel access.
+ *
+ */
+class SlottedAccess : public InstanceLocator, private NonCopyable
+{
+public:
+    /**
+     * The duration of a slotframe (in usec).
+     *
+     */
+    static constexpr uint32_t kSlotframeDuration = OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_SLOTFRAME_DURATION;
+
+    /**
+     * The time reserved (in msec) for a CSL transmission to a child, covering the longest frame and its ack.
+     *
+     * A direct transmission is not started within this time before an upcoming CSL transmission.
+     *
+     */
+    static constexpr uint32_t kCslTxGuard = 5;
+
+    /**
+     * This constructor initializes the `SlottedAccess` object.
+     *
+     * @param[in]  aInstance  A reference to the OpenThread instance.
+     *
+     */
+    explicit SlottedAccess(Instance &aInstance);
+
+    /**
+     * This method indicates whether or not slotted channel access is enabled.
+     *
+     * @retval TRUE   If slotted channel access is enabled.
+     * @retval FALSE  If slotted channel access is disabled.
+     *
+     */
+    bool IsEnabled(void) const { return mEnabled; }
+
+    /**
+     * This method enables or disables slotted channel access.
+     *
+     * @param[in]  aEnabled  TRUE to enable slotted channel access, FALSE to disable.
+     *
+     */
+    void SetEnabled(bool aEnabled) { mEnabled = aEnabled; }
+
+    /**
+     * This method gets the delay until the device may start a direct transmission in its own window.
+     *
+     * @param[out] aDelay  A reference to return the delay in milliseconds (zero if a transmission may start now).
+     *
+     * @retval kErrorNone          Successfully determined the delay, @p aDelay is updated.
+     * @retval kErrorInvalidState  Slotted channel access is not in use (disabled, not a router, or not synchronized to
+     *                             the network time). Unslotted channel access should be used.
+     *
+     */
+    Error GetDirectTxDelay(uint32_t &aDelay) const;
+
+    /**
+     * This static method calculates the delay from a given network time until the start of a window.
+     *
+     * @param[in]  aNetworkTime   The network time (in usec).
+     * @param[in]  aWindow        The index of the window (MUST be smaller than @p aNumWindows).
+     * @param[in]  aNumWindows    The number of windows in the slotframe (MUST NOT be zero).
+     *
+     * @returns The delay in usec, zero if @p aNetworkTime is within the window @p aWindow.
+     *
+     */
+    static uint32_t CalculateDelayToWindow(uint64_t aNetworkTime, uint8_t aWindow, uint8_t aNumWindows);
+
+private:
+    static_assert(kSlotframeDuration / Mle::kMaxRouters >= 1000,
+                  "OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_SLOTFRAME_DURATION is too short for max number of routers");
+
+    bool mEnabled;
+};
+
+/**
+ * @}
+ *
+ */
+
+} // namespace Mac
+} // namespace ot
+
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+
+#endif // SLOTTED_ACCESS_HPP_
@@ -418,7 +418,7 @@ void SubMac::ProcessTransmitSecurity(void)
     VerifyOrExit(mTransmitFrame.GetTimeIeOffset() == 0);
 #endif
 
-    mTransmitFrame.ProcessTransmitAesCcm(*extAddress);
+    mTransmitFrame.ProcessTransmitAesCcm(*extAddress, &GetCurrentMacKey());
 
 exit:
     return;
@@ -515,7 +515,7 @@ public:
      * @returns A reference to the current MAC key.
      *
      */
-    const KeyMaterial &GetCurrentMacKey(void) const { return mCurrKey; }
+    const CachedKeyMaterial &GetCurrentMacKey(void) const { return mCurrKey; }
 
     /**
      * This method returns a reference to the previous MAC key.
@@ -523,7 +523,7 @@ public:
      * @returns A reference to the previous MAC key.
      *
      */
-    const KeyMaterial &GetPreviousMacKey(void) const { return mPrevKey; }
+    const CachedKeyMaterial &GetPreviousMacKey(void) const { return mPrevKey; }
 
     /**
      * This method returns a reference to the next MAC key.
@@ -531,7 +531,7 @@ public:
      * @returns A reference to the next MAC key.
      *
      */
-    const KeyMaterial &GetNextMacKey(void) const { return mNextKey; }
+    const CachedKeyMaterial &GetNextMacKey(void) const { return mNextKey; }
 
     /**
      * This method returns the current MAC frame counter value.
@@ -694,9 +694,9 @@ private:
     Callbacks          mCallbacks;
     otLinkPcapCallback mPcapCallback;
     void *             mPcapCallbackContext;
-    KeyMaterial        mPrevKey;
-    KeyMaterial        mCurrKey;
-    KeyMaterial        mNextKey;
+    CachedKeyMaterial  mPrevKey;
+    CachedKeyMaterial  mCurrKey;
+    CachedKeyMaterial  mNextKey;
     uint32_t           mFrameCounter;
     uint8_t            mKeyId;
 #if OPENTHREAD_CONFIG_MAC_ADD_DELAY_ON_NO_ACK_ERROR_BEFORE_RETRY
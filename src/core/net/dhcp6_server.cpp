@@ -42,6 +42,7 @@
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
+#include "common/settings.hpp"
 #include "thread/mle.hpp"
 #include "thread/thread_netif.hpp"
 
@@ -55,8 +56,14 @@ Server::Server(Instance &aInstance)
     , mSocket(aInstance)
     , mPrefixAgentsCount(0)
     , mPrefixAgentsMask(0)
+    , mLeaseTimer(aInstance, Server::HandleLeaseTimer)
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+    , mSaveLeasesTasklet(aInstance, Server::HandleSaveLeasesTasklet)
+    , mLeasesRestored(false)
+#endif
 {
     memset(mPrefixAgents, 0, sizeof(mPrefixAgents));
+    mCounters.Clear();
 }
 
 Error Server::UpdateService(void)
@@ -66,6 +73,7 @@ Error Server::UpdateService(void)
     NetworkData::Iterator           iterator;
     NetworkData::OnMeshPrefixConfig config;
     Lowpan::Context                 lowpanContext;
+    bool                            agentsChanged = false;
 
     // remove dhcp agent aloc and prefix delegation
     for (PrefixAgent &prefixAgent : mPrefixAgents)
@@ -101,6 +109,7 @@ Error Server::UpdateService(void)
             Get<ThreadNetif>().RemoveUnicastAddress(prefixAgent.GetAloc());
             prefixAgent.Clear();
             mPrefixAgentsCount--;
+            agentsChanged = true;
         }
     }
 
@@ -116,12 +125,17 @@ Error Server::UpdateService(void)
 
         error = Get<NetworkData::Leader>().GetContext(AsCoreType(&config.mPrefix.mPrefix), lowpanContext);
 
-        if (error == kErrorNone)
+        if ((error == kErrorNone) && AddPrefixAgent(config.GetPrefix(), lowpanContext))
         {
-            AddPrefixAgent(config.GetPrefix(), lowpanContext);
+            agentsChanged = true;
         }
     }
 
+    if (agentsChanged)
+    {
+        HandlePrefixAgentsChanged();
+    }
+
     if (mPrefixAgentsCount > 0)
     {
         Start();
@@ -141,6 +155,13 @@ void Server::Start(void)
     IgnoreError(mSocket.Open(&Server::HandleUdpReceive, this));
     IgnoreError(mSocket.Bind(kDhcpServerPort));
 
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+    if (!mLeasesRestored)
+    {
+        RestoreLeases();
+    }
+#endif
+
 exit:
     return;
 }
@@ -150,9 +171,10 @@ void Server::Stop(void)
     IgnoreError(mSocket.Close());
 }
 
-void Server::AddPrefixAgent(const Ip6::Prefix &aIp6Prefix, const Lowpan::Context &aContext)
+bool Server::AddPrefixAgent(const Ip6::Prefix &aIp6Prefix, const Lowpan::Context &aContext)
 {
     Error        error    = kErrorNone;
+    bool         added    = false;
     PrefixAgent *newEntry = nullptr;
 
     for (PrefixAgent &prefixAgent : mPrefixAgents)
@@ -173,6 +195,7 @@ void Server::AddPrefixAgent(const Ip6::Prefix &aIp6Prefix, const Lowpan::Context
     newEntry->Set(aIp6Prefix, Get<Mle::MleRouter>().GetMeshLocalPrefix(), aContext.mContextId);
     Get<ThreadNetif>().AddUnicastAddress(newEntry->GetAloc());
     mPrefixAgentsCount++;
+    added = true;
 
 exit:
 
@@ -180,6 +203,21 @@ exit:
     {
         LogNote("Failed to add DHCPv6 prefix agent: %s", ErrorToString(error));
     }
+
+    return added;
+}
+
+void Server::HandlePrefixAgentsChanged(void)
+{
+    // The prefix agents assigned to a client are tracked in each lease
+    // as a mask of `mPrefixAgents` indexes, which are no longer valid
+    // once the agents change. Such leases are then renewed through the
+    // full IA_NA processing on the next Solicit from their clients.
+
+    for (uint16_t i = 0; i < mLeaseTable.GetNumLeases(); i++)
+    {
+        mLeaseTable.GetLeaseAt(i).mHasPrefixAgentsMask = false;
+    }
 }
 
 void Server::HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
@@ -207,6 +245,8 @@ void Server::ProcessSolicit(Message &aMessage, const Ip6::Address &aDst, const T
 {
     IaNa             iana;
     ClientIdentifier clientIdentifier;
+    Lease *          lease;
+    bool             isFastPath = false;
     uint16_t         optionOffset;
     uint16_t         offset = aMessage.GetOffset();
     uint16_t         length = aMessage.GetLength() - aMessage.GetOffset();
@@ -229,10 +269,38 @@ void Server::ProcessSolicit(Message &aMessage, const Ip6::Address &aDst, const T
 
     // IA_NA (discard if not present)
     VerifyOrExit((optionOffset = FindOption(aMessage, offset, length, kOptionIaNa)) > 0);
-    SuccessOrExit(ProcessIaNa(aMessage, optionOffset, iana));
+    SuccessOrExit(aMessage.Read(optionOffset, iana));
+
+    mCounters.mSolicits++;
+
+    lease = mLeaseTable.Find(clientIdentifier.GetDuidLinkLayerAddress());
+
+    if ((lease != nullptr) && lease->mHasPrefixAgentsMask && (lease->GetIaid() == iana.GetIaid()))
+    {
+        // Rapid Commit fast path: the client already has a lease for
+        // the same IA_NA and the prefix agents have not changed since,
+        // so it is assigned the same addresses as in the last reply
+        // without matching its IA Address options again.
+
+        mPrefixAgentsMask = lease->mPrefixAgentsMask;
+        isFastPath        = true;
+    }
+    else
+    {
+        SuccessOrExit(ProcessIaNa(aMessage, optionOffset, iana));
+    }
 
     SuccessOrExit(SendReply(aDst, aTransactionId, clientIdentifier, iana));
 
+    mCounters.mReplies++;
+
+    if (isFastPath)
+    {
+        mCounters.mFastPathReplies++;
+    }
+
+    UpdateLease(clientIdentifier, iana, lease);
+
 exit:
     return;
 }
@@ -488,6 +556,159 @@ Error Server::AppendRapidCommit(Message &aMessage)
     return aMessage.Append(option);
 }
 
+void Server::UpdateLease(const ClientIdentifier &aClientId, const IaNa &aIaNa, Lease *aLease)
+{
+    TimeMilli expireTime = TimerMilli::GetNow() + kLeaseTimeout;
+
+    if (aLease != nullptr)
+    {
+        if (aLease->mIaid != aIaNa.GetIaid())
+        {
+            aLease->mIaid = aIaNa.GetIaid();
+            SignalLeasesChanged();
+        }
+
+        mLeaseTable.UpdateExpireTime(*aLease, expireTime);
+        mCounters.mLeasesRenewed++;
+    }
+    else
+    {
+        if (mLeaseTable.IsFull())
+        {
+            Lease *evicted = mLeaseTable.GetEarliest();
+
+            LogInfo("Evicting lease for %s", evicted->GetClientAddress().ToString().AsCString());
+            mLeaseTable.Remove(*evicted);
+            mCounters.mLeasesEvicted++;
+        }
+
+        aLease = mLeaseTable.Add(aClientId.GetDuidLinkLayerAddress(), aIaNa.GetIaid(), expireTime);
+        OT_ASSERT(aLease != nullptr);
+
+        LogInfo("Added lease for %s", aLease->GetClientAddress().ToString().AsCString());
+        mCounters.mLeasesAdded++;
+        SignalLeasesChanged();
+    }
+
+    aLease->mPrefixAgentsMask    = mPrefixAgentsMask;
+    aLease->mHasPrefixAgentsMask = true;
+
+    ScheduleLeaseTimer();
+}
+
+void Server::ScheduleLeaseTimer(void)
+{
+    Lease *earliest = mLeaseTable.GetEarliest();
+
+    if (earliest == nullptr)
+    {
+        mLeaseTimer.Stop();
+    }
+    else if (!mLeaseTimer.IsRunning() || (mLeaseTimer.GetFireTime() != earliest->GetExpireTime()))
+    {
+        mLeaseTimer.FireAt(earliest->GetExpireTime());
+    }
+}
+
+void Server::HandleLeaseTimer(Timer &aTimer)
+{
+    aTimer.Get<Server>().HandleLeaseTimer();
+}
+
+void Server::HandleLeaseTimer(void)
+{
+    TimeMilli now = TimerMilli::GetNow();
+    Lease *   lease;
+
+    while (((lease = mLeaseTable.GetEarliest()) != nullptr) && (lease->GetExpireTime() <= now))
+    {
+        LogInfo("Lease for %s expired", lease->GetClientAddress().ToString().AsCString());
+        mLeaseTable.Remove(*lease);
+        mCounters.mLeasesExpired++;
+        SignalLeasesChanged();
+    }
+
+    ScheduleLeaseTimer();
+}
+
+void Server::SignalLeasesChanged(void)
+{
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+    // Saving is deferred to a tasklet so that a burst of lease changes
+    // (e.g., many clients soliciting at once) results in a single
+    // write to the non-volatile settings.
+    mSaveLeasesTasklet.Post();
+#endif
+}
+
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+
+void Server::HandleSaveLeasesTasklet(Tasklet &aTasklet)
+{
+    aTasklet.Get<Server>().SaveLeases();
+}
+
+void Server::SaveLeases(void)
+{
+    Settings::Dhcp6ServerLease leaseInfos[LeaseTable::kMaxLeases];
+    TimeMilli                  now = TimerMilli::GetNow();
+
+    for (uint16_t i = 0; i < mLeaseTable.GetNumLeases(); i++)
+    {
+        const Lease &lease = mLeaseTable.GetLeaseAt(i);
+
+        leaseInfos[i].Init();
+        leaseInfos[i].SetClientAddress(lease.GetClientAddress());
+        leaseInfos[i].SetIaid(lease.GetIaid());
+        leaseInfos[i].SetRemainingTime(
+            (lease.GetExpireTime() > now) ? Time::MsecToSec(lease.GetExpireTime() - now) : 0);
+    }
+
+    IgnoreError(Get<Settings>().SaveDhcp6ServerLeases(leaseInfos, mLeaseTable.GetNumLeases()));
+}
+
+void Server::RestoreLeases(void)
+{
+    Settings::Dhcp6ServerLease leaseInfos[LeaseTable::kMaxLeases];
+    uint16_t                   numLeases = GetArrayLength(leaseInfos);
+    TimeMilli                  now;
+
+    mLeasesRestored = true;
+
+    SuccessOrExit(Get<Settings>().ReadDhcp6ServerLeases(leaseInfos, numLeases));
+
+    now = TimerMilli::GetNow();
+
+    for (uint16_t i = 0; (i < numLeases) && !mLeaseTable.IsFull(); i++)
+    {
+        const Settings::Dhcp6ServerLease &leaseInfo     = leaseInfos[i];
+        uint32_t                          remainingTime = leaseInfo.GetRemainingTime();
+
+        // The time spent while the device was off is unknown, so a
+        // restored lease is given its remaining time as of when it
+        // was saved (capped to the current lease timeout).
+
+        remainingTime = OT_MIN(remainingTime, static_cast<uint32_t>(OPENTHREAD_CONFIG_DHCP6_SERVER_LEASE_TIMEOUT));
+
+        if ((remainingTime == 0) || (mLeaseTable.Find(leaseInfo.GetClientAddress()) != nullptr))
+        {
+            continue;
+        }
+
+        IgnoreReturnValue(mLeaseTable.Add(leaseInfo.GetClientAddress(), leaseInfo.GetIaid(),
+                                          now + Time::SecToMsec(remainingTime)));
+        mCounters.mLeasesRestored++;
+    }
+
+    LogInfo("Restored %u leases", mLeaseTable.GetNumLeases());
+    ScheduleLeaseTimer();
+
+exit:
+    return;
+}
+
+#endif // OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+
 void Server::ApplyMeshLocalPrefix(void)
 {
     for (PrefixAgent &prefixAgent : mPrefixAgents)
@@ -503,6 +724,150 @@ void Server::ApplyMeshLocalPrefix(void)
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// LeaseTable
+
+LeaseTable::LeaseTable(void)
+    : mNumLeases(0)
+{
+}
+
+LinkedList<Lease> &LeaseTable::GetBucket(const Mac::ExtAddress &aClientAddress)
+{
+    uint32_t hash = 0;
+
+    for (uint8_t byte : aClientAddress.m8)
+    {
+        hash = hash * 31 + byte;
+    }
+
+    return mBuckets[hash % kNumBuckets];
+}
+
+Lease *LeaseTable::Find(const Mac::ExtAddress &aClientAddress)
+{
+    return GetBucket(aClientAddress).FindMatching(aClientAddress);
+}
+
+Lease *LeaseTable::Add(const Mac::ExtAddress &aClientAddress, uint32_t aIaid, TimeMilli aExpireTime)
+{
+    Lease *lease = mLeasePool.Allocate();
+
+    VerifyOrExit(lease != nullptr);
+
+    lease->mClientAddress       = aClientAddress;
+    lease->mIaid                = aIaid;
+    lease->mExpireTime          = aExpireTime;
+    lease->mPrefixAgentsMask    = 0;
+    lease->mHasPrefixAgentsMask = false;
+
+    GetBucket(aClientAddress).Push(*lease);
+
+    SetHeapEntry(mNumLeases++, *lease);
+    SiftUp(lease->mHeapIndex);
+
+exit:
+    return lease;
+}
+
+void LeaseTable::Remove(Lease &aLease)
+{
+    uint16_t index = aLease.mHeapIndex;
+
+    OT_ASSERT((index < mNumLeases) && (mExpiryHeap[index] == &aLease));
+
+    IgnoreError(GetBucket(aLease.mClientAddress).Remove(aLease));
+
+    // Move the last heap entry in place of the removed lease and
+    // restore the heap order (it may need to move either way).
+
+    mNumLeases--;
+
+    if (index < mNumLeases)
+    {
+        SetHeapEntry(index, *mExpiryHeap[mNumLeases]);
+        SiftUp(index);
+        SiftDown(index);
+    }
+
+    mLeasePool.Free(aLease);
+}
+
+void LeaseTable::Clear(void)
+{
+    for (LinkedList<Lease> &bucket : mBuckets)
+    {
+        bucket.Clear();
+    }
+
+    mLeasePool.FreeAll();
+    mNumLeases = 0;
+}
+
+void LeaseTable::UpdateExpireTime(Lease &aLease, TimeMilli aExpireTime)
+{
+    aLease.mExpireTime = aExpireTime;
+
+    SiftUp(aLease.mHeapIndex);
+    SiftDown(aLease.mHeapIndex);
+}
+
+void LeaseTable::SetHeapEntry(uint16_t aIndex, Lease &aLease)
+{
+    mExpiryHeap[aIndex] = &aLease;
+    aLease.mHeapIndex   = aIndex;
+}
+
+void LeaseTable::SiftUp(uint16_t aIndex)
+{
+    Lease *lease = mExpiryHeap[aIndex];
+
+    while (aIndex > 0)
+    {
+        uint16_t parent = (aIndex - 1) / 2;
+
+        if (!(lease->mExpireTime < mExpiryHeap[parent]->mExpireTime))
+        {
+            break;
+        }
+
+        SetHeapEntry(aIndex, *mExpiryHeap[parent]);
+        aIndex = parent;
+    }
+
+    SetHeapEntry(aIndex, *lease);
+}
+
+void LeaseTable::SiftDown(uint16_t aIndex)
+{
+    Lease *lease = mExpiryHeap[aIndex];
+
+    while (true)
+    {
+        uint16_t child = 2 * aIndex + 1;
+
+        if (child >= mNumLeases)
+        {
+            break;
+        }
+
+        if ((child + 1 < mNumLeases) && (mExpiryHeap[child + 1]->mExpireTime < mExpiryHeap[child]->mExpireTime))
+        {
+            child++;
+        }
+
+        if (!(mExpiryHeap[child]->mExpireTime < lease->mExpireTime))
+        {
+            break;
+        }
+
+        SetHeapEntry(aIndex, *mExpiryHeap[child]);
+        aIndex = child;
+    }
+
+    SetHeapEntry(aIndex, *lease);
+}
+
 } // namespace Dhcp6
 } // namespace ot
 
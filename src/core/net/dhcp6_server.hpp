@@ -38,8 +38,14 @@
 
 #if OPENTHREAD_CONFIG_DHCP6_SERVER_ENABLE
 
+#include "common/clearable.hpp"
+#include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/pool.hpp"
+#include "common/tasklet.hpp"
+#include "common/time.hpp"
+#include "common/timer.hpp"
 #include "mac/mac.hpp"
 #include "mac/mac_types.hpp"
 #include "net/dhcp6.hpp"
@@ -63,9 +69,202 @@ namespace Dhcp6 {
  *
  */
 
+class LeaseTable;
+
+/**
+ * This class represents a DHCPv6 server lease.
+ *
+ * A lease records a client (identified by the link-layer address in its DUID) that was assigned addresses by the
+ * server, along with the time the lease expires.
+ *
+ */
+class Lease : public LinkedListEntry<Lease>, private NonCopyable
+{
+    friend class LeaseTable;
+    friend class LinkedListEntry<Lease>;
+    friend class Server;
+
+public:
+    /**
+     * This method returns the client extended address (from the client DUID).
+     *
+     * @returns The client extended address.
+     *
+     */
+    const Mac::ExtAddress &GetClientAddress(void) const { return mClientAddress; }
+
+    /**
+     * This method returns the client IAID (Identity Association Identifier) of the lease.
+     *
+     * @returns The client IAID.
+     *
+     */
+    uint32_t GetIaid(void) const { return mIaid; }
+
+    /**
+     * This method returns the time the lease expires.
+     *
+     * @returns The lease expire time.
+     *
+     */
+    TimeMilli GetExpireTime(void) const { return mExpireTime; }
+
+    /**
+     * This method indicates whether or not the lease is for a given client.
+     *
+     * @param[in] aClientAddress  The client extended address.
+     *
+     * @retval TRUE   The lease is for @p aClientAddress.
+     * @retval FALSE  The lease is not for @p aClientAddress.
+     *
+     */
+    bool Matches(const Mac::ExtAddress &aClientAddress) const { return mClientAddress == aClientAddress; }
+
+private:
+    Lease *         mNext;
+    Mac::ExtAddress mClientAddress;
+    uint32_t        mIaid;
+    TimeMilli       mExpireTime;
+    uint16_t        mHeapIndex;          // Index in `LeaseTable::mExpiryHeap`.
+    uint8_t         mPrefixAgentsMask;   // Prefix agents assigned in the last reply (used by `Server`).
+    bool            mHasPrefixAgentsMask; // Whether `mPrefixAgentsMask` matches the current prefix agents.
+};
+
+/**
+ * This class implements the DHCPv6 server lease table.
+ *
+ * Leases are hashed by the client extended address for lookup, and kept in a binary min-heap ordered by their expire
+ * time so that the earliest lease to expire is always readily available.
+ *
+ */
+class LeaseTable : private NonCopyable
+{
+public:
+    static constexpr uint16_t kMaxLeases = OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_LEASES; ///< Max number of leases.
+
+    /**
+     * This constructor initializes the `LeaseTable` as empty.
+     *
+     */
+    LeaseTable(void);
+
+    /**
+     * This method returns the number of leases in the table.
+     *
+     * @returns The number of leases.
+     *
+     */
+    uint16_t GetNumLeases(void) const { return mNumLeases; }
+
+    /**
+     * This method indicates whether or not the table is full.
+     *
+     * @retval TRUE   The table is full.
+     * @retval FALSE  The table is not full.
+     *
+     */
+    bool IsFull(void) const { return (mNumLeases == kMaxLeases); }
+
+    /**
+     * This method finds the lease for a given client.
+     *
+     * @param[in] aClientAddress  The client extended address.
+     *
+     * @returns A pointer to the lease, or `nullptr` if there is no lease for @p aClientAddress.
+     *
+     */
+    Lease *Find(const Mac::ExtAddress &aClientAddress);
+
+    /**
+     * This method adds a new lease to the table.
+     *
+     * The caller MUST ensure there is no lease for @p aClientAddress in the table.
+     *
+     * @param[in] aClientAddress  The client extended address.
+     * @param[in] aIaid           The client IAID.
+     * @param[in] aExpireTime     The lease expire time.
+     *
+     * @returns A pointer to the new lease, or `nullptr` if the table is full.
+     *
+     */
+    Lease *Add(const Mac::ExtAddress &aClientAddress, uint32_t aIaid, TimeMilli aExpireTime);
+
+    /**
+     * This method removes a lease from the table.
+     *
+     * @param[in] aLease  The lease to remove (MUST be in the table).
+     *
+     */
+    void Remove(Lease &aLease);
+
+    /**
+     * This method removes all leases from the table.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method updates the expire time of a lease.
+     *
+     * @param[in] aLease       The lease to update (MUST be in the table).
+     * @param[in] aExpireTime  The new lease expire time.
+     *
+     */
+    void UpdateExpireTime(Lease &aLease, TimeMilli aExpireTime);
+
+    /**
+     * This method returns the lease which expires first.
+     *
+     * @returns A pointer to the lease which expires first, or `nullptr` if the table is empty.
+     *
+     */
+    Lease *GetEarliest(void) { return (mNumLeases > 0) ? mExpiryHeap[0] : nullptr; }
+
+    /**
+     * This method returns the lease at a given index (in no particular order).
+     *
+     * @param[in] aIndex  The index (MUST be smaller than `GetNumLeases()`).
+     *
+     * @returns A reference to the lease.
+     *
+     */
+    Lease &GetLeaseAt(uint16_t aIndex) { return *mExpiryHeap[aIndex]; }
+
+private:
+    static constexpr uint16_t kNumBuckets = 8;
+
+    static_assert(kMaxLeases > 0, "OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_LEASES must not be zero");
+
+    LinkedList<Lease> &GetBucket(const Mac::ExtAddress &aClientAddress);
+    void               SetHeapEntry(uint16_t aIndex, Lease &aLease);
+    void               SiftUp(uint16_t aIndex);
+    void               SiftDown(uint16_t aIndex);
+
+    Pool<Lease, kMaxLeases> mLeasePool;
+    LinkedList<Lease>       mBuckets[kNumBuckets];
+    Lease *                 mExpiryHeap[kMaxLeases];
+    uint16_t                mNumLeases;
+};
+
 class Server : public InstanceLocator, private NonCopyable
 {
 public:
+    /**
+     * This structure represents the DHCPv6 server counters.
+     *
+     */
+    struct Counters : public Clearable<Counters>
+    {
+        uint32_t mSolicits;        ///< Number of Solicit messages processed.
+        uint32_t mReplies;         ///< Number of Reply messages sent.
+        uint32_t mFastPathReplies; ///< Number of Reply messages sent from an existing lease.
+        uint32_t mLeasesAdded;     ///< Number of new leases.
+        uint32_t mLeasesRenewed;   ///< Number of existing leases renewed.
+        uint32_t mLeasesExpired;   ///< Number of leases removed on expiry.
+        uint32_t mLeasesEvicted;   ///< Number of leases evicted to make room for a new client.
+        uint32_t mLeasesRestored;  ///< Number of leases restored from non-volatile settings.
+    };
+
     /**
      * This constructor initializes the object.
      *
@@ -86,6 +285,28 @@ public:
      */
     void ApplyMeshLocalPrefix(void);
 
+    /**
+     * This method returns the lease table.
+     *
+     * @returns A reference to the lease table.
+     *
+     */
+    LeaseTable &GetLeaseTable(void) { return mLeaseTable; }
+
+    /**
+     * This method returns the DHCPv6 server counters.
+     *
+     * @returns A reference to the counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the DHCPv6 server counters.
+     *
+     */
+    void ResetCounters(void) { mCounters.Clear(); }
+
 private:
     class PrefixAgent
     {
@@ -181,11 +402,30 @@ private:
     };
 
     static constexpr uint16_t kNumPrefixes = OPENTHREAD_CONFIG_DHCP6_SERVER_NUM_PREFIXES;
+    static constexpr uint32_t kLeaseTimeout = Time::SecToMsec(OPENTHREAD_CONFIG_DHCP6_SERVER_LEASE_TIMEOUT);
+
+    static_assert(kNumPrefixes <= 8, "Prefix agents mask (`uint8_t`) is too small for the number of prefixes");
+    static_assert(OPENTHREAD_CONFIG_DHCP6_SERVER_LEASE_TIMEOUT <= Time::MsecToSec(Timer::kMaxDelay),
+                  "OPENTHREAD_CONFIG_DHCP6_SERVER_LEASE_TIMEOUT is too long");
 
     void Start(void);
     void Stop(void);
 
-    void AddPrefixAgent(const Ip6::Prefix &aIp6Prefix, const Lowpan::Context &aContext);
+    bool AddPrefixAgent(const Ip6::Prefix &aIp6Prefix, const Lowpan::Context &aContext);
+    void HandlePrefixAgentsChanged(void);
+
+    void UpdateLease(const ClientIdentifier &aClientId, const IaNa &aIaNa, Lease *aLease);
+    void ScheduleLeaseTimer(void);
+    void HandleLeaseTimer(void);
+    void SignalLeasesChanged(void);
+
+    static void HandleLeaseTimer(Timer &aTimer);
+
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+    void        RestoreLeases(void);
+    void        SaveLeases(void);
+    static void HandleSaveLeasesTasklet(Tasklet &aTasklet);
+#endif
 
     Error AppendHeader(Message &aMessage, const TransactionId &aTransactionId);
     Error AppendClientIdentifier(Message &aMessage, ClientIdentifier &aClientId);
@@ -219,6 +459,14 @@ private:
     PrefixAgent mPrefixAgents[kNumPrefixes];
     uint8_t     mPrefixAgentsCount;
     uint8_t     mPrefixAgentsMask;
+
+    LeaseTable mLeaseTable;
+    TimerMilli mLeaseTimer;
+    Counters   mCounters;
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+    Tasklet mSaveLeasesTasklet;
+    bool    mLeasesRestored;
+#endif
 };
 
 /**
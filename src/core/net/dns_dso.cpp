@@ -91,8 +91,15 @@ Dso::Connection::Connection(Instance &           aInstance,
     , mPeerSockAddr(aPeerSockAddr)
     , mState(kStateDisconnected)
     , mIsServer(false)
+    , mInTimerHeap(false)
     , mInactivity(aInactivityTimeout)
     , mKeepAlive(aKeepAliveInterval)
+    , mHeapChild(nullptr)
+    , mHeapSibling(nullptr)
+    , mHeapPrev(nullptr)
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+    , mTxBatch(nullptr)
+#endif
 {
     OT_ASSERT(aKeepAliveInterval >= kMinKeepAliveInterval);
     Init(/* aIsServer */ false);
@@ -162,7 +169,7 @@ void Dso::Connection::Connect(void)
     OT_ASSERT(mState == kStateDisconnected);
 
     Init(/* aIsServer */ false);
-    Get<Dso>().mClientConnections.Push(*this);
+    Get<Dso>().mClientConnections.Add(*this);
     MarkAsConnecting();
     otPlatDsoConnect(this, &mPeerSockAddr);
 }
@@ -172,7 +179,7 @@ void Dso::Connection::Accept(void)
     OT_ASSERT(mState == kStateDisconnected);
 
     Init(/* aIsServer */ true);
-    Get<Dso>().mServerConnections.Push(*this);
+    Get<Dso>().mServerConnections.Add(*this);
     MarkAsConnecting();
 }
 
@@ -185,7 +192,7 @@ void Dso::Connection::MarkAsConnecting(void)
     // within the timeout, we consider it as failure and close it).
 
     mKeepAlive.SetExpirationTime(TimerMilli::GetNow() + kConnectingTimeout);
-    Get<Dso>().mTimer.FireAtIfEarlier(mKeepAlive.GetExpirationTime());
+    UpdateNextFireTime();
 
     // Wait for `HandleConnected()` or `HandleDisconnected()` callbacks
     // or timeout.
@@ -206,6 +213,15 @@ void Dso::Connection::Disconnect(DisconnectMode aMode, DisconnectReason aReason)
     VerifyOrExit(mState != kStateDisconnected);
 
     mDisconnectReason = aReason;
+
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+    if (aMode == kGracefullyClose)
+    {
+        // Deliver any queued messages before closing the connection.
+        SendTxBatch();
+    }
+#endif
+
     MarkAsDisconnected();
 
     otPlatDsoDisconnect(this, MapEnum(aMode));
@@ -246,15 +262,20 @@ void Dso::Connection::MarkAsDisconnected(void)
 {
     if (IsClient())
     {
-        IgnoreError(Get<Dso>().mClientConnections.Remove(*this));
+        Get<Dso>().mClientConnections.Remove(*this);
     }
     else
     {
-        IgnoreError(Get<Dso>().mServerConnections.Remove(*this));
+        Get<Dso>().mServerConnections.Remove(*this);
     }
 
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+    DiscardTxBatch();
+#endif
+
     mPendingRequests.Clear();
     SetState(kStateDisconnected);
+    UpdateNextFireTime();
 
     LogInfo("Disconnect reason: %s", DisconnectReasonToString(mDisconnectReason));
 }
@@ -288,9 +309,11 @@ Error Dso::Connection::SendUnidirectionalMessage(Message &aMessage)
     return SendMessage(aMessage, kUnidirectionalMessage, messageId);
 }
 
-Error Dso::Connection::SendResponseMessage(Message &aMessage, MessageId aResponseId)
+Error Dso::Connection::SendResponseMessage(Message &             aMessage,
+                                           MessageId             aResponseId,
+                                           Dns::Header::Response aResponseCode)
 {
-    return SendMessage(aMessage, kResponseMessage, aResponseId);
+    return SendMessage(aMessage, kResponseMessage, aResponseId, aResponseCode);
 }
 
 void Dso::Connection::SetLongLivedOperation(bool aLongLivedOperation)
@@ -301,18 +324,7 @@ void Dso::Connection::SetLongLivedOperation(bool aLongLivedOperation)
 
     LogInfo("Long-lived operation %s", mLongLivedOperation ? "started" : "stopped");
 
-    if (!mLongLivedOperation)
-    {
-        TimeMilli now = TimerMilli::GetNow();
-        TimeMilli nextTime;
-
-        nextTime = GetNextFireTime(now);
-
-        if (nextTime != now.GetDistantFuture())
-        {
-            Get<Dso>().mTimer.FireAtIfEarlier(nextTime);
-        }
-    }
+    UpdateNextFireTime();
 
 exit:
     return;
@@ -568,6 +580,12 @@ Error Dso::Connection::SendMessage(Message &             aMessage,
 
     SuccessOrExit(error = AppendPadding(aMessage));
 
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+    // Prepend the length field so the message can be added to the tx
+    // batch as is (see `AddToTxBatch()`).
+    SuccessOrExit(error = aMessage.Prepend<uint16_t>(HostSwap16(aMessage.GetLength())));
+#endif
+
     // Update `mPendingRequests` list with the new request info
 
     if (aMessageType == kRequestMessage)
@@ -611,7 +629,11 @@ Error Dso::Connection::SendMessage(Message &             aMessage,
 
     ResetTimeouts(/* aIsKeepAliveMessage*/ (primaryTlvType == KeepAliveTlv::kType));
 
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+    AddToTxBatch(aMessage);
+#else
     otPlatDsoSend(this, &aMessage);
+#endif
 
     // Signal any state changes. This is done at the very end when the
     // `SendMessage()` is fully processed (all state and local
@@ -861,6 +883,15 @@ Error Dso::Connection::ProcessResponseMessage(const Dns::Header &aHeader,
     VerifyOrExit(aHeader.GetMessageId() != 0);
     VerifyOrExit(mPendingRequests.Contains(aHeader.GetMessageId(), requestPrimaryTlvType));
 
+    // A response with no TLVs (e.g., a SUBSCRIBE response in DNS
+    // Push) only contains the Encryption Padding TLV, which is not a
+    // primary TLV.
+
+    if (aPrimaryTlvType == EncryptionPaddingTlv::kType)
+    {
+        aPrimaryTlvType = Tlv::kReservedType;
+    }
+
     // If the response has no error and contains a primary TLV, it
     // MUST match the request primary TLV.
 
@@ -1130,6 +1161,7 @@ void Dso::Connection::AdjustInactivityTimeout(uint32_t aNewTimeout)
     }
 
     mInactivity.SetExpirationTime(newExpiration);
+    UpdateNextFireTime();
 
 exit:
     return;
@@ -1149,7 +1181,6 @@ uint32_t Dso::Connection::CalculateServerInactivityWaitTime(void) const
 void Dso::Connection::ResetTimeouts(bool aIsKeepAliveMessage)
 {
     TimeMilli now = TimerMilli::GetNow();
-    TimeMilli nextTime;
 
     // At both servers and clients, the generation or reception of any
     // complete DNS message resets both timers for that DSO
@@ -1192,12 +1223,7 @@ void Dso::Connection::ResetTimeouts(bool aIsKeepAliveMessage)
         }
     }
 
-    nextTime = GetNextFireTime(now);
-
-    if (nextTime != now.GetDistantFuture())
-    {
-        Get<Dso>().mTimer.FireAtIfEarlier(nextTime);
-    }
+    UpdateNextFireTime();
 }
 
 TimeMilli Dso::Connection::GetNextFireTime(TimeMilli aNow) const
@@ -1244,7 +1270,12 @@ exit:
     return nextTime;
 }
 
-void Dso::Connection::HandleTimer(TimeMilli aNow, TimeMilli &aNextTime)
+void Dso::Connection::UpdateNextFireTime(void)
+{
+    Get<Dso>().UpdateTimer(*this, GetNextFireTime(TimerMilli::GetNow()));
+}
+
+void Dso::Connection::HandleTimer(TimeMilli aNow)
 {
     switch (mState)
     {
@@ -1311,7 +1342,18 @@ void Dso::Connection::HandleTimer(TimeMilli aNow, TimeMilli &aNextTime)
     }
 
 exit:
-    aNextTime = OT_MIN(aNextTime, GetNextFireTime(aNow));
+    // If the connection is still expecting an (already expired)
+    // timeout (e.g., it failed to send a Keep Alive message), it is
+    // scheduled again after a short delay (instead of now) to ensure
+    // `Dso::HandleTimer()` does not loop.
+
+    if (mState != kStateDisconnected)
+    {
+        TimeMilli nextTime = GetNextFireTime(aNow);
+
+        Get<Dso>().UpdateTimer(*this, (nextTime <= aNow) ? aNow + 1 : nextTime);
+    }
+
     SignalAnyStateChange();
 }
 
@@ -1449,6 +1491,9 @@ Dso::Dso(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mAcceptHandler(nullptr)
     , mTimer(aInstance, HandleTimer)
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+    , mTxBatchTasklet(aInstance, HandleTxBatchTasklet)
+#endif
 {
 }
 
@@ -1465,12 +1510,12 @@ void Dso::StopListening(void)
 
 Dso::Connection *Dso::FindClientConnection(const Ip6::SockAddr &aPeerSockAddr)
 {
-    return mClientConnections.FindMatching(aPeerSockAddr);
+    return mClientConnections.Find(aPeerSockAddr);
 }
 
 Dso::Connection *Dso::FindServerConnection(const Ip6::SockAddr &aPeerSockAddr)
 {
-    return mServerConnections.FindMatching(aPeerSockAddr);
+    return mServerConnections.Find(aPeerSockAddr);
 }
 
 Dso::Connection *Dso::AcceptConnection(const Ip6::SockAddr &aPeerSockAddr)
@@ -1494,29 +1539,285 @@ void Dso::HandleTimer(Timer &aTimer)
 
 void Dso::HandleTimer(void)
 {
-    TimeMilli   now      = TimerMilli::GetNow();
-    TimeMilli   nextTime = now.GetDistantFuture();
+    TimeMilli   now = TimerMilli::GetNow();
     Connection *conn;
-    Connection *next;
 
-    for (conn = mClientConnections.GetHead(); conn != nullptr; conn = next)
+    // Process the connections whose fire time has been reached in
+    // order. `TimerHeap` is re-checked after each connection since
+    // handling one connection can change others (e.g., a callback
+    // disconnecting a connection).
+
+    while (((conn = mTimerHeap.GetEarliest()) != nullptr) && (conn->mFireTime <= now))
+    {
+        // `conn` MUST NOT be used after `HandleTimer()` since it may
+        // be freed from the `HandleDisconnected` callback.
+
+        mTimerHeap.Remove(*conn);
+        conn->HandleTimer(now);
+    }
+
+    ScheduleTimer();
+}
+
+void Dso::UpdateTimer(Connection &aConnection, TimeMilli aFireTime)
+{
+    if (aConnection.mInTimerHeap)
     {
-        next = conn->GetNext();
-        conn->HandleTimer(now, nextTime);
+        mTimerHeap.Remove(aConnection);
     }
 
-    for (conn = mServerConnections.GetHead(); conn != nullptr; conn = next)
+    if (aFireTime != TimerMilli::GetNow().GetDistantFuture())
     {
-        next = conn->GetNext();
-        conn->HandleTimer(now, nextTime);
+        aConnection.mFireTime = aFireTime;
+        mTimerHeap.Add(aConnection);
     }
 
-    if (nextTime != now.GetDistantFuture())
+    ScheduleTimer();
+}
+
+void Dso::ScheduleTimer(void)
+{
+    if (mTimerHeap.IsEmpty())
+    {
+        mTimer.Stop();
+    }
+    else if (!mTimer.IsRunning() || (mTimer.GetFireTime() != mTimerHeap.GetEarliest()->mFireTime))
     {
-        mTimer.FireAtIfEarlier(nextTime);
+        mTimer.FireAt(mTimerHeap.GetEarliest()->mFireTime);
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// Dso::ConnectionTable
+
+LinkedList<Dso::Connection> &Dso::ConnectionTable::GetBucket(const Ip6::SockAddr &aPeerSockAddr)
+{
+    const uint8_t *bytes = aPeerSockAddr.GetAddress().GetBytes();
+    uint32_t       hash  = aPeerSockAddr.GetPort();
+
+    for (uint8_t i = 0; i < sizeof(Ip6::Address); i++)
+    {
+        hash = hash * 31 + bytes[i];
+    }
+
+    return mBuckets[hash % kNumBuckets];
+}
+
+void Dso::ConnectionTable::Remove(Connection &aConnection)
+{
+    IgnoreError(GetBucket(aConnection.GetPeerSockAddr()).Remove(aConnection));
+}
+
+Dso::Connection *Dso::ConnectionTable::Find(const Ip6::SockAddr &aPeerSockAddr)
+{
+    return GetBucket(aPeerSockAddr).FindMatching(aPeerSockAddr);
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Dso::TimerHeap
+
+void Dso::TimerHeap::Add(Connection &aConnection)
+{
+    OT_ASSERT(!aConnection.mInTimerHeap);
+
+    aConnection.mInTimerHeap = true;
+    aConnection.mHeapChild   = nullptr;
+    aConnection.mHeapSibling = nullptr;
+    aConnection.mHeapPrev    = nullptr;
+
+    mRoot = Meld(mRoot, &aConnection);
+}
+
+void Dso::TimerHeap::Remove(Connection &aConnection)
+{
+    Connection *subHeap;
+
+    OT_ASSERT(aConnection.mInTimerHeap);
+
+    aConnection.mInTimerHeap = false;
+
+    if (&aConnection == mRoot)
+    {
+        mRoot = MergePairs(aConnection.mHeapChild);
+        ExitNow();
+    }
+
+    // Detach the connection (along with its sub-heap) from its parent
+    // or its previous sibling, then merge its children back into the
+    // heap.
+
+    if (aConnection.mHeapPrev->mHeapChild == &aConnection)
+    {
+        aConnection.mHeapPrev->mHeapChild = aConnection.mHeapSibling;
+    }
+    else
+    {
+        aConnection.mHeapPrev->mHeapSibling = aConnection.mHeapSibling;
+    }
+
+    if (aConnection.mHeapSibling != nullptr)
+    {
+        aConnection.mHeapSibling->mHeapPrev = aConnection.mHeapPrev;
+    }
+
+    subHeap = MergePairs(aConnection.mHeapChild);
+    mRoot   = Meld(mRoot, subHeap);
+
+exit:
+    if (mRoot != nullptr)
+    {
+        mRoot->mHeapPrev = nullptr;
+    }
+}
+
+Dso::Connection *Dso::TimerHeap::Meld(Connection *aFirst, Connection *aSecond)
+{
+    // Melds two heaps (given by their roots) and returns the new root.
+    // The root with later fire time becomes the first child of the
+    // other root.
+
+    Connection *root = aFirst;
+
+    VerifyOrExit(aFirst != nullptr, root = aSecond);
+    VerifyOrExit(aSecond != nullptr);
+
+    if (aSecond->mFireTime < aFirst->mFireTime)
+    {
+        root    = aSecond;
+        aSecond = aFirst;
+    }
+
+    aSecond->mHeapPrev    = root;
+    aSecond->mHeapSibling = root->mHeapChild;
+
+    if (root->mHeapChild != nullptr)
+    {
+        root->mHeapChild->mHeapPrev = aSecond;
+    }
+
+    root->mHeapChild = aSecond;
+
+exit:
+    return root;
+}
+
+Dso::Connection *Dso::TimerHeap::MergePairs(Connection *aFirst)
+{
+    // Merges a list of sibling sub-heaps (starting from `aFirst`)
+    // into a single heap using the standard two-pass pairing: first
+    // meld siblings in pairs from left to right, then meld the
+    // resulting heaps from right to left. During the first pass
+    // the melded pairs are kept in a list (linked backwards through
+    // `mHeapPrev`).
+
+    Connection *pairs = nullptr;
+    Connection *root  = nullptr;
+
+    while (aFirst != nullptr)
+    {
+        Connection *second = aFirst->mHeapSibling;
+        Connection *next   = (second != nullptr) ? second->mHeapSibling : nullptr;
+        Connection *pair;
+
+        aFirst->mHeapSibling = nullptr;
+
+        if (second != nullptr)
+        {
+            second->mHeapSibling = nullptr;
+        }
+
+        pair            = Meld(aFirst, second);
+        pair->mHeapPrev = pairs;
+        pairs           = pair;
+        aFirst          = next;
+    }
+
+    while (pairs != nullptr)
+    {
+        Connection *prev = pairs->mHeapPrev;
+
+        pairs->mHeapPrev = nullptr;
+        root             = Meld(root, pairs);
+        pairs            = prev;
+    }
+
+    return root;
+}
+
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+
+//---------------------------------------------------------------------------------------------------------------------
+// Tx batching
+
+void Dso::Connection::AddToTxBatch(Message &aMessage)
+{
+    // `aMessage` is already prefixed with its length field. It is
+    // appended to the current batch. If there is no batch yet (or
+    // the message cannot be appended due to lack of buffers) the
+    // message itself starts a new batch. The batch is sent from
+    // `mTxBatchTasklet` or once it reaches `kMaxTxBatchLength`.
+
+    if ((mTxBatch != nullptr) && (mTxBatch->AppendBytesFromMessage(aMessage, 0, aMessage.GetLength()) == kErrorNone))
+    {
+        aMessage.Free();
+    }
+    else
+    {
+        SendTxBatch();
+        mTxBatch = &aMessage;
+        Get<Dso>().mTxBatchTasklet.Post();
+    }
+
+    if (mTxBatch->GetLength() >= kMaxTxBatchLength)
+    {
+        SendTxBatch();
+    }
+}
+
+void Dso::Connection::SendTxBatch(void)
+{
+    Message *batch = mTxBatch;
+
+    VerifyOrExit(batch != nullptr);
+    mTxBatch = nullptr;
+
+    LogInfo("Sending batch (len:%u) to %s", batch->GetLength(), mPeerSockAddr.ToString().AsCString());
+    otPlatDsoSendBatch(this, batch);
+
+exit:
+    return;
+}
+
+void Dso::Connection::DiscardTxBatch(void)
+{
+    FreeMessage(mTxBatch);
+    mTxBatch = nullptr;
+}
+
+void Dso::ConnectionTable::SendTxBatches(void)
+{
+    for (LinkedList<Connection> &bucket : mBuckets)
+    {
+        Connection *next;
+
+        for (Connection *conn = bucket.GetHead(); conn != nullptr; conn = next)
+        {
+            next = conn->GetNext();
+            conn->SendTxBatch();
+        }
+    }
+}
+
+void Dso::HandleTxBatchTasklet(Tasklet &aTasklet)
+{
+    Dso &dso = aTasklet.Get<Dso>();
+
+    dso.mClientConnections.SendTxBatches();
+    dso.mServerConnections.SendTxBatches();
+}
+
+#endif // OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+
 } // namespace Dns
 } // namespace ot
 
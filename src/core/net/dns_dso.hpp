@@ -43,6 +43,7 @@
 #include "common/locator.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
+#include "common/tasklet.hpp"
 #include "common/timer.hpp"
 #include "net/dns_types.hpp"
 #include "net/socket.hpp"
@@ -134,10 +135,14 @@ public:
     public:
         typedef uint16_t Type; ///< DSO TLV type.
 
-        static constexpr Type kReservedType          = 0; ///< Reserved TLV type.
-        static constexpr Type kKeepAliveType         = 1; ///< Keep Alive TLV type.
-        static constexpr Type kRetryDelayType        = 2; ///< Retry Delay TLV type.
-        static constexpr Type kEncryptionPaddingType = 3; ///< Encryption Padding TLV type.
+        static constexpr Type kReservedType          = 0;    ///< Reserved TLV type.
+        static constexpr Type kKeepAliveType         = 1;    ///< Keep Alive TLV type.
+        static constexpr Type kRetryDelayType        = 2;    ///< Retry Delay TLV type.
+        static constexpr Type kEncryptionPaddingType = 3;    ///< Encryption Padding TLV type.
+        static constexpr Type kSubscribeType         = 0x40; ///< DNS Push SUBSCRIBE TLV type (RFC 8765).
+        static constexpr Type kPushType              = 0x41; ///< DNS Push PUSH TLV type (RFC 8765).
+        static constexpr Type kUnsubscribeType       = 0x42; ///< DNS Push UNSUBSCRIBE TLV type (RFC 8765).
+        static constexpr Type kReconfirmType         = 0x43; ///< DNS Push RECONFIRM TLV type (RFC 8765).
 
         /**
          * This method initializes the `Tlv` instance with a given type and length.
@@ -579,14 +584,17 @@ public:
          * On success (when this method returns `kErrorNone`) it takes the ownership of the @p aMessage. On failure the
          * caller still owns the message and may need to free it.
          *
-         * @param[in] aMessage      The DSO response message to send.
-         * @param[in] aResponseId   The message ID to use for the response.
+         * @param[in] aMessage       The DSO response message to send.
+         * @param[in] aResponseId    The message ID to use for the response.
+         * @param[in] aResponseCode  The response code to use in the DNS header.
          *
          * @retval  kErrorNone      Successfully sent the DSO response message.
          * @retval  kErrorNoBufs    Failed to allocate new buffer to prepare the message (append header or padding).
          *
          */
-        Error SendResponseMessage(Message &aMessage, MessageId aResponseId);
+        Error SendResponseMessage(Message &             aMessage,
+                                  MessageId             aResponseId,
+                                  Dns::Header::Response aResponseCode = Dns::Header::kResponseSuccess);
 
         /**
          * This method returns the Keep Alive timeout interval (in msec).
@@ -811,7 +819,18 @@ public:
         uint32_t  CalculateServerInactivityWaitTime(void) const;
         void      ResetTimeouts(bool aIsKeepAliveMessage);
         TimeMilli GetNextFireTime(TimeMilli aNow) const;
-        void      HandleTimer(TimeMilli aNow, TimeMilli &aNextTime);
+        void      UpdateNextFireTime(void);
+        void      HandleTimer(TimeMilli aNow);
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+        // A tx batch is passed to platform early once it reaches this
+        // length so that the queued messages do not use up too many
+        // message buffers.
+        static constexpr uint16_t kMaxTxBatchLength = 1024;
+
+        void AddToTxBatch(Message &aMessage);
+        void SendTxBatch(void);
+        void DiscardTxBatch(void);
+#endif
 
         bool Matches(const Ip6::SockAddr &aPeerSockAddr) const { return mPeerSockAddr == aPeerSockAddr; }
 
@@ -828,11 +847,19 @@ public:
         bool                  mIsServer : 1;
         bool                  mStateDidChange : 1;
         bool                  mLongLivedOperation : 1;
+        bool                  mInTimerHeap : 1;
         Timeout               mInactivity;
         Timeout               mKeepAlive;
         uint32_t              mRetryDelay;
         Dns::Header::Response mRetryDelayErrorCode;
         DisconnectReason      mDisconnectReason;
+        TimeMilli             mFireTime;    // Next fire time (key in `Dso::TimerHeap`).
+        Connection *          mHeapChild;   // First child in `Dso::TimerHeap`.
+        Connection *          mHeapSibling; // Next sibling in `Dso::TimerHeap`.
+        Connection *          mHeapPrev;    // Previous sibling (or parent if first child) in `Dso::TimerHeap`.
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+        Message *mTxBatch; // Messages queued for tx (each prefixed with its length field).
+#endif
     };
 
     /**
@@ -950,15 +977,72 @@ private:
         // Value is padding bytes (zero) based on the length.
     } OT_TOOL_PACKED_END;
 
+    // Connections hashed by their peer socket address. Each bucket is
+    // a linked list (using `Connection::mNext`).
+    class ConnectionTable
+    {
+    public:
+        static constexpr uint16_t kNumBuckets = OPENTHREAD_CONFIG_DNS_DSO_CONNECTION_HASH_TABLE_SIZE;
+
+        void        Add(Connection &aConnection) { GetBucket(aConnection.GetPeerSockAddr()).Push(aConnection); }
+        void        Remove(Connection &aConnection);
+        Connection *Find(const Ip6::SockAddr &aPeerSockAddr);
+
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+        void SendTxBatches(void);
+#endif
+
+    private:
+        static_assert(kNumBuckets > 0, "OPENTHREAD_CONFIG_DNS_DSO_CONNECTION_HASH_TABLE_SIZE must not be zero");
+
+        LinkedList<Connection> &GetBucket(const Ip6::SockAddr &aPeerSockAddr);
+
+        LinkedList<Connection> mBuckets[kNumBuckets];
+    };
+
+    // Pairing heap of connections ordered by their next fire time
+    // (`Connection::mFireTime`). The heap is intrusive (it uses the
+    // `mHeap{Child/Sibling/Prev}` pointers in `Connection`) so adding,
+    // removing, or re-scheduling a connection does not require any
+    // extra storage.
+    class TimerHeap
+    {
+    public:
+        TimerHeap(void)
+            : mRoot(nullptr)
+        {
+        }
+
+        bool        IsEmpty(void) const { return (mRoot == nullptr); }
+        Connection *GetEarliest(void) { return mRoot; }
+        void        Add(Connection &aConnection);
+        void        Remove(Connection &aConnection);
+
+    private:
+        static Connection *Meld(Connection *aFirst, Connection *aSecond);
+        static Connection *MergePairs(Connection *aFirst);
+
+        Connection *mRoot;
+    };
+
     Connection *AcceptConnection(const Ip6::SockAddr &aPeerSockAddr);
+    void        UpdateTimer(Connection &aConnection, TimeMilli aFireTime);
+    void        ScheduleTimer(void);
 
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+    static void HandleTxBatchTasklet(Tasklet &aTasklet);
+#endif
 
     AcceptHandler          mAcceptHandler;
-    LinkedList<Connection> mClientConnections;
-    LinkedList<Connection> mServerConnections;
+    ConnectionTable        mClientConnections;
+    ConnectionTable        mServerConnections;
+    TimerHeap              mTimerHeap;
     TimerMilli             mTimer;
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+    Tasklet mTxBatchTasklet;
+#endif
 };
 
 } // namespace Dns
@@ -297,6 +297,70 @@ exit:
     return error;
 }
 
+Error Name::ParseName(const Message &aMessage, uint16_t &aOffset, uint32_t &aHash)
+{
+    Error         error;
+    LabelIterator iterator(aMessage, aOffset);
+
+    aHash = kHashInitValue;
+
+    while (true)
+    {
+        error = iterator.GetNextLabel();
+
+        switch (error)
+        {
+        case kErrorNone:
+            iterator.UpdateHash(aHash);
+            break;
+
+        case kErrorNotFound:
+            aOffset = iterator.mNameEndOffset;
+            error   = kErrorNone;
+
+            OT_FALL_THROUGH;
+
+        default:
+            ExitNow();
+        }
+    }
+
+exit:
+    return error;
+}
+
+uint32_t Name::CalculateHash(const char *aName)
+{
+    // Empty labels are skipped, so "example.com." and "example.com"
+    // (as well as "." and "") give the same hash. A name with back to
+    // back dot chars is not valid and would never match an encoded
+    // name in `CompareName()`, so its hash value does not matter.
+
+    uint32_t hash = kHashInitValue;
+
+    while (*aName != kNullChar)
+    {
+        const char *label = aName;
+
+        while ((*aName != kNullChar) && (*aName != kLabelSeperatorChar))
+        {
+            aName++;
+        }
+
+        if (aName != label)
+        {
+            UpdateHash(hash, label, static_cast<uint8_t>(aName - label));
+        }
+
+        if (*aName == kLabelSeperatorChar)
+        {
+            aName++;
+        }
+    }
+
+    return hash;
+}
+
 Error Name::ReadLabel(const Message &aMessage, uint16_t &aOffset, char *aLabelBuffer, uint8_t &aLabelLength)
 {
     Error         error;
@@ -482,18 +546,34 @@ Error Name::CompareName(const Message &aMessage, uint16_t &aOffset, const Name &
                                         : ParseName(aMessage, aOffset));
 }
 
+void Name::UpdateHash(uint32_t &aHash, const char *aLabel, uint8_t aLength)
+{
+    // FNV-1a over the label length and the lower-case label chars.
+    // Labels are compared case-insensitively so they are hashed
+    // in their canonical (lower-case) form.
+
+    aHash = (aHash ^ aLength) * kHashPrime;
+
+    for (uint8_t index = 0; index < aLength; index++)
+    {
+        aHash = (aHash ^ static_cast<uint8_t>(ToLowercase(aLabel[index]))) * kHashPrime;
+    }
+}
+
 Error Name::LabelIterator::GetNextLabel(void)
 {
-    Error error;
+    Error error = kErrorNone;
 
     while (true)
     {
-        uint8_t labelLength;
-        uint8_t labelType;
+        const uint8_t *bytes = GetBytes(mNextLabelOffset, sizeof(uint8_t));
+        uint8_t        labelLength;
+        uint8_t        labelType;
 
-        SuccessOrExit(error = mMessage.Read(mNextLabelOffset, labelLength));
+        VerifyOrExit(bytes != nullptr, error = kErrorParse);
 
-        labelType = labelLength & kLabelTypeMask;
+        labelLength = *bytes;
+        labelType   = labelLength & kLabelTypeMask;
 
         if (labelType == kTextLabelType)
         {
@@ -512,6 +592,12 @@ Error Name::LabelIterator::GetNextLabel(void)
             mLabelStartOffset = mNextLabelOffset + sizeof(uint8_t);
             mLabelLength      = labelLength;
             mNextLabelOffset  = mLabelStartOffset + labelLength;
+
+            // `mLabelChars` is set to `nullptr` if the label spans
+            // multiple chunks (or runs past the end of `mMessage`).
+            // In this case the label is read from `mMessage`.
+
+            mLabelChars = reinterpret_cast<const char *>(GetBytes(mLabelStartOffset, labelLength));
             ExitNow();
         }
         else if (labelType == kPointerLabelType)
@@ -520,9 +606,12 @@ Error Name::LabelIterator::GetNextLabel(void)
             // `uint16_t` value. The first two bits are ones. The next 14 bits
             // specify an offset value from the start of the DNS header.
 
-            uint16_t pointerValue;
+            uint16_t pointerOffset = static_cast<uint16_t>(labelLength & ~kLabelTypeMask) << 8;
+
+            bytes = GetBytes(mNextLabelOffset + sizeof(uint8_t), sizeof(uint8_t));
+            VerifyOrExit(bytes != nullptr, error = kErrorParse);
 
-            SuccessOrExit(error = mMessage.Read(mNextLabelOffset, pointerValue));
+            pointerOffset |= *bytes;
 
             if (!IsEndOffsetSet())
             {
@@ -531,7 +620,7 @@ Error Name::LabelIterator::GetNextLabel(void)
 
             // `mMessage.GetOffset()` must point to the start of the
             // DNS header.
-            mNextLabelOffset = mMessage.GetOffset() + (HostSwap16(pointerValue) & kPointerLabelOffsetMask);
+            mNextLabelOffset = mMessage.GetOffset() + pointerOffset;
 
             // Go back through the `while(true)` loop to get the next label.
         }
@@ -545,13 +634,54 @@ exit:
     return error;
 }
 
+const uint8_t *Name::LabelIterator::GetBytes(uint16_t aOffset, uint16_t aLength)
+{
+    // This method moves the chunk cursor to `aOffset` and returns a
+    // pointer to `aLength` bytes at `aOffset` in `mMessage` if they
+    // are all contained in the chunk, otherwise `nullptr`.
+
+    const uint8_t *bytes = nullptr;
+
+    if ((aOffset < mChunkOffset) || (mChunk.GetLength() == 0))
+    {
+        // Move the cursor back (or re-start it after reaching the
+        // end of `mMessage`).
+
+        mChunkOffset          = aOffset;
+        mChunkRemainingLength = mMessage.GetLength();
+        mMessage.GetFirstChunk(aOffset, mChunkRemainingLength, mChunk);
+    }
+
+    while (aOffset >= static_cast<uint32_t>(mChunkOffset) + mChunk.GetLength())
+    {
+        VerifyOrExit(mChunk.GetLength() > 0);
+
+        mChunkOffset += mChunk.GetLength();
+        mMessage.GetNextChunk(mChunkRemainingLength, mChunk);
+    }
+
+    VerifyOrExit(static_cast<uint32_t>(aOffset) + aLength <= static_cast<uint32_t>(mChunkOffset) + mChunk.GetLength());
+    bytes = mChunk.GetBytes() + (aOffset - mChunkOffset);
+
+exit:
+    return bytes;
+}
+
 Error Name::LabelIterator::ReadLabel(char *aLabelBuffer, uint8_t &aLabelLength, bool aAllowDotCharInLabel) const
 {
-    Error error;
+    Error error = kErrorNone;
 
     VerifyOrExit(mLabelLength < aLabelLength, error = kErrorNoBufs);
 
-    SuccessOrExit(error = mMessage.Read(mLabelStartOffset, aLabelBuffer, mLabelLength));
+    if (mLabelChars != nullptr)
+    {
+        memcpy(aLabelBuffer, mLabelChars, mLabelLength);
+    }
+    else
+    {
+        SuccessOrExit(error = mMessage.Read(mLabelStartOffset, aLabelBuffer, mLabelLength));
+    }
+
     aLabelBuffer[mLabelLength] = kNullChar;
     aLabelLength               = mLabelLength;
 
@@ -569,6 +699,19 @@ bool Name::LabelIterator::CaseInsensitiveMatch(uint8_t aFirst, uint8_t aSecond)
     return ToLowercase(static_cast<char>(aFirst)) == ToLowercase(static_cast<char>(aSecond));
 }
 
+bool Name::LabelIterator::CaseInsensitiveMatch(const char *aFirst, const char *aSecond, uint8_t aLength)
+{
+    bool matches = true;
+
+    for (; aLength > 0; aLength--)
+    {
+        VerifyOrExit(ToLowercase(*aFirst++) == ToLowercase(*aSecond++), matches = false);
+    }
+
+exit:
+    return matches;
+}
+
 bool Name::LabelIterator::CompareLabel(const char *&aName, bool aIsSingleLabel) const
 {
     // This method compares the current label in the iterator with the
@@ -582,7 +725,7 @@ bool Name::LabelIterator::CompareLabel(const char *&aName, bool aIsSingleLabel)
     bool matches = false;
 
     VerifyOrExit(StringLength(aName, mLabelLength) == mLabelLength);
-    matches = mMessage.CompareBytes(mLabelStartOffset, aName, mLabelLength, CaseInsensitiveMatch);
+    matches = CompareLabel(aName, mLabelLength);
 
     VerifyOrExit(matches);
 
@@ -609,9 +752,80 @@ bool Name::LabelIterator::CompareLabel(const LabelIterator &aOtherIterator) cons
     // This method compares the current label in the iterator with the
     // label from another iterator.
 
-    return (mLabelLength == aOtherIterator.mLabelLength) &&
-           mMessage.CompareBytes(mLabelStartOffset, aOtherIterator.mMessage, aOtherIterator.mLabelStartOffset,
-                                 mLabelLength, CaseInsensitiveMatch);
+    bool matches = (mLabelLength == aOtherIterator.mLabelLength);
+
+    VerifyOrExit(matches);
+
+    if (aOtherIterator.mLabelChars != nullptr)
+    {
+        matches = CompareLabel(aOtherIterator.mLabelChars, aOtherIterator.mLabelLength);
+    }
+    else
+    {
+        matches = mMessage.CompareBytes(mLabelStartOffset, aOtherIterator.mMessage, aOtherIterator.mLabelStartOffset,
+                                        mLabelLength, CaseInsensitiveMatch);
+    }
+
+exit:
+    return matches;
+}
+
+bool Name::LabelIterator::CompareLabel(const char *aLabel, uint8_t aLength) const
+{
+    // This method compares the current label in the iterator with a
+    // given label of a given length (not necessarily null-terminated).
+
+    bool matches = (mLabelLength == aLength);
+
+    VerifyOrExit(matches);
+
+    if (mLabelChars != nullptr)
+    {
+        matches = CaseInsensitiveMatch(mLabelChars, aLabel, aLength);
+    }
+    else
+    {
+        matches = mMessage.CompareBytes(mLabelStartOffset, aLabel, aLength, CaseInsensitiveMatch);
+    }
+
+exit:
+    return matches;
+}
+
+void Name::LabelIterator::UpdateHash(uint32_t &aHash) const
+{
+    // This method updates `aHash` with the current label in the
+    // iterator. If the label is not contiguous, its chars are read
+    // in place from the message chunks.
+
+    uint16_t       length;
+    Message::Chunk chunk;
+
+    if (mLabelChars != nullptr)
+    {
+        Name::UpdateHash(aHash, mLabelChars, mLabelLength);
+        ExitNow();
+    }
+
+    aHash  = (aHash ^ mLabelLength) * kHashPrime;
+    length = mLabelLength;
+
+    mMessage.GetFirstChunk(mLabelStartOffset, length, chunk);
+
+    while (chunk.GetLength() > 0)
+    {
+        const char *chars = reinterpret_cast<const char *>(chunk.GetBytes());
+
+        for (uint16_t index = 0; index < chunk.GetLength(); index++)
+        {
+            aHash = (aHash ^ static_cast<uint8_t>(ToLowercase(chars[index]))) * kHashPrime;
+        }
+
+        mMessage.GetNextChunk(length, chunk);
+    }
+
+exit:
+    return;
 }
 
 Error Name::LabelIterator::AppendLabel(Message &aMessage) const
@@ -683,6 +897,226 @@ exit:
     return match;
 }
 
+Error NameCompressor::AppendName(const char *aLabel, uint8_t aLabelLength, const char *aName, Message &aMessage)
+{
+    Error     error;
+    LabelList list;
+    uint8_t   matchIndex;
+    uint16_t  matchOffset = kUnusedOffset;
+
+    error = list.Init(aLabel, aLabelLength, aName);
+
+    if (error == kErrorNoBufs)
+    {
+        // The name has too many labels to be tracked, so we append it
+        // uncompressed.
+
+        if (aLabel != nullptr)
+        {
+            SuccessOrExit(error = Name::AppendLabel(aLabel, aLabelLength, aMessage));
+        }
+
+        ExitNow(error = Name::AppendName(aName, aMessage));
+    }
+
+    SuccessOrExit(error);
+
+    // Find the longest suffix of the name which is already present in
+    // the message (starting from the full name).
+
+    for (matchIndex = 0; matchIndex < list.mNumLabels; matchIndex++)
+    {
+        matchOffset = Find(aMessage, list, matchIndex);
+
+        if (matchOffset != kUnusedOffset)
+        {
+            break;
+        }
+    }
+
+    // Append the leading labels which are not present, remembering
+    // the offset of every new suffix, then the pointer label to the
+    // matched suffix or the terminator.
+
+    for (uint8_t index = 0; index < matchIndex; index++)
+    {
+        uint16_t offset = aMessage.GetLength() - aMessage.GetOffset();
+
+        SuccessOrExit(error = Name::AppendLabel(list.mLabels[index], list.mLengths[index], aMessage));
+
+        if (offset <= Name::kPointerLabelOffsetMask)
+        {
+            Add(list.mHashes[index], offset);
+        }
+    }
+
+    if (matchOffset != kUnusedOffset)
+    {
+        error = Name::AppendPointerLabel(matchOffset, aMessage);
+    }
+    else
+    {
+        error = Name::AppendTerminator(aMessage);
+    }
+
+exit:
+    return error;
+}
+
+uint16_t NameCompressor::Find(const Message &aMessage, const LabelList &aList, uint8_t aIndex) const
+{
+    uint16_t hash   = aList.mHashes[aIndex];
+    uint16_t offset = kUnusedOffset;
+    uint8_t  entry  = hash % kNumEntries;
+
+    for (uint8_t probe = 0; probe < kNumEntries; probe++)
+    {
+        if (mOffsets[entry] == kUnusedOffset)
+        {
+            break;
+        }
+
+        if ((mHashes[entry] == hash) && Matches(aMessage, mOffsets[entry], aList, aIndex))
+        {
+            ExitNow(offset = mOffsets[entry]);
+        }
+
+        entry = (entry + 1) % kNumEntries;
+    }
+
+exit:
+    return offset;
+}
+
+void NameCompressor::Add(uint16_t aHash, uint16_t aOffset)
+{
+    // Uses open addressing with linear probing. If the dictionary is
+    // full, the suffix is not remembered (later names are then only
+    // compressed against the suffixes already in the dictionary).
+
+    uint8_t entry = aHash % kNumEntries;
+
+    for (uint8_t probe = 0; probe < kNumEntries; probe++)
+    {
+        if (mOffsets[entry] == kUnusedOffset)
+        {
+            mHashes[entry]  = aHash;
+            mOffsets[entry] = aOffset;
+            break;
+        }
+
+        entry = (entry + 1) % kNumEntries;
+    }
+}
+
+bool NameCompressor::Matches(const Message &aMessage, uint16_t aOffset, const LabelList &aList, uint8_t aIndex)
+{
+    // This method verifies that the encoded name at `aOffset` (relative
+    // to the DNS header) in `aMessage` matches the suffix of `aList`
+    // starting from label `aIndex`.
+
+    Name::LabelIterator iterator(aMessage, aMessage.GetOffset() + aOffset);
+    bool                matches = false;
+
+    for (; aIndex < aList.mNumLabels; aIndex++)
+    {
+        VerifyOrExit(iterator.GetNextLabel() == kErrorNone);
+        VerifyOrExit(iterator.CompareLabel(aList.mLabels[aIndex], aList.mLengths[aIndex]));
+    }
+
+    matches = (iterator.GetNextLabel() == kErrorNotFound);
+
+exit:
+    return matches;
+}
+
+uint16_t NameCompressor::Hash(uint16_t aSuffixHash, const char *aLabel, uint8_t aLength)
+{
+    // Hash of the label chained with the hash of the rest of the
+    // name, folded to 16 bits.
+
+    uint32_t hash = (Name::kHashInitValue ^ aSuffixHash);
+
+    Name::UpdateHash(hash, aLabel, aLength);
+
+    return static_cast<uint16_t>(hash ^ (hash >> 16));
+}
+
+Error NameCompressor::LabelList::Init(const char *aLabel, uint8_t aLabelLength, const char *aName)
+{
+    Error    error           = kErrorNone;
+    uint16_t index           = 0;
+    uint16_t labelStartIndex = 0;
+    uint16_t hash            = 0;
+    char     ch;
+
+    mNumLabels     = 0;
+    mEncodedLength = sizeof(uint8_t); // Terminator.
+
+    if (aLabel != nullptr)
+    {
+        SuccessOrExit(error = Add(aLabel, aLabelLength));
+    }
+
+    VerifyOrExit(aName != nullptr);
+
+    // Parse the labels following the same rules as in
+    // `Name::AppendMultipleLabels()`.
+
+    do
+    {
+        ch = aName[index];
+
+        if ((ch == kNullChar) || (ch == Name::kLabelSeperatorChar))
+        {
+            uint8_t labelLength = static_cast<uint8_t>(index - labelStartIndex);
+
+            if (labelLength == 0)
+            {
+                error = ((ch == kNullChar) || ((index == 0) && (aName[1] == kNullChar))) ? kErrorNone
+                                                                                         : kErrorInvalidArgs;
+                ExitNow();
+            }
+
+            SuccessOrExit(error = Add(&aName[labelStartIndex], labelLength));
+            labelStartIndex = index + 1;
+        }
+
+        index++;
+
+    } while (ch != kNullChar);
+
+exit:
+    if (error == kErrorNone)
+    {
+        for (uint8_t labelIndex = mNumLabels; labelIndex > 0; labelIndex--)
+        {
+            hash = Hash(hash, mLabels[labelIndex - 1], mLengths[labelIndex - 1]);
+
+            mHashes[labelIndex - 1] = hash;
+        }
+    }
+
+    return error;
+}
+
+Error NameCompressor::LabelList::Add(const char *aLabel, uint8_t aLength)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit((0 < aLength) && (aLength <= Name::kMaxLabelLength), error = kErrorInvalidArgs);
+    VerifyOrExit(mEncodedLength + aLength + sizeof(uint8_t) <= Name::kMaxEncodedLength, error = kErrorInvalidArgs);
+    VerifyOrExit(mNumLabels < kMaxLabels, error = kErrorNoBufs);
+
+    mLabels[mNumLabels]  = aLabel;
+    mLengths[mNumLabels] = aLength;
+    mNumLabels++;
+    mEncodedLength += aLength + sizeof(uint8_t);
+
+exit:
+    return error;
+}
+
 Error ResourceRecord::ParseRecords(const Message &aMessage, uint16_t &aOffset, uint16_t aNumRecords)
 {
     Error error = kErrorNone;
@@ -45,6 +45,7 @@
 #include "common/encoding.hpp"
 #include "common/equatable.hpp"
 #include "common/message.hpp"
+#include "common/string.hpp"
 #include "crypto/ecdsa.hpp"
 #include "net/ip4_address.hpp"
 #include "net/ip6_address.hpp"
@@ -489,6 +490,8 @@ public:
  */
 class Name : public Clearable<Name>
 {
+    friend class NameCompressor;
+
 public:
     /**
      * Max size (number of chars) in a name string array (includes null char at the end of string).
@@ -817,6 +820,40 @@ public:
      */
     static Error ParseName(const Message &aMessage, uint16_t &aOffset);
 
+    /**
+     * This static method parses and skips over a full name in a message and calculates the hash of the name.
+     *
+     * The hash is calculated over the canonical (lower-case) form of the name labels as they are parsed (following
+     * any compression pointers), reading the label chars in place from the message buffers. Two names that match
+     * (using case-insensitive comparison) always have the same hash, independent of how they are encoded, so
+     * different hash values indicate that the names do not match.
+     *
+     * @param[in]     aMessage        The message to parse the name from. `aMessage.GetOffset()` MUST point to
+     *                                the start of DNS header (this is used to handle compressed names).
+     * @param[in,out] aOffset         On input the offset in @p aMessage pointing to the start of the name field.
+     *                                On exit (when parsed successfully), @p aOffset is updated to point to the byte
+     *                                after the end of name field.
+     * @param[out]    aHash           A reference to output the calculated hash of the name.
+     *
+     * @retval kErrorNone          Successfully parsed and skipped over name, @p Offset and @p aHash are updated.
+     * @retval kErrorParse         Name could not be parsed (invalid format).
+     *
+     */
+    static Error ParseName(const Message &aMessage, uint16_t &aOffset, uint32_t &aHash);
+
+    /**
+     * This static method calculates the hash of a given name string.
+     *
+     * The calculated hash is the same as the one from `ParseName()` for an encoded name matching @p aName.
+     *
+     * @param[in] aName  A pointer to a null terminated string containing the name, following "<label1>.<label2>"
+     *                   format, e.g., "example.com" or "example.com." (same as previous one).
+     *
+     * @returns The hash of @p aName.
+     *
+     */
+    static uint32_t CalculateHash(const char *aName);
+
     /**
      * This static method reads a name label from a message.
      *
@@ -1008,15 +1045,28 @@ private:
 
     static constexpr bool kIsSingleLabel = true; // Used in `LabelIterator::CompareLable()`.
 
+    static constexpr uint32_t kHashInitValue = 2166136261u; // FNV-1a offset basis (hash of root/empty name).
+    static constexpr uint32_t kHashPrime     = 16777619u;   // FNV-1a prime.
+
     struct LabelIterator
     {
+        // The labels are read through a chunk cursor which tracks the
+        // current message chunk (contiguous data in a message buffer).
+        // The cursor moves forward as labels are parsed and only goes
+        // back to the start of message when following a pointer label.
+        // When the chars of a label are contiguous in a chunk, the
+        // label is accessed in place through `mLabelChars`.
+
         static constexpr uint16_t kUnsetNameEndOffset = 0; // Special value indicating `mNameEndOffset` is not yet set.
 
         LabelIterator(const Message &aMessage, uint16_t aLabelOffset)
             : mMessage(aMessage)
             , mNextLabelOffset(aLabelOffset)
             , mNameEndOffset(kUnsetNameEndOffset)
+            , mChunkOffset(0)
+            , mChunkRemainingLength(0)
         {
+            mChunk.Init(nullptr, 0);
         }
 
         bool  IsEndOffsetSet(void) const { return (mNameEndOffset != kUnsetNameEndOffset); }
@@ -1024,17 +1074,28 @@ private:
         Error ReadLabel(char *aLabelBuffer, uint8_t &aLabelLength, bool aAllowDotCharInLabel) const;
         bool  CompareLabel(const char *&aName, bool aIsSingleLabel) const;
         bool  CompareLabel(const LabelIterator &aOtherIterator) const;
+        bool  CompareLabel(const char *aLabel, uint8_t aLength) const;
         Error AppendLabel(Message &aMessage) const;
+        void  UpdateHash(uint32_t &aHash) const;
 
-        static bool CaseInsensitiveMatch(uint8_t aFirst, uint8_t aSecond);
+        const uint8_t *GetBytes(uint16_t aOffset, uint16_t aLength);
 
-        const Message &mMessage;          // Message to read labels from.
-        uint16_t       mLabelStartOffset; // Offset in `mMessage` to the first char of current label text.
-        uint8_t        mLabelLength;      // Length of current label (number of chars).
-        uint16_t       mNextLabelOffset;  // Offset in `mMessage` to the start of the next label.
-        uint16_t       mNameEndOffset;    // Offset in `mMessage` to the byte after the end of domain name field.
+        static bool CaseInsensitiveMatch(uint8_t aFirst, uint8_t aSecond);
+        static bool CaseInsensitiveMatch(const char *aFirst, const char *aSecond, uint8_t aLength);
+
+        const Message &mMessage;              // Message to read labels from.
+        uint16_t       mLabelStartOffset;     // Offset in `mMessage` to the first char of current label text.
+        uint8_t        mLabelLength;          // Length of current label (number of chars).
+        const char *   mLabelChars;           // Current label chars in `mMessage` or `nullptr` if not contiguous.
+        uint16_t       mNextLabelOffset;      // Offset in `mMessage` to the start of the next label.
+        uint16_t       mNameEndOffset;        // Offset in `mMessage` to the byte after the end of domain name field.
+        Message::Chunk mChunk;                // Current chunk of the cursor.
+        uint16_t       mChunkOffset;          // Offset in `mMessage` to the start of `mChunk`.
+        uint16_t       mChunkRemainingLength; // Remaining length in `mMessage` after `mChunk`.
     };
 
+    static void UpdateHash(uint32_t &aHash, const char *aLabel, uint8_t aLength);
+
     Name(const char *aString, const Message *aMessage, uint16_t aOffset)
         : mString(aString)
         , mMessage(aMessage)
@@ -1047,6 +1108,115 @@ private:
     uint16_t       mOffset;  // Offset in `mMessage` to the start of name (used when name is from `mMessage`).
 };
 
+/**
+ * This class implements a name compression dictionary used when encoding DNS names into a message.
+ *
+ * The dictionary maps the hash of every name suffix (a sequence of trailing labels) appended through it to the offset
+ * of that suffix in the message. When a later name shares a suffix with a previously appended one, only its leading
+ * labels are appended followed by a pointer label to the earlier occurrence, so that the longest common suffix is
+ * always compressed (not only the few names an encoder explicitly tracks).
+ *
+ * Every hash match is verified against the content of the message before it is used, so a hash collision (or a stale
+ * entry after the message is truncated) never leads to an incorrect encoding.
+ *
+ * The same `NameCompressor` instance MUST be used with a single message, and all offsets are tracked relative to the
+ * start of DNS header (`aMessage.GetOffset()`).
+ *
+ */
+class NameCompressor : public Clearable<NameCompressor>
+{
+public:
+    /**
+     * This constructor initializes the `NameCompressor` as empty.
+     *
+     */
+    NameCompressor(void) { Clear(); }
+
+    /**
+     * This method encodes and appends a full name to a message using and updating the compression dictionary.
+     *
+     * The @p aName must follow  "<label1>.<label2>.<label3>", i.e., a sequence of labels separated by dot '.' char.
+     * E.g., "example.com", "example.com." (same as previous one), "local.", "default.service.arpa", "." or "" (root).
+     *
+     * @param[in]  aName              A name string. Can be `nullptr` (then treated as "." or root).
+     * @param[in]  aMessage           The message to append to.
+     *
+     * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+     * @retval kErrorInvalidArgs  Name @p aName is not valid.
+     * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+     *
+     */
+    Error AppendName(const char *aName, Message &aMessage) { return AppendName(nullptr, 0, aName, aMessage); }
+
+    /**
+     * This method encodes and appends a name formed by a single first label followed by a sequence of labels, using and
+     * updating the compression dictionary.
+     *
+     * The @p aLabel is always treated as a single whole label (it can contain dot '.' characters), which is useful for
+     * "Service Instance Names" where <Instance> portion is a user-friendly name.
+     *
+     * @param[in]  aLabel             The first label string. MUST NOT be `nullptr`.
+     * @param[in]  aName              The remaining labels of the name (e.g., "_http._tcp.default.service.arpa.").
+     * @param[in]  aMessage           The message to append to.
+     *
+     * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+     * @retval kErrorInvalidArgs  @p aLabel or @p aName is not valid.
+     * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+     *
+     */
+    Error AppendName(const char *aLabel, const char *aName, Message &aMessage)
+    {
+        return AppendName(aLabel, static_cast<uint8_t>(StringLength(aLabel, Name::kMaxLabelSize)), aName, aMessage);
+    }
+
+    /**
+     * This method encodes and appends a name formed by a single first label of a given length followed by a sequence
+     * of labels, using and updating the compression dictionary.
+     *
+     * @param[in]  aLabel             The first label string or `nullptr` if there is no separate first label.
+     * @param[in]  aLabelLength       The length of @p aLabel. @p aLabel must not contain '\0' within this length.
+     * @param[in]  aName              The remaining labels of the name.
+     * @param[in]  aMessage           The message to append to.
+     *
+     * @retval kErrorNone         Successfully encoded and appended the name to @p aMessage.
+     * @retval kErrorInvalidArgs  @p aLabel or @p aName is not valid.
+     * @retval kErrorNoBufs       Insufficient available buffers to grow the message.
+     *
+     */
+    Error AppendName(const char *aLabel, uint8_t aLabelLength, const char *aName, Message &aMessage);
+
+private:
+    // Number of suffix entries in the dictionary. Each entry uses
+    // four bytes (a 16-bit hash and a 16-bit offset).
+    static constexpr uint8_t kNumEntries = 32;
+
+    // Max number of labels in a name which is compressed. Longer
+    // (unusual) names are appended uncompressed.
+    static constexpr uint8_t kMaxLabels = 32;
+
+    static constexpr uint16_t kUnusedOffset = 0; // Offset zero is the DNS header, never a name.
+
+    struct LabelList
+    {
+        Error Init(const char *aLabel, uint8_t aLabelLength, const char *aName);
+        Error Add(const char *aLabel, uint8_t aLength);
+
+        uint8_t     mNumLabels;
+        uint8_t     mEncodedLength;
+        const char *mLabels[kMaxLabels];
+        uint8_t     mLengths[kMaxLabels];
+        uint16_t    mHashes[kMaxLabels]; // Hash of the suffix starting at the label.
+    };
+
+    uint16_t        Find(const Message &aMessage, const LabelList &aList, uint8_t aIndex) const;
+    void            Add(uint16_t aHash, uint16_t aOffset);
+    static bool     Matches(const Message &aMessage, uint16_t aOffset, const LabelList &aList, uint8_t aIndex);
+    static uint16_t Hash(uint16_t aSuffixHash, const char *aLabel, uint8_t aLength);
+
+    uint16_t mHashes[kNumEntries];
+    uint16_t mOffsets[kNumEntries];
+};
+
 /**
  * This type represents a TXT record entry representing a key/value pair (RFC 6763 - section 6.3).
  *
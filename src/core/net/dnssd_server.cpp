@@ -64,6 +64,14 @@ Server::Server(Instance &aInstance)
     , mQuerySubscribe(nullptr)
     , mQueryUnsubscribe(nullptr)
     , mTimer(aInstance, Server::HandleTimer)
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+    , mPushCallbacks(HandlePushConnected,
+                     HandlePushSessionEstablished,
+                     HandlePushDisconnected,
+                     ProcessPushRequest,
+                     ProcessPushUnidirectional,
+                     ProcessPushResponse)
+#endif
 {
     mCounters.Clear();
 }
@@ -81,6 +89,10 @@ Error Server::Start(void)
     Get<Srp::Server>().HandleDnssdServerStateChange();
 #endif
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+    Get<Dso>().StartListening(AcceptPushSession);
+#endif
+
 exit:
     LogInfo("started: %s", ErrorToString(error));
 
@@ -105,6 +117,18 @@ void Server::Stop(void)
 
     mTimer.Stop();
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+    Get<Dso>().StopListening();
+
+    while (!mPushSessions.IsEmpty())
+    {
+        PushSession &session = **mPushSessions.Back();
+
+        session.Disconnect(Dso::Connection::kGracefullyClose, Dso::Connection::kReasonUnknown);
+        FreePushSession(session);
+    }
+#endif
+
     IgnoreError(mSocket.Close());
     LogInfo("stopped");
 
@@ -144,7 +168,7 @@ void Server::ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage
     Error            error           = kErrorNone;
     Message *        responseMessage = nullptr;
     Header           responseHeader;
-    NameCompressInfo compressInfo(kDefaultDomainName);
+    NameCompressor   compressor;
     Header::Response response                = Header::kResponseSuccess;
     bool             resolveByQueryCallbacks = false;
 
@@ -165,18 +189,18 @@ void Server::ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage
     VerifyOrExit(!aRequestHeader.IsTruncationFlagSet(), response = Header::kResponseFormatError);
     VerifyOrExit(aRequestHeader.GetQuestionCount() > 0, response = Header::kResponseFormatError);
 
-    response = AddQuestions(aRequestHeader, aRequestMessage, responseHeader, *responseMessage, compressInfo);
+    response = AddQuestions(aRequestHeader, aRequestMessage, responseHeader, *responseMessage, compressor);
     VerifyOrExit(response == Header::kResponseSuccess);
 
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
     // Answer the questions
-    response = ResolveBySrp(responseHeader, *responseMessage, compressInfo);
+    response = ResolveBySrp(responseHeader, *responseMessage, compressor);
 #endif
 
     // Resolve the question using query callbacks if SRP server failed to resolve the questions.
     if (responseHeader.GetAnswerCount() == 0)
     {
-        if (kErrorNone == ResolveByQueryCallbacks(responseHeader, *responseMessage, compressInfo, aMessageInfo))
+        if (kErrorNone == ResolveByQueryCallbacks(responseHeader, *responseMessage, compressor, aMessageInfo))
         {
             resolveByQueryCallbacks = true;
         }
@@ -233,11 +257,11 @@ void Server::SendResponse(Header                  aHeader,
     UpdateResponseCounters(aResponseCode);
 }
 
-Header::Response Server::AddQuestions(const Header &    aRequestHeader,
-                                      const Message &   aRequestMessage,
-                                      Header &          aResponseHeader,
-                                      Message &         aResponseMessage,
-                                      NameCompressInfo &aCompressInfo)
+Header::Response Server::AddQuestions(const Header &  aRequestHeader,
+                                      const Message & aRequestMessage,
+                                      Header &        aResponseHeader,
+                                      Message &       aResponseMessage,
+                                      NameCompressor &aCompressor)
 {
     Question         question;
     uint16_t         readOffset;
@@ -263,7 +287,7 @@ Header::Response Server::AddQuestions(const Header &    aRequestHeader,
                          qtype == ResourceRecord::kTypeTxt || qtype == ResourceRecord::kTypeAaaa,
                      response = Header::kResponseNotImplemented);
 
-        VerifyOrExit(kErrorNone == FindNameComponents(name, aCompressInfo.GetDomainName(), nameComponentsOffsetInfo),
+        VerifyOrExit(kErrorNone == FindNameComponents(name, kDefaultDomainName, nameComponentsOffsetInfo),
                      response = Header::kResponseNameError);
 
         switch (question.GetType())
@@ -284,7 +308,7 @@ Header::Response Server::AddQuestions(const Header &    aRequestHeader,
             ExitNow(response = Header::kResponseNotImplemented);
         }
 
-        VerifyOrExit(AppendQuestion(name, question, aResponseMessage, aCompressInfo) == kErrorNone,
+        VerifyOrExit(AppendQuestion(name, question, aResponseMessage, aCompressor) == kErrorNone,
                      response = Header::kResponseServerFailure);
     }
 
@@ -294,24 +318,24 @@ exit:
     return response;
 }
 
-Error Server::AppendQuestion(const char *      aName,
-                             const Question &  aQuestion,
-                             Message &         aMessage,
-                             NameCompressInfo &aCompressInfo)
+Error Server::AppendQuestion(const char *    aName,
+                             const Question &aQuestion,
+                             Message &       aMessage,
+                             NameCompressor &aCompressor)
 {
     Error error = kErrorNone;
 
     switch (aQuestion.GetType())
     {
     case ResourceRecord::kTypePtr:
-        SuccessOrExit(error = AppendServiceName(aMessage, aName, aCompressInfo));
+        SuccessOrExit(error = aCompressor.AppendName(aName, aMessage));
         break;
     case ResourceRecord::kTypeSrv:
     case ResourceRecord::kTypeTxt:
-        SuccessOrExit(error = AppendInstanceName(aMessage, aName, aCompressInfo));
+        SuccessOrExit(error = AppendInstanceName(aMessage, aName, aCompressor));
         break;
     case ResourceRecord::kTypeAaaa:
-        SuccessOrExit(error = AppendHostName(aMessage, aName, aCompressInfo));
+        SuccessOrExit(error = aCompressor.AppendName(aName, aMessage));
         break;
     default:
         OT_ASSERT(false);
@@ -323,11 +347,11 @@ exit:
     return error;
 }
 
-Error Server::AppendPtrRecord(Message &         aMessage,
-                              const char *      aServiceName,
-                              const char *      aInstanceName,
-                              uint32_t          aTtl,
-                              NameCompressInfo &aCompressInfo)
+Error Server::AppendPtrRecord(Message &       aMessage,
+                              const char *    aServiceName,
+                              const char *    aInstanceName,
+                              uint32_t        aTtl,
+                              NameCompressor &aCompressor)
 {
     Error     error;
     PtrRecord ptrRecord;
@@ -336,12 +360,12 @@ Error Server::AppendPtrRecord(Message &         aMessage,
     ptrRecord.Init();
     ptrRecord.SetTtl(aTtl);
 
-    SuccessOrExit(error = AppendServiceName(aMessage, aServiceName, aCompressInfo));
+    SuccessOrExit(error = aCompressor.AppendName(aServiceName, aMessage));
 
     recordOffset = aMessage.GetLength();
     SuccessOrExit(error = aMessage.SetLength(recordOffset + sizeof(ptrRecord)));
 
-    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
+    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressor));
 
     ptrRecord.SetLength(aMessage.GetLength() - (recordOffset + sizeof(ResourceRecord)));
     aMessage.Write(recordOffset, ptrRecord);
@@ -350,14 +374,14 @@ exit:
     return error;
 }
 
-Error Server::AppendSrvRecord(Message &         aMessage,
-                              const char *      aInstanceName,
-                              const char *      aHostName,
-                              uint32_t          aTtl,
-                              uint16_t          aPriority,
-                              uint16_t          aWeight,
-                              uint16_t          aPort,
-                              NameCompressInfo &aCompressInfo)
+Error Server::AppendSrvRecord(Message &       aMessage,
+                              const char *    aInstanceName,
+                              const char *    aHostName,
+                              uint32_t        aTtl,
+                              uint16_t        aPriority,
+                              uint16_t        aWeight,
+                              uint16_t        aPort,
+                              NameCompressor &aCompressor)
 {
     SrvRecord srvRecord;
     Error     error = kErrorNone;
@@ -369,12 +393,12 @@ Error Server::AppendSrvRecord(Message &         aMessage,
     srvRecord.SetWeight(aWeight);
     srvRecord.SetPort(aPort);
 
-    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
+    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressor));
 
     recordOffset = aMessage.GetLength();
     SuccessOrExit(error = aMessage.SetLength(recordOffset + sizeof(srvRecord)));
 
-    SuccessOrExit(error = AppendHostName(aMessage, aHostName, aCompressInfo));
+    SuccessOrExit(error = aCompressor.AppendName(aHostName, aMessage));
 
     srvRecord.SetLength(aMessage.GetLength() - (recordOffset + sizeof(ResourceRecord)));
     aMessage.Write(recordOffset, srvRecord);
@@ -387,7 +411,7 @@ Error Server::AppendAaaaRecord(Message &           aMessage,
                                const char *        aHostName,
                                const Ip6::Address &aAddress,
                                uint32_t            aTtl,
-                               NameCompressInfo &  aCompressInfo)
+                               NameCompressor &    aCompressor)
 {
     AaaaRecord aaaaRecord;
     Error      error;
@@ -396,118 +420,39 @@ Error Server::AppendAaaaRecord(Message &           aMessage,
     aaaaRecord.SetTtl(aTtl);
     aaaaRecord.SetAddress(aAddress);
 
-    SuccessOrExit(error = AppendHostName(aMessage, aHostName, aCompressInfo));
+    SuccessOrExit(error = aCompressor.AppendName(aHostName, aMessage));
     error = aMessage.Append(aaaaRecord);
 
 exit:
     return error;
 }
 
-Error Server::AppendServiceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
+Error Server::AppendInstanceName(Message &aMessage, const char *aName, NameCompressor &aCompressor)
 {
-    Error       error;
-    uint16_t    serviceCompressOffset = aCompressInfo.GetServiceNameOffset(aMessage, aName);
-    const char *serviceName;
-
-    // Check whether `aName` is a sub-type service name.
-    serviceName = StringFind(aName, kDnssdSubTypeLabel, kStringCaseInsensitiveMatch);
-
-    if (serviceName != nullptr)
-    {
-        uint8_t subTypeLabelLength = static_cast<uint8_t>(serviceName - aName) + sizeof(kDnssdSubTypeLabel) - 1;
-
-        SuccessOrExit(error = Name::AppendMultipleLabels(aName, subTypeLabelLength, aMessage));
-
-        // Skip over the "._sub." label to get to the root service name.
-        serviceName += sizeof(kDnssdSubTypeLabel) - 1;
-    }
-    else
-    {
-        serviceName = aName;
-    }
-
-    if (serviceCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(serviceCompressOffset, aMessage);
-    }
-    else
-    {
-        uint8_t  domainStart          = static_cast<uint8_t>(StringLength(serviceName, Name::kMaxNameSize - 1) -
-                                                   StringLength(aCompressInfo.GetDomainName(), Name::kMaxNameSize - 1));
-        uint16_t domainCompressOffset = aCompressInfo.GetDomainNameOffset();
+    NameComponentsOffsetInfo nameComponentsInfo;
 
-        serviceCompressOffset = aMessage.GetLength();
-        aCompressInfo.SetServiceNameOffset(serviceCompressOffset);
+    IgnoreError(FindNameComponents(aName, kDefaultDomainName, nameComponentsInfo));
+    OT_ASSERT(nameComponentsInfo.IsServiceInstanceName());
 
-        if (domainCompressOffset == NameCompressInfo::kUnknownOffset)
-        {
-            aCompressInfo.SetDomainNameOffset(serviceCompressOffset + domainStart);
-            error = Name::AppendName(serviceName, aMessage);
-        }
-        else
-        {
-            SuccessOrExit(error = Name::AppendMultipleLabels(serviceName, domainStart, aMessage));
-            error = Name::AppendPointerLabel(domainCompressOffset, aMessage);
-        }
-    }
+    // The <Instance> portion is appended as a single label (it may
+    // contain dot characters) followed by the service name.
 
-exit:
-    return error;
+    return aCompressor.AppendName(aName, nameComponentsInfo.mServiceOffset - 1,
+                                  aName + nameComponentsInfo.mServiceOffset, aMessage);
 }
 
-Error Server::AppendInstanceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
-{
-    Error    error;
-    uint16_t instanceCompressOffset = aCompressInfo.GetInstanceNameOffset(aMessage, aName);
-
-    if (instanceCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(instanceCompressOffset, aMessage);
-    }
-    else
-    {
-        NameComponentsOffsetInfo nameComponentsInfo;
-
-        IgnoreError(FindNameComponents(aName, aCompressInfo.GetDomainName(), nameComponentsInfo));
-        OT_ASSERT(nameComponentsInfo.IsServiceInstanceName());
-
-        aCompressInfo.SetInstanceNameOffset(aMessage.GetLength());
-
-        // Append the instance name as one label
-        SuccessOrExit(error = Name::AppendLabel(aName, nameComponentsInfo.mServiceOffset - 1, aMessage));
-
-        {
-            const char *serviceName           = aName + nameComponentsInfo.mServiceOffset;
-            uint16_t    serviceCompressOffset = aCompressInfo.GetServiceNameOffset(aMessage, serviceName);
-
-            if (serviceCompressOffset != NameCompressInfo::kUnknownOffset)
-            {
-                error = Name::AppendPointerLabel(serviceCompressOffset, aMessage);
-            }
-            else
-            {
-                aCompressInfo.SetServiceNameOffset(aMessage.GetLength());
-                error = Name::AppendName(serviceName, aMessage);
-            }
-        }
-    }
-
-exit:
-    return error;
-}
-
-Error Server::AppendTxtRecord(Message &         aMessage,
-                              const char *      aInstanceName,
-                              const void *      aTxtData,
-                              uint16_t          aTxtLength,
-                              uint32_t          aTtl,
-                              NameCompressInfo &aCompressInfo)
+Error Server::AppendTxtRecord(Message &       aMessage,
+                              const char *    aInstanceName,
+                              const void *    aTxtData,
+                              uint16_t        aTxtLength,
+                              uint32_t        aTtl,
+                              NameCompressor &aCompressor)
 {
     Error         error = kErrorNone;
     TxtRecord     txtRecord;
     const uint8_t kEmptyTxt = 0;
 
-    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressInfo));
+    SuccessOrExit(error = AppendInstanceName(aMessage, aInstanceName, aCompressor));
 
     txtRecord.Init();
     txtRecord.SetTtl(aTtl);
@@ -527,40 +472,6 @@ exit:
     return error;
 }
 
-Error Server::AppendHostName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo)
-{
-    Error    error;
-    uint16_t hostCompressOffset = aCompressInfo.GetHostNameOffset(aMessage, aName);
-
-    if (hostCompressOffset != NameCompressInfo::kUnknownOffset)
-    {
-        error = Name::AppendPointerLabel(hostCompressOffset, aMessage);
-    }
-    else
-    {
-        uint8_t  domainStart          = static_cast<uint8_t>(StringLength(aName, Name::kMaxNameLength) -
-                                                   StringLength(aCompressInfo.GetDomainName(), Name::kMaxNameSize - 1));
-        uint16_t domainCompressOffset = aCompressInfo.GetDomainNameOffset();
-
-        hostCompressOffset = aMessage.GetLength();
-        aCompressInfo.SetHostNameOffset(hostCompressOffset);
-
-        if (domainCompressOffset == NameCompressInfo::kUnknownOffset)
-        {
-            aCompressInfo.SetDomainNameOffset(hostCompressOffset + domainStart);
-            error = Name::AppendName(aName, aMessage);
-        }
-        else
-        {
-            SuccessOrExit(error = Name::AppendMultipleLabels(aName, domainStart, aMessage));
-            error = Name::AppendPointerLabel(domainCompressOffset, aMessage);
-        }
-    }
-
-exit:
-    return error;
-}
-
 void Server::IncResourceRecordCount(Header &aHeader, bool aAdditional)
 {
     if (aAdditional)
@@ -658,9 +569,9 @@ exit:
 }
 
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
-Header::Response Server::ResolveBySrp(Header &                  aResponseHeader,
-                                      Message &                 aResponseMessage,
-                                      Server::NameCompressInfo &aCompressInfo)
+Header::Response Server::ResolveBySrp(Header &        aResponseHeader,
+                                      Message &       aResponseMessage,
+                                      NameCompressor &aCompressor)
 {
     Question         question;
     uint16_t         readOffset = sizeof(Header);
@@ -673,7 +584,7 @@ Header::Response Server::ResolveBySrp(Header &                  aResponseHeader,
         IgnoreError(aResponseMessage.Read(readOffset, question));
         readOffset += sizeof(question);
 
-        response = ResolveQuestionBySrp(name, question, aResponseHeader, aResponseMessage, aCompressInfo,
+        response = ResolveQuestionBySrp(name, question, aResponseHeader, aResponseMessage, aCompressor,
                                         /* aAdditional */ false);
 
         LogInfo("ANSWER: TRANSACTION=0x%04x, QUESTION=[%s %d %d], RCODE=%d", aResponseHeader.GetMessageId(), name,
@@ -691,7 +602,7 @@ Header::Response Server::ResolveBySrp(Header &                  aResponseHeader,
             readOffset += sizeof(question);
 
             VerifyOrExit(Header::kResponseServerFailure != ResolveQuestionBySrp(name, question, aResponseHeader,
-                                                                                aResponseMessage, aCompressInfo,
+                                                                                aResponseMessage, aCompressor,
                                                                                 /* aAdditional */ true),
                          response = Header::kResponseServerFailure);
 
@@ -703,12 +614,12 @@ exit:
     return response;
 }
 
-Header::Response Server::ResolveQuestionBySrp(const char *      aName,
-                                              const Question &  aQuestion,
-                                              Header &          aResponseHeader,
-                                              Message &         aResponseMessage,
-                                              NameCompressInfo &aCompressInfo,
-                                              bool              aAdditional)
+Header::Response Server::ResolveQuestionBySrp(const char *    aName,
+                                              const Question &aQuestion,
+                                              Header &        aResponseHeader,
+                                              Message &       aResponseMessage,
+                                              NameCompressor &aCompressor,
+                                              bool            aAdditional)
 {
     Error                    error    = kErrorNone;
     const Srp::Server::Host *host     = nullptr;
@@ -744,7 +655,7 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
                 if (!aAdditional && ptrQueryMatched)
                 {
                     SuccessOrExit(
-                        error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressInfo));
+                        error = AppendPtrRecord(aResponseMessage, aName, instanceName, instanceTtl, aCompressor));
                     IncResourceRecordCount(aResponseHeader, aAdditional);
                     response = Header::kResponseSuccess;
                 }
@@ -755,7 +666,7 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
                 {
                     SuccessOrExit(error = AppendSrvRecord(aResponseMessage, instanceName, hostName, instanceTtl,
                                                           service->GetPriority(), service->GetWeight(),
-                                                          service->GetPort(), aCompressInfo));
+                                                          service->GetPort(), aCompressor));
                     IncResourceRecordCount(aResponseHeader, aAdditional);
                     response = Header::kResponseSuccess;
                 }
@@ -765,7 +676,7 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
                      !HasQuestion(aResponseHeader, aResponseMessage, instanceName, ResourceRecord::kTypeTxt)))
                 {
                     SuccessOrExit(error = AppendTxtRecord(aResponseMessage, instanceName, service->GetTxtData(),
-                                                          service->GetTxtDataLength(), instanceTtl, aCompressInfo));
+                                                          service->GetTxtDataLength(), instanceTtl, aCompressor));
                     IncResourceRecordCount(aResponseHeader, aAdditional);
                     response = Header::kResponseSuccess;
                 }
@@ -783,7 +694,7 @@ Header::Response Server::ResolveQuestionBySrp(const char *      aName,
 
             for (uint8_t i = 0; i < addrNum; i++)
             {
-                SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aCompressInfo));
+                SuccessOrExit(error = AppendAaaaRecord(aResponseMessage, hostName, addrs[i], hostTtl, aCompressor));
                 IncResourceRecordCount(aResponseHeader, aAdditional);
             }
 
@@ -816,7 +727,7 @@ const Srp::Server::Service *Server::GetNextSrpService(const Srp::Server::Host &
 
 Error Server::ResolveByQueryCallbacks(Header &                aResponseHeader,
                                       Message &               aResponseMessage,
-                                      NameCompressInfo &      aCompressInfo,
+                                      NameCompressor &        aCompressor,
                                       const Ip6::MessageInfo &aMessageInfo)
 {
     QueryTransaction *query = nullptr;
@@ -830,7 +741,7 @@ Error Server::ResolveByQueryCallbacks(Header &                aResponseHeader,
     queryType = GetQueryTypeAndName(aResponseHeader, aResponseMessage, name);
     VerifyOrExit(queryType != kDnsQueryNone, error = kErrorNotImplemented);
 
-    query = NewQuery(aResponseHeader, aResponseMessage, aCompressInfo, aMessageInfo);
+    query = NewQuery(aResponseHeader, aResponseMessage, aCompressor, aMessageInfo);
     VerifyOrExit(query != nullptr, error = kErrorNoBufs);
 
     mQuerySubscribe(mQueryCallbackContext, name);
@@ -841,7 +752,7 @@ exit:
 
 Server::QueryTransaction *Server::NewQuery(const Header &          aResponseHeader,
                                            Message &               aResponseMessage,
-                                           const NameCompressInfo &aCompressInfo,
+                                           const NameCompressor &  aCompressor,
                                            const Ip6::MessageInfo &aMessageInfo)
 {
     QueryTransaction *newQuery = nullptr;
@@ -853,7 +764,7 @@ Server::QueryTransaction *Server::NewQuery(const Header &          aResponseHead
             continue;
         }
 
-        query.Init(aResponseHeader, aResponseMessage, aCompressInfo, aMessageInfo, GetInstance());
+        query.Init(aResponseHeader, aResponseMessage, aCompressor, aMessageInfo, GetInstance());
         ExitNow(newQuery = &query);
     }
 
@@ -904,16 +815,16 @@ void Server::AnswerQuery(QueryTransaction &                aQuery,
                          const char *                      aServiceFullName,
                          const otDnssdServiceInstanceInfo &aInstanceInfo)
 {
-    Header &          responseHeader  = aQuery.GetResponseHeader();
-    Message &         responseMessage = aQuery.GetResponseMessage();
-    Error             error           = kErrorNone;
-    NameCompressInfo &compressInfo    = aQuery.GetNameCompressInfo();
+    Header &        responseHeader  = aQuery.GetResponseHeader();
+    Message &       responseMessage = aQuery.GetResponseMessage();
+    Error           error           = kErrorNone;
+    NameCompressor &compressor      = aQuery.GetNameCompressor();
 
     if (HasQuestion(aQuery.GetResponseHeader(), aQuery.GetResponseMessage(), aServiceFullName,
                     ResourceRecord::kTypePtr))
     {
         SuccessOrExit(error = AppendPtrRecord(responseMessage, aServiceFullName, aInstanceInfo.mFullName,
-                                              aInstanceInfo.mTtl, compressInfo));
+                                              aInstanceInfo.mTtl, compressor));
         IncResourceRecordCount(responseHeader, false);
     }
 
@@ -924,7 +835,7 @@ void Server::AnswerQuery(QueryTransaction &                aQuery,
         {
             SuccessOrExit(error = AppendSrvRecord(responseMessage, aInstanceInfo.mFullName, aInstanceInfo.mHostName,
                                                   aInstanceInfo.mTtl, aInstanceInfo.mPriority, aInstanceInfo.mWeight,
-                                                  aInstanceInfo.mPort, compressInfo));
+                                                  aInstanceInfo.mPort, compressor));
             IncResourceRecordCount(responseHeader, additional);
         }
 
@@ -932,7 +843,7 @@ void Server::AnswerQuery(QueryTransaction &                aQuery,
                         ResourceRecord::kTypeTxt) == !additional)
         {
             SuccessOrExit(error = AppendTxtRecord(responseMessage, aInstanceInfo.mFullName, aInstanceInfo.mTxtData,
-                                                  aInstanceInfo.mTxtLength, aInstanceInfo.mTtl, compressInfo));
+                                                  aInstanceInfo.mTxtLength, aInstanceInfo.mTtl, compressor));
             IncResourceRecordCount(responseHeader, additional);
         }
 
@@ -947,7 +858,7 @@ void Server::AnswerQuery(QueryTransaction &                aQuery,
                           !address.IsLoopback());
 
                 SuccessOrExit(error = AppendAaaaRecord(responseMessage, aInstanceInfo.mHostName, address,
-                                                       aInstanceInfo.mTtl, compressInfo));
+                                                       aInstanceInfo.mTtl, compressor));
                 IncResourceRecordCount(responseHeader, additional);
             }
         }
@@ -960,10 +871,10 @@ exit:
 
 void Server::AnswerQuery(QueryTransaction &aQuery, const char *aHostFullName, const otDnssdHostInfo &aHostInfo)
 {
-    Header &          responseHeader  = aQuery.GetResponseHeader();
-    Message &         responseMessage = aQuery.GetResponseMessage();
-    Error             error           = kErrorNone;
-    NameCompressInfo &compressInfo    = aQuery.GetNameCompressInfo();
+    Header &        responseHeader  = aQuery.GetResponseHeader();
+    Message &       responseMessage = aQuery.GetResponseMessage();
+    Error           error           = kErrorNone;
+    NameCompressor &compressor      = aQuery.GetNameCompressor();
 
     if (HasQuestion(aQuery.GetResponseHeader(), aQuery.GetResponseMessage(), aHostFullName, ResourceRecord::kTypeAaaa))
     {
@@ -975,7 +886,7 @@ void Server::AnswerQuery(QueryTransaction &aQuery, const char *aHostFullName, co
                       !address.IsLoopback());
 
             SuccessOrExit(error =
-                              AppendAaaaRecord(responseMessage, aHostFullName, address, aHostInfo.mTtl, compressInfo));
+                              AppendAaaaRecord(responseMessage, aHostFullName, address, aHostInfo.mTtl, compressor));
             IncResourceRecordCount(responseHeader, /* aAdditional */ false);
         }
     }
@@ -1204,7 +1115,7 @@ void Server::FinalizeQuery(QueryTransaction &aQuery, Header::Response aResponseC
 
 void Server::QueryTransaction::Init(const Header &          aResponseHeader,
                                     Message &               aResponseMessage,
-                                    const NameCompressInfo &aCompressInfo,
+                                    const NameCompressor &  aCompressor,
                                     const Ip6::MessageInfo &aMessageInfo,
                                     Instance &              aInstance)
 {
@@ -1213,7 +1124,7 @@ void Server::QueryTransaction::Init(const Header &          aResponseHeader,
     InstanceLocatorInit::Init(aInstance);
     mResponseHeader  = aResponseHeader;
     mResponseMessage = &aResponseMessage;
-    mCompressInfo    = aCompressInfo;
+    mCompressor    = aCompressor;
     mMessageInfo     = aMessageInfo;
     mStartTime       = TimerMilli::GetNow();
 }
@@ -1251,6 +1162,610 @@ void Server::UpdateResponseCounters(Header::Response aResponseCode)
     }
 }
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+
+Dso::Connection *Server::AcceptPushSession(Instance &aInstance, const Ip6::SockAddr &aPeerSockAddr)
+{
+    return aInstance.Get<Server>().AcceptPushSession(aPeerSockAddr);
+}
+
+Dso::Connection *Server::AcceptPushSession(const Ip6::SockAddr &aPeerSockAddr)
+{
+    PushSession *session = nullptr;
+
+    VerifyOrExit(IsRunning());
+
+    if (mPushSessions.IsFull())
+    {
+        LogInfo("Rejected DNS Push session from %s, max sessions reached", aPeerSockAddr.ToString().AsCString());
+        ExitNow();
+    }
+
+    session = PushSession::Allocate(GetInstance(), aPeerSockAddr);
+    VerifyOrExit(session != nullptr);
+
+    IgnoreError(mPushSessions.PushBack(session));
+    LogInfo("Accepted DNS Push session from %s", aPeerSockAddr.ToString().AsCString());
+
+exit:
+    return session;
+}
+
+void Server::FreePushSession(PushSession &aSession)
+{
+    PushSession **entry = mPushSessions.Find(&aSession);
+
+    OT_ASSERT(entry != nullptr);
+    mPushSessions.Remove(*entry);
+    aSession.Free();
+}
+
+void Server::HandlePushConnected(Dso::Connection &aConnection)
+{
+    OT_UNUSED_VARIABLE(aConnection);
+}
+
+void Server::HandlePushSessionEstablished(Dso::Connection &aConnection)
+{
+    OT_UNUSED_VARIABLE(aConnection);
+}
+
+void Server::HandlePushDisconnected(Dso::Connection &aConnection)
+{
+    LogInfo("DNS Push session from %s disconnected", aConnection.GetPeerSockAddr().ToString().AsCString());
+
+    aConnection.Get<Server>().FreePushSession(static_cast<PushSession &>(aConnection));
+}
+
+Error Server::ProcessPushRequest(Dso::Connection &          aConnection,
+                                 Dso::Connection::MessageId aMessageId,
+                                 const Message &            aMessage,
+                                 Dso::Tlv::Type             aPrimaryTlvType)
+{
+    return static_cast<PushSession &>(aConnection).ProcessRequest(aMessageId, aMessage, aPrimaryTlvType);
+}
+
+Error Server::ProcessPushUnidirectional(Dso::Connection &aConnection,
+                                        const Message &  aMessage,
+                                        Dso::Tlv::Type   aPrimaryTlvType)
+{
+    return static_cast<PushSession &>(aConnection).ProcessUnidirectional(aMessage, aPrimaryTlvType);
+}
+
+Error Server::ProcessPushResponse(Dso::Connection &aConnection,
+                                  const Header &   aHeader,
+                                  const Message &  aMessage,
+                                  Dso::Tlv::Type   aResponseTlvType,
+                                  Dso::Tlv::Type   aRequestTlvType)
+{
+    OT_UNUSED_VARIABLE(aConnection);
+    OT_UNUSED_VARIABLE(aHeader);
+    OT_UNUSED_VARIABLE(aMessage);
+    OT_UNUSED_VARIABLE(aResponseTlvType);
+    OT_UNUSED_VARIABLE(aRequestTlvType);
+
+    // DNS Push server never sends a request message, so any
+    // response from client is unexpected.
+
+    return kErrorAbort;
+}
+
+template <typename EntryType> void Server::PushSrpChange(const EntryType &aEntry, SrpChange aChange)
+{
+    uint8_t index = 0;
+
+    while (index < mPushSessions.GetLength())
+    {
+        PushSession &session = *mPushSessions[index];
+
+        if (session.PushChange(aEntry, aChange) != kErrorNone)
+        {
+            // If the change cannot be pushed, the client can no
+            // longer be kept in sync, so the session is aborted. The
+            // client is expected to reconnect and subscribe again.
+            // `FreePushSession()` replaces the entry at `index` with
+            // the last one in `mPushSessions`.
+
+            LogWarn("Failed to push change to %s", session.GetPeerSockAddr().ToString().AsCString());
+            session.Disconnect(Dso::Connection::kForciblyAbort, Dso::Connection::kReasonUnknown);
+            FreePushSession(session);
+            continue;
+        }
+
+        index++;
+    }
+}
+
+void Server::HandleSrpChange(const Srp::Server::Host &aHost, SrpChange aChange)
+{
+    PushSrpChange(aHost, aChange);
+}
+
+void Server::HandleSrpChange(const Srp::Server::Service &aService, SrpChange aChange)
+{
+    PushSrpChange(aService, aChange);
+}
+
+Error Server::AppendPushName(Message &aMessage, const char *aName, bool aIsInstanceName)
+{
+    // Names in a PUSH message are not compressed (RFC 8765). The
+    // <Instance> portion of a service instance name is appended as
+    // a single label (it may contain dot characters).
+
+    Error                    error;
+    NameComponentsOffsetInfo nameInfo;
+
+    VerifyOrExit(aIsInstanceName, error = Name::AppendName(aName, aMessage));
+
+    IgnoreError(FindNameComponents(aName, kDefaultDomainName, nameInfo));
+    VerifyOrExit(nameInfo.IsServiceInstanceName(), error = kErrorInvalidArgs);
+
+    SuccessOrExit(error = Name::AppendLabel(aName, nameInfo.mServiceOffset - 1, aMessage));
+    error = Name::AppendName(aName + nameInfo.mServiceOffset, aMessage);
+
+exit:
+    return error;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Server::PushSession
+
+Server::PushSession::PushSession(Instance &aInstance, const Ip6::SockAddr &aPeerSockAddr)
+    : Dso::Connection(aInstance, aPeerSockAddr, aInstance.Get<Server>().mPushCallbacks)
+{
+}
+
+Error Server::PushSession::ProcessRequest(MessageId aMessageId, const Message &aMessage, Dso::Tlv::Type aPrimaryTlvType)
+{
+    Error            error        = kErrorNone;
+    Message *        response     = nullptr;
+    Subscription *   subscription = nullptr;
+    Header::Response responseCode;
+
+    // `kErrorNotFound` indicates to `Dso` that the TLV type is not
+    // known, so it responds with "DSO Type Not Implemented" error.
+
+    VerifyOrExit(aPrimaryTlvType == Dso::Tlv::kSubscribeType, error = kErrorNotFound);
+
+    responseCode = ProcessSubscribe(aMessageId, aMessage, subscription);
+
+    response = NewMessage();
+    VerifyOrExit(response != nullptr, error = kErrorNoBufs);
+    SuccessOrExit(error = SendResponseMessage(*response, aMessageId, responseCode));
+    response = nullptr;
+
+    // Once the subscription is acknowledged, the existing records
+    // matching it are pushed to client. If this fails, an error is
+    // returned and `Dso` aborts the connection.
+
+    if (subscription != nullptr)
+    {
+        error = PushInitialRecords(*subscription);
+    }
+
+exit:
+    FreeMessageOnError(response, error);
+    return error;
+}
+
+Header::Response Server::PushSession::ProcessSubscribe(MessageId      aMessageId,
+                                                       const Message &aMessage,
+                                                       Subscription *&aSubscription)
+{
+    Header::Response         response     = Header::kResponseSuccess;
+    Subscription *           subscription = nullptr;
+    uint16_t                 offset       = aMessage.GetOffset();
+    Dso::Tlv                 tlv;
+    Question                 question;
+    NameComponentsOffsetInfo nameInfo;
+    char                     name[Name::kMaxNameSize];
+
+    // The SUBSCRIBE TLV value contains a name, type, and class. The
+    // TLV itself is already validated by `Dso` (as the primary TLV).
+
+    IgnoreError(aMessage.Read(offset, tlv));
+    offset += sizeof(tlv);
+
+    VerifyOrExit(Name::ReadName(aMessage, offset, name, sizeof(name)) == kErrorNone,
+                 response = Header::kResponseFormatError);
+    VerifyOrExit(aMessage.Read(offset, question) == kErrorNone, response = Header::kResponseFormatError);
+    offset += sizeof(question);
+    VerifyOrExit(offset <= aMessage.GetOffset() + tlv.GetSize(), response = Header::kResponseFormatError);
+
+    VerifyOrExit(question.GetClass() == ResourceRecord::kClassInternet, response = Header::kResponseNotImplemented);
+    VerifyOrExit(FindNameComponents(name, kDefaultDomainName, nameInfo) == kErrorNone,
+                 response = Header::kResponseNotAuth);
+
+    switch (question.GetType())
+    {
+    case ResourceRecord::kTypePtr:
+        VerifyOrExit(nameInfo.IsServiceName(), response = Header::kResponseRefused);
+        break;
+    case ResourceRecord::kTypeSrv:
+    case ResourceRecord::kTypeTxt:
+        VerifyOrExit(nameInfo.IsServiceInstanceName(), response = Header::kResponseRefused);
+        break;
+    case ResourceRecord::kTypeAaaa:
+        VerifyOrExit(nameInfo.IsHostName(), response = Header::kResponseRefused);
+        break;
+    default:
+        ExitNow(response = Header::kResponseNotImplemented);
+    }
+
+    for (Subscription &entry : mSubscriptions)
+    {
+        if (!entry.IsInUse())
+        {
+            if (subscription == nullptr)
+            {
+                subscription = &entry;
+            }
+
+            continue;
+        }
+
+        // Client must not subscribe to the same name and type more
+        // than once within a session.
+
+        VerifyOrExit((entry.mType != question.GetType()) ||
+                         !StringMatch(entry.mName.AsCString(), name, kStringCaseInsensitiveMatch),
+                     response = Header::kResponseRefused);
+    }
+
+    if (subscription == nullptr)
+    {
+        LogInfo("Refused DNS Push subscription for %s, max subscriptions reached", name);
+        ExitNow(response = Header::kResponseRefused);
+    }
+
+    VerifyOrExit(subscription->mName.Set(name) == kErrorNone, response = Header::kResponseServerFailure);
+    subscription->mMessageId = aMessageId;
+    subscription->mType      = question.GetType();
+
+    SetLongLivedOperation(true);
+    aSubscription = subscription;
+
+    LogInfo("DNS Push subscription (id:%u) for %s, type:%u", aMessageId, name, question.GetType());
+
+exit:
+    return response;
+}
+
+Error Server::PushSession::ProcessUnidirectional(const Message &aMessage, Dso::Tlv::Type aPrimaryTlvType)
+{
+    Error error = kErrorNone;
+
+    switch (aPrimaryTlvType)
+    {
+    case Dso::Tlv::kUnsubscribeType:
+        error = ProcessUnsubscribe(aMessage);
+        break;
+
+    case Dso::Tlv::kReconfirmType:
+        // RECONFIRM applies to records discovered by a Discovery
+        // Proxy. Records from SRP server are authoritative, so it
+        // is ignored.
+        break;
+
+    default:
+        // An unrecognized primary TLV in a unidirectional message
+        // is a fatal error (connection is aborted).
+        error = kErrorAbort;
+        break;
+    }
+
+    return error;
+}
+
+Error Server::PushSession::ProcessUnsubscribe(const Message &aMessage)
+{
+    Error     error  = kErrorNone;
+    uint16_t  offset = aMessage.GetOffset();
+    Dso::Tlv  tlv;
+    MessageId messageId;
+
+    // The UNSUBSCRIBE TLV value contains the message ID of the
+    // SUBSCRIBE request.
+
+    IgnoreError(aMessage.Read(offset, tlv));
+    VerifyOrExit(tlv.GetLength() >= sizeof(messageId), error = kErrorParse);
+    SuccessOrExit(error = aMessage.Read(offset + sizeof(tlv), messageId));
+    messageId = HostSwap16(messageId);
+
+    for (Subscription &subscription : mSubscriptions)
+    {
+        if (subscription.IsInUse() && (subscription.mMessageId == messageId))
+        {
+            LogInfo("DNS Push unsubscribe (id:%u) for %s", messageId, subscription.mName.AsCString());
+            subscription.mName.Free();
+            break;
+        }
+    }
+
+    if (!HasSubscriptions())
+    {
+        SetLongLivedOperation(false);
+    }
+
+exit:
+    return error;
+}
+
+bool Server::PushSession::HasSubscriptions(void) const
+{
+    bool hasSubscriptions = false;
+
+    for (const Subscription &subscription : mSubscriptions)
+    {
+        if (subscription.IsInUse())
+        {
+            hasSubscriptions = true;
+            break;
+        }
+    }
+
+    return hasSubscriptions;
+}
+
+Error Server::PushSession::PushInitialRecords(const Subscription &aSubscription)
+{
+    Error                    error   = kErrorNone;
+    Message *                message = nullptr;
+    const Srp::Server::Host *host    = nullptr;
+
+    while ((host = Get<Server>().GetNextSrpHost(host)) != nullptr)
+    {
+        const Srp::Server::Service *service = nullptr;
+
+        SuccessOrExit(error = AppendRecords(message, aSubscription, *host, kSrpAdded));
+
+        while ((service = GetNextSrpService(*host, service)) != nullptr)
+        {
+            SuccessOrExit(error = AppendRecords(message, aSubscription, *service, kSrpAdded));
+        }
+    }
+
+    error   = SendPushMessage(message);
+    message = nullptr;
+
+exit:
+    FreeMessageOnError(message, error);
+    return error;
+}
+
+template <typename EntryType> Error Server::PushSession::PushChange(const EntryType &aEntry, SrpChange aChange)
+{
+    Error    error   = kErrorNone;
+    Message *message = nullptr;
+
+    // All records matching the session's subscriptions are included
+    // in a single PUSH message.
+
+    for (const Subscription &subscription : mSubscriptions)
+    {
+        if (subscription.IsInUse())
+        {
+            SuccessOrExit(error = AppendRecords(message, subscription, aEntry, aChange));
+        }
+    }
+
+    error   = SendPushMessage(message);
+    message = nullptr;
+
+exit:
+    FreeMessageOnError(message, error);
+    return error;
+}
+
+Error Server::PushSession::AppendRecords(Message *&               aMessage,
+                                         const Subscription &     aSubscription,
+                                         const Srp::Server::Host &aHost,
+                                         SrpChange                aChange)
+{
+    Error               error = kErrorNone;
+    const Ip6::Address *addresses;
+    uint8_t             addressesNum;
+    uint32_t            ttl;
+
+    VerifyOrExit((aSubscription.mType == ResourceRecord::kTypeAaaa) && aHost.Matches(aSubscription.mName.AsCString()));
+
+    if (aChange != kSrpAdded)
+    {
+        SuccessOrExit(error = AppendRemoveAllRecord(aMessage, aHost.GetFullName(), ResourceRecord::kTypeAaaa));
+    }
+
+    VerifyOrExit(aChange != kSrpRemoved);
+
+    addresses = aHost.GetAddresses(addressesNum);
+    ttl       = TimeMilli::MsecToSec(aHost.GetExpireTime() - TimerMilli::GetNow());
+
+    for (uint8_t i = 0; i < addressesNum; i++)
+    {
+        AaaaRecord aaaaRecord;
+
+        aaaaRecord.Init();
+        aaaaRecord.SetTtl(ttl);
+        aaaaRecord.SetAddress(addresses[i]);
+
+        SuccessOrExit(error = PrepareMessage(aMessage));
+        SuccessOrExit(error = AppendPushName(*aMessage, aHost.GetFullName(), /* aIsInstanceName */ false));
+        SuccessOrExit(error = aMessage->Append(aaaaRecord));
+    }
+
+exit:
+    return error;
+}
+
+Error Server::PushSession::AppendRecords(Message *&                  aMessage,
+                                         const Subscription &        aSubscription,
+                                         const Srp::Server::Service &aService,
+                                         SrpChange                   aChange)
+{
+    Error       error        = kErrorNone;
+    const char *instanceName = aService.GetInstanceName();
+    uint16_t    type         = aSubscription.mType;
+    uint32_t    ttl          = kPushRemoveTtl;
+    uint16_t    recordOffset;
+
+    if (aChange != kSrpRemoved)
+    {
+        ttl = TimeMilli::MsecToSec(aService.GetExpireTime() - TimerMilli::GetNow());
+    }
+
+    switch (type)
+    {
+    case ResourceRecord::kTypePtr:
+    {
+        PtrRecord ptrRecord;
+
+        // The PTR record is only added or removed. An update of the
+        // service does not change it.
+
+        VerifyOrExit((aChange != kSrpUpdated) && aService.MatchesServiceName(aSubscription.mName.AsCString()));
+
+        ptrRecord.Init();
+        ptrRecord.SetTtl(ttl);
+
+        SuccessOrExit(error = PrepareMessage(aMessage));
+        SuccessOrExit(error = AppendPushName(*aMessage, aService.GetServiceName(), /* aIsInstanceName */ false));
+        recordOffset = aMessage->GetLength();
+        SuccessOrExit(error = aMessage->Append(ptrRecord));
+        SuccessOrExit(error = AppendPushName(*aMessage, instanceName, /* aIsInstanceName */ true));
+
+        ptrRecord.SetLength(aMessage->GetLength() - (recordOffset + sizeof(ResourceRecord)));
+        aMessage->Write(recordOffset, ptrRecord);
+        break;
+    }
+
+    case ResourceRecord::kTypeSrv:
+    case ResourceRecord::kTypeTxt:
+
+        // Sub-types share the SRV and TXT records of the base type.
+
+        VerifyOrExit(!aService.IsSubType() && aService.MatchesInstanceName(aSubscription.mName.AsCString()));
+
+        if (aChange != kSrpAdded)
+        {
+            SuccessOrExit(error = AppendRemoveAllRecord(aMessage, instanceName, type));
+        }
+
+        VerifyOrExit(aChange != kSrpRemoved);
+
+        SuccessOrExit(error = PrepareMessage(aMessage));
+        SuccessOrExit(error = AppendPushName(*aMessage, instanceName, /* aIsInstanceName */ true));
+        recordOffset = aMessage->GetLength();
+
+        if (type == ResourceRecord::kTypeSrv)
+        {
+            SrvRecord srvRecord;
+
+            srvRecord.Init();
+            srvRecord.SetTtl(ttl);
+            srvRecord.SetPriority(aService.GetPriority());
+            srvRecord.SetWeight(aService.GetWeight());
+            srvRecord.SetPort(aService.GetPort());
+
+            SuccessOrExit(error = aMessage->Append(srvRecord));
+            SuccessOrExit(error = AppendPushName(*aMessage, aService.GetHost().GetFullName(),
+                                                 /* aIsInstanceName */ false));
+
+            srvRecord.SetLength(aMessage->GetLength() - (recordOffset + sizeof(ResourceRecord)));
+            aMessage->Write(recordOffset, srvRecord);
+        }
+        else
+        {
+            TxtRecord     txtRecord;
+            uint16_t      txtLength = aService.GetTxtDataLength();
+            const uint8_t kEmptyTxt = 0;
+
+            txtRecord.Init();
+            txtRecord.SetTtl(ttl);
+            txtRecord.SetLength(txtLength > 0 ? txtLength : sizeof(kEmptyTxt));
+
+            SuccessOrExit(error = aMessage->Append(txtRecord));
+
+            if (txtLength > 0)
+            {
+                SuccessOrExit(error = aMessage->AppendBytes(aService.GetTxtData(), txtLength));
+            }
+            else
+            {
+                SuccessOrExit(error = aMessage->Append(kEmptyTxt));
+            }
+        }
+        break;
+
+    default:
+        break;
+    }
+
+exit:
+    return error;
+}
+
+Error Server::PushSession::AppendRemoveAllRecord(Message *&aMessage, const char *aName, uint16_t aType)
+{
+    // Appends a record removing all records of `aType` for `aName`.
+    // `aName` is a host name for AAAA, otherwise an instance name.
+
+    Error          error;
+    ResourceRecord record;
+
+    record.Init(aType);
+    record.SetTtl(kPushRemoveAllTtl);
+    record.SetLength(0);
+
+    SuccessOrExit(error = PrepareMessage(aMessage));
+    SuccessOrExit(error = AppendPushName(*aMessage, aName, (aType != ResourceRecord::kTypeAaaa)));
+    error = aMessage->Append(record);
+
+exit:
+    return error;
+}
+
+Error Server::PushSession::PrepareMessage(Message *&aMessage)
+{
+    // Allocates the PUSH message (if not already allocated) and
+    // appends the PUSH TLV header. The TLV length is updated from
+    // `SendPushMessage()`.
+
+    Error    error = kErrorNone;
+    Dso::Tlv tlv;
+
+    VerifyOrExit(aMessage == nullptr);
+
+    aMessage = NewMessage();
+    VerifyOrExit(aMessage != nullptr, error = kErrorNoBufs);
+
+    tlv.Init(Dso::Tlv::kPushType, 0);
+    error = aMessage->Append(tlv);
+
+exit:
+    return error;
+}
+
+Error Server::PushSession::SendPushMessage(Message *aMessage)
+{
+    // Sends the PUSH message and takes its ownership (it is freed on
+    // failure). Nothing is sent if `aMessage` is `nullptr`.
+
+    Error    error = kErrorNone;
+    Dso::Tlv tlv;
+
+    VerifyOrExit(aMessage != nullptr);
+
+    tlv.Init(Dso::Tlv::kPushType, aMessage->GetLength() - sizeof(tlv));
+    aMessage->Write(0, tlv);
+
+    error = SendUnidirectionalMessage(*aMessage);
+
+exit:
+    FreeMessageOnError(aMessage, error);
+    return error;
+}
+
+#endif // OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+
 } // namespace ServiceDiscovery
 } // namespace Dns
 } // namespace ot
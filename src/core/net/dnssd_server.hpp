@@ -35,15 +35,25 @@
 
 #include <openthread/dnssd_server.h>
 
+#include "common/array.hpp"
 #include "common/as_core_type.hpp"
+#include "common/heap_allocatable.hpp"
+#include "common/heap_string.hpp"
 #include "common/message.hpp"
 #include "common/non_copyable.hpp"
 #include "common/timer.hpp"
+#include "net/dns_dso.hpp"
 #include "net/dns_types.hpp"
 #include "net/ip6.hpp"
 #include "net/netif.hpp"
 #include "net/srp_server.hpp"
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+#if !OPENTHREAD_CONFIG_DNS_DSO_ENABLE || !OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
+#error "OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE requires OPENTHREAD_CONFIG_DNS_DSO_ENABLE and SRP server"
+#endif
+#endif
+
 /**
  * @file
  *   This file includes definitions for the DNS-SD server.
@@ -172,84 +182,6 @@ public:
     const Counters &GetCounters(void) const { return mCounters; };
 
 private:
-    class NameCompressInfo : public Clearable<NameCompressInfo>
-    {
-    public:
-        explicit NameCompressInfo(void) = default;
-
-        explicit NameCompressInfo(const char *aDomainName)
-            : mDomainName(aDomainName)
-            , mDomainNameOffset(kUnknownOffset)
-            , mServiceNameOffset(kUnknownOffset)
-            , mInstanceNameOffset(kUnknownOffset)
-            , mHostNameOffset(kUnknownOffset)
-        {
-        }
-
-        static constexpr uint16_t kUnknownOffset = 0; // Unknown offset value (used when offset is not yet set).
-
-        uint16_t GetDomainNameOffset(void) const { return mDomainNameOffset; }
-
-        void SetDomainNameOffset(uint16_t aOffset) { mDomainNameOffset = aOffset; }
-
-        const char *GetDomainName(void) const { return mDomainName; }
-
-        uint16_t GetServiceNameOffset(const Message &aMessage, const char *aServiceName) const
-        {
-            return MatchCompressedName(aMessage, mServiceNameOffset, aServiceName)
-                       ? mServiceNameOffset
-                       : static_cast<uint16_t>(kUnknownOffset);
-        };
-
-        void SetServiceNameOffset(uint16_t aOffset)
-        {
-            if (mServiceNameOffset == kUnknownOffset)
-            {
-                mServiceNameOffset = aOffset;
-            }
-        }
-
-        uint16_t GetInstanceNameOffset(const Message &aMessage, const char *aName) const
-        {
-            return MatchCompressedName(aMessage, mInstanceNameOffset, aName) ? mInstanceNameOffset
-                                                                             : static_cast<uint16_t>(kUnknownOffset);
-        }
-
-        void SetInstanceNameOffset(uint16_t aOffset)
-        {
-            if (mInstanceNameOffset == kUnknownOffset)
-            {
-                mInstanceNameOffset = aOffset;
-            }
-        }
-
-        uint16_t GetHostNameOffset(const Message &aMessage, const char *aName) const
-        {
-            return MatchCompressedName(aMessage, mHostNameOffset, aName) ? mHostNameOffset
-                                                                         : static_cast<uint16_t>(kUnknownOffset);
-        }
-
-        void SetHostNameOffset(uint16_t aOffset)
-        {
-            if (mHostNameOffset == kUnknownOffset)
-            {
-                mHostNameOffset = aOffset;
-            }
-        }
-
-    private:
-        static bool MatchCompressedName(const Message &aMessage, uint16_t aOffset, const char *aName)
-        {
-            return aOffset != kUnknownOffset && Name::CompareName(aMessage, aOffset, aName) == kErrorNone;
-        }
-
-        const char *mDomainName;         // The serialized domain name.
-        uint16_t    mDomainNameOffset;   // Offset of domain name serialization into the response message.
-        uint16_t    mServiceNameOffset;  // Offset of service name serialization into the response message.
-        uint16_t    mInstanceNameOffset; // Offset of instance name serialization into the response message.
-        uint16_t    mHostNameOffset;     // Offset of host name serialization into the response message.
-    };
-
     static constexpr bool     kBindUnspecifiedNetif = OPENTHREAD_CONFIG_DNSSD_SERVER_BIND_UNSPECIFIED_NETIF;
     static constexpr uint8_t  kProtocolLabelLength  = 4;
     static constexpr uint8_t  kSubTypeLabelLength   = 4;
@@ -299,7 +231,7 @@ private:
 
         void                    Init(const Header &          aResponseHeader,
                                      Message &               aResponseMessage,
-                                     const NameCompressInfo &aCompressInfo,
+                                     const NameCompressor &  aCompressor,
                                      const Ip6::MessageInfo &aMessageInfo,
                                      Instance &              aInstance);
         bool                    IsValid(void) const { return mResponseMessage != nullptr; }
@@ -309,58 +241,114 @@ private:
         const Message &         GetResponseMessage(void) const { return *mResponseMessage; }
         Message &               GetResponseMessage(void) { return *mResponseMessage; }
         TimeMilli               GetStartTime(void) const { return mStartTime; }
-        NameCompressInfo &      GetNameCompressInfo(void) { return mCompressInfo; };
+        NameCompressor &        GetNameCompressor(void) { return mCompressor; };
         void                    Finalize(Header::Response aResponseMessage, Ip6::Udp::Socket &aSocket);
 
         Header           mResponseHeader;
         Message *        mResponseMessage;
-        NameCompressInfo mCompressInfo;
+        NameCompressor   mCompressor;
         Ip6::MessageInfo mMessageInfo;
         TimeMilli        mStartTime;
     };
 
     static constexpr uint32_t kQueryTimeout = OPENTHREAD_CONFIG_DNSSD_QUERY_TIMEOUT;
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+    static constexpr uint8_t kMaxPushSessions      = OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_MAX_SESSIONS;
+    static constexpr uint8_t kMaxPushSubscriptions = OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_MAX_SUBSCRIPTIONS;
+
+    // TTL values in a PUSH message indicating removal of a single
+    // record, or of all records with a given name and type (RFC 8765).
+    static constexpr uint32_t kPushRemoveTtl    = 0xffffffff;
+    static constexpr uint32_t kPushRemoveAllTtl = 0xfffffffe;
+
+    // Change to SRP server records signalled from `Srp::Server`.
+    enum SrpChange : uint8_t
+    {
+        kSrpAdded,   // Host or service is added (or re-added after being deleted).
+        kSrpUpdated, // Records of an existing host or service are changed.
+        kSrpRemoved, // Host or service is removed (deleted or expired).
+    };
+
+    // A DSO session from a DNS Push client along with its subscriptions.
+    class PushSession : public Dso::Connection, public Heap::Allocatable<PushSession>
+    {
+    public:
+        PushSession(Instance &aInstance, const Ip6::SockAddr &aPeerSockAddr);
+
+        Error ProcessRequest(MessageId aMessageId, const Message &aMessage, Dso::Tlv::Type aPrimaryTlvType);
+        Error ProcessUnidirectional(const Message &aMessage, Dso::Tlv::Type aPrimaryTlvType);
+
+        template <typename EntryType> Error PushChange(const EntryType &aEntry, SrpChange aChange);
+
+    private:
+        struct Subscription
+        {
+            bool IsInUse(void) const { return !mName.IsNull(); }
+
+            MessageId    mMessageId; // Message ID of the SUBSCRIBE request.
+            uint16_t     mType;      // Record type (PTR, SRV, TXT, or AAAA).
+            Heap::String mName;      // Subscribed name.
+        };
+
+        Header::Response ProcessSubscribe(MessageId aMessageId, const Message &aMessage, Subscription *&aSubscription);
+        Error            ProcessUnsubscribe(const Message &aMessage);
+        Error            PushInitialRecords(const Subscription &aSubscription);
+        Error            AppendRecords(Message *&                aMessage,
+                                       const Subscription &      aSubscription,
+                                       const Srp::Server::Host & aHost,
+                                       SrpChange                 aChange);
+        Error            AppendRecords(Message *&                  aMessage,
+                                       const Subscription &        aSubscription,
+                                       const Srp::Server::Service &aService,
+                                       SrpChange                   aChange);
+        Error            AppendRemoveAllRecord(Message *&aMessage, const char *aName, uint16_t aType);
+        Error            PrepareMessage(Message *&aMessage);
+        Error            SendPushMessage(Message *aMessage);
+        bool             HasSubscriptions(void) const;
+
+        Subscription mSubscriptions[kMaxPushSubscriptions];
+    };
+#endif
+
     bool        IsRunning(void) const { return mSocket.IsBound(); }
     static void HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleUdpReceive(Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
     void ProcessQuery(const Header &aRequestHeader, Message &aRequestMessage, const Ip6::MessageInfo &aMessageInfo);
-    static Header::Response AddQuestions(const Header &    aRequestHeader,
-                                         const Message &   aRequestMessage,
-                                         Header &          aResponseHeader,
-                                         Message &         aResponseMessage,
-                                         NameCompressInfo &aCompressInfo);
-    static Error            AppendQuestion(const char *      aName,
-                                           const Question &  aQuestion,
-                                           Message &         aMessage,
-                                           NameCompressInfo &aCompressInfo);
-    static Error            AppendPtrRecord(Message &         aMessage,
-                                            const char *      aServiceName,
-                                            const char *      aInstanceName,
-                                            uint32_t          aTtl,
-                                            NameCompressInfo &aCompressInfo);
-    static Error            AppendSrvRecord(Message &         aMessage,
-                                            const char *      aInstanceName,
-                                            const char *      aHostName,
-                                            uint32_t          aTtl,
-                                            uint16_t          aPriority,
-                                            uint16_t          aWeight,
-                                            uint16_t          aPort,
-                                            NameCompressInfo &aCompressInfo);
-    static Error            AppendTxtRecord(Message &         aMessage,
-                                            const char *      aInstanceName,
-                                            const void *      aTxtData,
-                                            uint16_t          aTxtLength,
-                                            uint32_t          aTtl,
-                                            NameCompressInfo &aCompressInfo);
+    static Header::Response AddQuestions(const Header &  aRequestHeader,
+                                         const Message & aRequestMessage,
+                                         Header &        aResponseHeader,
+                                         Message &       aResponseMessage,
+                                         NameCompressor &aCompressor);
+    static Error            AppendQuestion(const char *    aName,
+                                           const Question &aQuestion,
+                                           Message &       aMessage,
+                                           NameCompressor &aCompressor);
+    static Error            AppendPtrRecord(Message &       aMessage,
+                                            const char *    aServiceName,
+                                            const char *    aInstanceName,
+                                            uint32_t        aTtl,
+                                            NameCompressor &aCompressor);
+    static Error            AppendSrvRecord(Message &       aMessage,
+                                            const char *    aInstanceName,
+                                            const char *    aHostName,
+                                            uint32_t        aTtl,
+                                            uint16_t        aPriority,
+                                            uint16_t        aWeight,
+                                            uint16_t        aPort,
+                                            NameCompressor &aCompressor);
+    static Error            AppendTxtRecord(Message &       aMessage,
+                                            const char *    aInstanceName,
+                                            const void *    aTxtData,
+                                            uint16_t        aTxtLength,
+                                            uint32_t        aTtl,
+                                            NameCompressor &aCompressor);
     static Error            AppendAaaaRecord(Message &           aMessage,
                                              const char *        aHostName,
                                              const Ip6::Address &aAddress,
                                              uint32_t            aTtl,
-                                             NameCompressInfo &  aCompressInfo);
-    static Error            AppendServiceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo);
-    static Error            AppendInstanceName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo);
-    static Error            AppendHostName(Message &aMessage, const char *aName, NameCompressInfo &aCompressInfo);
+                                             NameCompressor &    aCompressor);
+    static Error            AppendInstanceName(Message &aMessage, const char *aName, NameCompressor &aCompressor);
     static void             IncResourceRecordCount(Header &aHeader, bool aAdditional);
     static Error            FindNameComponents(const char *aName, const char *aDomain, NameComponentsOffsetInfo &aInfo);
     static Error            FindPreviousLabel(const char *aName, uint8_t &aStart, uint8_t &aStop);
@@ -370,15 +358,15 @@ private:
                                          const Ip6::MessageInfo &aMessageInfo,
                                          Ip6::Udp::Socket &      aSocket);
 #if OPENTHREAD_CONFIG_SRP_SERVER_ENABLE
-    Header::Response                   ResolveBySrp(Header &                  aResponseHeader,
-                                                    Message &                 aResponseMessage,
-                                                    Server::NameCompressInfo &aCompressInfo);
-    Header::Response                   ResolveQuestionBySrp(const char *      aName,
-                                                            const Question &  aQuestion,
-                                                            Header &          aResponseHeader,
-                                                            Message &         aResponseMessage,
-                                                            NameCompressInfo &aCompressInfo,
-                                                            bool              aAdditional);
+    Header::Response                   ResolveBySrp(Header &        aResponseHeader,
+                                                    Message &       aResponseMessage,
+                                                    NameCompressor &aCompressor);
+    Header::Response                   ResolveQuestionBySrp(const char *    aName,
+                                                            const Question &aQuestion,
+                                                            Header &        aResponseHeader,
+                                                            Message &       aResponseMessage,
+                                                            NameCompressor &aCompressor,
+                                                            bool            aAdditional);
     const Srp::Server::Host *          GetNextSrpHost(const Srp::Server::Host *aHost);
     static const Srp::Server::Service *GetNextSrpService(const Srp::Server::Host &   aHost,
                                                          const Srp::Server::Service *aService);
@@ -386,11 +374,11 @@ private:
 
     Error             ResolveByQueryCallbacks(Header &                aResponseHeader,
                                               Message &               aResponseMessage,
-                                              NameCompressInfo &      aCompressInfo,
+                                              NameCompressor &        aCompressor,
                                               const Ip6::MessageInfo &aMessageInfo);
     QueryTransaction *NewQuery(const Header &          aResponseHeader,
                                Message &               aResponseMessage,
-                               const NameCompressInfo &aCompressInfo,
+                               const NameCompressor &  aCompressor,
                                const Ip6::MessageInfo &aMessageInfo);
     static bool       CanAnswerQuery(const QueryTransaction &          aQuery,
                                      const char *                      aServiceFullName,
@@ -411,6 +399,32 @@ private:
 
     void UpdateResponseCounters(Header::Response aResponseCode);
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+    void                               HandleSrpChange(const Srp::Server::Host &aHost, SrpChange aChange);
+    void                               HandleSrpChange(const Srp::Server::Service &aService, SrpChange aChange);
+    template <typename EntryType> void PushSrpChange(const EntryType &aEntry, SrpChange aChange);
+    static Error                       AppendPushName(Message &aMessage, const char *aName, bool aIsInstanceName);
+
+    static Dso::Connection *AcceptPushSession(Instance &aInstance, const Ip6::SockAddr &aPeerSockAddr);
+    Dso::Connection *       AcceptPushSession(const Ip6::SockAddr &aPeerSockAddr);
+    void                    FreePushSession(PushSession &aSession);
+    static void             HandlePushConnected(Dso::Connection &aConnection);
+    static void             HandlePushSessionEstablished(Dso::Connection &aConnection);
+    static void             HandlePushDisconnected(Dso::Connection &aConnection);
+    static Error            ProcessPushRequest(Dso::Connection &          aConnection,
+                                               Dso::Connection::MessageId aMessageId,
+                                               const Message &            aMessage,
+                                               Dso::Tlv::Type             aPrimaryTlvType);
+    static Error            ProcessPushUnidirectional(Dso::Connection &aConnection,
+                                                      const Message &  aMessage,
+                                                      Dso::Tlv::Type   aPrimaryTlvType);
+    static Error            ProcessPushResponse(Dso::Connection &aConnection,
+                                                const Header &   aHeader,
+                                                const Message &  aMessage,
+                                                Dso::Tlv::Type   aResponseTlvType,
+                                                Dso::Tlv::Type   aRequestTlvType);
+#endif
+
     static const char kDnssdProtocolUdp[];
     static const char kDnssdProtocolTcp[];
     static const char kDnssdSubTypeLabel[];
@@ -423,6 +437,11 @@ private:
     otDnssdQueryUnsubscribeCallback mQueryUnsubscribe;
     TimerMilli                      mTimer;
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+    Dso::Connection::Callbacks              mPushCallbacks;
+    Array<PushSession *, kMaxPushSessions> mPushSessions;
+#endif
+
     Counters mCounters;
 };
 
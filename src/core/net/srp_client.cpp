@@ -255,6 +255,7 @@ Client::Client(Instance &aInstance)
 #endif
     , mUpdateMessageId(0)
     , mRetryWaitInterval(kMinRetryWaitInterval)
+    , mUpdateTxTime(TimerMilli::GetNow() - kUpdateHoldDownInterval)
     , mAcceptedLeaseInterval(0)
     , mTtl(0)
     , mLeaseInterval(kDefaultLease)
@@ -336,6 +337,7 @@ void Client::Stop(Requester aRequester, StopMode aMode)
     VerifyOrExit(GetState() != kStateStopped);
 
     mSingleServiceMode.Disable();
+    mSignatureCache.Invalidate();
 
     // State changes:
     //   kAdding     -> kToRefresh
@@ -406,6 +408,7 @@ void Client::Pause(void)
     };
 
     mSingleServiceMode.Disable();
+    mSignatureCache.Invalidate();
 
     // State changes:
     //   kAdding     -> kToRefresh
@@ -690,7 +693,7 @@ void Client::SetState(State aState)
         break;
 
     case kStateToUpdate:
-        mTimer.Start(kUpdateTxDelay);
+        mTimer.Start(DetermineUpdateTxDelay());
         break;
 
     case kStateUpdating:
@@ -804,8 +807,9 @@ void Client::SendUpdate(void)
     ChangeHostAndServiceStates(kNewStateOnMessageTx);
 
     // Remember the update message tx time to use later to determine the
-    // lease renew time.
+    // lease renew time and the hold-down before next update tx.
     mLeaseRenewTime      = TimerMilli::GetNow();
+    mUpdateTxTime        = mLeaseRenewTime;
     mTxFailureRetryCount = 0;
 
     SetState(kStateUpdating);
@@ -869,13 +873,19 @@ Error Client::PrepareUpdateMessage(Message &aMessage)
 
     SuccessOrExit(error = ReadOrGenerateKey(info.mKeyPair));
 
-    // Generate random Message ID and ensure it is different from last one
-    do
-    {
-        SuccessOrExit(error = header.SetRandomMessageId());
-    } while (header.GetMessageId() == mUpdateMessageId);
+    // When retransmitting a previously signed update, start with the
+    // same message ID. If the content turns out to be identical, the
+    // earlier signature is reused (see `AppendSignature()`), otherwise
+    // a new message ID is generated before signing.
 
-    mUpdateMessageId = header.GetMessageId();
+    if (mSignatureCache.IsValid())
+    {
+        header.SetMessageId(mUpdateMessageId);
+    }
+    else
+    {
+        SuccessOrExit(error = GenerateMessageId(header));
+    }
 
     // SRP Update (DNS Update) message must have exactly one record in
     // Zone section, no records in Prerequisite Section, can have
@@ -893,8 +903,7 @@ Error Client::PrepareUpdateMessage(Message &aMessage)
 
     // Prepare Zone section
 
-    info.mDomainNameOffset = aMessage.GetLength();
-    SuccessOrExit(error = Dns::Name::AppendName(mDomainName, aMessage));
+    SuccessOrExit(error = info.mCompressor.AppendName(mDomainName, aMessage));
     SuccessOrExit(error = aMessage.Append(Dns::Zone()));
 
     // Prepare Update section
@@ -922,6 +931,8 @@ Error Client::PrepareUpdateMessage(Message &aMessage)
     SuccessOrExit(error = AppendUpdateLeaseOptRecord(aMessage));
     SuccessOrExit(error = AppendSignature(aMessage, info));
 
+    // Message ID may be changed by `AppendSignature()`.
+    header.SetMessageId(mUpdateMessageId);
     header.SetAdditionalRecordCount(2); // Lease OPT and SIG RRs
     aMessage.Write(kHeaderOffset, header);
 
@@ -929,6 +940,23 @@ exit:
     return error;
 }
 
+Error Client::GenerateMessageId(Dns::UpdateHeader &aHeader)
+{
+    // Generate random Message ID and ensure it is different from last one
+
+    Error error;
+
+    do
+    {
+        SuccessOrExit(error = aHeader.SetRandomMessageId());
+    } while (aHeader.GetMessageId() == mUpdateMessageId);
+
+    mUpdateMessageId = aHeader.GetMessageId();
+
+exit:
+    return error;
+}
+
 Error Client::ReadOrGenerateKey(Crypto::Ecdsa::P256::KeyPair &aKeyPair)
 {
     Error error;
@@ -958,7 +986,6 @@ Error Client::AppendServiceInstructions(Service &aService, Message &aMessage, In
     Dns::ResourceRecord rr;
     Dns::SrvRecord      srv;
     bool                removing;
-    uint16_t            serviceNameOffset;
     uint16_t            instanceNameOffset;
     uint16_t            offset;
 
@@ -980,10 +1007,10 @@ Error Client::AppendServiceInstructions(Service &aService, Message &aMessage, In
 
     // PTR record
 
-    // "service name labels" + (pointer to) domain name.
-    serviceNameOffset = aMessage.GetLength();
-    SuccessOrExit(error = Dns::Name::AppendMultipleLabels(aService.GetName(), aMessage));
-    SuccessOrExit(error = Dns::Name::AppendPointerLabel(aInfo.mDomainNameOffset, aMessage));
+    // "service name labels" + domain name. The name compressor
+    // turns this into a pointer when another service of the same
+    // type (or a shared suffix of it) is already in the message.
+    SuccessOrExit(error = AppendFullName(nullptr, aService.GetName(), aMessage, aInfo));
 
     // On remove, we use "Delete an RR from an RRSet" where class is set
     // to NONE and TTL to zero (RFC 2136 - section 2.5.4).
@@ -995,33 +1022,24 @@ Error Client::AppendServiceInstructions(Service &aService, Message &aMessage, In
 
     // "Instance name" + (pointer to) service name.
     instanceNameOffset = aMessage.GetLength();
-    SuccessOrExit(error = Dns::Name::AppendLabel(aService.GetInstanceName(), aMessage));
-    SuccessOrExit(error = Dns::Name::AppendPointerLabel(serviceNameOffset, aMessage));
+    SuccessOrExit(error = AppendFullName(aService.GetInstanceName(), aService.GetName(), aMessage, aInfo));
 
     UpdateRecordLengthInMessage(rr, offset, aMessage);
     aInfo.mRecordCount++;
 
     if (aService.HasSubType())
     {
-        const char *subTypeLabel;
-        uint16_t    subServiceNameOffset = 0;
+        const char *                    subTypeLabel;
+        String<Dns::Name::kMaxNameSize> subServiceName;
+
+        subServiceName.Append("_sub.%s", aService.GetName());
+        VerifyOrExit(!subServiceName.IsTruncated(), error = kErrorInvalidArgs);
 
         for (uint16_t index = 0; (subTypeLabel = aService.GetSubTypeLabelAt(index)) != nullptr; ++index)
         {
             // subtype label + "_sub" label + (pointer to) service name.
 
-            SuccessOrExit(error = Dns::Name::AppendLabel(subTypeLabel, aMessage));
-
-            if (index == 0)
-            {
-                subServiceNameOffset = aMessage.GetLength();
-                SuccessOrExit(error = Dns::Name::AppendLabel("_sub", aMessage));
-                SuccessOrExit(error = Dns::Name::AppendPointerLabel(serviceNameOffset, aMessage));
-            }
-            else
-            {
-                SuccessOrExit(error = Dns::Name::AppendPointerLabel(subServiceNameOffset, aMessage));
-            }
+            SuccessOrExit(error = AppendFullName(subTypeLabel, subServiceName.AsCString(), aMessage, aInfo));
 
             // `rr` is already initialized as PTR (add or remove).
             offset = aMessage.GetLength();
@@ -1214,18 +1232,35 @@ Error Client::AppendHostName(Message &aMessage, Info &aInfo, bool aDoNotCompress
         ExitNow();
     }
 
-    // If host name was previously added in the message, add it
-    // compressed as pointer to the previous one. Otherwise,
-    // append it and remember the offset.
+    // If host name was previously added in the message, the name
+    // compressor adds it as pointer to the previous one.
+
+    error = AppendFullName(nullptr, mHostInfo.GetName(), aMessage, aInfo);
 
-    if (aInfo.mHostNameOffset != Info::kUnknownOffset)
+exit:
+    return error;
+}
+
+Error Client::AppendFullName(const char *aLabel, const char *aLabels, Message &aMessage, Info &aInfo) const
+{
+    // This method appends "<aLabel>.<aLabels>.<domain>" using the name
+    // compressor. `aLabel` is optional (can be `nullptr`) and is
+    // appended as a single label (can contain dot characters).
+
+    Error                           error = kErrorNone;
+    String<Dns::Name::kMaxNameSize> name;
+
+    name.Append("%s.%s", aLabels, mDomainName);
+    VerifyOrExit(!name.IsTruncated(), error = kErrorInvalidArgs);
+
+    if (aLabel != nullptr)
     {
-        ExitNow(error = Dns::Name::AppendPointerLabel(aInfo.mHostNameOffset, aMessage));
+        error = aInfo.mCompressor.AppendName(aLabel, name.AsCString(), aMessage);
+    }
+    else
+    {
+        error = aInfo.mCompressor.AppendName(name.AsCString(), aMessage);
     }
-
-    aInfo.mHostNameOffset = aMessage.GetLength();
-    SuccessOrExit(error = Dns::Name::AppendMultipleLabels(mHostInfo.GetName(), aMessage));
-    error = Dns::Name::AppendPointerLabel(aInfo.mDomainNameOffset, aMessage);
 
 exit:
     return error;
@@ -1272,11 +1307,9 @@ Error Client::AppendSignature(Message &aMessage, Info &aInfo)
 {
     Error                          error;
     Dns::SigRecord                 sig;
-    Crypto::Sha256                 sha256;
     Crypto::Sha256::Hash           hash;
     Crypto::Ecdsa::P256::Signature signature;
     uint16_t                       offset;
-    uint16_t                       len;
 
     // Prepare SIG RR: TTL, type covered, labels count should be set
     // to zero. Since we have no clock, inception and expiration time
@@ -1296,24 +1329,37 @@ Error Client::AppendSignature(Message &aMessage, Info &aInfo)
     SuccessOrExit(error = aMessage.Append(sig));
     SuccessOrExit(error = AppendHostName(aMessage, aInfo, /* aDoNotCompress */ true));
 
-    // Calculate signature (RFC 2931): Calculated over "data" which is
-    // concatenation of (1) the SIG RR RDATA wire format (including
-    // the canonical form of the signer's name), entirely omitting the
-    // signature subfield, (2) DNS query message, including DNS header
-    // but not UDP/IP header before the header RR counts have been
-    // adjusted for the inclusion of SIG(0).
+    CalculateSignatureHash(aMessage, offset, hash);
 
-    sha256.Start();
+    if (mSignatureCache.Matches(hash))
+    {
+        // Content (including message ID) is identical to the last
+        // signed update, so its signature can be reused.
 
-    // (1) SIG RR RDATA wire format
-    len = aMessage.GetLength() - offset - sizeof(Dns::ResourceRecord);
-    sha256.Update(aMessage, offset + sizeof(Dns::ResourceRecord), len);
+        signature = mSignatureCache.GetSignature();
+        LogInfo("Reusing signature of last update");
+    }
+    else
+    {
+        if (mSignatureCache.IsValid())
+        {
+            // The message was prepared with the message ID of the last
+            // signed update but its content has changed. Use a new
+            // message ID so that a late response to the earlier update
+            // is not mistaken for a response to this one.
 
-    // (2) Message from DNS header before SIG
-    sha256.Update(aMessage, 0, offset);
+            Dns::UpdateHeader header;
+
+            IgnoreError(aMessage.Read(0, header));
+            SuccessOrExit(error = GenerateMessageId(header));
+            aMessage.Write(0, header);
+
+            CalculateSignatureHash(aMessage, offset, hash);
+        }
 
-    sha256.Finish(hash);
-    SuccessOrExit(error = aInfo.mKeyPair.Sign(hash, signature));
+        SuccessOrExit(error = aInfo.mKeyPair.Sign(hash, signature));
+        mSignatureCache.Save(hash, signature);
+    }
 
     // Move back in message and append SIG RR now with compressed host
     // name (as signer's name) along with the calculated signature.
@@ -1333,6 +1379,32 @@ exit:
     return error;
 }
 
+void Client::CalculateSignatureHash(const Message &aMessage, uint16_t aSigOffset, Crypto::Sha256::Hash &aHash)
+{
+    // Calculate signature hash (RFC 2931): Calculated over "data" which
+    // is concatenation of (1) the SIG RR RDATA wire format (including
+    // the canonical form of the signer's name), entirely omitting the
+    // signature subfield, (2) DNS query message, including DNS header
+    // but not UDP/IP header before the header RR counts have been
+    // adjusted for the inclusion of SIG(0). `aSigOffset` gives the
+    // offset to the start of SIG RR which is the last entry in the
+    // message.
+
+    Crypto::Sha256 sha256;
+    uint16_t       len;
+
+    sha256.Start();
+
+    // (1) SIG RR RDATA wire format
+    len = aMessage.GetLength() - aSigOffset - sizeof(Dns::ResourceRecord);
+    sha256.Update(aMessage, aSigOffset + sizeof(Dns::ResourceRecord), len);
+
+    // (2) Message from DNS header before SIG
+    sha256.Update(aMessage, 0, aSigOffset);
+
+    sha256.Finish(aHash);
+}
+
 void Client::UpdateRecordLengthInMessage(Dns::ResourceRecord &aRecord, uint16_t aOffset, Message &aMessage) const
 {
     // This method is used to calculate an RR DATA length and update
@@ -1379,6 +1451,8 @@ void Client::ProcessResponse(Message &aMessage)
     VerifyOrExit(header.GetQueryType() == Dns::Header::kQueryTypeUpdate, error = kErrorParse);
     VerifyOrExit(header.GetMessageId() == mUpdateMessageId, error = kErrorDrop);
 
+    mSignatureCache.Invalidate();
+
     if (!Get<Mle::Mle>().IsRxOnWhenIdle())
     {
         Get<DataPollSender>().StopFastPolls();
@@ -1731,6 +1805,24 @@ uint32_t Client::GetBoundedLeaseInterval(uint32_t aInterval, uint32_t aDefaultIn
     return boundedInterval;
 }
 
+uint32_t Client::DetermineUpdateTxDelay(void) const
+{
+    // The update is sent after the short `kUpdateTxDelay`, but no
+    // sooner than `kUpdateHoldDownInterval` from the previous update
+    // tx. Any changes made until then are coalesced into the same
+    // update message.
+
+    uint32_t delay   = kUpdateTxDelay;
+    uint32_t elapsed = TimerMilli::GetNow() - mUpdateTxTime;
+
+    if ((elapsed < kUpdateHoldDownInterval) && (kUpdateHoldDownInterval - elapsed > delay))
+    {
+        delay = kUpdateHoldDownInterval - elapsed;
+    }
+
+    return delay;
+}
+
 bool Client::ShouldRenewEarly(const Service &aService) const
 {
     // Check if we reached the service renew time or close to it. The
@@ -46,6 +46,7 @@
 #include "common/numeric_limits.hpp"
 #include "common/timer.hpp"
 #include "crypto/ecdsa.hpp"
+#include "crypto/sha256.hpp"
 #include "net/dns_types.hpp"
 #include "net/ip6.hpp"
 #include "net/udp6.hpp"
@@ -779,6 +780,15 @@ private:
     // that are then all sent in same update message.
     static constexpr uint32_t kUpdateTxDelay = OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_TX_DELAY; // in msec.
 
+    // -------------------------------
+    // The hold-down interval is the minimum time between the start of
+    // two successive SRP update transmissions. Changes made within
+    // this interval after an update tx are coalesced and sent together
+    // in a single update once the interval expires. Zero disables the
+    // hold-down (only `kUpdateTxDelay` is applied).
+    static constexpr uint32_t kUpdateHoldDownInterval =
+        OPENTHREAD_CONFIG_SRP_CLIENT_UPDATE_HOLD_DOWN_INTERVAL; // in msec.
+
     // -------------------------------
     // Retry related constants
     //
@@ -874,6 +884,38 @@ private:
         Service *mService;
     };
 
+    class SignatureCache
+    {
+        // Remembers the SIG(0) signature of the last signed update
+        // message. It is used while retransmitting an update (e.g.,
+        // after a response timeout) so that an update with identical
+        // content reuses the same message ID and signature instead of
+        // being signed again. The cache is invalidated once a response
+        // is received or the client is paused/stopped.
+
+    public:
+        SignatureCache(void)
+            : mValid(false)
+        {
+        }
+
+        void Invalidate(void) { mValid = false; }
+        bool IsValid(void) const { return mValid; }
+        bool Matches(const Crypto::Sha256::Hash &aHash) const { return mValid && (aHash == mHash); }
+        void Save(const Crypto::Sha256::Hash &aHash, const Crypto::Ecdsa::P256::Signature &aSignature)
+        {
+            mValid     = true;
+            mHash      = aHash;
+            mSignature = aSignature;
+        }
+        const Crypto::Ecdsa::P256::Signature &GetSignature(void) const { return mSignature; }
+
+    private:
+        bool                           mValid;
+        Crypto::Sha256::Hash           mHash;
+        Crypto::Ecdsa::P256::Signature mSignature;
+    };
+
 #if OPENTHREAD_CONFIG_SRP_CLIENT_AUTO_START_API_ENABLE
     class AutoStart : Clearable<AutoStart>
     {
@@ -924,12 +966,9 @@ private:
 
     struct Info : public Clearable<Info>
     {
-        static constexpr uint16_t kUnknownOffset = 0; // Unknown offset value (used when offset is not yet set).
-
-        uint16_t                     mDomainNameOffset; // Offset of domain name serialization
-        uint16_t                     mHostNameOffset;   // Offset of host name serialization.
-        uint16_t                     mRecordCount;      // Number of resource records in Update section.
-        Crypto::Ecdsa::P256::KeyPair mKeyPair;          // The ECDSA key pair.
+        Dns::NameCompressor          mCompressor;  // Name compression dictionary of the message.
+        uint16_t                     mRecordCount; // Number of resource records in Update section.
+        Crypto::Ecdsa::P256::KeyPair mKeyPair;     // The ECDSA key pair.
     };
 
     Error        Start(const Ip6::SockAddr &aServerSockAddr, Requester aRequester);
@@ -947,16 +986,20 @@ private:
     void         InvokeCallback(Error aError, const HostInfo &aHostInfo, const Service *aRemovedServices) const;
     void         HandleHostInfoOrServiceChange(void);
     void         SendUpdate(void);
+    uint32_t     DetermineUpdateTxDelay(void) const;
     Error        PrepareUpdateMessage(Message &aMessage);
+    Error        GenerateMessageId(Dns::UpdateHeader &aHeader);
     Error        ReadOrGenerateKey(Crypto::Ecdsa::P256::KeyPair &aKeyPair);
     Error        AppendServiceInstructions(Service &aService, Message &aMessage, Info &aInfo);
     Error        AppendHostDescriptionInstruction(Message &aMessage, Info &aInfo);
     Error        AppendKeyRecord(Message &aMessage, Info &aInfo) const;
     Error        AppendDeleteAllRrsets(Message &aMessage) const;
     Error        AppendHostName(Message &aMessage, Info &aInfo, bool aDoNotCompress = false) const;
+    Error        AppendFullName(const char *aLabel, const char *aLabels, Message &aMessage, Info &aInfo) const;
     Error        AppendAaaaRecord(const Ip6::Address &aAddress, Message &aMessage, Info &aInfo) const;
     Error        AppendUpdateLeaseOptRecord(Message &aMessage) const;
     Error        AppendSignature(Message &aMessage, Info &aInfo);
+    static void  CalculateSignatureHash(const Message &aMessage, uint16_t aSigOffset, Crypto::Sha256::Hash &aHash);
     void         UpdateRecordLengthInMessage(Dns::ResourceRecord &aRecord, uint16_t aOffset, Message &aMessage) const;
     static void  HandleUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void         ProcessResponse(Message &aMessage);
@@ -1003,6 +1046,7 @@ private:
     uint32_t mRetryWaitInterval;
 
     TimeMilli mLeaseRenewTime;
+    TimeMilli mUpdateTxTime;
     uint32_t  mAcceptedLeaseInterval;
     uint32_t  mTtl;
     uint32_t  mLeaseInterval;
@@ -1016,6 +1060,7 @@ private:
     HostInfo            mHostInfo;
     LinkedList<Service> mServices;
     SingleServiceMode   mSingleServiceMode;
+    SignatureCache      mSignatureCache;
     TimerMilli          mTimer;
 #if OPENTHREAD_CONFIG_SRP_CLIENT_AUTO_START_API_ENABLE
     AutoStart mAutoStart;
@@ -294,6 +294,22 @@ void Server::RemoveHost(Host *aHost, RetainName aRetainName, NotifyMode aNotifyS
 {
     VerifyOrExit(aHost != nullptr);
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+    if (!aHost->IsDeleted())
+    {
+        Get<Dns::ServiceDiscovery::Server>().HandleSrpChange(*aHost, Dns::ServiceDiscovery::Server::kSrpRemoved);
+
+        for (const Service &service : aHost->mServices)
+        {
+            if (!service.mIsDeleted && service.mIsCommitted)
+            {
+                Get<Dns::ServiceDiscovery::Server>().HandleSrpChange(service,
+                                                                     Dns::ServiceDiscovery::Server::kSrpRemoved);
+            }
+        }
+    }
+#endif
+
     aHost->mLease = 0;
     aHost->ClearResources();
 
@@ -476,6 +492,18 @@ void Server::CommitSrpUpdate(Error                    aError,
             service.Log(Service::kAddNew);
         }
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+        Get<Dns::ServiceDiscovery::Server>().HandleSrpChange(aHost, Dns::ServiceDiscovery::Server::kSrpAdded);
+
+        for (const Service &service : aHost.GetServices())
+        {
+            if (!service.mIsDeleted)
+            {
+                Get<Dns::ServiceDiscovery::Server>().HandleSrpChange(service, Dns::ServiceDiscovery::Server::kSrpAdded);
+            }
+        }
+#endif
+
 #if OPENTHREAD_CONFIG_SRP_SERVER_PORT_SWITCH_ENABLE
         if (!mHasRegisteredAnyService && (mAddressMode == kAddressModeUnicast))
         {
@@ -805,9 +833,13 @@ Error Server::ProcessHostDescriptionInstruction(Host &                 aHost,
     for (uint16_t numRecords = aMetadata.mDnsHeader.GetUpdateRecordCount(); numRecords > 0; numRecords--)
     {
         char                name[Dns::Name::kMaxNameSize];
+        uint16_t            nameOffset = offset;
         Dns::ResourceRecord record;
 
-        SuccessOrExit(error = Dns::Name::ReadName(aMessage, offset, name, sizeof(name)));
+        // The record name is only read (copied) for the records
+        // processed here, other records are skipped over.
+
+        SuccessOrExit(error = Dns::Name::ParseName(aMessage, offset));
 
         SuccessOrExit(error = aMessage.Read(offset, record));
 
@@ -816,6 +848,8 @@ Error Server::ProcessHostDescriptionInstruction(Host &                 aHost,
             // Delete All RRsets from a name.
             VerifyOrExit(IsValidDeleteAllRecord(record), error = kErrorFailed);
 
+            SuccessOrExit(error = Dns::Name::ReadName(aMessage, nameOffset, name, sizeof(name)));
+
             // A "Delete All RRsets from a name" RR can only apply to a Service or Host Description.
 
             if (!aHost.HasServiceInstance(name))
@@ -834,6 +868,7 @@ Error Server::ProcessHostDescriptionInstruction(Host &                 aHost,
 
             SuccessOrExit(error = aHost.ProcessTtl(record.GetTtl()));
 
+            SuccessOrExit(error = Dns::Name::ReadName(aMessage, nameOffset, name, sizeof(name)));
             SuccessOrExit(error = aHost.SetFullName(name));
 
             SuccessOrExit(error = aMessage.Read(offset, aaaaRecord));
@@ -970,17 +1005,30 @@ Error Server::ProcessServiceDescriptionInstructions(Host &           aHost,
     {
         RetainPtr<Service::Description> desc;
         char                            name[Dns::Name::kMaxNameSize];
+        uint16_t                        nameOffset = offset;
+        uint32_t                        nameHash;
         Dns::ResourceRecord             record;
 
-        SuccessOrExit(error = Dns::Name::ReadName(aMessage, offset, name, sizeof(name)));
+        // The record name is only read (copied) for the records
+        // processed here, other records are skipped over. The name
+        // hash (calculated while parsing) is used to look up the
+        // service description.
+
+        SuccessOrExit(error = Dns::Name::ParseName(aMessage, offset, nameHash));
         SuccessOrExit(error = aMessage.Read(offset, record));
 
+        if ((record.GetClass() == Dns::ResourceRecord::kClassAny) ||
+            (record.GetType() == Dns::ResourceRecord::kTypeSrv) || (record.GetType() == Dns::ResourceRecord::kTypeTxt))
+        {
+            SuccessOrExit(error = Dns::Name::ReadName(aMessage, nameOffset, name, sizeof(name)));
+        }
+
         if (record.GetClass() == Dns::ResourceRecord::kClassAny)
         {
             // Delete All RRsets from a name.
             VerifyOrExit(IsValidDeleteAllRecord(record), error = kErrorFailed);
 
-            desc = aHost.FindServiceDescription(name);
+            desc = aHost.FindServiceDescription(name, nameHash);
 
             if (desc != nullptr)
             {
@@ -995,8 +1043,6 @@ Error Server::ProcessServiceDescriptionInstructions(Host &           aHost,
         if (record.GetType() == Dns::ResourceRecord::kTypeSrv)
         {
             Dns::SrvRecord srvRecord;
-            char           hostName[Dns::Name::kMaxNameSize];
-            uint16_t       hostNameLength = sizeof(hostName);
 
             VerifyOrExit(record.GetClass() == aMetadata.mDnsZone.GetClass(), error = kErrorFailed);
 
@@ -1005,11 +1051,15 @@ Error Server::ProcessServiceDescriptionInstructions(Host &           aHost,
             SuccessOrExit(error = aMessage.Read(offset, srvRecord));
             offset += sizeof(srvRecord);
 
-            SuccessOrExit(error = Dns::Name::ReadName(aMessage, offset, hostName, hostNameLength));
+            // The target host name is compared in place in the message
+            // with the host name (without reading it).
+
+            error = Dns::Name::CompareName(aMessage, offset, aHost.GetFullName());
+            VerifyOrExit(error != kErrorNotFound, error = kErrorFailed);
+            SuccessOrExit(error);
             VerifyOrExit(Dns::Name::IsSubDomainOf(name, GetDomain()), error = kErrorSecurity);
-            VerifyOrExit(aHost.Matches(hostName), error = kErrorFailed);
 
-            desc = aHost.FindServiceDescription(name);
+            desc = aHost.FindServiceDescription(name, nameHash);
             VerifyOrExit(desc != nullptr, error = kErrorFailed);
 
             // Make sure that this is the first SRV RR for this service description
@@ -1026,7 +1076,7 @@ Error Server::ProcessServiceDescriptionInstructions(Host &           aHost,
 
             SuccessOrExit(error = aHost.ProcessTtl(record.GetTtl()));
 
-            desc = aHost.FindServiceDescription(name);
+            desc = aHost.FindServiceDescription(name, nameHash);
             VerifyOrExit(desc != nullptr, error = kErrorFailed);
 
             offset += sizeof(record);
@@ -1789,6 +1839,8 @@ Error Server::Service::Description::Init(const char *aInstanceName, Host &aHost)
     mUpdateTime = TimerMilli::GetNow().GetDistantPast();
     mTxtData.Free();
 
+    mInstanceNameHash = Dns::Name::CalculateHash(aInstanceName);
+
     return mInstanceName.Set(aInstanceName);
 }
 
@@ -1797,6 +1849,11 @@ bool Server::Service::Description::Matches(const char *aInstanceName) const
     return StringMatch(mInstanceName.AsCString(), aInstanceName, kStringCaseInsensitiveMatch);
 }
 
+bool Server::Service::Description::Matches(const char *aInstanceName, uint32_t aInstanceNameHash) const
+{
+    return (mInstanceNameHash == aInstanceNameHash) && Matches(aInstanceName);
+}
+
 void Server::Service::Description::ClearResources(void)
 {
     mPort = 0;
@@ -1817,6 +1874,18 @@ void Server::Service::Description::TakeResourcesFrom(Description &aDescription)
     mUpdateTime = TimerMilli::GetNow();
 }
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+bool Server::Service::Description::HasSameResourcesAs(const Description &aDescription) const
+{
+    // Compares the resources published in SRV and TXT records.
+
+    return (mPriority == aDescription.mPriority) && (mWeight == aDescription.mWeight) &&
+           (mPort == aDescription.mPort) && (mTxtData.GetLength() == aDescription.mTxtData.GetLength()) &&
+           ((mTxtData.GetLength() == 0) ||
+            (memcmp(mTxtData.GetBytes(), aDescription.mTxtData.GetBytes(), mTxtData.GetLength()) == 0));
+}
+#endif
+
 Error Server::Service::Description::SetTxtDataFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength)
 {
     Error error;
@@ -1988,6 +2057,15 @@ void Server::Host::RemoveService(Service *aService, RetainName aRetainName, Noti
 
     VerifyOrExit(aService != nullptr);
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+    // When the host itself is removed, `Server::RemoveHost()` signals
+    // the removal of all its services.
+    if (!aService->mIsDeleted && aService->mIsCommitted && !IsDeleted())
+    {
+        Get<Dns::ServiceDiscovery::Server>().HandleSrpChange(*aService, Dns::ServiceDiscovery::Server::kSrpRemoved);
+    }
+#endif
+
     aService->mIsDeleted = true;
 
     aService->Log(aRetainName ? Service::kRemoveButRetainName : Service::kFullyRemove);
@@ -2054,6 +2132,10 @@ Error Server::Host::MergeServicesAndResourcesFrom(Host &aHost)
     // possibly take ownership of some items from `aHost`.
 
     Error error = kErrorNone;
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+    bool wasDeleted       = IsDeleted();
+    bool addressesChanged = !HasSameAddressesAs(aHost);
+#endif
 
     LogInfo("Update host %s", GetFullName());
 
@@ -2064,10 +2146,22 @@ Error Server::Host::MergeServicesAndResourcesFrom(Host &aHost)
     mKeyLease   = aHost.mKeyLease;
     mUpdateTime = TimerMilli::GetNow();
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+    if (wasDeleted || addressesChanged)
+    {
+        Get<Dns::ServiceDiscovery::Server>().HandleSrpChange(
+            *this, wasDeleted ? Dns::ServiceDiscovery::Server::kSrpAdded : Dns::ServiceDiscovery::Server::kSrpUpdated);
+    }
+#endif
+
     for (Service &service : aHost.mServices)
     {
         Service *existingService = FindService(service.GetServiceName(), service.GetInstanceName());
         Service *newService;
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+        bool isNew = (existingService == nullptr) || existingService->mIsDeleted;
+        bool isChanged;
+#endif
 
         if (service.mIsDeleted)
         {
@@ -2084,6 +2178,11 @@ Error Server::Host::MergeServicesAndResourcesFrom(Host &aHost)
 
         VerifyOrExit(newService != nullptr, error = kErrorNoBufs);
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+        isChanged = isNew || (!service.mIsSubType &&
+                              !newService->mDescription->HasSameResourcesAs(*service.mDescription));
+#endif
+
         newService->mIsDeleted   = false;
         newService->mIsCommitted = true;
         newService->mUpdateTime  = TimerMilli::GetNow();
@@ -2097,12 +2196,35 @@ Error Server::Host::MergeServicesAndResourcesFrom(Host &aHost)
         }
 
         newService->Log((existingService != nullptr) ? Service::kUpdateExisting : Service::kAddNew);
+
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+        if (isChanged)
+        {
+            Get<Dns::ServiceDiscovery::Server>().HandleSrpChange(
+                *newService, isNew ? Dns::ServiceDiscovery::Server::kSrpAdded
+                                   : Dns::ServiceDiscovery::Server::kSrpUpdated);
+        }
+#endif
     }
 
 exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+bool Server::Host::HasSameAddressesAs(const Host &aHost) const
+{
+    bool isSame = (mAddresses.GetLength() == aHost.mAddresses.GetLength());
+
+    for (uint16_t i = 0; isSame && (i < mAddresses.GetLength()); i++)
+    {
+        isSame = (mAddresses[i] == aHost.mAddresses[i]);
+    }
+
+    return isSame;
+}
+#endif
+
 bool Server::Host::HasServiceInstance(const char *aInstanceName) const
 {
     return (FindServiceDescription(aInstanceName) != nullptr);
@@ -2110,11 +2232,24 @@ bool Server::Host::HasServiceInstance(const char *aInstanceName) const
 
 const RetainPtr<Server::Service::Description> Server::Host::FindServiceDescription(const char *aInstanceName) const
 {
+    return FindServiceDescription(aInstanceName, Dns::Name::CalculateHash(aInstanceName));
+}
+
+RetainPtr<Server::Service::Description> Server::Host::FindServiceDescription(const char *aInstanceName)
+{
+    return AsNonConst(AsConst(this)->FindServiceDescription(aInstanceName));
+}
+
+const RetainPtr<Server::Service::Description> Server::Host::FindServiceDescription(const char *aInstanceName,
+                                                                                   uint32_t    aInstanceNameHash) const
+{
+    // The instance names are compared only when their hashes match.
+
     const Service::Description *desc = nullptr;
 
     for (const Service &service : mServices)
     {
-        if (service.mDescription->Matches(aInstanceName))
+        if (service.mDescription->Matches(aInstanceName, aInstanceNameHash))
         {
             desc = service.mDescription.Get();
             break;
@@ -2124,9 +2259,10 @@ const RetainPtr<Server::Service::Description> Server::Host::FindServiceDescripti
     return RetainPtr<Service::Description>(AsNonConst(desc));
 }
 
-RetainPtr<Server::Service::Description> Server::Host::FindServiceDescription(const char *aInstanceName)
+RetainPtr<Server::Service::Description> Server::Host::FindServiceDescription(const char *aInstanceName,
+                                                                             uint32_t    aInstanceNameHash)
 {
-    return AsNonConst(AsConst(this)->FindServiceDescription(aInstanceName));
+    return AsNonConst(AsConst(this)->FindServiceDescription(aInstanceName, aInstanceNameHash));
 }
 
 const Server::Service *Server::Host::FindService(const char *aServiceName, const char *aInstanceName) const
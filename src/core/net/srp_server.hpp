@@ -387,12 +387,17 @@ public:
             Error       Init(const char *aInstanceName, Host &aHost);
             const char *GetInstanceName(void) const { return mInstanceName.AsCString(); }
             bool        Matches(const char *aInstanceName) const;
+            bool        Matches(const char *aInstanceName, uint32_t aInstanceNameHash) const;
             void        ClearResources(void);
             void        TakeResourcesFrom(Description &aDescription);
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+            bool HasSameResourcesAs(const Description &aDescription) const;
+#endif
             Error       SetTxtDataFromMessage(const Message &aMessage, uint16_t aOffset, uint16_t aLength);
 
             Description *mNext;
             Heap::String mInstanceName;
+            uint32_t     mInstanceNameHash; // Hash of `mInstanceName` (from `Dns::Name::CalculateHash()`).
             Host *       mHost;
             Heap::Data   mTxtData;
             uint16_t     mPriority;
@@ -589,10 +594,16 @@ public:
         void                 FreeAllServices(void);
         void                 ClearResources(void);
         Error                MergeServicesAndResourcesFrom(Host &aHost);
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE
+        bool HasSameAddressesAs(const Host &aHost) const;
+#endif
         Error                AddIp6Address(const Ip6::Address &aIp6Address);
         bool                 HasServiceInstance(const char *aInstanceName) const;
         RetainPtr<Service::Description>       FindServiceDescription(const char *aInstanceName);
         const RetainPtr<Service::Description> FindServiceDescription(const char *aInstanceName) const;
+        RetainPtr<Service::Description> FindServiceDescription(const char *aInstanceName, uint32_t aInstanceNameHash);
+        const RetainPtr<Service::Description> FindServiceDescription(const char *aInstanceName,
+                                                                     uint32_t    aInstanceNameHash) const;
         Service *                             FindService(const char *aServiceName, const char *aInstanceName);
         const Service *                       FindService(const char *aServiceName, const char *aInstanceName) const;
         Service *                             FindBaseService(const char *aInstanceName);
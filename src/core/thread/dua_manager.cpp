@@ -56,18 +56,19 @@ DuaManager::DuaManager(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mRegistrationTask(aInstance, DuaManager::HandleRegistrationTask)
     , mDuaNotification(UriPath::kDuaRegistrationNotify, &DuaManager::HandleDuaNotification, this)
-    , mIsDuaPending(false)
 #if OPENTHREAD_CONFIG_DUA_ENABLE
     , mDuaState(kNotExist)
     , mDadCounter(0)
     , mLastRegistrationTime(0)
 #endif
-#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
-    , mChildIndexDuaRegistering(Mle::kMaxChildren)
-#endif
 {
     mDelay.mValue = 0;
 
+    for (PendingRegistration &registration : mPendingRegistrations)
+    {
+        registration.Init(aInstance);
+    }
+
 #if OPENTHREAD_CONFIG_DUA_ENABLE
     mDomainUnicastAddress.InitAsThreadOriginGlobalScope();
     mFixedDuaInterfaceIdentifier.Clear();
@@ -76,6 +77,12 @@ DuaManager::DuaManager(Instance &aInstance)
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
     mChildDuaMask.Clear();
     mChildDuaRegisteredMask.Clear();
+    mChildDuaPriorityMask.Clear();
+
+    for (ChildDuaRetry &retry : mChildDuaRetries)
+    {
+        retry.Clear();
+    }
 #endif
 
     Get<Tmf::Agent>().AddResource(mDuaNotification);
@@ -86,10 +93,7 @@ void DuaManager::HandleDomainPrefixUpdate(BackboneRouter::Leader::DomainPrefixSt
     if ((aState == BackboneRouter::Leader::kDomainPrefixRemoved) ||
         (aState == BackboneRouter::Leader::kDomainPrefixRefreshed))
     {
-        if (mIsDuaPending)
-        {
-            IgnoreError(Get<Tmf::Agent>().AbortTransaction(&DuaManager::HandleDuaResponse, this));
-        }
+        AbortRegistrations();
 
 #if OPENTHREAD_CONFIG_DUA_ENABLE
         RemoveDomainUnicastAddress();
@@ -98,8 +102,10 @@ void DuaManager::HandleDomainPrefixUpdate(BackboneRouter::Leader::DomainPrefixSt
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
         if (mChildDuaMask.HasAny())
         {
-            mChildDuaMask.Clear();
-            mChildDuaRegisteredMask.Clear();
+            for (uint16_t childIndex = 0; childIndex < Mle::kMaxChildren; childIndex++)
+            {
+                ClearChildDua(childIndex);
+            }
         }
 #endif
     }
@@ -240,9 +246,14 @@ void DuaManager::AddDomainUnicastAddress(void)
 
 void DuaManager::RemoveDomainUnicastAddress(void)
 {
-    if (mDuaState == kRegistering && mIsDuaPending)
+    if (mDuaState == kRegistering)
     {
-        IgnoreError(Get<Tmf::Agent>().AbortTransaction(&DuaManager::HandleDuaResponse, this));
+        PendingRegistration *registration = FindRegistration(Mle::kMaxChildren);
+
+        if (registration != nullptr)
+        {
+            registration->Abort();
+        }
     }
 
     mDuaState                        = kNotExist;
@@ -379,6 +390,13 @@ void DuaManager::HandleTimeTick(void)
         attempt = true;
     }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
+    if (HandleChildDuaRetryTimeTick())
+    {
+        attempt = true;
+    }
+#endif
+
     if ((mDelay.mFields.mReregistrationDelay > 0) && (--mDelay.mFields.mReregistrationDelay == 0))
     {
 #if OPENTHREAD_CONFIG_DUA_ENABLE
@@ -409,7 +427,13 @@ void DuaManager::HandleRegistrationTask(Tasklet &aTasklet)
 
 void DuaManager::UpdateTimeTickerRegistration(void)
 {
-    if (mDelay.mValue == 0)
+    bool hasDelay = (mDelay.mValue != 0);
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
+    hasDelay = hasDelay || HasChildDuaRetry();
+#endif
+
+    if (!hasDelay)
     {
         Get<TimeTicker>().UnregisterReceiver(TimeTicker::kDuaManager);
     }
@@ -419,19 +443,88 @@ void DuaManager::UpdateTimeTickerRegistration(void)
     }
 }
 
+DuaManager::PendingRegistration *DuaManager::FindFreeRegistration(void)
+{
+    PendingRegistration *freeRegistration = nullptr;
+
+    for (PendingRegistration &registration : mPendingRegistrations)
+    {
+        if (!registration.IsInUse())
+        {
+            freeRegistration = &registration;
+            break;
+        }
+    }
+
+    return freeRegistration;
+}
+
+DuaManager::PendingRegistration *DuaManager::FindRegistration(uint16_t aChildIndex)
+{
+    // Finds the pending registration of a child DUA, or of the
+    // device's own DUA when `aChildIndex` is `Mle::kMaxChildren`.
+
+    PendingRegistration *matchingRegistration = nullptr;
+
+    for (PendingRegistration &registration : mPendingRegistrations)
+    {
+        if (registration.IsInUse() && (registration.GetChildIndex() == aChildIndex))
+        {
+            matchingRegistration = &registration;
+            break;
+        }
+    }
+
+    return matchingRegistration;
+}
+
+void DuaManager::AbortRegistrations(void)
+{
+    for (PendingRegistration &registration : mPendingRegistrations)
+    {
+        if (registration.IsInUse())
+        {
+            registration.Abort();
+        }
+    }
+}
+
 void DuaManager::PerformNextRegistration(void)
 {
-    Error            error   = kErrorNone;
-    Mle::MleRouter & mle     = Get<Mle::MleRouter>();
-    Coap::Message *  message = nullptr;
-    Tmf::MessageInfo messageInfo(GetInstance());
-    Ip6::Address     dua;
+    // Sends DUA.req messages back to back (without waiting for the
+    // responses) until the window of pending registrations is full
+    // or there is nothing left to register.
+
+    Error   error;
+    uint8_t numSent = 0;
+
+    while ((error = SendNextRegistration()) == kErrorNone)
+    {
+        numSent++;
+    }
+
+    LogInfo("PerformNextRegistration: sent %u DUA.req, %s", numSent, ErrorToString(error));
+}
+
+Error DuaManager::SendNextRegistration(void)
+{
+    Error                error   = kErrorNone;
+    Mle::MleRouter &     mle     = Get<Mle::MleRouter>();
+    Coap::Message *      message = nullptr;
+    Tmf::MessageInfo     messageInfo(GetInstance());
+    Ip6::Address         dua;
+    uint16_t             childIndex = Mle::kMaxChildren;
+    PendingRegistration *registration;
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
+    Child *child = nullptr;
+#endif
 
     VerifyOrExit(mle.IsAttached(), error = kErrorInvalidState);
     VerifyOrExit(Get<BackboneRouter::Leader>().HasPrimary(), error = kErrorInvalidState);
 
-    // Only allow one outgoing DUA.req
-    VerifyOrExit(!mIsDuaPending, error = kErrorBusy);
+    // Limit the number of outstanding DUA.req
+    registration = FindFreeRegistration();
+    VerifyOrExit(registration != nullptr, error = kErrorBusy);
 
     // Only send DUA.req when necessary
 #if OPENTHREAD_CONFIG_DUA_ENABLE
@@ -449,7 +542,11 @@ void DuaManager::PerformNextRegistration(void)
 #endif
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
-        needReg = needReg || (mChildDuaMask.HasAny() && mChildDuaMask != mChildDuaRegisteredMask);
+        if (!needReg)
+        {
+            child   = FindNextChildToRegister();
+            needReg = (child != nullptr);
+        }
 #endif
         VerifyOrExit(needReg, error = kErrorNotFound);
     }
@@ -473,23 +570,11 @@ void DuaManager::PerformNextRegistration(void)
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
         uint32_t            lastTransactionTime;
         const Ip6::Address *duaPtr = nullptr;
-        Child *             child  = nullptr;
-
-        OT_ASSERT(mChildIndexDuaRegistering == Mle::kMaxChildren);
 
-        for (Child &iter : Get<ChildTable>().Iterate(Child::kInStateValid))
-        {
-            uint16_t childIndex = Get<ChildTable>().GetChildIndex(iter);
+        OT_ASSERT(child != nullptr);
 
-            if (mChildDuaMask.Get(childIndex) && !mChildDuaRegisteredMask.Get(childIndex))
-            {
-                mChildIndexDuaRegistering = childIndex;
-                break;
-            }
-        }
-
-        child  = Get<ChildTable>().GetChildAtIndex(mChildIndexDuaRegistering);
-        duaPtr = child->GetDomainUnicastAddress();
+        childIndex = Get<ChildTable>().GetChildIndex(*child);
+        duaPtr     = child->GetDomainUnicastAddress();
 
         OT_ASSERT(duaPtr != nullptr);
 
@@ -517,11 +602,11 @@ void DuaManager::PerformNextRegistration(void)
 
     messageInfo.SetSockAddrToRloc();
 
-    SuccessOrExit(error = Get<Tmf::Agent>().SendMessage(*message, messageInfo, &DuaManager::HandleDuaResponse, this));
+    SuccessOrExit(error = Get<Tmf::Agent>().SendMessage(*message, messageInfo, &DuaManager::HandleDuaResponse,
+                                                        registration));
 
-    mIsDuaPending   = true;
-    mRegisteringDua = dua;
-    mDelay.mValue   = 0;
+    registration->Start(dua, childIndex);
+    mDelay.mValue = 0;
 
     // Generally Thread 1.2 Router would send DUA.req on behalf for DUA registered by its MTD child.
     // When Thread 1.2 MTD attaches to Thread 1.1 parent, 1.2 MTD should send DUA.req to PBBR itself.
@@ -539,8 +624,8 @@ exit:
         UpdateCheckDelay(Mle::kNoBufDelay);
     }
 
-    LogInfo("PerformNextRegistration: %s", ErrorToString(error));
     FreeMessageOnError(message, error);
+    return error;
 }
 
 void DuaManager::HandleDuaResponse(void *               aContext,
@@ -548,22 +633,37 @@ void DuaManager::HandleDuaResponse(void *               aContext,
                                    const otMessageInfo *aMessageInfo,
                                    Error                aResult)
 {
-    static_cast<DuaManager *>(aContext)->HandleDuaResponse(AsCoapMessagePtr(aMessage), AsCoreTypePtr(aMessageInfo),
-                                                           aResult);
+    OT_UNUSED_VARIABLE(aMessageInfo);
+
+    PendingRegistration &registration = *static_cast<PendingRegistration *>(aContext);
+
+    registration.Get<DuaManager>().HandleDuaResponse(registration, AsCoapMessagePtr(aMessage), aResult);
 }
 
-void DuaManager::HandleDuaResponse(Coap::Message *aMessage, const Ip6::MessageInfo *aMessageInfo, Error aResult)
+void DuaManager::HandleDuaResponse(PendingRegistration &aRegistration, Coap::Message *aMessage, Error aResult)
 {
-    OT_UNUSED_VARIABLE(aMessageInfo);
-    Error error;
+    Error        error;
+    Ip6::Address dua = aRegistration.GetDua();
 
-    mIsDuaPending = false;
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
-    mChildIndexDuaRegistering = Mle::kMaxChildren;
+    uint16_t childIndex = aRegistration.GetChildIndex();
+    bool     isForChild = aRegistration.IsForChild();
 #endif
 
+    aRegistration.Finish();
+
     if (aResult == kErrorResponseTimeout)
     {
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
+        if (isForChild)
+        {
+            // Retry this child DUA later (with exponential backoff)
+            // while registrations of other DUAs can go ahead.
+            ScheduleChildDuaRetry(childIndex);
+            mRegistrationTask.Post();
+            ExitNow(error = aResult);
+        }
+#endif
         UpdateCheckDelay(Mle::KResponseTimeoutDelay);
         ExitNow(error = aResult);
     }
@@ -574,7 +674,14 @@ void DuaManager::HandleDuaResponse(Coap::Message *aMessage, const Ip6::MessageIn
     VerifyOrExit(aMessage->GetCode() == Coap::kCodeChanged || aMessage->GetCode() >= Coap::kCodeBadRequest,
                  error = kErrorParse);
 
-    error = ProcessDuaResponse(*aMessage);
+    if (aMessage->GetCode() >= Coap::kCodeBadRequest)
+    {
+        error = ProcessDuaStatus(dua, ThreadStatusTlv::kDuaGeneralFailure);
+    }
+    else
+    {
+        error = ProcessDuaResponse(*aMessage);
+    }
 
 exit:
     if (error != kErrorResponseTimeout)
@@ -582,7 +689,7 @@ exit:
         mRegistrationTask.Post();
     }
 
-    LogInfo("Received DUA.rsp: %s", ErrorToString(error));
+    LogInfo("Received DUA.rsp for DUA %s: %s", dua.ToString().AsCString(), ErrorToString(error));
 }
 
 void DuaManager::HandleDuaNotification(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
@@ -611,27 +718,29 @@ exit:
 
 Error DuaManager::ProcessDuaResponse(Coap::Message &aMessage)
 {
-    Error        error = kErrorNone;
+    Error        error;
     Ip6::Address target;
     uint8_t      status;
 
-    if (aMessage.GetCode() >= Coap::kCodeBadRequest)
-    {
-        status = ThreadStatusTlv::kDuaGeneralFailure;
-        target = mRegisteringDua;
-    }
-    else
-    {
-        SuccessOrExit(error = Tlv::Find<ThreadStatusTlv>(aMessage, status));
-        SuccessOrExit(error = Tlv::Find<ThreadTargetTlv>(aMessage, target));
-    }
+    SuccessOrExit(error = Tlv::Find<ThreadStatusTlv>(aMessage, status));
+    SuccessOrExit(error = Tlv::Find<ThreadTargetTlv>(aMessage, target));
 
-    VerifyOrExit(Get<BackboneRouter::Leader>().IsDomainUnicast(target), error = kErrorDrop);
+    error = ProcessDuaStatus(target, status);
+
+exit:
+    return error;
+}
+
+Error DuaManager::ProcessDuaStatus(const Ip6::Address &aTarget, uint8_t aStatus)
+{
+    Error error = kErrorNone;
+
+    VerifyOrExit(Get<BackboneRouter::Leader>().IsDomainUnicast(aTarget), error = kErrorDrop);
 
 #if OPENTHREAD_CONFIG_DUA_ENABLE
-    if (Get<ThreadNetif>().HasUnicastAddress(target))
+    if (Get<ThreadNetif>().HasUnicastAddress(aTarget))
     {
-        switch (static_cast<ThreadStatusTlv::DuaStatus>(status))
+        switch (static_cast<ThreadStatusTlv::DuaStatus>(aStatus))
         {
         case ThreadStatusTlv::kDuaSuccess:
             mLastRegistrationTime = TimerMilli::GetNow();
@@ -667,7 +776,7 @@ Error DuaManager::ProcessDuaResponse(Coap::Message &aMessage)
 
         for (Child &iter : Get<ChildTable>().Iterate(Child::kInStateValid))
         {
-            if (iter.HasIp6Address(target))
+            if (iter.HasIp6Address(aTarget))
             {
                 child = &iter;
                 break;
@@ -678,36 +787,37 @@ Error DuaManager::ProcessDuaResponse(Coap::Message &aMessage)
 
         childIndex = Get<ChildTable>().GetChildIndex(*child);
 
-        switch (status)
+        switch (aStatus)
         {
         case ThreadStatusTlv::kDuaSuccess:
             // Mark as Registered
             if (mChildDuaMask.Get(childIndex))
             {
                 mChildDuaRegisteredMask.Set(childIndex, true);
+                mChildDuaPriorityMask.Set(childIndex, false);
+                mChildDuaRetries[childIndex].Clear();
             }
             break;
         case ThreadStatusTlv::kDuaReRegister:
             // Parent stops registering for the Child's DUA until next Child Update Request
-            mChildDuaMask.Set(childIndex, false);
-            mChildDuaRegisteredMask.Set(childIndex, false);
+            ClearChildDua(childIndex);
             break;
         case ThreadStatusTlv::kDuaInvalid:
         case ThreadStatusTlv::kDuaDuplicate:
-            IgnoreError(child->RemoveIp6Address(target));
-            mChildDuaMask.Set(childIndex, false);
-            mChildDuaRegisteredMask.Set(childIndex, false);
+            IgnoreError(child->RemoveIp6Address(aTarget));
+            ClearChildDua(childIndex);
             break;
         case ThreadStatusTlv::kDuaNoResources:
         case ThreadStatusTlv::kDuaNotPrimary:
         case ThreadStatusTlv::kDuaGeneralFailure:
             UpdateReregistrationDelay();
+            ScheduleChildDuaRetry(childIndex);
             break;
         }
 
-        if (status != ThreadStatusTlv::kDuaSuccess)
+        if (aStatus != ThreadStatusTlv::kDuaSuccess)
         {
-            SendAddressNotification(target, static_cast<ThreadStatusTlv::DuaStatus>(status), *child);
+            SendAddressNotification(aTarget, static_cast<ThreadStatusTlv::DuaStatus>(aStatus), *child);
         }
     }
 #endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
@@ -718,7 +828,7 @@ exit:
 }
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
-void DuaManager::SendAddressNotification(Ip6::Address &             aAddress,
+void DuaManager::SendAddressNotification(const Ip6::Address &       aAddress,
                                          ThreadStatusTlv::DuaStatus aStatus,
                                          const Child &              aChild)
 {
@@ -757,14 +867,15 @@ void DuaManager::UpdateChildDomainUnicastAddress(const Child &aChild, Mle::Child
     if ((aState == Mle::ChildDuaState::kRemoved || aState == Mle::ChildDuaState::kChanged) &&
         mChildDuaMask.Get(childIndex))
     {
+        PendingRegistration *registration = FindRegistration(childIndex);
+
         // Abort on going proxy DUA.req for this child
-        if (mChildIndexDuaRegistering == childIndex)
+        if (registration != nullptr)
         {
-            IgnoreError(Get<Tmf::Agent>().AbortTransaction(&DuaManager::HandleDuaResponse, this));
+            registration->Abort();
         }
 
-        mChildDuaMask.Set(childIndex, false);
-        mChildDuaRegisteredMask.Set(childIndex, false);
+        ClearChildDua(childIndex);
     }
 
     if (aState == Mle::ChildDuaState::kAdded || aState == Mle::ChildDuaState::kChanged ||
@@ -777,12 +888,143 @@ void DuaManager::UpdateChildDomainUnicastAddress(const Child &aChild, Mle::Child
 
         mChildDuaMask.Set(childIndex, true);
         mChildDuaRegisteredMask.Set(childIndex, false);
+        mChildDuaRetries[childIndex].Clear();
+
+        // A newly added (or changed) DUA, e.g., from a recently
+        // attached child, is registered ahead of re-registrations
+        // of the already registered child DUAs.
+        mChildDuaPriorityMask.Set(childIndex, aState != Mle::ChildDuaState::kUnchanged);
     }
 
     return;
 }
+
+Child *DuaManager::FindNextChildToRegister(void)
+{
+    // Finds the next child whose DUA needs to be registered, skipping
+    // the ones with a pending registration or waiting for a retry.
+    // Children with a priority DUA are selected first.
+
+    Child *candidate = nullptr;
+
+    for (Child &child : Get<ChildTable>().Iterate(Child::kInStateValid))
+    {
+        uint16_t childIndex = Get<ChildTable>().GetChildIndex(child);
+
+        if (!mChildDuaMask.Get(childIndex) || mChildDuaRegisteredMask.Get(childIndex) ||
+            (mChildDuaRetries[childIndex].mDelay > 0) || (FindRegistration(childIndex) != nullptr))
+        {
+            continue;
+        }
+
+        if (mChildDuaPriorityMask.Get(childIndex))
+        {
+            candidate = &child;
+            break;
+        }
+
+        if (candidate == nullptr)
+        {
+            candidate = &child;
+        }
+    }
+
+    return candidate;
+}
+
+void DuaManager::ClearChildDua(uint16_t aChildIndex)
+{
+    mChildDuaMask.Set(aChildIndex, false);
+    mChildDuaRegisteredMask.Set(aChildIndex, false);
+    mChildDuaPriorityMask.Set(aChildIndex, false);
+    mChildDuaRetries[aChildIndex].Clear();
+}
+
+void DuaManager::ScheduleChildDuaRetry(uint16_t aChildIndex)
+{
+    // The retry delay doubles on every failed attempt (up to
+    // `kChildDuaMaxRetryDelay`) and is randomized within
+    // [delay/2, delay] so that retries of different child DUAs do
+    // not happen in bursts.
+
+    ChildDuaRetry &retry = mChildDuaRetries[aChildIndex];
+    uint8_t        delay = kChildDuaMinRetryDelay;
+
+    for (uint8_t attempt = 0; attempt < retry.mAttempts; attempt++)
+    {
+        delay *= 2;
+    }
+
+    if (delay < kChildDuaMaxRetryDelay)
+    {
+        retry.mAttempts++;
+    }
+
+    retry.mDelay = Random::NonCrypto::GetUint8InRange(delay / 2, delay + 1);
+
+    LogInfo("Retry DUA registration for child index %u in %u sec", aChildIndex, retry.mDelay);
+    UpdateTimeTickerRegistration();
+}
+
+bool DuaManager::HasChildDuaRetry(void) const
+{
+    bool hasRetry = false;
+
+    for (const ChildDuaRetry &retry : mChildDuaRetries)
+    {
+        if (retry.mDelay > 0)
+        {
+            hasRetry = true;
+            break;
+        }
+    }
+
+    return hasRetry;
+}
+
+bool DuaManager::HandleChildDuaRetryTimeTick(void)
+{
+    // Returns whether or not the retry delay of any child DUA expired.
+
+    bool expired = false;
+
+    for (ChildDuaRetry &retry : mChildDuaRetries)
+    {
+        if ((retry.mDelay > 0) && (--retry.mDelay == 0))
+        {
+            expired = true;
+        }
+    }
+
+    return expired;
+}
 #endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
 
+//---------------------------------------------------------------------------------------------------------------------
+// DuaManager::PendingRegistration
+
+void DuaManager::PendingRegistration::Init(Instance &aInstance)
+{
+    InstanceLocatorInit::Init(aInstance);
+    mChildIndex = Mle::kMaxChildren;
+    mInUse      = false;
+}
+
+void DuaManager::PendingRegistration::Start(const Ip6::Address &aDua, uint16_t aChildIndex)
+{
+    mDua        = aDua;
+    mChildIndex = aChildIndex;
+    mInUse      = true;
+}
+
+void DuaManager::PendingRegistration::Abort(void)
+{
+    // The response handler is invoked (with `kErrorAbort`) which
+    // finishes the registration.
+
+    IgnoreError(Get<Tmf::Agent>().AbortTransaction(&DuaManager::HandleDuaResponse, this));
+}
+
 } // namespace ot
 
 #endif // OPENTHREAD_CONFIG_DUA_ENABLE || (OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE)
@@ -49,6 +49,7 @@
 #include "backbone_router/bbr_leader.hpp"
 #include "coap/coap.hpp"
 #include "coap/coap_message.hpp"
+#include "common/clearable.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/notifier.hpp"
@@ -178,6 +179,38 @@ private:
     static constexpr uint8_t kNewRouterRegistrationDelay = 3; ///< Delay (in sec) to establish link for a new router.
     static constexpr uint8_t kNewDuaRegistrationDelay    = 1; ///< Delay (in sec) for newly added DUA.
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
+    static constexpr uint8_t kMaxPendingRegistrations = OPENTHREAD_CONFIG_TMF_PROXY_DUA_MAX_PENDING_REGISTRATIONS;
+    static constexpr uint8_t kChildDuaMinRetryDelay   = 2;   // Initial retry delay (in sec) for a child DUA.
+    static constexpr uint8_t kChildDuaMaxRetryDelay   = 128; // Max retry delay (in sec) for a child DUA.
+
+    static_assert(kMaxPendingRegistrations > 0, "TMF_PROXY_DUA_MAX_PENDING_REGISTRATIONS must be non-zero");
+#else
+    static constexpr uint8_t kMaxPendingRegistrations = 1;
+#endif
+
+    // A DUA registration (DUA.req) waiting for its response. It is
+    // used as the response handler context to map a response (or
+    // its timeout) to the registration.
+    class PendingRegistration : public InstanceLocatorInit
+    {
+    public:
+        void Init(Instance &aInstance);
+
+        bool                IsInUse(void) const { return mInUse; }
+        const Ip6::Address &GetDua(void) const { return mDua; }
+        void                Start(const Ip6::Address &aDua, uint16_t aChildIndex);
+        void                Finish(void) { mInUse = false; }
+        bool                IsForChild(void) const { return (mChildIndex != Mle::kMaxChildren); }
+        uint16_t            GetChildIndex(void) const { return mChildIndex; }
+        void                Abort(void);
+
+    private:
+        Ip6::Address mDua;
+        uint16_t     mChildIndex; // `Mle::kMaxChildren` for device's own DUA.
+        bool         mInUse;
+    };
+
 #if OPENTHREAD_CONFIG_DUA_ENABLE
     Error GenerateDomainUnicastAddressIid(void);
     Error Store(void);
@@ -188,7 +221,14 @@ private:
 #endif
 
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_DUA_ENABLE
-    void SendAddressNotification(Ip6::Address &aAddress, ThreadStatusTlv::DuaStatus aStatus, const Child &aChild);
+    void   SendAddressNotification(const Ip6::Address &       aAddress,
+                                   ThreadStatusTlv::DuaStatus aStatus,
+                                   const Child &              aChild);
+    Child *FindNextChildToRegister(void);
+    void   ClearChildDua(uint16_t aChildIndex);
+    void   ScheduleChildDuaRetry(uint16_t aChildIndex);
+    bool   HasChildDuaRetry(void) const;
+    bool   HandleChildDuaRetryTimeTick(void);
 #endif
 
     void HandleNotifierEvents(Events aEvents);
@@ -203,21 +243,26 @@ private:
                                   otMessage *          aMessage,
                                   const otMessageInfo *aMessageInfo,
                                   Error                aResult);
-    void        HandleDuaResponse(Coap::Message *aMessage, const Ip6::MessageInfo *aMessageInfo, Error aResult);
+    void        HandleDuaResponse(PendingRegistration &aRegistration, Coap::Message *aMessage, Error aResult);
 
     static void HandleDuaNotification(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleDuaNotification(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
     Error ProcessDuaResponse(Coap::Message &aMessage);
+    Error ProcessDuaStatus(const Ip6::Address &aTarget, uint8_t aStatus);
+
+    PendingRegistration *FindFreeRegistration(void);
+    PendingRegistration *FindRegistration(uint16_t aChildIndex);
+    void                 AbortRegistrations(void);
 
-    void PerformNextRegistration(void);
+    void  PerformNextRegistration(void);
+    Error SendNextRegistration(void);
     void UpdateReregistrationDelay(void);
     void UpdateCheckDelay(uint8_t aDelay);
 
-    Tasklet        mRegistrationTask;
-    Coap::Resource mDuaNotification;
-    Ip6::Address   mRegisteringDua;
-    bool           mIsDuaPending : 1;
+    Tasklet             mRegistrationTask;
+    Coap::Resource      mDuaNotification;
+    PendingRegistration mPendingRegistrations[kMaxPendingRegistrations];
 
 #if OPENTHREAD_CONFIG_DUA_ENABLE
     enum DuaState : uint8_t
@@ -252,9 +297,16 @@ private:
     // TODO: (DUA) may re-evaluate the alternative option of distributing the flags into the child table:
     //       - Child class itself have some padding - may save some RAM
     //       - Avoid cross reference between a bit-vector and the child entry
-    ChildMask mChildDuaMask;             // Child Mask for child who registers DUA via Child Update Request.
-    ChildMask mChildDuaRegisteredMask;   // Child Mask for child's DUA that was registered by the parent on behalf.
-    uint16_t  mChildIndexDuaRegistering; // Child Index of the DUA being registered.
+    struct ChildDuaRetry : public Clearable<ChildDuaRetry>
+    {
+        uint8_t mDelay;    // Remaining delay (in seconds) before the child DUA can be registered again.
+        uint8_t mAttempts; // Number of failed registration attempts (determines the next delay).
+    };
+
+    ChildMask     mChildDuaMask;           // Child Mask for child who registers DUA via Child Update Request.
+    ChildMask     mChildDuaRegisteredMask; // Child Mask for child's DUA that was registered by the parent on behalf.
+    ChildMask     mChildDuaPriorityMask;   // Child Mask for child's DUA that was newly added (registered first).
+    ChildDuaRetry mChildDuaRetries[Mle::kMaxChildren];
 #endif
 };
 
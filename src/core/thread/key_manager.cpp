@@ -404,7 +404,7 @@ const Mle::KeyMaterial &KeyManager::GetTemporaryMleKey(uint32_t aKeySequence)
 }
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
-const Mac::KeyMaterial &KeyManager::GetTemporaryTrelMacKey(uint32_t aKeySequence)
+const Mac::CachedKeyMaterial &KeyManager::GetTemporaryTrelMacKey(uint32_t aKeySequence)
 {
     Mac::Key key;
 
@@ -202,7 +202,7 @@ typedef Mac::Key Kek;
  * This class represents a Key Material for Key Encryption Key (KEK).
  *
  */
-typedef Mac::KeyMaterial KekKeyMaterial;
+typedef Mac::CachedKeyMaterial KekKeyMaterial;
 
 /**
  * This class defines Thread Key Manager.
@@ -333,7 +333,7 @@ public:
      * @returns The current TREL MAC key.
      *
      */
-    const Mac::KeyMaterial &GetCurrentTrelMacKey(void) const { return mTrelKey; }
+    const Mac::CachedKeyMaterial &GetCurrentTrelMacKey(void) const { return mTrelKey; }
 
     /**
      * This method returns a temporary MAC key for TREL radio link computed from the given key sequence.
@@ -343,7 +343,7 @@ public:
      * @returns The temporary TREL MAC key.
      *
      */
-    const Mac::KeyMaterial &GetTemporaryTrelMacKey(uint32_t aKeySequence);
+    const Mac::CachedKeyMaterial &GetTemporaryTrelMacKey(uint32_t aKeySequence);
 #endif
 
     /**
@@ -604,8 +604,8 @@ private:
     Mle::KeyMaterial mTemporaryMleKey;
 
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
-    Mac::KeyMaterial mTrelKey;
-    Mac::KeyMaterial mTemporaryTrelKey;
+    Mac::CachedKeyMaterial mTrelKey;
+    Mac::CachedKeyMaterial mTemporaryTrelKey;
 #endif
 
     Mac::LinkFrameCounters mMacFrameCounters;
@@ -467,7 +467,9 @@ void LinkMetrics::HandleReport(const Message &     aMessage,
 
     OT_UNUSED_VARIABLE(error);
 
+#if !OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
     VerifyOrExit(mReportCallback != nullptr);
+#endif
 
     values.Clear();
 
@@ -547,6 +549,17 @@ void LinkMetrics::HandleReport(const Message &     aMessage,
         }
     }
 
+#if OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+    // A reported link margin (measured by the subject on frames from
+    // this device) refreshes the info of a parent candidate.
+    if (hasReport && values.GetMetrics().mLinkMargin)
+    {
+        Get<Mle::Mle>().HandleParentCandidateLinkMargin(aAddress, values.mLinkMarginValue);
+    }
+
+    VerifyOrExit(mReportCallback != nullptr);
+#endif
+
     if (hasStatus)
     {
         mReportCallback(&aAddress, nullptr, status, mReportCallbackContext);
@@ -104,6 +104,10 @@ MeshForwarder::MeshForwarder(Instance &aInstance)
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
     , mDelayNextTx(false)
     , mTxDelayTimer(aInstance, HandleTxDelayTimer)
+#endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE && !OPENTHREAD_CONFIG_MULTI_RADIO
+    , mCutThroughPending(false)
+    , mCutThroughLength(0)
 #endif
     , mScheduleTransmissionTask(aInstance, MeshForwarder::ScheduleTransmissionTask)
 #if OPENTHREAD_FTD
@@ -154,6 +158,10 @@ void MeshForwarder::Stop(void)
     mDelayNextTx = false;
 #endif
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE && !OPENTHREAD_CONFIG_MULTI_RADIO
+    mCutThroughPending = false;
+#endif
+
     mEnabled     = false;
     mSendMessage = nullptr;
     Get<Mac::Mac>().SetRxOnWhenIdle(false);
@@ -273,6 +281,12 @@ void MeshForwarder::ScheduleTransmissionTask(void)
     VerifyOrExit(!mDelayNextTx);
 #endif
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE && !OPENTHREAD_CONFIG_MULTI_RADIO
+    // A cut-through frame already owns the direct tx path. The
+    // send queue is processed again once its transmission is done.
+    VerifyOrExit(!mCutThroughPending);
+#endif
+
     mSendMessage = PrepareNextDirectTransmission();
     VerifyOrExit(mSendMessage != nullptr);
 
@@ -507,6 +521,19 @@ Mac::TxFrame *MeshForwarder::HandleFrameRequest(Mac::TxFrames &aTxFrames)
     Mac::TxFrame *frame         = nullptr;
     bool          addFragHeader = false;
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE && !OPENTHREAD_CONFIG_MULTI_RADIO
+    if (mCutThroughPending)
+    {
+        VerifyOrExit(mEnabled);
+
+        frame     = &aTxFrames.GetTxFrame();
+        mSendBusy = true;
+        SendCutThroughFrame(*frame);
+        frame->SetIsARetransmission(false);
+        ExitNow();
+    }
+#endif
+
     VerifyOrExit(mEnabled && (mSendMessage != nullptr));
 
 #if OPENTHREAD_CONFIG_MULTI_RADIO
@@ -1041,6 +1068,13 @@ void MeshForwarder::HandleSentFrame(Mac::TxFrame &aFrame, Error aError)
         neighbor = UpdateNeighborOnSentFrame(aFrame, aError, macDest);
     }
 
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE && !OPENTHREAD_CONFIG_MULTI_RADIO
+    if (mCutThroughPending)
+    {
+        HandleCutThroughFrameSent(aError);
+    }
+#endif
+
     UpdateSendMessage(aError, macDest, neighbor);
 
 exit:
@@ -454,6 +454,13 @@ private:
     void  EvaluateRoutingCost(uint16_t aDest, uint8_t &aBestCost, uint16_t &aBestDest) const;
     Error AnycastRouteLookup(uint8_t aServiceId, AnycastType aType, uint16_t &aMeshDest) const;
     Error UpdateMeshRoute(Message &aMessage);
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE && !OPENTHREAD_CONFIG_MULTI_RADIO
+    Error ForwardMeshFrameCutThrough(const Lowpan::MeshHeader &aMeshHeader,
+                                     const uint8_t *           aFrame,
+                                     uint16_t                  aFrameLength);
+    void  SendCutThroughFrame(Mac::TxFrame &aFrame);
+    void  HandleCutThroughFrameSent(Error aError);
+#endif
     bool  UpdateReassemblyList(void);
     void  UpdateFragmentPriority(Lowpan::FragmentHeader &aFragmentHeader,
                                  uint16_t                aFragmentLength,
@@ -595,6 +602,12 @@ private:
     bool       mDelayNextTx : 1;
     TimerMilli mTxDelayTimer;
 #endif
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE && !OPENTHREAD_CONFIG_MULTI_RADIO
+    bool      mCutThroughPending;
+    uint8_t   mCutThroughLength;
+    TimeMilli mCutThroughRxTime;
+    uint8_t   mCutThroughFrame[kMeshHeaderFrameMtu];
+#endif
 
     Tasklet mScheduleTransmissionTask;
 
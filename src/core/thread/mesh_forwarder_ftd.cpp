@@ -414,6 +414,111 @@ exit:
     return error;
 }
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE && !OPENTHREAD_CONFIG_MULTI_RADIO
+
+Error MeshForwarder::ForwardMeshFrameCutThrough(const Lowpan::MeshHeader &aMeshHeader,
+                                                const uint8_t *           aFrame,
+                                                uint16_t                  aFrameLength)
+{
+    // Copies a Mesh Header frame to be forwarded into the cut-through
+    // buffer and requests a direct transmission from MAC, skipping the
+    // message allocation and the send queue. This is only done when no
+    // other direct transmission is in progress or waiting, so that a
+    // forwarded frame never overtakes an earlier queued message. On
+    // any error the caller falls back to the queued path.
+
+    Error           error = kErrorNone;
+    const Neighbor *neighbor;
+    uint16_t        nextHop;
+    uint8_t         headerLength;
+
+    VerifyOrExit(mEnabled && !mTxPaused && !mSendBusy && !mCutThroughPending && (mSendMessage == nullptr),
+                 error = kErrorBusy);
+
+#if OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
+    VerifyOrExit(!mDelayNextTx, error = kErrorBusy);
+#endif
+
+    // Header IEs are derived from the message being sent.
+    VerifyOrExit(!CalcIePresent(nullptr), error = kErrorNotCapable);
+
+    for (const Message &message : mSendQueue)
+    {
+        VerifyOrExit(!message.IsDirectTransmission() || message.IsResolvingAddress(), error = kErrorBusy);
+    }
+
+    headerLength = aMeshHeader.GetHeaderLength();
+    VerifyOrExit(headerLength + aFrameLength <= sizeof(mCutThroughFrame), error = kErrorNoBufs);
+
+    nextHop = Get<Mle::MleRouter>().GetNextHop(aMeshHeader.GetDestination());
+
+    if (nextHop != Mac::kShortAddrInvalid)
+    {
+        neighbor = Get<NeighborTable>().FindNeighbor(nextHop);
+    }
+    else
+    {
+        neighbor = Get<NeighborTable>().FindNeighbor(aMeshHeader.GetDestination());
+    }
+
+    VerifyOrExit(neighbor != nullptr, error = kErrorNoRoute);
+
+    aMeshHeader.WriteTo(mCutThroughFrame);
+    memcpy(mCutThroughFrame + headerLength, aFrame, aFrameLength);
+    mCutThroughLength = static_cast<uint8_t>(headerLength + aFrameLength);
+
+    mMacDest.SetShort(neighbor->GetRloc16());
+    mMacSource.SetShort(Get<Mac::Mac>().GetShortAddress());
+    mMeshDest   = aMeshHeader.GetDestination();
+    mMeshSource = aMeshHeader.GetSource();
+
+#if OPENTHREAD_CONFIG_MAC_COLLISION_AVOIDANCE_DELAY_ENABLE
+    if (mMacDest.GetShort() != mMeshDest)
+    {
+        mDelayNextTx = true;
+    }
+#endif
+
+    mCutThroughRxTime  = TimerMilli::GetNow();
+    mCutThroughPending = true;
+    Get<Mac::Mac>().RequestDirectFrameTransmission();
+
+exit:
+    return error;
+}
+
+void MeshForwarder::SendCutThroughFrame(Mac::TxFrame &aFrame)
+{
+    uint16_t fcf;
+
+    fcf = Mac::Frame::kFcfFrameData | Mac::Frame::kFcfPanidCompression | Mac::Frame::kFcfDstAddrShort |
+          Mac::Frame::kFcfSrcAddrShort | Mac::Frame::kFcfAckRequest | Mac::Frame::kFcfSecurityEnabled;
+
+    fcf |= CalcFrameVersion(Get<NeighborTable>().FindNeighbor(mMacDest), /* aIePresent */ false);
+
+    aFrame.InitMacHeader(fcf, Mac::Frame::kKeyIdMode1 | Mac::Frame::kSecEncMic32);
+    aFrame.SetDstPanId(Get<Mac::Mac>().GetPanId());
+    aFrame.SetDstAddr(mMacDest.GetShort());
+    aFrame.SetSrcAddr(mMacSource.GetShort());
+
+    OT_ASSERT(mCutThroughLength <= aFrame.GetMaxPayloadLength());
+    memcpy(aFrame.GetPayload(), mCutThroughFrame, mCutThroughLength);
+    aFrame.SetPayloadLength(mCutThroughLength);
+}
+
+void MeshForwarder::HandleCutThroughFrameSent(Error aError)
+{
+    mCutThroughPending = false;
+
+    LogInfo("Cut-through forward, len:%u, src:0x%04x, dst:0x%04x, next-hop:0x%04x, latency:%lums, error:%s",
+            mCutThroughLength, mMeshSource, mMeshDest, mMacDest.GetShort(),
+            static_cast<unsigned long>(TimerMilli::GetNow() - mCutThroughRxTime), ErrorToString(aError));
+
+    OT_UNUSED_VARIABLE(aError);
+}
+
+#endif // OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE && !OPENTHREAD_CONFIG_MULTI_RADIO
+
 void MeshForwarder::EvaluateRoutingCost(uint16_t aDest, uint8_t &aBestCost, uint16_t &aBestDest) const
 {
     const Neighbor *neighbor;
@@ -782,6 +887,13 @@ void MeshForwarder::HandleMesh(uint8_t *             aFrame,
 
         meshHeader.DecrementHopsLeft();
 
+#if OPENTHREAD_CONFIG_MESH_FORWARDER_CUT_THROUGH_ENABLE && !OPENTHREAD_CONFIG_MULTI_RADIO
+        if (ForwardMeshFrameCutThrough(meshHeader, aFrame, aFrameLength) == kErrorNone)
+        {
+            ExitNow();
+        }
+#endif
+
         GetForwardFramePriority(aFrame, aFrameLength, meshSource, meshDest, priority);
         message =
             Get<MessagePool>().Allocate(Message::kType6lowpan, /* aReserveHeader */ 0, Message::Settings(priority));
@@ -101,6 +101,9 @@ Mle::Mle(Instance &aInstance)
     , mParentLinkMargin(0)
     , mParentIsSingleton(false)
     , mReceivedResponseFromParent(false)
+#if OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE
+    , mFastReparentPending(false)
+#endif
     , mSocket(aInstance)
     , mTimeout(kMleEndDeviceTimeout)
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
@@ -254,6 +257,9 @@ void Mle::Stop(StopMode aMode)
 
     Get<KeyManager>().Stop();
     SetStateDetached();
+#if OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+    mParentCandidates.Clear();
+#endif
     Get<ThreadNetif>().UnsubscribeMulticast(mRealmLocalAllThreadNodes);
     Get<ThreadNetif>().UnsubscribeMulticast(mLinkLocalAllThreadNodes);
     Get<ThreadNetif>().RemoveUnicastAddress(mMeshLocal16);
@@ -501,6 +507,10 @@ Error Mle::BecomeDetached(void)
     mParentSearchRecentlyDetached = true;
 #endif
 
+#if OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE
+    PrepareFastReparent();
+#endif
+
     SetStateDetached();
     mParent.SetState(Neighbor::kStateInvalid);
     SetRloc16(Mac::kShortAddrInvalid);
@@ -592,6 +602,12 @@ uint32_t Mle::GetAttachStartDelay(void) const
 
     VerifyOrExit(IsDetached());
 
+#if OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE
+    // Fast re-parent starts right away, the Parent Request is sent to
+    // a single candidate.
+    VerifyOrExit(!mFastReparentPending);
+#endif
+
     if (mAttachCounter == 0)
     {
         delay = 1 + Random::NonCrypto::GetUint32InRange(0, kParentRequestRouterTimeout);
@@ -1313,6 +1329,7 @@ bool Mle::HasAcceptableParentCandidate(void) const
         break;
 
     case kAttachStateParentRequestReed:
+    case kAttachStateFastReparent:
         break;
 
     default:
@@ -1363,6 +1380,14 @@ void Mle::HandleAttachTimer(void)
         break;
 
     case kAttachStateStart:
+#if OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE
+        if (StartFastReparent())
+        {
+            delay = kParentRequestReedTimeout;
+            break;
+        }
+#endif
+
         if (mAttachCounter > 0)
         {
             LogNote("Attempt to attach - attempt %d, %s %s", mAttachCounter, AttachModeToString(mAttachMode),
@@ -1439,6 +1464,17 @@ void Mle::HandleAttachTimer(void)
         mParentCandidate.Clear();
         delay = Reattach();
         break;
+
+    case kAttachStateFastReparent:
+#if OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE
+        // No (acceptable) response from the candidate, continue with
+        // a regular attach.
+        LogNote("Fast re-parent to %s failed", mFastReparentAddress.ToString().AsCString());
+        mParentCandidates.Remove(mFastReparentAddress);
+#endif
+        SetAttachState(kAttachStateStart);
+        delay = 1;
+        break;
     }
 
 exit:
@@ -1643,7 +1679,7 @@ void Mle::RemoveDelayedMessage(Message::SubType aSubType, MessageType aMessageTy
     }
 }
 
-void Mle::SendParentRequest(ParentRequestType aType)
+void Mle::SendParentRequest(ParentRequestType aType, const Mac::ExtAddress *aExtAddress)
 {
     Error        error = kErrorNone;
     TxMessage *  message;
@@ -1672,7 +1708,15 @@ void Mle::SendParentRequest(ParentRequestType aType)
     SuccessOrExit(error = message->AppendTimeRequestTlv());
 #endif
 
-    destination.SetToLinkLocalAllRoutersMulticast();
+    if (aExtAddress != nullptr)
+    {
+        destination.SetToLinkLocalAddress(*aExtAddress);
+    }
+    else
+    {
+        destination.SetToLinkLocalAllRoutersMulticast();
+    }
+
     SuccessOrExit(error = message->SendTo(destination));
 
     switch (aType)
@@ -2687,6 +2731,21 @@ void Mle::HandleAdvertisement(RxInfo &aRxInfo)
         ExitNow();
 
     case kRoleChild:
+#if OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+        if (aRxInfo.mNeighbor != &mParent)
+        {
+            // Advertisements from other routers refresh the link
+            // margin of parent candidates.
+
+            Mac::ExtAddress extAddress;
+            uint8_t         linkMargin;
+
+            aRxInfo.mMessageInfo.GetPeerAddr().GetIid().ConvertToExtAddress(extAddress);
+            linkMargin = LinkQualityInfo::ConvertRssToLinkMargin(Get<Mac::Mac>().GetNoiseFloor(),
+                                                                 aRxInfo.mMessageInfo.GetThreadLinkInfo()->GetRss());
+            mParentCandidates.UpdateLinkMarginIn(extAddress, linkMargin, TimerMilli::GetNow());
+        }
+#endif
         VerifyOrExit(aRxInfo.mNeighbor == &mParent);
 
         if ((mParent.GetRloc16() == sourceAddress) && (leaderData.GetPartitionId() != mLeaderData.GetPartitionId() ||
@@ -3035,6 +3094,86 @@ exit:
     return rval;
 }
 
+#if OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+bool Mle::IsBetterParentCandidate(const Mac::ExtAddress &aExtAddress) const
+{
+    bool                                   rval      = false;
+    const ParentCandidateTable::Candidate *candidate = mParentCandidates.Find(aExtAddress);
+    const ParentCandidateTable::Candidate *current   = mParentCandidates.Find(mParentCandidate.GetExtAddress());
+
+    // A candidate not in the table (evicted due to its low score)
+    // is never better than the current one.
+
+    VerifyOrExit(candidate != nullptr);
+    VerifyOrExit(current != nullptr, rval = true);
+
+    rval = (candidate->CalculateScore() > current->CalculateScore());
+
+exit:
+    return rval;
+}
+
+void Mle::HandleParentCandidateLinkMargin(const Ip6::Address &aAddress, uint8_t aLinkMargin)
+{
+    Mac::ExtAddress extAddress;
+
+    aAddress.GetIid().ConvertToExtAddress(extAddress);
+    mParentCandidates.UpdateLinkMarginOut(extAddress, aLinkMargin, TimerMilli::GetNow());
+}
+#endif // OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+
+#if OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE
+void Mle::PrepareFastReparent(void)
+{
+    // Called when the device detaches. If it was a child, the best
+    // remaining parent candidate is selected to re-attach to.
+
+    const ParentCandidateTable::Candidate *candidate;
+
+    mFastReparentPending = false;
+
+    VerifyOrExit(IsChild());
+
+    mParentCandidates.Remove(mParent.GetExtAddress());
+
+    candidate = mParentCandidates.FindBest(mParent.GetExtAddress(), TimerMilli::GetNow(), kParentCandidateMaxAge);
+    VerifyOrExit(candidate != nullptr);
+
+    mFastReparentAddress = candidate->mExtAddress;
+    mFastReparentPending = true;
+
+exit:
+    return;
+}
+
+bool Mle::StartFastReparent(void)
+{
+    bool                                   started = false;
+    const ParentCandidateTable::Candidate *candidate;
+
+    VerifyOrExit(mFastReparentPending);
+    mFastReparentPending = false;
+
+    candidate = mParentCandidates.Find(mFastReparentAddress);
+    VerifyOrExit(candidate != nullptr);
+
+    LogNote("Attempt fast re-parent to %s", mFastReparentAddress.ToString().AsCString());
+
+    SetAttachState(kAttachStateFastReparent);
+    mParentCandidate.SetState(Neighbor::kStateInvalid);
+    mReceivedResponseFromParent = false;
+    Get<MeshForwarder>().SetRxOnWhenIdle(true);
+
+    // A router responds with a shorter delay to a Parent Request
+    // sent to routers only.
+    SendParentRequest(IsActiveRouter(candidate->mRloc16) ? kToRouters : kToRoutersAndReeds, &mFastReparentAddress);
+    started = true;
+
+exit:
+    return started;
+}
+#endif // OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE
+
 void Mle::HandleParentResponse(RxInfo &aRxInfo)
 {
     Error                 error    = kErrorNone;
@@ -3158,6 +3297,34 @@ void Mle::HandleParentResponse(RxInfo &aRxInfo)
     }
 #endif
 
+#if OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+    {
+        ParentCandidateTable::Candidate candidate;
+
+        candidate.Clear();
+        candidate.mExtAddress     = extAddress;
+        candidate.mRloc16         = sourceAddress;
+        candidate.mLinkMarginIn   = LinkQualityInfo::ConvertRssToLinkMargin(Get<Mac::Mac>().GetNoiseFloor(),
+                                                                          linkInfo->GetRss());
+        candidate.mLinkMarginOut  = linkMarginFromTlv;
+        candidate.mParentPriority = connectivity.GetParentPriority();
+        candidate.mLinkQuality3   = connectivity.GetLinkQuality3();
+        candidate.mLinkQuality2   = connectivity.GetLinkQuality2();
+        candidate.mLinkQuality1   = connectivity.GetLinkQuality1();
+        candidate.mVersion        = static_cast<uint8_t>(version);
+        candidate.mLastUpdate     = TimerMilli::GetNow();
+#if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
+        if (!IsRxOnWhenIdle())
+        {
+            candidate.mCslClockAccuracy = clockAccuracy.GetCslClockAccuracy();
+            candidate.mCslUncertainty   = clockAccuracy.GetCslUncertainty();
+        }
+#endif
+
+        mParentCandidates.Update(candidate);
+    }
+#endif
+
     // Continue to process the "ParentResponse" if it is from current
     // parent candidate to update the challenge and frame counters.
 
@@ -3179,7 +3346,9 @@ void Mle::HandleParentResponse(RxInfo &aRxInfo)
 #endif
 
         // only consider better parents if the partitions are the same
-#if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
+#if OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+        VerifyOrExit(compare != 0 || IsBetterParentCandidate(extAddress));
+#elif OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
         VerifyOrExit(compare != 0 ||
                      IsBetterParent(sourceAddress, linkQuality, linkMargin, connectivity, static_cast<uint8_t>(version),
                                     clockAccuracy.GetCslClockAccuracy(), clockAccuracy.GetCslUncertainty()));
@@ -3246,6 +3415,15 @@ void Mle::HandleParentResponse(RxInfo &aRxInfo)
     mParentIsSingleton      = connectivity.GetActiveRouters() <= 1;
     mParentLinkMargin       = linkMargin;
 
+#if OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE
+    if (mAttachState == kAttachStateFastReparent)
+    {
+        // Attach to the candidate right away, no other response is
+        // expected to the unicast Parent Request.
+        mAttachTimer.Start(0);
+    }
+#endif
+
 exit:
     LogProcessError(kTypeParentResponse, error);
 }
@@ -4219,6 +4397,7 @@ const char *Mle::AttachStateToString(AttachState aState)
         "ParentReqReeds",   // (4) kAttachStateParentRequestReed
         "Announce",         // (5) kAttachStateAnnounce
         "ChildIdReq",       // (6) kAttachStateChildIdRequest
+        "FastReparent",     // (7) kAttachStateFastReparent
     };
 
     static_assert(kAttachStateIdle == 0, "kAttachStateIdle value is incorrect");
@@ -4228,6 +4407,7 @@ const char *Mle::AttachStateToString(AttachState aState)
     static_assert(kAttachStateParentRequestReed == 4, "kAttachStateParentRequestReed value is incorrect");
     static_assert(kAttachStateAnnounce == 5, "kAttachStateAnnounce value is incorrect");
     static_assert(kAttachStateChildIdRequest == 6, "kAttachStateChildIdRequest value is incorrect");
+    static_assert(kAttachStateFastReparent == 7, "kAttachStateFastReparent value is incorrect");
 
     return kAttachStateStrings[aState];
 }
@@ -53,8 +53,13 @@
 #include "thread/mle_types.hpp"
 #include "thread/neighbor_table.hpp"
 #include "thread/network_data_types.hpp"
+#include "thread/parent_candidates.hpp"
 #include "thread/topology.hpp"
 
+#if OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE && !OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+#error "OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE is required for OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE"
+#endif
+
 namespace ot {
 
 /**
@@ -425,6 +430,25 @@ public:
      */
     Router &GetParentCandidate(void) { return mParentCandidate; }
 
+#if OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+    /**
+     * This method gets the table of scored parent candidates.
+     *
+     * @returns A reference to the parent candidate table.
+     *
+     */
+    const ParentCandidateTable &GetParentCandidateTable(void) const { return mParentCandidates; }
+
+    /**
+     * This method updates the link margin measured by a parent candidate (e.g., from a Link Metrics report).
+     *
+     * @param[in] aAddress     The link-local IPv6 address of the candidate.
+     * @param[in] aLinkMargin  The link margin (in dB) of frames from this device measured by the candidate.
+     *
+     */
+    void HandleParentCandidateLinkMargin(const Ip6::Address &aAddress, uint8_t aLinkMargin);
+#endif
+
     /**
      * This method indicates whether or not an IPv6 address is an RLOC.
      *
@@ -819,6 +843,7 @@ protected:
         kAttachStateParentRequestReed,   ///< Searching for Routers or REEDs to attach to.
         kAttachStateAnnounce,            ///< Send Announce messages
         kAttachStateChildIdRequest,      ///< Sending a Child ID Request message.
+        kAttachStateFastReparent,        ///< Searching for the runner-up parent candidate after parent link failure.
     };
 
     /**
@@ -1731,6 +1756,10 @@ private:
     static constexpr uint32_t kAttachBackoffDelayToResetCounter =
         OPENTHREAD_CONFIG_MLE_ATTACH_BACKOFF_DELAY_TO_RESET_BACKOFF_INTERVAL;
 
+#if OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+    static constexpr uint32_t kParentCandidateMaxAge = (OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_MAX_AGE * 1000u);
+#endif
+
     enum StartMode : uint8_t // Used in `Start()`.
     {
         kNormalAttach,
@@ -1873,7 +1902,7 @@ private:
     bool  HasUnregisteredAddress(void);
 
     uint32_t GetAttachStartDelay(void) const;
-    void     SendParentRequest(ParentRequestType aType);
+    void     SendParentRequest(ParentRequestType aType, const Mac::ExtAddress *aExtAddress = nullptr);
     Error    SendChildIdRequest(void);
     Error    GetNextAnnouceChannel(uint8_t &aChannel) const;
     bool     HasMoreChannelsToAnnouce(void) const;
@@ -1897,6 +1926,14 @@ private:
                         uint8_t                aCslUncertainty);
     bool IsNetworkDataNewer(const LeaderData &aLeaderData);
 
+#if OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+    bool IsBetterParentCandidate(const Mac::ExtAddress &aExtAddress) const;
+#endif
+#if OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE
+    void PrepareFastReparent(void);
+    bool StartFastReparent(void);
+#endif
+
     Error ProcessMessageSecurity(Crypto::AesCcm::Mode    aMode,
                                  Message &               aMessage,
                                  const Ip6::MessageInfo &aMessageInfo,
@@ -1953,6 +1990,14 @@ private:
 
     Challenge mParentCandidateChallenge;
 
+#if OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_ENABLE
+    ParentCandidateTable mParentCandidates;
+#endif
+#if OPENTHREAD_CONFIG_MLE_FAST_REPARENT_ENABLE
+    bool            mFastReparentPending;
+    Mac::ExtAddress mFastReparentAddress;
+#endif
+
     Ip6::Udp::Socket mSocket;
     uint32_t         mTimeout;
 #if OPENTHREAD_CONFIG_MAC_CSL_RECEIVER_ENABLE
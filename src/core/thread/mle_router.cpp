@@ -100,6 +100,10 @@ MleRouter::MleRouter(Instance &aInstance)
 
     SetRouterId(kInvalidRouterId);
 
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE
+    mLastAdvertisedRouteTlv.SetLength(0);
+#endif
+
 #if OPENTHREAD_CONFIG_MLE_STEERING_DATA_SET_OOB_ENABLE
     mSteeringData.Clear();
 #endif
@@ -452,12 +456,89 @@ void MleRouter::HandleAdvertiseTrickleTimer(void)
 {
     VerifyOrExit(IsRouterEligible(), mAdvertiseTrickleTimer.Stop());
 
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE
+    VerifyOrExit(!ShouldSuppressAdvertisement());
+#endif
+
     SendAdvertisement();
 
 exit:
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE
+    if (mAdvertiseTrickleTimer.IsRunning() && (mAdvertiseTrickleTimer.GetMode() == TrickleTimer::kModeTrickle))
+    {
+        mAdvertiseTrickleTimer.SetIntervalMax(DetermineAdvertiseIntervalMax());
+    }
+#endif
     return;
 }
 
+uint32_t MleRouter::DetermineAdvertiseIntervalMax(void) const
+{
+    uint32_t interval = kAdvertiseIntervalMax;
+
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE
+    static constexpr uint8_t  kRouterThreshold    = OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ROUTER_THRESHOLD;
+    static constexpr uint32_t kIntervalMaxLargest = OPENTHREAD_CONFIG_MLE_ADVERTISE_INTERVAL_MAX_LARGE_NETWORK;
+
+    static_assert(kRouterThreshold < kMaxRouters, "ADVERTISE_SUPPRESSION_ROUTER_THRESHOLD must be below max routers");
+    static_assert(kIntervalMaxLargest >= kAdvertiseIntervalMax, "ADVERTISE_INTERVAL_MAX_LARGE_NETWORK is too small");
+    static_assert(kIntervalMaxLargest + kIntervalMaxLargest / 2 < kMaxNeighborAge,
+                  "ADVERTISE_INTERVAL_MAX_LARGE_NETWORK is too large, neighbors would age out the router");
+
+    uint8_t routerCount = mRouterTable.GetActiveRouterCount();
+
+    // The max interval grows linearly from `kAdvertiseIntervalMax`
+    // at the router threshold up to `kIntervalMaxLargest` when all
+    // router IDs are in use.
+
+    if (routerCount > kRouterThreshold)
+    {
+        interval += (kIntervalMaxLargest - kAdvertiseIntervalMax) * (routerCount - kRouterThreshold) /
+                    (kMaxRouters - kRouterThreshold);
+    }
+#endif
+
+    return Time::SecToMsec(interval);
+}
+
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE
+bool MleRouter::ShouldSuppressAdvertisement(void)
+{
+    // An Advertisement is suppressed in a large network when enough
+    // consistent Advertisements (same partition and Router ID Set)
+    // were heard in the current trickle interval and the Route TLV
+    // is unchanged since the last Advertisement, so that it carries
+    // nothing new to the neighbors. The next Advertisement is sent
+    // at the latest by the end of the next interval, which must be
+    // within the neighbor max age from the last one.
+
+    bool     suppress = false;
+    RouteTlv routeTlv;
+
+    VerifyOrExit(IsRouterOrLeader() && (mAdvertiseTrickleTimer.GetMode() == TrickleTimer::kModeTrickle));
+    VerifyOrExit(mRouterTable.GetActiveRouterCount() >= OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ROUTER_THRESHOLD);
+    VerifyOrExit(mAdvertiseTrickleTimer.GetCounter() >= OPENTHREAD_CONFIG_MLE_ADVERTISE_REDUNDANCY_CONSTANT);
+    VerifyOrExit(mAdvertiseTrickleTimer.GetIntervalEndTime() + DetermineAdvertiseIntervalMax() - mLastAdvertiseTime <
+                 Time::SecToMsec(kMaxNeighborAge));
+
+    routeTlv.Init();
+    FillRouteTlv(routeTlv);
+
+    // The leader increments the Router ID Sequence periodically, a
+    // new sequence number alone is not a change to advertise.
+    routeTlv.SetRouterIdSequence(mLastAdvertisedRouteTlv.GetRouterIdSequence());
+
+    VerifyOrExit((routeTlv.GetLength() == mLastAdvertisedRouteTlv.GetLength()) &&
+                 (memcmp(&routeTlv, &mLastAdvertisedRouteTlv, routeTlv.GetSize()) == 0));
+
+    LogInfo("Suppress Advertisement, heard %u consistent", mAdvertiseTrickleTimer.GetCounter());
+    suppress = true;
+
+exit:
+    return suppress;
+}
+#endif
+
 void MleRouter::StopAdvertiseTrickleTimer(void)
 {
     mAdvertiseTrickleTimer.Stop();
@@ -470,7 +551,10 @@ void MleRouter::ResetAdvertiseInterval(void)
     if (!mAdvertiseTrickleTimer.IsRunning())
     {
         mAdvertiseTrickleTimer.Start(TrickleTimer::kModeTrickle, Time::SecToMsec(kAdvertiseIntervalMin),
-                                     Time::SecToMsec(kAdvertiseIntervalMax));
+                                     DetermineAdvertiseIntervalMax());
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE
+        mLastAdvertisedRouteTlv.SetLength(0);
+#endif
     }
 
     mAdvertiseTrickleTimer.IndicateInconsistent();
@@ -528,6 +612,15 @@ void MleRouter::SendAdvertisement(void)
 
     Log(kMessageSend, kTypeAdvertisement, destination);
 
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE
+    if (IsRouterOrLeader())
+    {
+        mLastAdvertiseTime = TimerMilli::GetNow();
+        mLastAdvertisedRouteTlv.Init();
+        FillRouteTlv(mLastAdvertisedRouteTlv);
+    }
+#endif
+
 exit:
     FreeMessageOnError(message, error);
     LogSendError(kTypeAdvertisement, error);
@@ -1490,6 +1583,13 @@ Error MleRouter::HandleAdvertisement(RxInfo &aRxInfo)
         break;
     }
 
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE
+    if (route.GetRouterIdMask() == mRouterTable.GetRouterIdSet())
+    {
+        mAdvertiseTrickleTimer.IndicateConsistent();
+    }
+#endif
+
     UpdateRoutes(route, routerId);
 
 exit:
@@ -2449,6 +2549,9 @@ void MleRouter::HandleChildIdRequest(RxInfo &aRxInfo)
     child->SetVersion(static_cast<uint8_t>(version));
     child->GetLinkInfo().AddRss(aRxInfo.mMessageInfo.GetThreadLinkInfo()->GetRss());
     child->SetTimeout(timeout);
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+    child->SetInfoUpdateTime(TimerMilli::GetNow());
+#endif
 #if OPENTHREAD_CONFIG_MULTI_RADIO
     child->ClearLastRxFragmentTag();
 #endif
@@ -2612,6 +2715,10 @@ void MleRouter::HandleChildUpdateRequest(RxInfo &aRxInfo)
         ExitNow(error = kErrorParse);
     }
 
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+    child->SetInfoUpdateTime(TimerMilli::GetNow());
+#endif
+
     // TLV Request
     switch (aRxInfo.mMessage.ReadTlvRequestTlv(requestedTlvs))
     {
@@ -2833,6 +2940,9 @@ void MleRouter::HandleChildUpdateResponse(RxInfo &aRxInfo)
     SetChildStateToValid(*child);
     child->SetLastHeard(TimerMilli::GetNow());
     child->SetKeySequence(aRxInfo.mKeySequence);
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+    child->SetInfoUpdateTime(TimerMilli::GetNow());
+#endif
     child->GetLinkInfo().AddRss(aRxInfo.mMessageInfo.GetThreadLinkInfo()->GetRss());
 
     aRxInfo.mClass = (response.mLength == 0) ? RxInfo::kPeerMessage : RxInfo::kAuthoritativeMessage;
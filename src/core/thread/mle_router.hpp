@@ -667,8 +667,16 @@ private:
     static void HandleAdvertiseTrickleTimer(TrickleTimer &aTimer);
     void        HandleAdvertiseTrickleTimer(void);
     void        HandleTimeTick(void);
+    uint32_t    DetermineAdvertiseIntervalMax(void) const;
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE
+    bool ShouldSuppressAdvertisement(void);
+#endif
 
     TrickleTimer mAdvertiseTrickleTimer;
+#if OPENTHREAD_CONFIG_MLE_ADVERTISE_SUPPRESSION_ENABLE
+    TimeMilli mLastAdvertiseTime;
+    RouteTlv  mLastAdvertisedRouteTlv;
+#endif
 
     Coap::Resource mAddressSolicit;
     Coap::Resource mAddressRelease;
@@ -550,10 +550,10 @@ private:
 } OT_TOOL_PACKED_END;
 
 /**
- * This class represents a MLE Key Material
+ * This class represents a MLE Key Material (along with its cached AES key schedule).
  *
  */
-typedef Mac::KeyMaterial KeyMaterial;
+typedef Mac::CachedKeyMaterial KeyMaterial;
 
 /**
  * This class represents a MLE Key.
@@ -61,6 +61,9 @@ RegisterLogModule("NetworkData");
 Leader::Leader(Instance &aInstance)
     : LeaderBase(aInstance)
     , mTimer(aInstance, Leader::HandleTimer)
+#if OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+    , mVersionTimer(aInstance, Leader::HandleVersionTimer)
+#endif
     , mServerData(UriPath::kServerData, &Leader::HandleServerData, this)
     , mCommissioningDataGet(UriPath::kCommissionerGet, &Leader::HandleCommissioningGet, this)
     , mCommissioningDataSet(UriPath::kCommissionerSet, &Leader::HandleCommissioningSet, this)
@@ -75,6 +78,11 @@ void Leader::Reset(void)
     memset(reinterpret_cast<void *>(mContextLastUsed), 0, sizeof(mContextLastUsed));
     mContextUsed         = 0;
     mContextIdReuseDelay = kContextIdReuseDelay;
+
+#if OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+    mVersionTimer.Stop();
+    mPendingChanges.Clear();
+#endif
 }
 
 void Leader::Start(void)
@@ -89,6 +97,11 @@ void Leader::Stop(void)
     Get<Tmf::Agent>().RemoveResource(mServerData);
     Get<Tmf::Agent>().RemoveResource(mCommissioningDataGet);
     Get<Tmf::Agent>().RemoveResource(mCommissioningDataSet);
+
+#if OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+    mVersionTimer.Stop();
+    mPendingChanges.Clear();
+#endif
 }
 
 void Leader::IncrementVersion(void)
@@ -117,6 +130,13 @@ void Leader::IncrementVersions(const ChangedFlags &aFlags)
 
 void Leader::IncrementVersions(bool aIncludeStable)
 {
+#if OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+    // Any pending coalesced changes are covered by this increment.
+    aIncludeStable = aIncludeStable || mPendingChanges.DidStableChange();
+    mPendingChanges.Clear();
+    mVersionTimer.Stop();
+#endif
+
     if (aIncludeStable)
     {
         mStableVersion++;
@@ -126,6 +146,45 @@ void Leader::IncrementVersions(bool aIncludeStable)
     Get<ot::Notifier>().Signal(kEventThreadNetdataChanged);
 }
 
+void Leader::ScheduleIncrementVersions(const ChangedFlags &aFlags)
+{
+#if OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+    VerifyOrExit(aFlags.DidChange());
+
+    mPendingChanges.Update(aFlags);
+
+    // The window is not extended by later registrations so that
+    // the changes are published within `kCoalesceWindow`.
+
+    if (!mVersionTimer.IsRunning())
+    {
+        mVersionTimer.Start(kCoalesceWindow);
+    }
+
+exit:
+    return;
+#else
+    IncrementVersions(aFlags);
+#endif
+}
+
+#if OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+
+void Leader::HandleVersionTimer(Timer &aTimer)
+{
+    aTimer.Get<Leader>().HandleVersionTimer();
+}
+
+void Leader::HandleVersionTimer(void)
+{
+    ChangedFlags flags = mPendingChanges;
+
+    LogInfo("Publishing coalesced network data changes");
+    IncrementVersions(flags);
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+
 void Leader::RemoveBorderRouter(uint16_t aRloc16, MatchMode aMatchMode)
 {
     ChangedFlags flags;
@@ -143,6 +202,7 @@ void Leader::HandleServerData(Coap::Message &aMessage, const Ip6::MessageInfo &a
 {
     ThreadNetworkDataTlv networkDataTlv;
     uint16_t             rloc16;
+    ChangedFlags         flags;
 
     LogInfo("Received network data registration");
 
@@ -151,7 +211,8 @@ void Leader::HandleServerData(Coap::Message &aMessage, const Ip6::MessageInfo &a
     switch (Tlv::Find<ThreadRloc16Tlv>(aMessage, rloc16))
     {
     case kErrorNone:
-        RemoveBorderRouter(rloc16, kMatchModeRloc16);
+        RemoveRloc(rloc16, kMatchModeRloc16, flags);
+        ScheduleIncrementVersions(flags);
         break;
     case kErrorNotFound:
         break;
@@ -725,7 +786,7 @@ void Leader::RegisterNetworkData(uint16_t aRloc16, const NetworkData &aNetworkDa
         }
     }
 
-    IncrementVersions(flags);
+    ScheduleIncrementVersions(flags);
 
     DumpDebg("Register", GetBytes(), GetLength());
 
@@ -202,6 +202,18 @@ private:
             mStableChanged = (mStableChanged || aTlv.IsStable());
         }
 
+        void Update(const ChangedFlags &aFlags)
+        {
+            mChanged       = (mChanged || aFlags.mChanged);
+            mStableChanged = (mStableChanged || aFlags.mStableChanged);
+        }
+
+        void Clear(void)
+        {
+            mChanged       = false;
+            mStableChanged = false;
+        }
+
         bool DidChange(void) const { return mChanged; }
         bool DidStableChange(void) const { return mStableChanged; }
 
@@ -222,6 +234,11 @@ private:
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+    static void HandleVersionTimer(Timer &aTimer);
+    void        HandleVersionTimer(void);
+#endif
+
     void RegisterNetworkData(uint16_t aRloc16, const NetworkData &aNetworkData);
 
     Error AddPrefix(const PrefixTlv &aPrefix, ChangedFlags &aChangedFlags);
@@ -300,17 +317,27 @@ private:
                                       MeshCoP::StateTlv::State aState);
     void IncrementVersions(bool aIncludeStable);
     void IncrementVersions(const ChangedFlags &aFlags);
+    void ScheduleIncrementVersions(const ChangedFlags &aFlags);
 
     static constexpr uint8_t  kMinContextId        = 1;            // Minimum Context ID (0 is used for Mesh Local)
     static constexpr uint8_t  kNumContextIds       = 15;           // Maximum Context ID
     static constexpr uint32_t kContextIdReuseDelay = 48 * 60 * 60; // in seconds
     static constexpr uint32_t kStateUpdatePeriod   = 60 * 1000;    // State update period in milliseconds
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+    static constexpr uint32_t kCoalesceWindow = OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW; // in msec
+#endif
+
     uint16_t   mContextUsed;
     TimeMilli  mContextLastUsed[kNumContextIds];
     uint32_t   mContextIdReuseDelay;
     TimerMilli mTimer;
 
+#if OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW
+    TimerMilli   mVersionTimer;
+    ChangedFlags mPendingChanges;
+#endif
+
     Coap::Resource mServerData;
 
     Coap::Resource mCommissioningDataGet;
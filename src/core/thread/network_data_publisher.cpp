@@ -36,15 +36,16 @@
 
 #if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_ENABLE
 
-#include "common/array.hpp"
 #include "common/code_utils.hpp"
 #include "common/const_cast.hpp"
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
 #include "common/random.hpp"
+#include "thread/network_data_leader.hpp"
 #include "thread/network_data_local.hpp"
 #include "thread/network_data_service.hpp"
+#include "thread/network_data_tlvs.hpp"
 
 namespace ot {
 namespace NetworkData {
@@ -60,23 +61,15 @@ Publisher::Publisher(Instance &aInstance)
     , mDnsSrpServiceEntry(aInstance)
 #endif
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE
+#if !OPENTHREAD_CONFIG_NETDATA_PUBLISHER_HEAP_PREFIX_ENTRIES_ENABLE
+    , mPrefixEntryPool(aInstance)
+#endif
     , mPrefixCallback(nullptr)
     , mPrefixCallbackContext(nullptr)
 #endif
     , mTimer(aInstance, Publisher::HandleTimer)
 {
-#if OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE
-    // Since the `PrefixEntry` type is used in an array,
-    // we cannot use a constructor with an argument (e.g.,
-    // we cannot use `InstacneLocator`) so we use
-    // `IntanceLocatorInit`  and `Init()` the entries one
-    // by one.
-
-    for (PrefixEntry &entry : mPrefixEntries)
-    {
-        entry.Init(aInstance);
-    }
-#endif
+    mCounters.Clear();
 }
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE
@@ -143,7 +136,13 @@ Error Publisher::UnpublishPrefix(const Ip6::Prefix &aPrefix)
     entry = FindMatchingPrefixEntry(aPrefix);
     VerifyOrExit(entry != nullptr, error = kErrorNotFound);
 
+    // The entry is removed from the list before it is unpublished
+    // so that a new entry for the same prefix can be published
+    // from the callback reporting the entry removal.
+
+    IgnoreError(mPrefixEntries.Remove(*entry));
     entry->Unpublish();
+    FreePrefixEntry(*entry);
 
 exit:
     return error;
@@ -158,19 +157,30 @@ Publisher::PrefixEntry *Publisher::FindOrAllocatePrefixEntry(const Ip6::Prefix &
 
     VerifyOrExit(prefixEntry == nullptr);
 
-    for (PrefixEntry &entry : mPrefixEntries)
-    {
-        if (!entry.IsInUse())
-        {
-            prefixEntry = &entry;
-            ExitNow();
-        }
-    }
+#if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_HEAP_PREFIX_ENTRIES_ENABLE
+    prefixEntry = PrefixEntry::Allocate();
+    VerifyOrExit(prefixEntry != nullptr);
+    prefixEntry->Init(GetInstance());
+#else
+    prefixEntry = mPrefixEntryPool.Allocate();
+    VerifyOrExit(prefixEntry != nullptr);
+#endif
+
+    mPrefixEntries.Push(*prefixEntry);
 
 exit:
     return prefixEntry;
 }
 
+void Publisher::FreePrefixEntry(PrefixEntry &aEntry)
+{
+#if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_HEAP_PREFIX_ENTRIES_ENABLE
+    aEntry.Free();
+#else
+    mPrefixEntryPool.Free(aEntry);
+#endif
+}
+
 Publisher::PrefixEntry *Publisher::FindMatchingPrefixEntry(const Ip6::Prefix &aPrefix)
 {
     return AsNonConst(AsConst(this)->FindMatchingPrefixEntry(aPrefix));
@@ -178,23 +188,73 @@ Publisher::PrefixEntry *Publisher::FindMatchingPrefixEntry(const Ip6::Prefix &aP
 
 const Publisher::PrefixEntry *Publisher::FindMatchingPrefixEntry(const Ip6::Prefix &aPrefix) const
 {
-    const PrefixEntry *prefixEntry = nullptr;
+    return mPrefixEntries.FindMatching(aPrefix);
+}
+
+bool Publisher::IsAPrefixEntry(const Entry &aEntry) const
+{
+    // Prefix entries are either allocated from heap or from a pool,
+    // so any entry other than the DNS/SRP service one is a prefix
+    // entry.
+
+#if OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
+    return !IsADnsSrpServiceEntry(aEntry);
+#else
+    OT_UNUSED_VARIABLE(aEntry);
+    return true;
+#endif
+}
 
-    for (const PrefixEntry &entry : mPrefixEntries)
+void Publisher::ProcessPrefixEntries(void)
+{
+    // This method checks the entries currently present in Network
+    // Data for all published prefix entries using a single pass over
+    // the Network Data TLVs (instead of a separate prefix lookup for
+    // every entry) and then updates the state of each entry.
+
+    const NetworkDataTlv *start;
+    const NetworkDataTlv *end;
+    const PrefixTlv *     prefixTlv;
+
+    // Do not make any changes if device is not attached, and wait
+    // for role change event.
+    VerifyOrExit(Get<Mle::Mle>().IsAttached());
+
+    VerifyOrExit(!mPrefixEntries.IsEmpty());
+
+    for (PrefixEntry &entry : mPrefixEntries)
     {
-        if (entry.IsInUse() && entry.Matches(aPrefix))
+        entry.ClearEntryCounts();
+    }
+
+    start = Get<Leader>().GetTlvsStart();
+    end   = Get<Leader>().GetTlvsEnd();
+
+    while ((prefixTlv = NetworkDataTlv::Find<PrefixTlv>(start, end)) != nullptr)
+    {
+        Ip6::Prefix  prefix;
+        PrefixEntry *entry;
+
+        prefixTlv->CopyPrefixTo(prefix);
+        entry = FindMatchingPrefixEntry(prefix);
+
+        if (entry != nullptr)
         {
-            prefixEntry = &entry;
-            break;
+            entry->CountEntries(*prefixTlv);
         }
+
+        start = prefixTlv->GetNext();
     }
 
-    return prefixEntry;
-}
+    mCounters.mNetDataScans++;
 
-bool Publisher::IsAPrefixEntry(const Entry &aEntry) const
-{
-    return (&mPrefixEntries[0] <= &aEntry) && (&aEntry < GetArrayEnd(mPrefixEntries));
+    for (PrefixEntry &entry : mPrefixEntries)
+    {
+        entry.UpdateState();
+    }
+
+exit:
+    return;
 }
 
 void Publisher::NotifyPrefixEntryChange(Event aEvent, const Ip6::Prefix &aPrefix) const
@@ -214,9 +274,9 @@ void Publisher::HandleNotifierEvents(Events aEvents)
 #endif
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE
-    for (PrefixEntry &entry : mPrefixEntries)
+    if (aEvents.ContainsAny(kEventThreadNetdataChanged | kEventThreadRoleChanged))
     {
-        entry.HandleNotifierEvents(aEvents);
+        ProcessPrefixEntries();
     }
 #endif
 }
@@ -513,6 +573,8 @@ void Publisher::DnsSrpServiceEntry::PublishUnicast(uint16_t aPort)
 
 void Publisher::DnsSrpServiceEntry::Publish(const Info &aInfo)
 {
+    Get<Publisher>().mCounters.mPublishRequests++;
+
     if (GetState() != kNoEntry)
     {
         if (aInfo == mInfo)
@@ -537,6 +599,7 @@ void Publisher::DnsSrpServiceEntry::Unpublish(void)
 {
     LogInfo("Unpublishing DNS/SRP service");
 
+    Get<Publisher>().mCounters.mUnpublishRequests++;
     Remove(/* aNextState */ kNoEntry);
 }
 
@@ -587,6 +650,7 @@ void Publisher::DnsSrpServiceEntry::Add(void)
     }
 
     Get<Notifier>().HandleServerDataUpdated();
+    Get<Publisher>().mCounters.mEntryAdds++;
     SetState(kAdded);
     Notify(kEventEntryAdded);
 
@@ -618,6 +682,7 @@ void Publisher::DnsSrpServiceEntry::Remove(State aNextState)
     }
 
     Get<Notifier>().HandleServerDataUpdated();
+    Get<Publisher>().mCounters.mEntryRemoves++;
     Notify(kEventEntryRemoved);
 
 exit:
@@ -652,6 +717,8 @@ void Publisher::DnsSrpServiceEntry::Process(void)
 
     VerifyOrExit(GetState() != kNoEntry);
 
+    Get<Publisher>().mCounters.mNetDataScans++;
+
     switch (GetType())
     {
     case kTypeAnycast:
@@ -807,6 +874,8 @@ void Publisher::PrefixEntry::Publish(const ExternalRouteConfig &aConfig)
 
 void Publisher::PrefixEntry::Publish(const Ip6::Prefix &aPrefix, uint16_t aNewFlags, Type aNewType)
 {
+    Get<Publisher>().mCounters.mPublishRequests++;
+
     if (GetState() != kNoEntry)
     {
         // If this is an existing entry, first we check that there is
@@ -846,17 +915,10 @@ void Publisher::PrefixEntry::Unpublish(void)
 {
     LogInfo("Unpublishing %s", mPrefix.ToString().AsCString());
 
+    Get<Publisher>().mCounters.mUnpublishRequests++;
     Remove(/* aNextState */ kNoEntry);
 }
 
-void Publisher::PrefixEntry::HandleNotifierEvents(Events aEvents)
-{
-    if (aEvents.ContainsAny(kEventThreadNetdataChanged | kEventThreadRoleChanged))
-    {
-        Process();
-    }
-}
-
 void Publisher::PrefixEntry::Add(void)
 {
     // Adds the prefix entry to the network data.
@@ -873,6 +935,7 @@ void Publisher::PrefixEntry::Add(void)
     }
 
     Get<Notifier>().HandleServerDataUpdated();
+    Get<Publisher>().mCounters.mEntryAdds++;
     SetState(kAdded);
     Get<Publisher>().NotifyPrefixEntryChange(kEventEntryAdded, mPrefix);
 
@@ -920,6 +983,7 @@ void Publisher::PrefixEntry::Remove(State aNextState)
     }
 
     Get<Notifier>().HandleServerDataUpdated();
+    Get<Publisher>().mCounters.mEntryRemoves++;
     Get<Publisher>().NotifyPrefixEntryChange(kEventEntryRemoved, mPrefix);
 
 exit:
@@ -929,12 +993,12 @@ exit:
 void Publisher::PrefixEntry::Process(void)
 {
     // This method checks the entries currently present in Network Data
-    // based on which it then decides whether or not take action
-    // (add/remove or keep monitoring).
+    // for this entry only (e.g., when the entry is newly published)
+    // and then decides whether or not take action (add/remove or keep
+    // monitoring). On Network Data changes, all the prefix entries are
+    // processed together by `Publisher::ProcessPrefixEntries()`.
 
-    uint8_t numEntries          = 0;
-    uint8_t numPreferredEntries = 0;
-    uint8_t desiredNumEntries   = 0;
+    const PrefixTlv *prefixTlv;
 
     // Do not make any changes if device is not attached, and wait
     // for role change event.
@@ -942,35 +1006,71 @@ void Publisher::PrefixEntry::Process(void)
 
     VerifyOrExit(GetState() != kNoEntry);
 
+    ClearEntryCounts();
+
+    prefixTlv = Get<Leader>().FindPrefix(mPrefix);
+
+    if (prefixTlv != nullptr)
+    {
+        CountEntries(*prefixTlv);
+    }
+
+    Get<Publisher>().mCounters.mNetDataScans++;
+
+    UpdateState();
+
+exit:
+    return;
+}
+
+void Publisher::PrefixEntry::ClearEntryCounts(void)
+{
+    mNumEntries          = 0;
+    mNumPreferredEntries = 0;
+}
+
+void Publisher::PrefixEntry::CountEntries(const PrefixTlv &aPrefixTlv)
+{
+    switch (mType)
+    {
+    case kTypeOnMeshPrefix:
+        CountOnMeshPrefixEntries(aPrefixTlv);
+        break;
+    case kTypeExternalRoute:
+        CountExternalRouteEntries(aPrefixTlv);
+        break;
+    }
+}
+
+void Publisher::PrefixEntry::UpdateState(void)
+{
+    uint8_t desiredNumEntries = 0;
+
+    VerifyOrExit(GetState() != kNoEntry);
+
     switch (mType)
     {
     case kTypeOnMeshPrefix:
-        CountOnMeshPrefixEntries(numEntries, numPreferredEntries);
         desiredNumEntries = kDesiredNumOnMeshPrefix;
         break;
     case kTypeExternalRoute:
-        CountExternalRouteEntries(numEntries, numPreferredEntries);
         desiredNumEntries = kDesiredNumExternalRoute;
         break;
     }
 
-    UpdateState(numEntries, numPreferredEntries, desiredNumEntries);
+    Entry::UpdateState(mNumEntries, mNumPreferredEntries, desiredNumEntries);
 
 exit:
     return;
 }
 
-void Publisher::PrefixEntry::CountOnMeshPrefixEntries(uint8_t &aNumEntries, uint8_t &aNumPreferredEntries) const
+void Publisher::PrefixEntry::CountOnMeshPrefixEntries(const PrefixTlv &aPrefixTlv)
 {
-    const PrefixTlv *      prefixTlv;
     const BorderRouterTlv *brSubTlv;
     int8_t                 preference             = BorderRouterEntry::PreferenceFromFlags(mFlags);
     uint16_t               flagsWithoutPreference = BorderRouterEntry::FlagsWithoutPreference(mFlags);
 
-    prefixTlv = Get<Leader>().FindPrefix(mPrefix);
-    VerifyOrExit(prefixTlv != nullptr);
-
-    brSubTlv = prefixTlv->FindSubTlv<BorderRouterTlv>(/* aStable */ true);
+    brSubTlv = aPrefixTlv.FindSubTlv<BorderRouterTlv>(/* aStable */ true);
     VerifyOrExit(brSubTlv != nullptr);
 
     for (const BorderRouterEntry *entry = brSubTlv->GetFirstEntry(); entry <= brSubTlv->GetLastEntry();
@@ -990,7 +1090,7 @@ void Publisher::PrefixEntry::CountOnMeshPrefixEntries(uint8_t &aNumEntries, uint
         if ((BorderRouterEntry::FlagsWithoutPreference(entryFlags) == flagsWithoutPreference) &&
             (entryPreference >= preference))
         {
-            aNumEntries++;
+            mNumEntries++;
 
             // We prefer an entry if it has strictly higher preference
             // than ours or if it has same preference we use the associated
@@ -998,7 +1098,7 @@ void Publisher::PrefixEntry::CountOnMeshPrefixEntries(uint8_t &aNumEntries, uint
 
             if ((entryPreference > preference) || IsPreferred(entry->GetRloc()))
             {
-                aNumPreferredEntries++;
+                mNumPreferredEntries++;
             }
         }
     }
@@ -1007,17 +1107,13 @@ exit:
     return;
 }
 
-void Publisher::PrefixEntry::CountExternalRouteEntries(uint8_t &aNumEntries, uint8_t &aNumPreferredEntries) const
+void Publisher::PrefixEntry::CountExternalRouteEntries(const PrefixTlv &aPrefixTlv)
 {
-    const PrefixTlv *  prefixTlv;
     const HasRouteTlv *hrSubTlv;
     int8_t             preference             = HasRouteEntry::PreferenceFromFlags(static_cast<uint8_t>(mFlags));
     uint8_t            flagsWithoutPreference = HasRouteEntry::FlagsWithoutPreference(static_cast<uint8_t>(mFlags));
 
-    prefixTlv = Get<Leader>().FindPrefix(mPrefix);
-    VerifyOrExit(prefixTlv != nullptr);
-
-    hrSubTlv = prefixTlv->FindSubTlv<HasRouteTlv>(/* aStable */ true);
+    hrSubTlv = aPrefixTlv.FindSubTlv<HasRouteTlv>(/* aStable */ true);
     VerifyOrExit(hrSubTlv != nullptr);
 
     for (const HasRouteEntry *entry = hrSubTlv->GetFirstEntry(); entry <= hrSubTlv->GetLastEntry();
@@ -1037,7 +1133,7 @@ void Publisher::PrefixEntry::CountExternalRouteEntries(uint8_t &aNumEntries, uin
         if ((HasRouteEntry::FlagsWithoutPreference(entryFlags) == flagsWithoutPreference) &&
             (entryPreference >= preference))
         {
-            aNumEntries++;
+            mNumEntries++;
 
             // We prefer an entry if it has strictly higher preference
             // than ours or if it has same preference with a smaller
@@ -1045,7 +1141,7 @@ void Publisher::PrefixEntry::CountExternalRouteEntries(uint8_t &aNumEntries, uin
 
             if ((entryPreference > preference) || IsPreferred(entry->GetRloc()))
             {
-                aNumPreferredEntries++;
+                mNumPreferredEntries++;
             }
         }
     }
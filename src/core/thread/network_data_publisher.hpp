@@ -43,8 +43,9 @@
             "or OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE"
 #endif
 
-#if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE && (OPENTHREAD_CONFIG_NETDATA_PUBLISHER_MAX_PREFIX_ENTRIES < \
-                                                (OPENTHREAD_CONFIG_BORDER_ROUTING_MAX_DISCOVERED_PREFIXES + 4))
+#if OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE && !OPENTHREAD_CONFIG_NETDATA_PUBLISHER_HEAP_PREFIX_ENTRIES_ENABLE && \
+    (OPENTHREAD_CONFIG_NETDATA_PUBLISHER_MAX_PREFIX_ENTRIES <                                                     \
+     (OPENTHREAD_CONFIG_BORDER_ROUTING_MAX_DISCOVERED_PREFIXES + 4))
 #error "OPENTHREAD_CONFIG_NETDATA_PUBLISHER_MAX_PREFIX_ENTRIES needs to support more entries when "\
        "OPENTHREAD_CONFIG_BORDER_ROUTING_ENABLE is enabled to accommodate for max on-link prefixes"
 #endif
@@ -54,9 +55,12 @@
 #include "common/clearable.hpp"
 #include "common/equatable.hpp"
 #include "common/error.hpp"
+#include "common/heap_allocatable.hpp"
+#include "common/linked_list.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
 #include "common/notifier.hpp"
+#include "common/pool.hpp"
 #include "common/string.hpp"
 #include "common/timer.hpp"
 #include "net/ip6_address.hpp"
@@ -65,6 +69,8 @@
 namespace ot {
 namespace NetworkData {
 
+class PrefixTlv;
+
 /**
  * This class implements the Network Data Publisher.
  *
@@ -95,6 +101,28 @@ public:
      */
     explicit Publisher(Instance &aInstance);
 
+    /**
+     * This type represents the Publisher counters.
+     *
+     */
+    class Counters : public otNetDataPublisherCounters, public Clearable<Counters>
+    {
+    };
+
+    /**
+     * This method gets the Publisher counters.
+     *
+     * @returns A reference to the Publisher counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method resets the Publisher counters.
+     *
+     */
+    void ResetCounters(void) { mCounters.Clear(); }
+
 #if OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
 
     /**
@@ -226,8 +254,10 @@ public:
      * @retval kErrorNone         The on-mesh prefix is published successfully.
      * @retval kErrorInvalidArgs  The @p aConfig is not valid (bad prefix, invalid flag combinations, or not stable).
      * @retval kErrorAlready      An entry with the same prefix is already in the published list.
-     * @retval kErrorNoBufs       Could not allocate an entry for the new request. Publisher supports a limited number
-     *                            of entries (shared between on-mesh prefix and external route) determined by config
+     * @retval kErrorNoBufs       Could not allocate an entry for the new request. Unless config
+     *                            `OPENTHREAD_CONFIG_NETDATA_PUBLISHER_HEAP_PREFIX_ENTRIES_ENABLE` is enabled (entries
+     *                            are then allocated from heap), Publisher supports a limited number of entries (shared
+     *                            between on-mesh prefix and external route) determined by config
      *                            `OPENTHREAD_CONFIG_NETDATA_PUBLISHER_MAX_PREFIX_ENTRIES`.
      *
      *
@@ -250,8 +280,10 @@ public:
      *
      * @retval kErrorNone         The external route is published successfully.
      * @retval kErrorInvalidArgs  The @p aConfig is not valid (bad prefix, invalid flag combinations, or not stable).
-     * @retval kErrorNoBufs       Could not allocate an entry for the new request. Publisher supports a limited number
-     *                            of entries (shared between on-mesh prefix and external route) determined by config
+     * @retval kErrorNoBufs       Could not allocate an entry for the new request. Unless config
+     *                            `OPENTHREAD_CONFIG_NETDATA_PUBLISHER_HEAP_PREFIX_ENTRIES_ENABLE` is enabled (entries
+     *                            are then allocated from heap), Publisher supports a limited number of entries (shared
+     *                            between on-mesh prefix and external route) determined by config
      *                            `OPENTHREAD_CONFIG_NETDATA_PUBLISHER_MAX_PREFIX_ENTRIES`.
      *
      *
@@ -401,22 +433,31 @@ private:
 #endif // OPENTHREAD_CONFIG_TMF_NETDATA_SERVICE_ENABLE
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE
+#if !OPENTHREAD_CONFIG_NETDATA_PUBLISHER_HEAP_PREFIX_ENTRIES_ENABLE
     // Max number of prefix (on-mesh or external route) entries.
     static constexpr uint16_t kMaxPrefixEntries = OPENTHREAD_CONFIG_NETDATA_PUBLISHER_MAX_PREFIX_ENTRIES;
+#endif
 
-    class PrefixEntry : public Entry, private NonCopyable
+    class PrefixEntry : public Entry,
+                        public LinkedListEntry<PrefixEntry>,
+#if OPENTHREAD_CONFIG_NETDATA_PUBLISHER_HEAP_PREFIX_ENTRIES_ENABLE
+                        public Heap::Allocatable<PrefixEntry>,
+#endif
+                        private NonCopyable
     {
         friend class Entry;
+        friend class LinkedListEntry<PrefixEntry>;
 
     public:
         void Init(Instance &aInstance) { Entry::Init(aInstance); }
-        bool IsInUse(void) const { return GetState() != kNoEntry; }
         bool Matches(const Ip6::Prefix &aPrefix) const { return mPrefix == aPrefix; }
         void Publish(const OnMeshPrefixConfig &aConfig);
         void Publish(const ExternalRouteConfig &aConfig);
         void Unpublish(void);
         void HandleTimer(void) { Entry::HandleTimer(); }
-        void HandleNotifierEvents(Events aEvents);
+        void ClearEntryCounts(void);
+        void CountEntries(const PrefixTlv &aPrefixTlv);
+        void UpdateState(void);
 
     private:
         static constexpr uint8_t kDesiredNumOnMeshPrefix =
@@ -437,12 +478,15 @@ private:
         Error AddExternalRoute(void);
         void  Remove(State aNextState);
         void  Process(void);
-        void  CountOnMeshPrefixEntries(uint8_t &aNumEntries, uint8_t &aNumPreferredEntries) const;
-        void  CountExternalRouteEntries(uint8_t &aNumEntries, uint8_t &aNumPreferredEntries) const;
-
-        Type        mType;
-        Ip6::Prefix mPrefix;
-        uint16_t    mFlags;
+        void  CountOnMeshPrefixEntries(const PrefixTlv &aPrefixTlv);
+        void  CountExternalRouteEntries(const PrefixTlv &aPrefixTlv);
+
+        PrefixEntry *mNext;
+        Type         mType;
+        Ip6::Prefix  mPrefix;
+        uint16_t     mFlags;
+        uint8_t      mNumEntries;
+        uint8_t      mNumPreferredEntries;
     };
 #endif // OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE
 
@@ -454,7 +498,9 @@ private:
     PrefixEntry *      FindOrAllocatePrefixEntry(const Ip6::Prefix &aPrefix);
     PrefixEntry *      FindMatchingPrefixEntry(const Ip6::Prefix &aPrefix);
     const PrefixEntry *FindMatchingPrefixEntry(const Ip6::Prefix &aPrefix) const;
+    void               FreePrefixEntry(PrefixEntry &aEntry);
     bool               IsAPrefixEntry(const Entry &aEntry) const;
+    void               ProcessPrefixEntries(void);
     void               NotifyPrefixEntryChange(Event aEvent, const Ip6::Prefix &aPrefix) const;
 #endif
 
@@ -468,12 +514,16 @@ private:
 #endif
 
 #if OPENTHREAD_CONFIG_BORDER_ROUTER_ENABLE
-    PrefixEntry    mPrefixEntries[kMaxPrefixEntries];
-    PrefixCallback mPrefixCallback;
-    void *         mPrefixCallbackContext;
+#if !OPENTHREAD_CONFIG_NETDATA_PUBLISHER_HEAP_PREFIX_ENTRIES_ENABLE
+    Pool<PrefixEntry, kMaxPrefixEntries> mPrefixEntryPool;
+#endif
+    LinkedList<PrefixEntry> mPrefixEntries;
+    PrefixCallback          mPrefixCallback;
+    void *                  mPrefixCallbackContext;
 #endif
 
     TimerMilli mTimer;
+    Counters   mCounters;
 };
 
 } // namespace NetworkData
@@ -44,6 +44,7 @@
 #include "common/instance.hpp"
 #include "common/locator_getters.hpp"
 #include "common/log.hpp"
+#include "common/random.hpp"
 #include "mac/mac.hpp"
 #include "net/netif.hpp"
 #include "thread/mesh_forwarder.hpp"
@@ -66,6 +67,12 @@ NetworkDiagnostic::NetworkDiagnostic(Instance &aInstance)
     , mDiagnosticReset(UriPath::kDiagnosticReset, &NetworkDiagnostic::HandleDiagnosticReset, this)
     , mReceiveDiagnosticGetCallback(nullptr)
     , mReceiveDiagnosticGetCallbackContext(nullptr)
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE && OPENTHREAD_FTD
+    , mAnswerRequest(nullptr)
+    , mAnswerChildIndex(0)
+    , mAnswerOwnTlvsSent(false)
+    , mAnswerTimer(aInstance, NetworkDiagnostic::HandleAnswerTimer)
+#endif
 {
     Get<Tmf::Agent>().AddResource(mDiagnosticGetRequest);
     Get<Tmf::Agent>().AddResource(mDiagnosticGetQuery);
@@ -78,13 +85,38 @@ Error NetworkDiagnostic::SendDiagnosticGet(const Ip6::Address &           aDesti
                                            uint8_t                        aCount,
                                            otReceiveDiagnosticGetCallback aCallback,
                                            void *                         aCallbackContext)
+{
+    return SendDiagnosticGet(aDestination, aTlvTypes, aCount, aCallback, aCallbackContext, /* aAggregate */ false);
+}
+
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+Error NetworkDiagnostic::SendAggregatedDiagnosticGet(const Ip6::Address &           aDestination,
+                                                     const uint8_t                  aTlvTypes[],
+                                                     uint8_t                        aCount,
+                                                     otReceiveDiagnosticGetCallback aCallback,
+                                                     void *                         aCallbackContext)
+{
+    return SendDiagnosticGet(aDestination, aTlvTypes, aCount, aCallback, aCallbackContext, /* aAggregate */ true);
+}
+#endif
+
+Error NetworkDiagnostic::SendDiagnosticGet(const Ip6::Address &           aDestination,
+                                           const uint8_t                  aTlvTypes[],
+                                           uint8_t                        aCount,
+                                           otReceiveDiagnosticGetCallback aCallback,
+                                           void *                         aCallbackContext,
+                                           bool                           aAggregate)
 {
     Error                 error;
     Coap::Message *       message = nullptr;
     Tmf::MessageInfo      messageInfo(GetInstance());
     otCoapResponseHandler handler = nullptr;
 
-    if (aDestination.IsMulticast())
+    // An aggregated request is always sent as a DIAG_GET.qry (even
+    // to a unicast destination) since the answers are sent by the
+    // routers as separate DIAG_GET.ans messages.
+
+    if (aDestination.IsMulticast() || aAggregate)
     {
         message = Get<Tmf::Agent>().NewNonConfirmablePostMessage(UriPath::kDiagnosticGetQuery);
         messageInfo.SetMulticastLoop(true);
@@ -102,6 +134,15 @@ Error NetworkDiagnostic::SendDiagnosticGet(const Ip6::Address &           aDesti
         SuccessOrExit(error = Tlv::Append<TypeListTlv>(*message, aTlvTypes, aCount));
     }
 
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+    if (aAggregate)
+    {
+        SuccessOrExit(error = Tlv::Append<AggregatedQueryTlv>(*message, nullptr, 0));
+    }
+#else
+    OT_UNUSED_VARIABLE(aAggregate);
+#endif
+
     if (aDestination.IsLinkLocal() || aDestination.IsLinkLocalMulticast())
     {
         messageInfo.SetSockAddr(Get<Mle::MleRouter>().GetLinkLocalAddress());
@@ -169,7 +210,12 @@ void NetworkDiagnostic::HandleDiagnosticGetAnswer(Coap::Message &aMessage, const
 
     if (mReceiveDiagnosticGetCallback)
     {
-        mReceiveDiagnosticGetCallback(kErrorNone, &aMessage, &aMessageInfo, mReceiveDiagnosticGetCallbackContext);
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+        if (ProcessAggregatedAnswer(aMessage, aMessageInfo) == kErrorNotFound)
+#endif
+        {
+            mReceiveDiagnosticGetCallback(kErrorNone, &aMessage, &aMessageInfo, mReceiveDiagnosticGetCallbackContext);
+        }
     }
 
     SuccessOrExit(Get<Tmf::Agent>().SendEmptyAck(aMessage, aMessageInfo));
@@ -207,6 +253,21 @@ exit:
     return error;
 }
 
+Error NetworkDiagnostic::AppendLeaderData(Message &aMessage)
+{
+    LeaderDataTlv          tlv;
+    const Mle::LeaderData &leaderData = Get<Mle::MleRouter>().GetLeaderData();
+
+    tlv.Init();
+    tlv.SetPartitionId(leaderData.GetPartitionId());
+    tlv.SetWeighting(leaderData.GetWeighting());
+    tlv.SetDataVersion(leaderData.GetDataVersion(NetworkData::kFullSet));
+    tlv.SetStableDataVersion(leaderData.GetDataVersion(NetworkData::kStableSubset));
+    tlv.SetLeaderRouterId(leaderData.GetLeaderRouterId());
+
+    return tlv.AppendTo(aMessage);
+}
+
 #if OPENTHREAD_FTD
 Error NetworkDiagnostic::AppendChildTable(Message &aMessage)
 {
@@ -336,20 +397,8 @@ Error NetworkDiagnostic::FillRequestedTlvs(const Message &       aRequest,
 #endif
 
         case NetworkDiagnosticTlv::kLeaderData:
-        {
-            LeaderDataTlv          tlv;
-            const Mle::LeaderData &leaderData = Get<Mle::MleRouter>().GetLeaderData();
-
-            tlv.Init();
-            tlv.SetPartitionId(leaderData.GetPartitionId());
-            tlv.SetWeighting(leaderData.GetWeighting());
-            tlv.SetDataVersion(leaderData.GetDataVersion(NetworkData::kFullSet));
-            tlv.SetStableDataVersion(leaderData.GetDataVersion(NetworkData::kStableSubset));
-            tlv.SetLeaderRouterId(leaderData.GetLeaderRouterId());
-
-            SuccessOrExit(error = tlv.AppendTo(aResponse));
+            SuccessOrExit(error = AppendLeaderData(aResponse));
             break;
-        }
 
         case NetworkDiagnosticTlv::kNetworkData:
         {
@@ -480,6 +529,22 @@ void NetworkDiagnostic::HandleDiagnosticGetQuery(Coap::Message &aMessage, const
         }
     }
 
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+    {
+        uint16_t offset;
+
+        if (Tlv::FindTlvOffset(aMessage, NetworkDiagnosticTlv::kAggregatedQuery, offset) == kErrorNone)
+        {
+            // Children are answered for by their parent.
+            VerifyOrExit(Get<Mle::MleRouter>().IsRouterOrLeader());
+#if OPENTHREAD_FTD
+            StartAggregatedAnswer(aMessage, aMessageInfo);
+#endif
+            ExitNow();
+        }
+    }
+#endif
+
     message = Get<Tmf::Agent>().NewConfirmablePostMessage(UriPath::kDiagnosticGetAnswer);
     VerifyOrExit(message != nullptr, error = kErrorNoBufs);
 
@@ -540,6 +605,458 @@ exit:
     FreeMessageOnError(message, error);
 }
 
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+
+#if OPENTHREAD_FTD
+void NetworkDiagnostic::StartAggregatedAnswer(const Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    // A new aggregated query replaces the one being answered (if any).
+    StopAggregatedAnswer();
+
+    mAnswerRequest = aMessage.Clone();
+    VerifyOrExit(mAnswerRequest != nullptr);
+
+    mAnswerPeerAddr    = aMessageInfo.GetPeerAddr();
+    mAnswerChildIndex  = 0;
+    mAnswerOwnTlvsSent = false;
+
+    // The first answer is delayed by a random jitter so that the
+    // routers receiving a multicast query do not answer at once.
+    mAnswerTimer.Start(Random::NonCrypto::GetUint32InRange(0, kAnswerMaxJitter + 1));
+
+    LogInfo("Scheduled aggregated diagnostic get answer");
+
+exit:
+    return;
+}
+
+void NetworkDiagnostic::StopAggregatedAnswer(void)
+{
+    mAnswerTimer.Stop();
+
+    if (mAnswerRequest != nullptr)
+    {
+        mAnswerRequest->Free();
+        mAnswerRequest = nullptr;
+    }
+}
+
+void NetworkDiagnostic::HandleAnswerTimer(Timer &aTimer)
+{
+    aTimer.Get<NetworkDiagnostic>().HandleAnswerTimer();
+}
+
+void NetworkDiagnostic::HandleAnswerTimer(void)
+{
+    Error                error   = kErrorNone;
+    Coap::Message *      message = nullptr;
+    NetworkDiagnosticTlv networkDiagnosticTlv;
+    Tmf::MessageInfo     messageInfo(GetInstance());
+    uint16_t             emptyLength;
+    bool                 done = true;
+
+    VerifyOrExit(mAnswerRequest != nullptr);
+    VerifyOrExit(Get<Mle::MleRouter>().IsRouterOrLeader(), error = kErrorInvalidState);
+
+    SuccessOrExit(error = mAnswerRequest->Read(mAnswerRequest->GetOffset(), networkDiagnosticTlv));
+
+    message = Get<Tmf::Agent>().NewConfirmablePostMessage(UriPath::kDiagnosticGetAnswer);
+    VerifyOrExit(message != nullptr, error = kErrorNoBufs);
+
+    emptyLength = message->GetLength();
+
+    if (!mAnswerOwnTlvsSent)
+    {
+        SuccessOrExit(error = FillRequestedTlvs(*mAnswerRequest, *message, networkDiagnosticTlv));
+        mAnswerOwnTlvsSent = true;
+    }
+
+    // Append the children one at a time, stopping once the message
+    // exceeds the block size. The remaining children are sent in
+    // the next block.
+
+    for (; mAnswerChildIndex < Get<ChildTable>().GetMaxChildrenAllowed(); mAnswerChildIndex++)
+    {
+        const Child *child = Get<ChildTable>().GetChildAtIndex(mAnswerChildIndex);
+        uint16_t     length;
+
+        if ((child == nullptr) || !child->IsStateValid())
+        {
+            continue;
+        }
+
+        length = message->GetLength();
+
+        if ((AppendChildDiagnostic(*child, *mAnswerRequest, *message) != kErrorNone) ||
+            (message->GetLength() > kAnswerMaxBlockSize))
+        {
+            // A child entry which does not fit in an otherwise empty
+            // block is skipped.
+            IgnoreError(message->SetLength(length));
+
+            if (length != emptyLength)
+            {
+                done = false;
+                break;
+            }
+        }
+    }
+
+    if (message->GetLength() != emptyLength)
+    {
+        if (mAnswerPeerAddr.IsLinkLocal())
+        {
+            messageInfo.SetSockAddr(Get<Mle::MleRouter>().GetLinkLocalAddress());
+        }
+        else
+        {
+            messageInfo.SetSockAddrToRloc();
+        }
+
+        messageInfo.SetPeerAddr(mAnswerPeerAddr);
+
+        SuccessOrExit(error = Get<Tmf::Agent>().SendMessage(*message, messageInfo, nullptr, this));
+
+        LogInfo("Sent aggregated diagnostic get answer (%s)", done ? "last" : "more to follow");
+    }
+    else
+    {
+        message->Free();
+    }
+
+    message = nullptr;
+
+    if (done)
+    {
+        StopAggregatedAnswer();
+    }
+    else
+    {
+        mAnswerTimer.Start(kAnswerBlockInterval);
+    }
+
+exit:
+    FreeMessageOnError(message, error);
+
+    if (error != kErrorNone)
+    {
+        StopAggregatedAnswer();
+    }
+}
+
+Error NetworkDiagnostic::AppendChildDiagnostic(const Child &aChild, const Message &aRequest, Message &aMessage)
+{
+    Error                error;
+    uint16_t             startOffset = aMessage.GetLength();
+    uint16_t             offset;
+    NetworkDiagnosticTlv typeListTlv;
+    ExtendedTlv          tlv;
+    uint8_t              type;
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+    TimeMilli       now = TimerMilli::GetNow();
+    ChildInfoAgeTlv ageTlv;
+#endif
+
+    SuccessOrExit(error = aRequest.Read(aRequest.GetOffset(), typeListTlv));
+
+    // The container is always appended as an Extended TLV since the
+    // length of a child's IPv6 address list is not known in advance.
+    tlv.SetType(NetworkDiagnosticTlv::kChildDiagnostic);
+    tlv.SetLength(0);
+    SuccessOrExit(error = aMessage.Append(tlv));
+
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+    // The info is reported from the child table without contacting
+    // the child, so its age is always included.
+    ageTlv.Init();
+    ageTlv.SetSecondsSinceLastHeard(Time::MsecToSec(now - aChild.GetLastHeard()));
+    ageTlv.SetSecondsSinceInfoUpdate(Time::MsecToSec(now - aChild.GetInfoUpdateTime()));
+    SuccessOrExit(error = ageTlv.AppendTo(aMessage));
+#endif
+
+    offset = aRequest.GetOffset() + sizeof(NetworkDiagnosticTlv);
+
+    for (uint8_t i = 0; i < typeListTlv.GetLength(); i++, offset++)
+    {
+        SuccessOrExit(error = aRequest.Read(offset, type));
+
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+        if (!IsChildInfoFresh(type, (type == NetworkDiagnosticTlv::kChildLinkQuality)
+                                        ? ageTlv.GetSecondsSinceLastHeard()
+                                        : ageTlv.GetSecondsSinceInfoUpdate()))
+        {
+            continue;
+        }
+#endif
+
+        switch (type)
+        {
+        case NetworkDiagnosticTlv::kExtMacAddress:
+            SuccessOrExit(error = Tlv::Append<ExtMacAddressTlv>(aMessage, aChild.GetExtAddress()));
+            break;
+
+        case NetworkDiagnosticTlv::kAddress16:
+            SuccessOrExit(error = Tlv::Append<Address16Tlv>(aMessage, aChild.GetRloc16()));
+            break;
+
+        case NetworkDiagnosticTlv::kMode:
+            SuccessOrExit(error = Tlv::Append<ModeTlv>(aMessage, aChild.GetDeviceMode().Get()));
+            break;
+
+        case NetworkDiagnosticTlv::kTimeout:
+            if (!aChild.IsRxOnWhenIdle())
+            {
+                SuccessOrExit(error = Tlv::Append<TimeoutTlv>(aMessage, aChild.GetTimeout()));
+            }
+
+            break;
+
+        case NetworkDiagnosticTlv::kLeaderData:
+            SuccessOrExit(error = AppendLeaderData(aMessage));
+            break;
+
+        case NetworkDiagnosticTlv::kIp6AddressList:
+            SuccessOrExit(error = AppendChildIp6AddressList(aChild, aMessage));
+            break;
+
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+        case NetworkDiagnosticTlv::kChildLinkQuality:
+            SuccessOrExit(error = AppendChildLinkQuality(aChild, aMessage));
+            break;
+
+        case NetworkDiagnosticTlv::kChildVersion:
+            SuccessOrExit(error = Tlv::Append<ChildVersionTlv>(aMessage, aChild.GetVersion()));
+            break;
+
+#if OPENTHREAD_CONFIG_CHILD_SUPERVISION_ENABLE
+        case NetworkDiagnosticTlv::kChildSupervision:
+            SuccessOrExit(error = Tlv::Append<ChildSupervisionTlv>(
+                              aMessage, Get<Utils::ChildSupervisor>().GetSupervisionInterval()));
+            break;
+#endif
+#endif // OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+
+        default:
+            // The other TLVs are only known to the child itself and
+            // are omitted.
+            break;
+        }
+    }
+
+    tlv.SetLength(static_cast<uint16_t>(aMessage.GetLength() - startOffset - sizeof(ExtendedTlv)));
+    aMessage.Write(startOffset, tlv);
+
+exit:
+    return error;
+}
+
+Error NetworkDiagnostic::AppendChildIp6AddressList(const Child &aChild, Message &aMessage)
+{
+    Error             error = kErrorNone;
+    Ip6AddressListTlv tlv;
+    uint8_t           count = 0;
+
+    tlv.Init();
+
+    for (const Ip6::Address &address : aChild.IterateIp6Addresses(Ip6::Address::kTypeUnicast))
+    {
+        OT_UNUSED_VARIABLE(address);
+        count++;
+    }
+
+    tlv.SetLength(count * sizeof(Ip6::Address));
+    SuccessOrExit(error = aMessage.Append(tlv));
+
+    for (const Ip6::Address &address : aChild.IterateIp6Addresses(Ip6::Address::kTypeUnicast))
+    {
+        SuccessOrExit(error = aMessage.Append(address));
+    }
+
+exit:
+    return error;
+}
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+Error NetworkDiagnostic::AppendChildLinkQuality(const Child &aChild, Message &aMessage)
+{
+    ChildLinkQualityTlv    tlv;
+    const LinkQualityInfo &linkInfo = aChild.GetLinkInfo();
+
+    tlv.Init();
+    tlv.SetLinkQualityIn(linkInfo.GetLinkQuality());
+    tlv.SetAverageRssi(linkInfo.GetAverageRss());
+    tlv.SetLastRssi(linkInfo.GetLastRss());
+    tlv.SetFrameErrorRate(linkInfo.GetFrameErrorRate());
+    tlv.SetMessageErrorRate(linkInfo.GetMessageErrorRate());
+
+    return tlv.AppendTo(aMessage);
+}
+
+bool NetworkDiagnostic::IsChildInfoFresh(uint8_t aType, uint32_t aAge)
+{
+    bool     isFresh = true;
+    uint32_t maxAge;
+
+    switch (aType)
+    {
+    case NetworkDiagnosticTlv::kMode:
+        maxAge = OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_MODE;
+        break;
+
+    case NetworkDiagnosticTlv::kTimeout:
+        maxAge = OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_TIMEOUT;
+        break;
+
+    case NetworkDiagnosticTlv::kIp6AddressList:
+        maxAge = OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_IP6_ADDR_LIST;
+        break;
+
+    case NetworkDiagnosticTlv::kChildVersion:
+        maxAge = OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_VERSION;
+        break;
+
+    case NetworkDiagnosticTlv::kChildSupervision:
+        maxAge = OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_SUPERVISION;
+        break;
+
+    case NetworkDiagnosticTlv::kChildLinkQuality:
+        maxAge = OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_MAX_AGE_LINK_QUALITY;
+        break;
+
+    default:
+        // The Ext Address and Address16 identify the child and the
+        // Leader Data is the router's own, so they are always fresh.
+        ExitNow();
+    }
+
+    isFresh = (maxAge != 0) && (aAge <= maxAge);
+
+exit:
+    return isFresh;
+}
+#endif // OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+#endif // OPENTHREAD_FTD
+
+Error NetworkDiagnostic::ProcessAggregatedAnswer(const Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo)
+{
+    Error    error = kErrorNone;
+    uint16_t offset;
+    uint16_t end = aMessage.GetLength();
+    Tlv      tlv;
+
+    SuccessOrExit(error = Tlv::FindTlvOffset(aMessage, NetworkDiagnosticTlv::kChildDiagnostic, offset));
+
+    // Report the TLVs of the answering router itself (outside of any
+    // Child Diagnostic TLV), then the contents of each Child
+    // Diagnostic TLV as a separate answer. The router's own TLVs are
+    // only present in the first block of an answer.
+
+    ReportDeviceAnswer(aMessage, aMessage.GetOffset(), end - aMessage.GetOffset(), aMessageInfo, /* aIsChild */ false);
+
+    offset = aMessage.GetOffset();
+
+    while (offset < end)
+    {
+        uint16_t valueOffset;
+        uint16_t length;
+
+        SuccessOrExit(error = aMessage.Read(offset, tlv));
+
+        if (tlv.IsExtended())
+        {
+            ExtendedTlv extTlv;
+
+            SuccessOrExit(error = aMessage.Read(offset, extTlv));
+            valueOffset = offset + sizeof(ExtendedTlv);
+            length      = extTlv.GetLength();
+        }
+        else
+        {
+            valueOffset = offset + sizeof(Tlv);
+            length      = tlv.GetLength();
+        }
+
+        VerifyOrExit(valueOffset + length <= end, error = kErrorParse);
+
+        if (tlv.GetType() == NetworkDiagnosticTlv::kChildDiagnostic)
+        {
+            ReportDeviceAnswer(aMessage, valueOffset, length, aMessageInfo, /* aIsChild */ true);
+        }
+
+        offset = valueOffset + length;
+    }
+
+exit:
+    return error;
+}
+
+void NetworkDiagnostic::ReportDeviceAnswer(const Message &         aMessage,
+                                           uint16_t                aOffset,
+                                           uint16_t                aLength,
+                                           const Ip6::MessageInfo &aMessageInfo,
+                                           bool                    aIsChild)
+{
+    Coap::Message *  message = nullptr;
+    Ip6::MessageInfo messageInfo(aMessageInfo);
+    uint16_t         offset = aOffset;
+    uint16_t         end    = aOffset + aLength;
+    Tlv              tlv;
+
+    message = Get<Tmf::Agent>().NewMessage();
+    VerifyOrExit(message != nullptr);
+
+    // Copy the TLVs (excluding any Child Diagnostic TLVs) into a new
+    // message which is then reported as a separate answer.
+
+    while (offset < end)
+    {
+        uint16_t size;
+
+        SuccessOrExit(aMessage.Read(offset, tlv));
+
+        if (tlv.IsExtended())
+        {
+            ExtendedTlv extTlv;
+
+            SuccessOrExit(aMessage.Read(offset, extTlv));
+            size = sizeof(ExtendedTlv) + extTlv.GetLength();
+        }
+        else
+        {
+            size = sizeof(Tlv) + tlv.GetLength();
+        }
+
+        VerifyOrExit(offset + size <= end);
+
+        if (tlv.GetType() != NetworkDiagnosticTlv::kChildDiagnostic)
+        {
+            SuccessOrExit(message->AppendBytesFromMessage(aMessage, offset, size));
+        }
+
+        offset += size;
+    }
+
+    VerifyOrExit(message->GetLength() > message->GetOffset());
+
+    if (aIsChild)
+    {
+        uint16_t rloc16;
+
+        // Report the child's RLOC as the source of the answer.
+
+        if (Tlv::Find<Address16Tlv>(*message, rloc16) == kErrorNone)
+        {
+            messageInfo.GetPeerAddr().SetToRoutingLocator(Get<Mle::MleRouter>().GetMeshLocalPrefix(), rloc16);
+        }
+    }
+
+    mReceiveDiagnosticGetCallback(kErrorNone, message, &messageInfo, mReceiveDiagnosticGetCallbackContext);
+
+exit:
+    FreeMessage(message);
+}
+
+#endif // OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+
 Error NetworkDiagnostic::SendDiagnosticReset(const Ip6::Address &aDestination,
                                              const uint8_t       aTlvTypes[],
                                              uint8_t             aCount)
@@ -845,6 +1362,42 @@ Error NetworkDiagnostic::GetNextDiagTlv(const Coap::Message &aMessage,
                               Tlv::Read<MaxChildTimeoutTlv>(aMessage, offset, aNetworkDiagTlv.mData.mMaxChildTimeout));
             break;
 
+        case NetworkDiagnosticTlv::kChildLinkQuality:
+        {
+            ChildLinkQualityTlv linkQuality;
+
+            SuccessOrExit(error = aMessage.Read(offset, linkQuality));
+            VerifyOrExit(linkQuality.IsValid(), error = kErrorParse);
+
+            aNetworkDiagTlv.mData.mChildLinkQuality.mLinkQualityIn    = linkQuality.GetLinkQualityIn();
+            aNetworkDiagTlv.mData.mChildLinkQuality.mAverageRssi      = linkQuality.GetAverageRssi();
+            aNetworkDiagTlv.mData.mChildLinkQuality.mLastRssi         = linkQuality.GetLastRssi();
+            aNetworkDiagTlv.mData.mChildLinkQuality.mFrameErrorRate   = linkQuality.GetFrameErrorRate();
+            aNetworkDiagTlv.mData.mChildLinkQuality.mMessageErrorRate = linkQuality.GetMessageErrorRate();
+            break;
+        }
+
+        case NetworkDiagnosticTlv::kChildVersion:
+            SuccessOrExit(error = Tlv::Read<ChildVersionTlv>(aMessage, offset, aNetworkDiagTlv.mData.mChildVersion));
+            break;
+
+        case NetworkDiagnosticTlv::kChildSupervision:
+            SuccessOrExit(error = Tlv::Read<ChildSupervisionTlv>(aMessage, offset,
+                                                                 aNetworkDiagTlv.mData.mChildSupervisionInterval));
+            break;
+
+        case NetworkDiagnosticTlv::kChildInfoAge:
+        {
+            ChildInfoAgeTlv infoAge;
+
+            SuccessOrExit(error = aMessage.Read(offset, infoAge));
+            VerifyOrExit(infoAge.IsValid(), error = kErrorParse);
+
+            aNetworkDiagTlv.mData.mChildInfoAge.mSecondsSinceLastHeard  = infoAge.GetSecondsSinceLastHeard();
+            aNetworkDiagTlv.mData.mChildInfoAge.mSecondsSinceInfoUpdate = infoAge.GetSecondsSinceInfoUpdate();
+            break;
+        }
+
         default:
             // Ignore unrecognized Network Diagnostic TLV silently and
             // continue to top of the `while(true)` loop.
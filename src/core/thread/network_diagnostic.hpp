@@ -43,11 +43,14 @@
 #include "coap/coap.hpp"
 #include "common/locator.hpp"
 #include "common/non_copyable.hpp"
+#include "common/timer.hpp"
 #include "net/udp6.hpp"
 #include "thread/network_diagnostic_tlvs.hpp"
 
 namespace ot {
 
+class Child;
+
 namespace NetworkDiagnostic {
 
 /**
@@ -98,6 +101,29 @@ public:
                             otReceiveDiagnosticGetCallback aCallback,
                             void *                         aCallbackContext);
 
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+    /**
+     * This method sends an aggregated Diagnostic Get query (DIAG_GET.qry).
+     *
+     * Routers receiving the query answer for themselves and on behalf of their children, while children do not
+     * answer. Each router paces its answer and may split it over multiple DIAG_GET.ans messages. The answers are
+     * split per device so that @p aCallback is invoked once for every router and every child.
+     *
+     * @param[in]  aDestination      A reference to the destination address (typically a multicast address).
+     * @param[in]  aTlvTypes         An array of Network Diagnostic TLV types.
+     * @param[in]  aCount            Number of types in aTlvTypes.
+     * @param[in]  aCallback         A pointer to a function that is called for each device in the received answers
+     *                               or NULL to disable the callback.
+     * @param[in]  aCallbackContext  A pointer to application-specific context.
+     *
+     */
+    Error SendAggregatedDiagnosticGet(const Ip6::Address &           aDestination,
+                                      const uint8_t                  aTlvTypes[],
+                                      uint8_t                        aCount,
+                                      otReceiveDiagnosticGetCallback aCallback,
+                                      void *                         aCallbackContext);
+#endif
+
     /**
      * This method sends Diagnostic Reset request.
      *
@@ -124,7 +150,21 @@ public:
     static Error GetNextDiagTlv(const Coap::Message &aMessage, Iterator &aIterator, otNetworkDiagTlv &aNetworkDiagTlv);
 
 private:
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+    static constexpr uint32_t kAnswerMaxJitter     = OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_MAX_JITTER;
+    static constexpr uint32_t kAnswerBlockInterval = OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_BLOCK_INTERVAL;
+    static constexpr uint16_t kAnswerMaxBlockSize  = OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_MAX_BLOCK_SIZE;
+#endif
+
+    Error SendDiagnosticGet(const Ip6::Address &           aDestination,
+                            const uint8_t                  aTlvTypes[],
+                            uint8_t                        aCount,
+                            otReceiveDiagnosticGetCallback aCallback,
+                            void *                         aCallbackContext,
+                            bool                           aAggregate);
+
     Error AppendIp6AddressList(Message &aMessage);
+    Error AppendLeaderData(Message &aMessage);
     Error AppendChildTable(Message &aMessage);
     void  FillMacCountersTlv(MacCountersTlv &aMacCountersTlv);
     Error FillRequestedTlvs(const Message &aRequest, Message &aResponse, NetworkDiagnosticTlv &aNetworkDiagnosticTlv);
@@ -147,6 +187,28 @@ private:
     static void HandleDiagnosticReset(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo);
     void        HandleDiagnosticReset(Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
 
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE
+    Error ProcessAggregatedAnswer(const Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    void  ReportDeviceAnswer(const Message &         aMessage,
+                             uint16_t                aOffset,
+                             uint16_t                aLength,
+                             const Ip6::MessageInfo &aMessageInfo,
+                             bool                    aIsChild);
+#if OPENTHREAD_FTD
+    void  StartAggregatedAnswer(const Coap::Message &aMessage, const Ip6::MessageInfo &aMessageInfo);
+    void  StopAggregatedAnswer(void);
+    Error AppendChildDiagnostic(const Child &aChild, const Message &aRequest, Message &aMessage);
+    Error AppendChildIp6AddressList(const Child &aChild, Message &aMessage);
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+    Error       AppendChildLinkQuality(const Child &aChild, Message &aMessage);
+    static bool IsChildInfoFresh(uint8_t aType, uint32_t aAge);
+#endif
+
+    static void HandleAnswerTimer(Timer &aTimer);
+    void        HandleAnswerTimer(void);
+#endif
+#endif
+
     Coap::Resource mDiagnosticGetRequest;
     Coap::Resource mDiagnosticGetQuery;
     Coap::Resource mDiagnosticGetAnswer;
@@ -154,6 +216,14 @@ private:
 
     otReceiveDiagnosticGetCallback mReceiveDiagnosticGetCallback;
     void *                         mReceiveDiagnosticGetCallbackContext;
+
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE && OPENTHREAD_FTD
+    Coap::Message *mAnswerRequest;
+    Ip6::Address   mAnswerPeerAddr;
+    uint16_t       mAnswerChildIndex;
+    bool           mAnswerOwnTlvsSent;
+    TimerMilli     mAnswerTimer;
+#endif
 };
 
 /**
@@ -76,22 +76,28 @@ public:
      */
     enum Type : uint8_t
     {
-        kExtMacAddress   = OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS,
-        kAddress16       = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS,
-        kMode            = OT_NETWORK_DIAGNOSTIC_TLV_MODE,
-        kTimeout         = OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT,
-        kConnectivity    = OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY,
-        kRoute           = OT_NETWORK_DIAGNOSTIC_TLV_ROUTE,
-        kLeaderData      = OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA,
-        kNetworkData     = OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA,
-        kIp6AddressList  = OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST,
-        kMacCounters     = OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS,
-        kBatteryLevel    = OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL,
-        kSupplyVoltage   = OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE,
-        kChildTable      = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE,
-        kChannelPages    = OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES,
-        kTypeList        = OT_NETWORK_DIAGNOSTIC_TLV_TYPE_LIST,
-        kMaxChildTimeout = OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT,
+        kExtMacAddress    = OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS,
+        kAddress16        = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS,
+        kMode             = OT_NETWORK_DIAGNOSTIC_TLV_MODE,
+        kTimeout          = OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT,
+        kConnectivity     = OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY,
+        kRoute            = OT_NETWORK_DIAGNOSTIC_TLV_ROUTE,
+        kLeaderData       = OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA,
+        kNetworkData      = OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA,
+        kIp6AddressList   = OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST,
+        kMacCounters      = OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS,
+        kBatteryLevel     = OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL,
+        kSupplyVoltage    = OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE,
+        kChildTable       = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE,
+        kChannelPages     = OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES,
+        kTypeList         = OT_NETWORK_DIAGNOSTIC_TLV_TYPE_LIST,
+        kMaxChildTimeout  = OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT,
+        kAggregatedQuery  = 240, ///< OpenThread specific - Requests routers to also answer for their children.
+        kChildDiagnostic  = 241, ///< OpenThread specific - Diagnostic TLVs of a child (in an aggregated answer).
+        kChildLinkQuality = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_LINK_QUALITY,
+        kChildVersion     = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_VERSION,
+        kChildSupervision = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_SUPERVISION,
+        kChildInfoAge     = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_INFO_AGE,
     };
 
     /**
@@ -154,6 +160,36 @@ typedef UintTlvInfo<NetworkDiagnosticTlv::kSupplyVoltage, uint16_t> SupplyVoltag
  */
 typedef UintTlvInfo<NetworkDiagnosticTlv::kMaxChildTimeout, uint32_t> MaxChildTimeoutTlv;
 
+/**
+ * This class defines Aggregated Query TLV constants and types.
+ *
+ * The Aggregated Query TLV has no value. It is included along with the Type List TLV in a DIAG_GET.qry to request
+ * routers to answer on behalf of their children.
+ *
+ */
+typedef TlvInfo<NetworkDiagnosticTlv::kAggregatedQuery> AggregatedQueryTlv;
+
+/**
+ * This class defines Child Diagnostic TLV constants and types.
+ *
+ * The value of the Child Diagnostic TLV is a sequence of Network Diagnostic TLVs describing a child. It is included
+ * by a router in an aggregated DIAG_GET.ans.
+ *
+ */
+typedef TlvInfo<NetworkDiagnosticTlv::kChildDiagnostic> ChildDiagnosticTlv;
+
+/**
+ * This class defines Child Version TLV constants and types.
+ *
+ */
+typedef UintTlvInfo<NetworkDiagnosticTlv::kChildVersion, uint16_t> ChildVersionTlv;
+
+/**
+ * This class defines Child Supervision TLV constants and types.
+ *
+ */
+typedef UintTlvInfo<NetworkDiagnosticTlv::kChildSupervision, uint16_t> ChildSupervisionTlv;
+
 /**
  * This class implements Connectivity TLV generation and parsing.
  *
@@ -655,6 +691,191 @@ private:
     uint8_t  mLeaderRouterId;
 } OT_TOOL_PACKED_END;
 
+/**
+ * This class implements Child Link Quality TLV generation and parsing.
+ *
+ * The Child Link Quality TLV is included by a router in a Child Diagnostic TLV and describes the link to the child as
+ * seen by the router.
+ *
+ */
+OT_TOOL_PACKED_BEGIN
+class ChildLinkQualityTlv : public NetworkDiagnosticTlv, public TlvInfo<NetworkDiagnosticTlv::kChildLinkQuality>
+{
+public:
+    /**
+     * This method initializes the TLV.
+     *
+     */
+    void Init(void)
+    {
+        SetType(kChildLinkQuality);
+        SetLength(sizeof(*this) - sizeof(NetworkDiagnosticTlv));
+    }
+
+    /**
+     * This method indicates whether or not the TLV appears to be well-formed.
+     *
+     * @retval TRUE   If the TLV appears to be well-formed.
+     * @retval FALSE  If the TLV does not appear to be well-formed.
+     *
+     */
+    bool IsValid(void) const { return GetLength() >= sizeof(*this) - sizeof(NetworkDiagnosticTlv); }
+
+    /**
+     * This method returns the Link Quality In value.
+     *
+     * @returns The Link Quality In value.
+     *
+     */
+    uint8_t GetLinkQualityIn(void) const { return mLinkQualityIn; }
+
+    /**
+     * This method sets the Link Quality In value.
+     *
+     * @param[in]  aLinkQuality  The Link Quality In value.
+     *
+     */
+    void SetLinkQualityIn(uint8_t aLinkQuality) { mLinkQualityIn = aLinkQuality; }
+
+    /**
+     * This method returns the Average RSSI value.
+     *
+     * @returns The Average RSSI value (in dBm).
+     *
+     */
+    int8_t GetAverageRssi(void) const { return mAverageRssi; }
+
+    /**
+     * This method sets the Average RSSI value.
+     *
+     * @param[in]  aRssi  The Average RSSI value (in dBm).
+     *
+     */
+    void SetAverageRssi(int8_t aRssi) { mAverageRssi = aRssi; }
+
+    /**
+     * This method returns the Last RSSI value.
+     *
+     * @returns The Last RSSI value (in dBm).
+     *
+     */
+    int8_t GetLastRssi(void) const { return mLastRssi; }
+
+    /**
+     * This method sets the Last RSSI value.
+     *
+     * @param[in]  aRssi  The Last RSSI value (in dBm).
+     *
+     */
+    void SetLastRssi(int8_t aRssi) { mLastRssi = aRssi; }
+
+    /**
+     * This method returns the Frame Error Rate value.
+     *
+     * @returns The Frame Error Rate value (0xffff represents 100%).
+     *
+     */
+    uint16_t GetFrameErrorRate(void) const { return HostSwap16(mFrameErrorRate); }
+
+    /**
+     * This method sets the Frame Error Rate value.
+     *
+     * @param[in]  aRate  The Frame Error Rate value (0xffff represents 100%).
+     *
+     */
+    void SetFrameErrorRate(uint16_t aRate) { mFrameErrorRate = HostSwap16(aRate); }
+
+    /**
+     * This method returns the Message Error Rate value.
+     *
+     * @returns The Message Error Rate value (0xffff represents 100%).
+     *
+     */
+    uint16_t GetMessageErrorRate(void) const { return HostSwap16(mMessageErrorRate); }
+
+    /**
+     * This method sets the Message Error Rate value.
+     *
+     * @param[in]  aRate  The Message Error Rate value (0xffff represents 100%).
+     *
+     */
+    void SetMessageErrorRate(uint16_t aRate) { mMessageErrorRate = HostSwap16(aRate); }
+
+private:
+    uint8_t  mLinkQualityIn;
+    int8_t   mAverageRssi;
+    int8_t   mLastRssi;
+    uint16_t mFrameErrorRate;
+    uint16_t mMessageErrorRate;
+} OT_TOOL_PACKED_END;
+
+/**
+ * This class implements Child Info Age TLV generation and parsing.
+ *
+ * The Child Info Age TLV is included by a router in a Child Diagnostic TLV and indicates how fresh the info reported
+ * on behalf of the child is.
+ *
+ */
+OT_TOOL_PACKED_BEGIN
+class ChildInfoAgeTlv : public NetworkDiagnosticTlv, public TlvInfo<NetworkDiagnosticTlv::kChildInfoAge>
+{
+public:
+    /**
+     * This method initializes the TLV.
+     *
+     */
+    void Init(void)
+    {
+        SetType(kChildInfoAge);
+        SetLength(sizeof(*this) - sizeof(NetworkDiagnosticTlv));
+    }
+
+    /**
+     * This method indicates whether or not the TLV appears to be well-formed.
+     *
+     * @retval TRUE   If the TLV appears to be well-formed.
+     * @retval FALSE  If the TLV does not appear to be well-formed.
+     *
+     */
+    bool IsValid(void) const { return GetLength() >= sizeof(*this) - sizeof(NetworkDiagnosticTlv); }
+
+    /**
+     * This method returns the number of seconds since the router last heard from the child.
+     *
+     * @returns The number of seconds since the router last heard from the child.
+     *
+     */
+    uint32_t GetSecondsSinceLastHeard(void) const { return HostSwap32(mSecondsSinceLastHeard); }
+
+    /**
+     * This method sets the number of seconds since the router last heard from the child.
+     *
+     * @param[in]  aSeconds  The number of seconds since the router last heard from the child.
+     *
+     */
+    void SetSecondsSinceLastHeard(uint32_t aSeconds) { mSecondsSinceLastHeard = HostSwap32(aSeconds); }
+
+    /**
+     * This method returns the number of seconds since the child last updated its info (in an MLE exchange).
+     *
+     * @returns The number of seconds since the child last updated its info.
+     *
+     */
+    uint32_t GetSecondsSinceInfoUpdate(void) const { return HostSwap32(mSecondsSinceInfoUpdate); }
+
+    /**
+     * This method sets the number of seconds since the child last updated its info (in an MLE exchange).
+     *
+     * @param[in]  aSeconds  The number of seconds since the child last updated its info.
+     *
+     */
+    void SetSecondsSinceInfoUpdate(uint32_t aSeconds) { mSecondsSinceInfoUpdate = HostSwap32(aSeconds); }
+
+private:
+    uint32_t mSecondsSinceLastHeard;
+    uint32_t mSecondsSinceInfoUpdate;
+} OT_TOOL_PACKED_END;
+
 /**
  * This class implements Network Data TLV generation and parsing.
  *
@@ -0,0 +1,174 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the table of scored parent candidates.
+ */
+
+#include "parent_candidates.hpp"
+
+#include "common/code_utils.hpp"
+#include "thread/mle.hpp"
+
+namespace ot {
+namespace Mle {
+
+//---------------------------------------------------------------------------------------------------------------------
+// ParentCandidateTable::Candidate
+
+uint8_t ParentCandidateTable::Candidate::GetTwoWayLinkMargin(void) const
+{
+    return OT_MIN(mLinkMarginIn, mLinkMarginOut);
+}
+
+uint16_t ParentCandidateTable::Candidate::CalculateScore(void) const
+{
+    // A link margin above `kMaxLinkMargin` is as good as any
+    // (link quality 3 requires a margin above 20 dB).
+
+    static constexpr uint8_t  kMaxLinkMargin    = 40;
+    static constexpr uint16_t kLinkMarginWeight = 8;
+    static constexpr uint16_t kRouterBonus      = 64;
+    static constexpr uint16_t kPriorityWeight   = 24;
+    static constexpr uint8_t  kMaxLinkCount     = 8;
+    static constexpr uint16_t kVersionBonus     = 8;
+    static constexpr uint16_t kMaxCslPenalty    = 16;
+
+    uint16_t score;
+    uint16_t cslPenalty;
+    int8_t   priority = OT_MAX(mParentPriority, static_cast<int8_t>(-1));
+
+    score = OT_MIN(GetTwoWayLinkMargin(), kMaxLinkMargin) * kLinkMarginWeight;
+
+    if (Mle::IsActiveRouter(mRloc16))
+    {
+        score += kRouterBonus;
+    }
+
+    score += static_cast<uint16_t>(priority + 1) * kPriorityWeight;
+
+    score += OT_MIN(mLinkQuality3, kMaxLinkCount) * 4;
+    score += OT_MIN(mLinkQuality2, kMaxLinkCount) * 2;
+    score += OT_MIN(mLinkQuality1, kMaxLinkCount);
+
+    if (mVersion >= OT_THREAD_VERSION_1_2)
+    {
+        score += kVersionBonus;
+    }
+
+    cslPenalty = OT_MIN(static_cast<uint16_t>((mCslClockAccuracy + mCslUncertainty) / 8), kMaxCslPenalty);
+    score      = (score > cslPenalty) ? score - cslPenalty : 0;
+
+    return score;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// ParentCandidateTable
+
+void ParentCandidateTable::Update(const Candidate &aCandidate)
+{
+    Candidate *entry = mCandidates.FindMatching(aCandidate.mExtAddress);
+
+    if ((entry == nullptr) && mCandidates.IsFull())
+    {
+        Candidate *worst = nullptr;
+
+        for (Candidate &candidate : mCandidates)
+        {
+            if ((worst == nullptr) || (candidate.CalculateScore() < worst->CalculateScore()))
+            {
+                worst = &candidate;
+            }
+        }
+
+        VerifyOrExit(aCandidate.CalculateScore() > worst->CalculateScore());
+        entry = worst;
+    }
+
+    if (entry == nullptr)
+    {
+        entry = mCandidates.PushBack();
+    }
+
+    *entry = aCandidate;
+
+exit:
+    return;
+}
+
+void ParentCandidateTable::UpdateLinkMarginIn(const Mac::ExtAddress &aExtAddress, uint8_t aLinkMargin, TimeMilli aNow)
+{
+    Candidate *entry = mCandidates.FindMatching(aExtAddress);
+
+    VerifyOrExit(entry != nullptr);
+
+    entry->mLinkMarginIn = static_cast<uint8_t>((static_cast<uint16_t>(entry->mLinkMarginIn) + aLinkMargin) / 2);
+    entry->mLastUpdate   = aNow;
+
+exit:
+    return;
+}
+
+void ParentCandidateTable::UpdateLinkMarginOut(const Mac::ExtAddress &aExtAddress, uint8_t aLinkMargin, TimeMilli aNow)
+{
+    Candidate *entry = mCandidates.FindMatching(aExtAddress);
+
+    VerifyOrExit(entry != nullptr);
+
+    entry->mLinkMarginOut = aLinkMargin;
+    entry->mLastUpdate    = aNow;
+
+exit:
+    return;
+}
+
+const ParentCandidateTable::Candidate *ParentCandidateTable::FindBest(const Mac::ExtAddress &aExclude,
+                                                                      TimeMilli              aNow,
+                                                                      uint32_t               aMaxAge) const
+{
+    const Candidate *best = nullptr;
+
+    for (const Candidate &candidate : mCandidates)
+    {
+        if (candidate.Matches(aExclude) || (aNow - candidate.mLastUpdate > aMaxAge))
+        {
+            continue;
+        }
+
+        if ((best == nullptr) || (candidate.CalculateScore() > best->CalculateScore()))
+        {
+            best = &candidate;
+        }
+    }
+
+    return best;
+}
+
+} // namespace Mle
+} // namespace ot
@@ -0,0 +1,225 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the table of scored parent candidates.
+ */
+
+#ifndef PARENT_CANDIDATES_HPP_
+#define PARENT_CANDIDATES_HPP_
+
+#include "openthread-core-config.h"
+
+#include <stdint.h>
+
+#include "common/array.hpp"
+#include "common/clearable.hpp"
+#include "common/time.hpp"
+#include "mac/mac_types.hpp"
+
+namespace ot {
+namespace Mle {
+
+/**
+ * @addtogroup core-mle-core
+ *
+ * @{
+ */
+
+/**
+ * This class implements a table of scored parent candidates.
+ *
+ * Every Parent Response received during an attach attempt (or a parent search) is recorded as a candidate with a
+ * score. The table keeps the best scoring candidates, so that the runner-up can be used to quickly re-attach (without
+ * going through all the attach phases) when the link to the current parent fails.
+ *
+ */
+class ParentCandidateTable
+{
+public:
+    static constexpr uint8_t kMaxCandidates = OPENTHREAD_CONFIG_MLE_PARENT_CANDIDATE_TABLE_SIZE; ///< Table size.
+
+    /**
+     * This class represents a parent candidate.
+     *
+     */
+    class Candidate : public Clearable<Candidate>
+    {
+    public:
+        /**
+         * This method calculates the score of the candidate (higher is better).
+         *
+         * The two-way link margin has the largest weight, followed by whether the candidate is an active router, its
+         * parent priority, and its number of links to neighbors (from Connectivity TLV). The Thread version and the
+         * CSL accuracy are used to break ties.
+         *
+         * @returns The score of the candidate.
+         *
+         */
+        uint16_t CalculateScore(void) const;
+
+        /**
+         * This method returns the two-way link margin (minimum of the link margin in both directions).
+         *
+         * @returns The two-way link margin (in dB).
+         *
+         */
+        uint8_t GetTwoWayLinkMargin(void) const;
+
+        /**
+         * This method indicates whether the candidate matches a given extended address.
+         *
+         * @param[in] aExtAddress  The extended address to match.
+         *
+         * @retval TRUE   The candidate matches @p aExtAddress.
+         * @retval FALSE  The candidate does not match @p aExtAddress.
+         *
+         */
+        bool Matches(const Mac::ExtAddress &aExtAddress) const { return mExtAddress == aExtAddress; }
+
+        Mac::ExtAddress mExtAddress;       ///< The extended address.
+        uint16_t        mRloc16;           ///< The RLOC16.
+        uint8_t         mLinkMarginIn;     ///< The link margin of frames received from the candidate (in dB).
+        uint8_t         mLinkMarginOut;    ///< The link margin reported by the candidate (in dB).
+        int8_t          mParentPriority;   ///< The parent priority (from Connectivity TLV).
+        uint8_t         mLinkQuality3;     ///< The number of neighbors with link quality 3 (from Connectivity TLV).
+        uint8_t         mLinkQuality2;     ///< The number of neighbors with link quality 2 (from Connectivity TLV).
+        uint8_t         mLinkQuality1;     ///< The number of neighbors with link quality 1 (from Connectivity TLV).
+        uint8_t         mVersion;          ///< The Thread version.
+        uint8_t         mCslClockAccuracy; ///< The CSL clock accuracy (in ppm), zero if not used.
+        uint8_t         mCslUncertainty;   ///< The CSL uncertainty (in units of 10 us), zero if not used.
+        TimeMilli       mLastUpdate;       ///< The time the candidate info was last updated.
+    };
+
+    /**
+     * This constructor initializes the `ParentCandidateTable` as empty.
+     *
+     */
+    ParentCandidateTable(void) { Clear(); }
+
+    /**
+     * This method clears the table.
+     *
+     */
+    void Clear(void) { mCandidates.Clear(); }
+
+    /**
+     * This method indicates whether the table is empty.
+     *
+     * @retval TRUE   The table is empty.
+     * @retval FALSE  The table is not empty.
+     *
+     */
+    bool IsEmpty(void) const { return mCandidates.IsEmpty(); }
+
+    /**
+     * This method gets the number of candidates in the table.
+     *
+     * @returns The number of candidates.
+     *
+     */
+    uint8_t GetLength(void) const { return mCandidates.GetLength(); }
+
+    /**
+     * This method adds a new candidate or updates an existing one (with the same extended address).
+     *
+     * If the table is full, the lowest scoring candidate is evicted (unless the new candidate has an even lower score).
+     *
+     * @param[in] aCandidate  The candidate info.
+     *
+     */
+    void Update(const Candidate &aCandidate);
+
+    /**
+     * This method updates the link margin of frames received from a candidate (if present in the table).
+     *
+     * The new value is averaged with the previous one.
+     *
+     * @param[in] aExtAddress  The extended address of the candidate.
+     * @param[in] aLinkMargin  The link margin (in dB).
+     * @param[in] aNow         The current time.
+     *
+     */
+    void UpdateLinkMarginIn(const Mac::ExtAddress &aExtAddress, uint8_t aLinkMargin, TimeMilli aNow);
+
+    /**
+     * This method updates the link margin measured by a candidate (e.g., from a Link Metrics report).
+     *
+     * The new value replaces the one reported in the Parent Response.
+     *
+     * @param[in] aExtAddress  The extended address of the candidate.
+     * @param[in] aLinkMargin  The link margin (in dB).
+     * @param[in] aNow         The current time.
+     *
+     */
+    void UpdateLinkMarginOut(const Mac::ExtAddress &aExtAddress, uint8_t aLinkMargin, TimeMilli aNow);
+
+    /**
+     * This method removes a candidate from the table.
+     *
+     * @param[in] aExtAddress  The extended address of the candidate to remove.
+     *
+     */
+    void Remove(const Mac::ExtAddress &aExtAddress) { mCandidates.RemoveMatching(aExtAddress); }
+
+    /**
+     * This method finds a candidate in the table.
+     *
+     * @param[in] aExtAddress  The extended address of the candidate.
+     *
+     * @returns A pointer to the candidate, or `nullptr` if not found.
+     *
+     */
+    const Candidate *Find(const Mac::ExtAddress &aExtAddress) const { return mCandidates.FindMatching(aExtAddress); }
+
+    /**
+     * This method finds the best scoring candidate, excluding a given one (e.g., the current parent) and the ones
+     * not updated within a given age.
+     *
+     * @param[in] aExclude  The extended address of the candidate to exclude.
+     * @param[in] aNow      The current time.
+     * @param[in] aMaxAge   The maximum age (in msec) of candidate info.
+     *
+     * @returns A pointer to the best candidate, or `nullptr` if none.
+     *
+     */
+    const Candidate *FindBest(const Mac::ExtAddress &aExclude, TimeMilli aNow, uint32_t aMaxAge) const;
+
+private:
+    Array<Candidate, kMaxCandidates> mCandidates;
+};
+
+/**
+ * @}
+ */
+
+} // namespace Mle
+} // namespace ot
+
+#endif // PARENT_CANDIDATES_HPP_
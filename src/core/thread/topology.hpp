@@ -1138,6 +1138,26 @@ public:
      */
     void SetTimeout(uint32_t aTimeout) { mTimeout = aTimeout; }
 
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+    /**
+     * This method gets the time the child last updated its info (mode, timeout, registered addresses) in an MLE
+     * exchange.
+     *
+     * @returns The info update time.
+     *
+     */
+    TimeMilli GetInfoUpdateTime(void) const { return mInfoUpdateTime; }
+
+    /**
+     * This method sets the time the child last updated its info (mode, timeout, registered addresses) in an MLE
+     * exchange.
+     *
+     * @param[in]  aTime  The info update time.
+     *
+     */
+    void SetInfoUpdateTime(TimeMilli aTime) { mInfoUpdateTime = aTime; }
+#endif
+
     /**
      * This method gets the network data version.
      *
@@ -1309,6 +1329,10 @@ private:
     Ip6::Address             mIp6Address[kNumIp6Addresses]; ///< Registered IPv6 addresses
     uint32_t                 mTimeout;                      ///< Child timeout
 
+#if OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_CHILD_CACHE_ENABLE
+    TimeMilli mInfoUpdateTime; ///< Time of the last info update (in an MLE exchange)
+#endif
+
 #if OPENTHREAD_FTD && OPENTHREAD_CONFIG_TMF_PROXY_MLR_ENABLE
     ChildIp6AddressMask mMlrToRegisterMask;
     ChildIp6AddressMask mMlrRegisteredMask;
@@ -35,6 +35,8 @@
 
 #if OPENTHREAD_CONFIG_PING_SENDER_ENABLE
 
+#include <string.h>
+
 #include "common/as_core_type.hpp"
 #include "common/encoding.hpp"
 #include "common/locator_getters.hpp"
@@ -43,6 +45,7 @@
 namespace ot {
 namespace Utils {
 
+using Encoding::BigEndian::HostSwap16;
 using Encoding::BigEndian::HostSwap32;
 
 void PingSender::Config::SetUnspecifiedToDefault(void)
@@ -90,6 +93,10 @@ PingSender::PingSender(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mIdentifier(0)
     , mTargetEchoSequence(0)
+    , mReplyHistory(0)
+    , mLargestReplyIndex(0)
+    , mLastRoundTripTime(0)
+    , mScaledJitter(0)
     , mTimer(aInstance, PingSender::HandleTimer)
     , mIcmpHandler(PingSender::HandleIcmpReceive, this)
 {
@@ -106,12 +113,27 @@ Error PingSender::Ping(const Config &aConfig)
     mConfig.SetUnspecifiedToDefault();
 
     VerifyOrExit(mConfig.mInterval <= Timer::kMaxDelay, error = kErrorInvalidArgs);
+    VerifyOrExit(mConfig.mMaxOutstanding <= kMaxOutstanding, error = kErrorInvalidArgs);
+    VerifyOrExit(mConfig.mPatternLength <= sizeof(mConfig.mPattern), error = kErrorInvalidArgs);
 
     mStatistics.Clear();
     mStatistics.mIsMulticast = AsCoreType(&mConfig.mDestination).IsMulticast();
+    mRoundTripTimeHistogram.Clear();
+    mReplyHistory      = 0;
+    mLargestReplyIndex = 0;
+    mLastRoundTripTime = 0;
+    mScaledJitter      = 0;
 
     mIdentifier++;
-    SendPing();
+
+    if (IsHighRateMode())
+    {
+        SendHighRatePings();
+    }
+    else
+    {
+        SendPing();
+    }
 
 exit:
     return error;
@@ -137,15 +159,31 @@ void PingSender::SendPing(void)
     message = Get<Ip6::Icmp>().NewMessage(0);
     VerifyOrExit(message != nullptr);
 
+    // The payload starts with the tx timestamp followed by the index
+    // of the request (within this ping), which is used to detect
+    // duplicate and out of order replies.
+
     SuccessOrExit(message->Append(HostSwap32(now.GetValue())));
+    SuccessOrExit(message->Append(HostSwap16(mStatistics.mSentCount)));
 
     if (mConfig.mSize > message->GetLength())
     {
+        uint16_t offset = message->GetLength();
+
         SuccessOrExit(message->SetLength(mConfig.mSize));
+
+        for (; (mConfig.mPatternLength > 0) && (offset < mConfig.mSize); offset += mConfig.mPatternLength)
+        {
+            message->WriteBytes(offset, mConfig.mPattern,
+                                static_cast<uint16_t>(OT_MIN(mConfig.mPatternLength, mConfig.mSize - offset)));
+        }
     }
 
     mTargetEchoSequence = Get<Ip6::Icmp>().GetEchoSequence();
     SuccessOrExit(Get<Ip6::Icmp>().SendEchoRequest(*message, messageInfo, mIdentifier));
+
+    mRequestTimes[mStatistics.mSentCount % kMaxOutstanding] = now;
+    mReplyHistory <<= 1;
     mStatistics.mSentCount++;
 
 #if OPENTHREAD_CONFIG_OTNS_ENABLE
@@ -158,16 +196,149 @@ exit:
     FreeMessage(message);
     mConfig.mCount--;
 
-    if (mConfig.mCount > 0)
+    // In high-rate mode, the timer is scheduled from `SendHighRatePings()`.
+    if (!IsHighRateMode())
+    {
+        mTimer.Start((mConfig.mCount > 0) ? mConfig.mInterval : mConfig.mTimeout);
+    }
+}
+
+void PingSender::SendHighRatePings(void)
+{
+    // In high-rate mode, a new request is sent whenever fewer than
+    // `mMaxOutstanding` requests are waiting for a reply. The
+    // timer tracks the earliest time an outstanding request times
+    // out (freeing its slot). The ping finishes when all requests
+    // are sent and none is outstanding.
+
+    TimeMilli now = TimerMilli::GetNow();
+    TimeMilli nextExpireTime;
+    uint16_t  numOutstanding;
+
+    while (true)
+    {
+        numOutstanding = CountOutstanding(now, nextExpireTime);
+
+        VerifyOrExit(mConfig.mCount > 0);
+        VerifyOrExit(numOutstanding < mConfig.mMaxOutstanding);
+
+        // The send time of request `mSentCount - kMaxOutstanding` is
+        // about to be overwritten, so it must no longer be outstanding.
+        // This ensures all outstanding requests are among the ones
+        // checked by `CountOutstanding()`.
+
+        if (mStatistics.mSentCount >= kMaxOutstanding)
+        {
+            uint16_t index = mStatistics.mSentCount - kMaxOutstanding;
+
+            VerifyOrExit(IsReplied(index) || (now >= mRequestTimes[index % kMaxOutstanding] + mConfig.mTimeout));
+        }
+
+        SendPing();
+    }
+
+exit:
+    if (numOutstanding == 0)
     {
-        mTimer.Start(mConfig.mInterval);
+        Finish();
     }
     else
     {
-        mTimer.Start(mConfig.mTimeout);
+        mTimer.FireAt(nextExpireTime);
     }
 }
 
+uint16_t PingSender::CountOutstanding(TimeMilli aNow, TimeMilli &aNextExpireTime) const
+{
+    uint16_t numOutstanding = 0;
+    uint16_t numChecked     = OT_MIN(mStatistics.mSentCount, kMaxOutstanding);
+
+    aNextExpireTime = aNow.GetDistantFuture();
+
+    for (uint16_t index = mStatistics.mSentCount - numChecked; index != mStatistics.mSentCount; index++)
+    {
+        TimeMilli expireTime = mRequestTimes[index % kMaxOutstanding] + mConfig.mTimeout;
+
+        if (!IsReplied(index) && (aNow < expireTime))
+        {
+            numOutstanding++;
+            aNextExpireTime = OT_MIN(aNextExpireTime, expireTime);
+        }
+    }
+
+    return numOutstanding;
+}
+
+bool PingSender::IsReplied(uint16_t aIndex) const
+{
+    uint16_t offset = mStatistics.mSentCount - 1 - aIndex;
+
+    return (offset < sizeof(mReplyHistory) * CHAR_BIT) && ((mReplyHistory & (1UL << offset)) != 0);
+}
+
+void PingSender::UpdateStatistics(uint16_t aIndex, uint16_t aRoundTripTime)
+{
+    uint16_t offset = mStatistics.mSentCount - 1 - aIndex;
+
+    if (!mStatistics.mIsMulticast)
+    {
+        uint16_t delta;
+
+        // Duplicates can only be detected within the reply history.
+        if (IsReplied(aIndex))
+        {
+            mStatistics.mDuplicateCount++;
+            ExitNow();
+        }
+
+        if (mStatistics.mReceivedCount > 0)
+        {
+            if (aIndex < mLargestReplyIndex)
+            {
+                mStatistics.mOutOfOrderCount++;
+            }
+
+            delta = (aRoundTripTime > mLastRoundTripTime) ? (aRoundTripTime - mLastRoundTripTime)
+                                                           : (mLastRoundTripTime - aRoundTripTime);
+
+            mScaledJitter       = mScaledJitter + delta - ((mScaledJitter + 8) >> 4);
+            mStatistics.mJitter = static_cast<uint16_t>((mScaledJitter + 8) >> 4);
+        }
+
+        if ((mStatistics.mReceivedCount == 0) || (aIndex > mLargestReplyIndex))
+        {
+            mLargestReplyIndex = aIndex;
+        }
+
+        mLastRoundTripTime = aRoundTripTime;
+    }
+
+    if (offset < sizeof(mReplyHistory) * CHAR_BIT)
+    {
+        mReplyHistory |= (1UL << offset);
+    }
+
+    mStatistics.mReceivedCount++;
+    mStatistics.mTotalRoundTripTime += aRoundTripTime;
+    mStatistics.mMaxRoundTripTime = OT_MAX(mStatistics.mMaxRoundTripTime, aRoundTripTime);
+    mStatistics.mMinRoundTripTime = OT_MIN(mStatistics.mMinRoundTripTime, aRoundTripTime);
+    mRoundTripTimeHistogram.Add(aRoundTripTime);
+
+exit:
+    return;
+}
+
+void PingSender::Finish(void)
+{
+    mTimer.Stop();
+
+    mStatistics.mRoundTripTimeP50 = mRoundTripTimeHistogram.GetPercentile(50, mStatistics.mMaxRoundTripTime);
+    mStatistics.mRoundTripTimeP90 = mRoundTripTimeHistogram.GetPercentile(90, mStatistics.mMaxRoundTripTime);
+    mStatistics.mRoundTripTimeP99 = mRoundTripTimeHistogram.GetPercentile(99, mStatistics.mMaxRoundTripTime);
+
+    mConfig.InvokeStatisticsCallback(mStatistics);
+}
+
 void PingSender::HandleTimer(Timer &aTimer)
 {
     aTimer.Get<PingSender>().HandleTimer();
@@ -175,13 +346,17 @@ void PingSender::HandleTimer(Timer &aTimer)
 
 void PingSender::HandleTimer(void)
 {
-    if (mConfig.mCount > 0)
+    if (IsHighRateMode())
+    {
+        SendHighRatePings();
+    }
+    else if (mConfig.mCount > 0)
     {
         SendPing();
     }
     else // The last reply times out, triggering the callback to print statistics in CLI.
     {
-        mConfig.InvokeStatisticsCallback(mStatistics);
+        Finish();
     }
 }
 
@@ -200,6 +375,8 @@ void PingSender::HandleIcmpReceive(const Message &          aMessage,
 {
     Reply    reply;
     uint32_t timestamp;
+    uint16_t index;
+    bool     isLastReply;
 
     VerifyOrExit(mTimer.IsRunning());
     VerifyOrExit(aIcmpHeader.GetType() == Ip6::Icmp::Header::kTypeEchoReply);
@@ -208,6 +385,10 @@ void PingSender::HandleIcmpReceive(const Message &          aMessage,
     SuccessOrExit(aMessage.Read(aMessage.GetOffset(), timestamp));
     timestamp = HostSwap32(timestamp);
 
+    SuccessOrExit(aMessage.Read(aMessage.GetOffset() + sizeof(timestamp), index));
+    index = HostSwap16(index);
+    VerifyOrExit(index < mStatistics.mSentCount);
+
     reply.mSenderAddress = aMessageInfo.GetPeerAddr();
     reply.mRoundTripTime =
         static_cast<uint16_t>(OT_MIN(TimerMilli::GetNow() - TimeMilli(timestamp), NumericLimits<uint16_t>::kMax));
@@ -215,30 +396,122 @@ void PingSender::HandleIcmpReceive(const Message &          aMessage,
     reply.mSequenceNumber = aIcmpHeader.GetSequence();
     reply.mHopLimit       = aMessageInfo.GetHopLimit();
 
-    mStatistics.mReceivedCount++;
-    mStatistics.mTotalRoundTripTime += reply.mRoundTripTime;
-    mStatistics.mMaxRoundTripTime = OT_MAX(mStatistics.mMaxRoundTripTime, reply.mRoundTripTime);
-    mStatistics.mMinRoundTripTime = OT_MIN(mStatistics.mMinRoundTripTime, reply.mRoundTripTime);
+    UpdateStatistics(index, reply.mRoundTripTime);
 
 #if OPENTHREAD_CONFIG_OTNS_ENABLE
     Get<Utils::Otns>().EmitPingReply(aMessageInfo.GetPeerAddr(), reply.mSize, timestamp, reply.mHopLimit);
 #endif
+
+    isLastReply = !IsHighRateMode() && !mStatistics.mIsMulticast && mConfig.mCount == 0 &&
+                  aIcmpHeader.GetSequence() == mTargetEchoSequence;
+
     // Received all ping replies, no need to wait longer.
-    if (!mStatistics.mIsMulticast && mConfig.mCount == 0 && aIcmpHeader.GetSequence() == mTargetEchoSequence)
+    if (isLastReply)
     {
         mTimer.Stop();
     }
+
     mConfig.InvokeReplyCallback(reply);
-    // Received all ping replies, no need to wait longer.
-    if (!mStatistics.mIsMulticast && mConfig.mCount == 0 && aIcmpHeader.GetSequence() == mTargetEchoSequence)
+
+    if (isLastReply)
     {
-        mConfig.InvokeStatisticsCallback(mStatistics);
+        Finish();
+    }
+    else if (IsHighRateMode() && mTimer.IsRunning())
+    {
+        // Check `mTimer` in case the ping was stopped from the callback.
+        SendHighRatePings();
     }
 
 exit:
     return;
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+// PingSender::RoundTripTimeHistogram
+
+void PingSender::RoundTripTimeHistogram::Clear(void)
+{
+    memset(mCounts, 0, sizeof(mCounts));
+}
+
+void PingSender::RoundTripTimeHistogram::Add(uint16_t aRoundTripTime)
+{
+    uint16_t &count = mCounts[ValueToBucket(aRoundTripTime)];
+
+    if (count < NumericLimits<uint16_t>::kMax)
+    {
+        count++;
+    }
+}
+
+uint16_t PingSender::RoundTripTimeHistogram::GetPercentile(uint8_t aPercent, uint16_t aMaxRoundTripTime) const
+{
+    uint16_t value = 0;
+    uint32_t total = 0;
+    uint32_t target;
+
+    for (uint16_t count : mCounts)
+    {
+        total += count;
+    }
+
+    VerifyOrExit(total > 0);
+
+    target = (total * aPercent + 99) / 100;
+    total  = 0;
+
+    for (uint8_t bucket = 0; bucket < kNumBuckets; bucket++)
+    {
+        total += mCounts[bucket];
+
+        if (total >= target)
+        {
+            value = OT_MIN(GetBucketMaxValue(bucket), aMaxRoundTripTime);
+            break;
+        }
+    }
+
+exit:
+    return value;
+}
+
+uint8_t PingSender::RoundTripTimeHistogram::ValueToBucket(uint16_t aValue)
+{
+    uint8_t bucket = static_cast<uint8_t>(aValue);
+    uint8_t msb;
+
+    VerifyOrExit(aValue >= kNumExactBuckets);
+
+    for (msb = kSubBucketBits + 1; (aValue >> (msb + 1)) != 0; msb++)
+    {
+    }
+
+    // The bucket is selected by the position of the most significant
+    // bit and the `kSubBucketBits` bits following it.
+    bucket = kNumExactBuckets + (msb - kSubBucketBits - 1) * kNumSubBuckets +
+             ((aValue >> (msb - kSubBucketBits)) & (kNumSubBuckets - 1));
+
+exit:
+    return bucket;
+}
+
+uint16_t PingSender::RoundTripTimeHistogram::GetBucketMaxValue(uint8_t aBucket)
+{
+    uint16_t value = aBucket;
+    uint8_t  shift;
+    uint8_t  subBucket;
+
+    VerifyOrExit(aBucket >= kNumExactBuckets);
+
+    shift     = (aBucket - kNumExactBuckets) / kNumSubBuckets + 1;
+    subBucket = (aBucket - kNumExactBuckets) % kNumSubBuckets;
+    value     = static_cast<uint16_t>((static_cast<uint32_t>(kNumSubBuckets + subBucket + 1) << shift) - 1);
+
+exit:
+    return value;
+}
+
 } // namespace Utils
 } // namespace ot
 
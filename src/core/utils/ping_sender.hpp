@@ -38,6 +38,8 @@
 
 #if OPENTHREAD_CONFIG_PING_SENDER_ENABLE
 
+#include <limits.h>
+
 #include <openthread/ping_sender.h>
 
 #include "common/as_core_type.hpp"
@@ -83,6 +85,12 @@ public:
             mMinRoundTripTime   = NumericLimits<uint16_t>::kMax;
             mMaxRoundTripTime   = NumericLimits<uint16_t>::kMin;
             mIsMulticast        = false;
+            mDuplicateCount     = 0;
+            mOutOfOrderCount    = 0;
+            mRoundTripTimeP50   = 0;
+            mRoundTripTimeP90   = 0;
+            mRoundTripTimeP99   = 0;
+            mJitter             = 0;
         }
     };
 
@@ -165,7 +173,41 @@ public:
     void Stop(void);
 
 private:
+    static constexpr uint16_t kMaxOutstanding = OPENTHREAD_CONFIG_PING_SENDER_MAX_OUTSTANDING;
+
+    static_assert(kMaxOutstanding < sizeof(uint32_t) * CHAR_BIT, "PING_SENDER_MAX_OUTSTANDING is too large");
+
+    // Log-linear histogram of round trip times: values below
+    // `kNumExactBuckets` each have their own bucket, larger values
+    // use `kNumSubBuckets` buckets per power of two.
+    class RoundTripTimeHistogram
+    {
+    public:
+        void     Clear(void);
+        void     Add(uint16_t aRoundTripTime);
+        uint16_t GetPercentile(uint8_t aPercent, uint16_t aMaxRoundTripTime) const;
+
+    private:
+        static constexpr uint8_t kSubBucketBits   = 3;
+        static constexpr uint8_t kNumSubBuckets   = (1 << kSubBucketBits);
+        static constexpr uint8_t kNumExactBuckets = (2 * kNumSubBuckets);
+        static constexpr uint8_t kNumBuckets =
+            kNumExactBuckets + (sizeof(uint16_t) * CHAR_BIT - kSubBucketBits - 1) * kNumSubBuckets;
+
+        static uint8_t  ValueToBucket(uint16_t aValue);
+        static uint16_t GetBucketMaxValue(uint8_t aBucket);
+
+        uint16_t mCounts[kNumBuckets];
+    };
+
+    bool        IsHighRateMode(void) const { return mConfig.mMaxOutstanding != 0; }
     void        SendPing(void);
+    void        SendHighRatePings(void);
+    void        HandleHighRateProgress(void);
+    uint16_t    CountOutstanding(TimeMilli aNow, TimeMilli &aNextExpireTime) const;
+    bool        IsReplied(uint16_t aIndex) const;
+    void        UpdateStatistics(uint16_t aIndex, uint16_t aRoundTripTime);
+    void        Finish(void);
     static void HandleTimer(Timer &aTimer);
     void        HandleTimer(void);
     static void HandleIcmpReceive(void *               aContext,
@@ -176,12 +218,18 @@ private:
                                   const Ip6::MessageInfo & aMessageInfo,
                                   const Ip6::Icmp::Header &aIcmpHeader);
 
-    Config             mConfig;
-    Statistics         mStatistics;
-    uint16_t           mIdentifier;
-    uint16_t           mTargetEchoSequence;
-    TimerMilli         mTimer;
-    Ip6::Icmp::Handler mIcmpHandler;
+    Config                 mConfig;
+    Statistics             mStatistics;
+    RoundTripTimeHistogram mRoundTripTimeHistogram;
+    uint16_t               mIdentifier;
+    uint16_t               mTargetEchoSequence;
+    uint32_t               mReplyHistory; // Bit `n` is set if request `mSentCount - 1 - n` got a reply.
+    uint16_t               mLargestReplyIndex;
+    uint16_t               mLastRoundTripTime;
+    uint32_t               mScaledJitter; // Jitter multiplied by 16 (RFC 3550, section 6.4.1).
+    TimeMilli              mRequestTimes[kMaxOutstanding];
+    TimerMilli             mTimer;
+    Ip6::Icmp::Handler     mIcmpHandler;
 };
 
 } // namespace Utils
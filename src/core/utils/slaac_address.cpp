@@ -53,9 +53,17 @@ RegisterLogModule("Slaac");
 Slaac::Slaac(Instance &aInstance)
     : InstanceLocator(aInstance)
     , mEnabled(true)
+    , mHasIidSecretKey(false)
+    , mHasPrefixUsingOtherAddress(false)
     , mFilter(nullptr)
+#if OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE > 0
+    , mIidCacheUseStamp(0)
+#endif
 {
     memset(mAddresses, 0, sizeof(mAddresses));
+#if OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE > 0
+    memset(mIidCache, 0, sizeof(mIidCache));
+#endif
 }
 
 void Slaac::Enable(void)
@@ -101,6 +109,12 @@ bool Slaac::ShouldFilter(const Ip6::Prefix &aPrefix) const
     return (mFilter != nullptr) && mFilter(&GetInstance(), &aPrefix);
 }
 
+bool Slaac::IsSlaacConfig(const NetworkData::OnMeshPrefixConfig &aConfig) const
+{
+    // Domain prefix is skipped since it is processed in MLE.
+    return !aConfig.mDp && aConfig.mSlaac && !ShouldFilter(aConfig.GetPrefix());
+}
+
 void Slaac::HandleNotifierEvents(Events aEvents)
 {
     UpdateMode mode = kModeNone;
@@ -112,7 +126,7 @@ void Slaac::HandleNotifierEvents(Events aEvents)
         mode |= kModeAdd | kModeRemove;
     }
 
-    if (aEvents.Contains(kEventIp6AddressRemoved))
+    if (aEvents.Contains(kEventIp6AddressRemoved) && mHasPrefixUsingOtherAddress)
     {
         // When an IPv6 address is removed, we ensure to check if a SLAAC address
         // needs to be added (replacing the removed address).
@@ -122,6 +136,11 @@ void Slaac::HandleNotifierEvents(Events aEvents)
         // with same prefix), the SLAAC module will not add a SLAAC address with same
         // prefix. So on IPv6 address removal event, we check if SLAAC module need
         // to add any addresses.
+        //
+        // This is only needed if there was such a prefix on the last update.
+        // Otherwise the removed address can only be one that is unrelated to the
+        // SLAAC prefixes (e.g., a SLAAC address removed by this module itself),
+        // and the network data does not need to be scanned again.
 
         mode |= kModeAdd;
     }
@@ -147,69 +166,100 @@ void Slaac::Update(UpdateMode aMode)
 {
     NetworkData::Iterator           iterator;
     NetworkData::OnMeshPrefixConfig config;
-    bool                            found;
+
+    // The update is diff-based: SLAAC addresses whose prefix is still
+    // present in network data are left as they are (no address removal
+    // and re-add, and no notifications for them), only addresses for
+    // removed prefixes are removed and only new prefixes get a new
+    // address.
 
     if (aMode & kModeRemove)
     {
         // If enabled, remove any SLAAC addresses with no matching on-mesh prefix,
         // otherwise (when disabled) remove all previously added SLAAC addresses.
+        // The network data is scanned once, marking the addresses whose
+        // prefix is still present.
 
-        for (Ip6::Netif::UnicastAddress &slaacAddr : mAddresses)
-        {
-            if (!slaacAddr.mValid)
-            {
-                continue;
-            }
+        bool isInNetData[kNumAddresses];
 
-            found = false;
+        memset(isInNetData, 0, sizeof(isInNetData));
 
-            if (mEnabled)
-            {
-                iterator = NetworkData::kIteratorInit;
+        if (mEnabled)
+        {
+            iterator = NetworkData::kIteratorInit;
 
-                while (Get<NetworkData::Leader>().GetNextOnMeshPrefix(iterator, config) == kErrorNone)
+            while (Get<NetworkData::Leader>().GetNextOnMeshPrefix(iterator, config) == kErrorNone)
+            {
+                if (!IsSlaacConfig(config))
                 {
-                    if (config.mDp)
-                    {
-                        // Skip domain prefix which is processed in MLE.
-                        continue;
-                    }
+                    continue;
+                }
 
-                    if (config.mSlaac && !ShouldFilter(config.GetPrefix()) &&
-                        DoesConfigMatchNetifAddr(config, slaacAddr))
+                for (uint16_t i = 0; i < kNumAddresses; i++)
+                {
+                    if (mAddresses[i].mValid && DoesConfigMatchNetifAddr(config, mAddresses[i]))
                     {
-                        found = true;
-                        break;
+                        isInNetData[i] = true;
                     }
                 }
             }
+        }
 
-            if (!found)
-            {
-                LogInfo("Removing address %s", slaacAddr.GetAddress().ToString().AsCString());
+        for (uint16_t i = 0; i < kNumAddresses; i++)
+        {
+            Ip6::Netif::UnicastAddress &slaacAddr = mAddresses[i];
 
-                Get<ThreadNetif>().RemoveUnicastAddress(slaacAddr);
-                slaacAddr.mValid = false;
+            if (!slaacAddr.mValid || isInNetData[i])
+            {
+                continue;
             }
+
+            LogInfo("Removing address %s", slaacAddr.GetAddress().ToString().AsCString());
+
+            Get<ThreadNetif>().RemoveUnicastAddress(slaacAddr);
+            slaacAddr.mValid = false;
         }
     }
 
-    if ((aMode & kModeAdd) && mEnabled)
+    if (!mEnabled)
+    {
+        mHasPrefixUsingOtherAddress = false;
+    }
+    else if (aMode & kModeAdd)
     {
         // Generate and add SLAAC addresses for any newly added on-mesh prefixes.
 
+        mHasPrefixUsingOtherAddress = false;
+
         iterator = NetworkData::kIteratorInit;
 
         while (Get<NetworkData::Leader>().GetNextOnMeshPrefix(iterator, config) == kErrorNone)
         {
             Ip6::Prefix &prefix = config.GetPrefix();
+            bool         found  = false;
 
-            if (config.mDp || !config.mSlaac || ShouldFilter(prefix))
+            if (!IsSlaacConfig(config))
             {
                 continue;
             }
 
-            found = false;
+            // Check the SLAAC addresses first, which is the common case
+            // for an existing prefix, before checking all the addresses
+            // on the interface (e.g., one added by user).
+
+            for (const Ip6::Netif::UnicastAddress &slaacAddr : mAddresses)
+            {
+                if (slaacAddr.mValid && DoesConfigMatchNetifAddr(config, slaacAddr))
+                {
+                    found = true;
+                    break;
+                }
+            }
+
+            if (found)
+            {
+                continue;
+            }
 
             for (const Ip6::Netif::UnicastAddress &netifAddr : Get<ThreadNetif>().GetUnicastAddresses())
             {
@@ -220,35 +270,37 @@ void Slaac::Update(UpdateMode aMode)
                 }
             }
 
-            if (!found)
+            if (found)
             {
-                bool added = false;
+                mHasPrefixUsingOtherAddress = true;
+                continue;
+            }
+
+            found = false;
 
-                for (Ip6::Netif::UnicastAddress &slaacAddr : mAddresses)
+            for (Ip6::Netif::UnicastAddress &slaacAddr : mAddresses)
+            {
+                if (slaacAddr.mValid)
                 {
-                    if (slaacAddr.mValid)
-                    {
-                        continue;
-                    }
+                    continue;
+                }
 
-                    slaacAddr.InitAsSlaacOrigin(config.mOnMesh ? prefix.mLength : 128, config.mPreferred);
-                    slaacAddr.GetAddress().SetPrefix(prefix);
+                slaacAddr.InitAsSlaacOrigin(config.mOnMesh ? prefix.mLength : 128, config.mPreferred);
+                slaacAddr.GetAddress().SetPrefix(prefix);
 
-                    IgnoreError(GenerateIid(slaacAddr));
+                IgnoreError(GenerateIid(slaacAddr));
 
-                    LogInfo("Adding address %s", slaacAddr.GetAddress().ToString().AsCString());
+                LogInfo("Adding address %s", slaacAddr.GetAddress().ToString().AsCString());
 
-                    Get<ThreadNetif>().AddUnicastAddress(slaacAddr);
+                Get<ThreadNetif>().AddUnicastAddress(slaacAddr);
 
-                    added = true;
-                    break;
-                }
+                found = true;
+                break;
+            }
 
-                if (!added)
-                {
-                    LogWarn("Failed to add - max %d addresses supported and already in use",
-                            GetArrayLength(mAddresses));
-                }
+            if (!found)
+            {
+                LogWarn("Failed to add - max %d addresses supported and already in use", kNumAddresses);
             }
         }
     }
@@ -257,7 +309,7 @@ void Slaac::Update(UpdateMode aMode)
 Error Slaac::GenerateIid(Ip6::Netif::UnicastAddress &aAddress,
                          uint8_t *                   aNetworkId,
                          uint8_t                     aNetworkIdLength,
-                         uint8_t *                   aDadCounter) const
+                         uint8_t *                   aDadCounter)
 {
     /*
      *  This method generates a semantically opaque IID per RFC 7217.
@@ -272,6 +324,11 @@ Error Slaac::GenerateIid(Ip6::Netif::UnicastAddress &aAddress,
      *    random number generator) and saved in non-volatile settings for
      *    future use.
      *
+     *  Since the IID is stable for a given prefix and DAD counter, the
+     *  IIDs generated without `Network_ID` are remembered in a small
+     *  cache so that they are not derived again when a prefix is removed
+     *  and later re-added.
+     *
      */
 
     Error                error      = kErrorFailed;
@@ -284,6 +341,18 @@ Error Slaac::GenerateIid(Ip6::Netif::UnicastAddress &aAddress,
     static_assert(sizeof(hash) >= Ip6::InterfaceIdentifier::kSize,
                   "SHA-256 hash size is too small to use as IPv6 address IID");
 
+#if OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE > 0
+    if ((aNetworkId == nullptr) && ReadIidFromCache(aAddress, dadCounter))
+    {
+        if (aDadCounter)
+        {
+            *aDadCounter = dadCounter;
+        }
+
+        ExitNow(error = kErrorNone);
+    }
+#endif
+
     GetIidSecretKey(secretKey);
 
     for (uint16_t count = 0; count < kMaxIidCreationAttempts; count++, dadCounter++)
@@ -309,6 +378,13 @@ Error Slaac::GenerateIid(Ip6::Netif::UnicastAddress &aAddress,
             continue;
         }
 
+#if OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE > 0
+        if (aNetworkId == nullptr)
+        {
+            SaveIidInCache(aAddress, aDadCounter ? *aDadCounter : 0, dadCounter);
+        }
+#endif
+
         if (aDadCounter)
         {
             *aDadCounter = dadCounter;
@@ -324,31 +400,94 @@ exit:
     return error;
 }
 
-void Slaac::GetIidSecretKey(IidSecretKey &aKey) const
+void Slaac::GetIidSecretKey(IidSecretKey &aKey)
 {
     Error error;
 
-    error = Get<Settings>().Read<Settings::SlaacIidSecretKey>(aKey);
+    // The secret key is read from settings once and then kept so that
+    // generating an IID does not require a settings read.
+
+    VerifyOrExit(!mHasIidSecretKey);
+
+    error = Get<Settings>().Read<Settings::SlaacIidSecretKey>(mIidSecretKey);
+    mHasIidSecretKey = true;
     VerifyOrExit(error != kErrorNone);
 
     // If there is no previously saved secret key, generate
     // a random one and save it.
 
-    error = Random::Crypto::FillBuffer(aKey.m8, sizeof(IidSecretKey));
+    error = Random::Crypto::FillBuffer(mIidSecretKey.m8, sizeof(IidSecretKey));
 
     if (error != kErrorNone)
     {
-        IgnoreError(Random::Crypto::FillBuffer(aKey.m8, sizeof(IidSecretKey)));
+        IgnoreError(Random::Crypto::FillBuffer(mIidSecretKey.m8, sizeof(IidSecretKey)));
     }
 
-    IgnoreError(Get<Settings>().Save<Settings::SlaacIidSecretKey>(aKey));
+    IgnoreError(Get<Settings>().Save<Settings::SlaacIidSecretKey>(mIidSecretKey));
 
     LogInfo("Generated and saved secret key");
 
 exit:
-    return;
+    aKey = mIidSecretKey;
 }
 
+#if OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE > 0
+
+bool Slaac::IidCacheEntry::Matches(const Ip6::Netif::UnicastAddress &aAddress, uint8_t aDadCounter) const
+{
+    return IsInUse() && (mDadCounter == aDadCounter) && (mPrefix.GetLength() == aAddress.mPrefixLength) &&
+           (memcmp(mPrefix.GetBytes(), aAddress.GetAddress().GetBytes(), mPrefix.GetBytesSize()) == 0);
+}
+
+bool Slaac::ReadIidFromCache(Ip6::Netif::UnicastAddress &aAddress, uint8_t &aDadCounter)
+{
+    bool found = false;
+
+    for (IidCacheEntry &entry : mIidCache)
+    {
+        if (entry.Matches(aAddress, aDadCounter))
+        {
+            aAddress.GetAddress().SetIid(entry.mIid);
+            aDadCounter    = entry.mResultDadCounter;
+            entry.mLastUse = ++mIidCacheUseStamp;
+            found          = true;
+            break;
+        }
+    }
+
+    return found;
+}
+
+void Slaac::SaveIidInCache(const Ip6::Netif::UnicastAddress &aAddress, uint8_t aDadCounter, uint8_t aResultDadCounter)
+{
+    // Use an unused entry if any, otherwise replace the least recently
+    // used one.
+
+    IidCacheEntry *entry = &mIidCache[0];
+
+    for (IidCacheEntry &cacheEntry : mIidCache)
+    {
+        if (!cacheEntry.IsInUse())
+        {
+            entry = &cacheEntry;
+            break;
+        }
+
+        if (cacheEntry.mLastUse < entry->mLastUse)
+        {
+            entry = &cacheEntry;
+        }
+    }
+
+    entry->mPrefix.Set(aAddress.GetAddress().GetBytes(), aAddress.mPrefixLength);
+    entry->mIid              = aAddress.GetAddress().GetIid();
+    entry->mDadCounter       = aDadCounter;
+    entry->mResultDadCounter = aResultDadCounter;
+    entry->mLastUse          = ++mIidCacheUseStamp;
+}
+
+#endif // OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE > 0
+
 } // namespace Utils
 } // namespace ot
 
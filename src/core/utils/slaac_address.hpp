@@ -141,10 +141,12 @@ public:
     Error GenerateIid(Ip6::Netif::UnicastAddress &aAddress,
                       uint8_t *                   aNetworkId       = nullptr,
                       uint8_t                     aNetworkIdLength = 0,
-                      uint8_t *                   aDadCounter      = nullptr) const;
+                      uint8_t *                   aDadCounter      = nullptr);
 
 private:
     static constexpr uint16_t kMaxIidCreationAttempts = 256; // Maximum number of attempts when generating IID.
+    static constexpr uint16_t kNumAddresses           = OPENTHREAD_CONFIG_IP6_SLAAC_NUM_ADDRESSES;
+    static constexpr uint16_t kIidCacheSize           = OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE;
 
     typedef uint8_t UpdateMode;
 
@@ -158,16 +160,46 @@ private:
     // - When SLAAC is disabled, remove all previously added addresses.
     static constexpr UpdateMode kModeRemove = 1 << 1;
 
+#if OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE > 0
+    // An IID generated (without a Network_ID) for a prefix starting
+    // from a given DAD counter, along with the DAD counter that
+    // produced it (after skipping reserved IIDs).
+    struct IidCacheEntry
+    {
+        bool IsInUse(void) const { return mLastUse != 0; }
+        bool Matches(const Ip6::Netif::UnicastAddress &aAddress, uint8_t aDadCounter) const;
+
+        Ip6::Prefix              mPrefix;
+        Ip6::InterfaceIdentifier mIid;
+        uint8_t                  mDadCounter;
+        uint8_t                  mResultDadCounter;
+        uint32_t                 mLastUse; // Stamp of the last use (for LRU replacement), zero if not in use.
+    };
+#endif
+
+#if OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE > 0
+    bool ReadIidFromCache(Ip6::Netif::UnicastAddress &aAddress, uint8_t &aDadCounter);
+    void SaveIidInCache(const Ip6::Netif::UnicastAddress &aAddress, uint8_t aDadCounter, uint8_t aResultDadCounter);
+#endif
+
     bool        ShouldFilter(const Ip6::Prefix &aPrefix) const;
+    bool        IsSlaacConfig(const NetworkData::OnMeshPrefixConfig &aConfig) const;
     void        Update(UpdateMode aMode);
-    void        GetIidSecretKey(IidSecretKey &aKey) const;
+    void        GetIidSecretKey(IidSecretKey &aKey);
     void        HandleNotifierEvents(Events aEvents);
     static bool DoesConfigMatchNetifAddr(const NetworkData::OnMeshPrefixConfig &aConfig,
                                          const Ip6::Netif::UnicastAddress &     aAddr);
 
     bool                       mEnabled;
+    bool                       mHasIidSecretKey;
+    bool                       mHasPrefixUsingOtherAddress;
     otIp6SlaacPrefixFilter     mFilter;
-    Ip6::Netif::UnicastAddress mAddresses[OPENTHREAD_CONFIG_IP6_SLAAC_NUM_ADDRESSES];
+    Ip6::Netif::UnicastAddress mAddresses[kNumAddresses];
+    IidSecretKey               mIidSecretKey;
+#if OPENTHREAD_CONFIG_IP6_SLAAC_IID_CACHE_SIZE > 0
+    IidCacheEntry mIidCache[kIidCacheSize];
+    uint32_t      mIidCacheUseStamp;
+#endif
 };
 
 /**
@@ -68,11 +68,13 @@ namespace {
 struct Config
 {
     const char *mNetifName;
+    bool        mPipeline;
 };
 
 enum
 {
-    kLineBufferSize = OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH,
+    kLineBufferSize       = OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH,
+    kMaxPipelinedCommands = 16,
 };
 
 static_assert(kLineBufferSize >= sizeof("> "), "kLineBufferSize is too small");
@@ -208,15 +210,93 @@ exit:
     return ok;
 }
 
+bool IsResultLine(const char *aLine)
+{
+    // Skip the request ID of a pipelined command ("@<id> ").
+    if (*aLine == '@')
+    {
+        const char *separator = strchr(aLine, ' ');
+
+        if (separator != nullptr)
+        {
+            aLine = separator + 1;
+        }
+    }
+
+    return (strncmp("Done\n", aLine, 5) == 0 || strncmp("Done\r\n", aLine, 6) == 0 || strncmp("Error ", aLine, 6) == 0);
+}
+
+bool IsEmptyLine(const char *aLine, size_t aLength)
+{
+    bool isEmpty = true;
+
+    for (size_t i = 0; i < aLength; i++)
+    {
+        VerifyOrExit(aLine[i] == ' ' || aLine[i] == '\t' || aLine[i] == '\r' || aLine[i] == '\n', isEmpty = false);
+    }
+
+exit:
+    return isEmpty;
+}
+
+/**
+ * This function sends the complete command lines buffered from stdin over the session, as long as less than
+ * `kMaxPipelinedCommands` commands are waiting for their result.
+ *
+ */
+bool SendPipelinedCommands(char *aBuffer, size_t &aLength, bool aIsEof, uint16_t &aNumInFlight)
+{
+    bool ok = true;
+
+    while (aNumInFlight < kMaxPipelinedCommands && aLength > 0)
+    {
+        const char *lineEnd = static_cast<const char *>(memchr(aBuffer, '\n', aLength));
+        size_t      lineLength;
+
+        if (lineEnd != nullptr)
+        {
+            lineLength = static_cast<size_t>(lineEnd - aBuffer) + 1;
+        }
+        else if (aIsEof || aLength == kLineBufferSize)
+        {
+            lineLength = aLength;
+        }
+        else
+        {
+            break;
+        }
+
+        if (!IsEmptyLine(aBuffer, lineLength))
+        {
+            VerifyOrExit(DoWrite(sSessionFd, aBuffer, lineLength), ok = false);
+
+            if (lineEnd == nullptr)
+            {
+                VerifyOrExit(DoWrite(sSessionFd, "\n", 1), ok = false);
+            }
+
+            aNumInFlight++;
+        }
+
+        aLength -= lineLength;
+        memmove(aBuffer, aBuffer + lineLength, aLength);
+    }
+
+exit:
+    return ok;
+}
+
 enum
 {
     kOptInterfaceName = 'I',
     kOptHelp          = 'h',
+    kOptPipeline      = 'p',
 };
 
 const struct option kOptions[] = {
     {"interface-name", required_argument, NULL, kOptInterfaceName},
     {"help", required_argument, NULL, kOptHelp},
+    {"pipeline", no_argument, NULL, kOptPipeline},
 };
 
 void PrintUsage(const char *aProgramName, FILE *aStream, int aExitCode)
@@ -226,8 +306,10 @@ void PrintUsage(const char *aProgramName, FILE *aStream, int aExitCode)
             "    %s [Options] [--] ...\n"
             "Options:\n"
             "    -h  --help                    Display this usage information.\n"
-            "    -I  --interface-name name     Thread network interface name.\n",
-            aProgramName);
+            "    -I  --interface-name name     Thread network interface name.\n"
+            "    -p  --pipeline                Run the commands read from stdin (one per line) over a single\n"
+            "                                  session, pipelining up to %d of them.\n",
+            aProgramName, kMaxPipelinedCommands);
     exit(aExitCode);
 }
 
@@ -238,11 +320,11 @@ static bool ShouldEscape(char aChar)
 
 Config ParseArg(int &aArgCount, char **&aArgVector)
 {
-    Config config = {"wpan0"};
+    Config config = {"wpan0", false};
 
     optind = 1;
 
-    for (int index, option; (option = getopt_long(aArgCount, aArgVector, "+I:h", kOptions, &index)) != -1;)
+    for (int index, option; (option = getopt_long(aArgCount, aArgVector, "+I:hp", kOptions, &index)) != -1;)
     {
         switch (option)
         {
@@ -252,12 +334,20 @@ Config ParseArg(int &aArgCount, char **&aArgVector)
         case kOptHelp:
             PrintUsage(aArgVector[0], stdout, OT_EXIT_SUCCESS);
             break;
+        case kOptPipeline:
+            config.mPipeline = true;
+            break;
         default:
             PrintUsage(aArgVector[0], stderr, OT_EXIT_FAILURE);
             break;
         }
     }
 
+    if (config.mPipeline && aArgCount > optind)
+    {
+        PrintUsage(aArgVector[0], stderr, OT_EXIT_FAILURE);
+    }
+
     aArgCount -= optind;
     aArgVector += optind;
 
@@ -268,13 +358,17 @@ Config ParseArg(int &aArgCount, char **&aArgVector)
 
 int main(int argc, char *argv[])
 {
-    bool   isInteractive = true;
-    bool   isFinished    = false;
-    bool   isBeginOfLine = true;
-    char   lineBuffer[kLineBufferSize];
-    size_t lineBufferWritePos = 0;
-    int    ret;
-    Config config;
+    bool     isInteractive = true;
+    bool     isFinished    = false;
+    bool     isBeginOfLine = true;
+    char     lineBuffer[kLineBufferSize];
+    size_t   lineBufferWritePos = 0;
+    char     inputBuffer[kLineBufferSize];
+    size_t   inputLength = 0;
+    bool     isInputEof  = false;
+    uint16_t numInFlight = 0;
+    int      ret;
+    Config   config;
 
     config = ParseArg(argc, argv);
 
@@ -303,14 +397,19 @@ int main(int argc, char *argv[])
             buffer[count++] = ' ';
         }
 
-        // ignore the trailing space
+        // replace the trailing space with the line terminator
         if (--count)
         {
+            buffer[count++] = '\n';
             VerifyOrExit(DoWrite(sSessionFd, buffer, count), ret = OT_EXIT_FAILURE);
         }
 
         isInteractive = false;
     }
+    else if (config.mPipeline)
+    {
+        isInteractive = false;
+    }
 #if OPENTHREAD_USE_READLINE
     else
     {
@@ -332,6 +431,26 @@ int main(int argc, char *argv[])
 
         FD_SET(sSessionFd, &readFdSet);
 
+        if (config.mPipeline)
+        {
+            VerifyOrExit(SendPipelinedCommands(inputBuffer, inputLength, isInputEof, numInFlight),
+                         ret = OT_EXIT_FAILURE);
+
+            if (isInputEof && inputLength == 0 && numInFlight == 0)
+            {
+                ExitNow(ret = OT_EXIT_SUCCESS);
+            }
+
+            if (!isInputEof && inputLength < sizeof(inputBuffer))
+            {
+                FD_SET(STDIN_FILENO, &readFdSet);
+                if (STDIN_FILENO > maxFd)
+                {
+                    maxFd = STDIN_FILENO;
+                }
+            }
+        }
+
         if (isInteractive)
         {
             FD_SET(STDIN_FILENO, &readFdSet);
@@ -362,6 +481,21 @@ int main(int argc, char *argv[])
 #endif
         }
 
+        if (config.mPipeline && FD_ISSET(STDIN_FILENO, &readFdSet))
+        {
+            ssize_t rval = read(STDIN_FILENO, &inputBuffer[inputLength], sizeof(inputBuffer) - inputLength);
+            VerifyOrExit(rval != -1, perror("read"); ret = OT_EXIT_FAILURE);
+
+            if (rval == 0)
+            {
+                isInputEof = true;
+            }
+            else
+            {
+                inputLength += static_cast<size_t>(rval);
+            }
+        }
+
         if (FD_ISSET(sSessionFd, &readFdSet))
         {
             ssize_t rval = read(sSessionFd, buffer, sizeof(buffer));
@@ -375,7 +509,7 @@ int main(int argc, char *argv[])
                     continue;
                 }
 
-                ExitNow(ret = isInteractive ? OT_EXIT_FAILURE : OT_EXIT_SUCCESS);
+                ExitNow(ret = (isInteractive || numInFlight > 0) ? OT_EXIT_FAILURE : OT_EXIT_SUCCESS);
             }
 
             if (isInteractive)
@@ -405,12 +539,18 @@ int main(int argc, char *argv[])
 
                         VerifyOrExit(DoWrite(STDOUT_FILENO, line, len), ret = OT_EXIT_FAILURE);
 
-                        if (isBeginOfLine && (strncmp("Done\n", line, 5) == 0 || strncmp("Done\r\n", line, 6) == 0 ||
-                                              strncmp("Error ", line, 6) == 0))
+                        if (isBeginOfLine && IsResultLine(line))
                         {
-                            isFinished = true;
-                            ret        = OT_EXIT_SUCCESS;
-                            break;
+                            if (config.mPipeline)
+                            {
+                                numInFlight -= (numInFlight > 0) ? 1 : 0;
+                            }
+                            else
+                            {
+                                isFinished = true;
+                                ret        = OT_EXIT_SUCCESS;
+                                break;
+                            }
                         }
 
                         // reset for next line
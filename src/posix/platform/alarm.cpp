@@ -50,12 +50,41 @@ static uint32_t sUsAlarm     = 0;
 
 static uint32_t sSpeedUpFactor = 1;
 
+#if OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+
+#if !defined(__linux__) || OPENTHREAD_POSIX_VIRTUAL_TIME
+#error "OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE requires Linux and is not supported with virtual time"
+#endif
+
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+struct AlarmTimerFd
+{
+    const char *mName;
+    int         mFd;
+    bool        mArmed;
+    uint32_t    mArmedAlarm; // The alarm time (in alarm units) the timerfd is armed for.
+    uint32_t    mWakeups;    // Number of wakeups from the timerfd since jitter stats were last logged.
+    uint64_t    mTotalDelay; // Total delay (in usec) between alarm fire time and processing time.
+    uint32_t    mMaxDelay;   // Max delay (in usec) between alarm fire time and processing time.
+};
+
+static AlarmTimerFd sMsTimerFd = {"milli", -1, false, 0, 0, 0, 0};
+
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+static AlarmTimerFd sUsTimerFd = {"micro", -1, false, 0, 0, 0, 0};
+#endif
+
+#endif // OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+
 #ifdef __linux__
 
 #include <signal.h>
 #include <time.h>
 
-#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE && !OPENTHREAD_POSIX_VIRTUAL_TIME
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE && !OPENTHREAD_POSIX_VIRTUAL_TIME && \
+    !OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
 static timer_t sMicroTimer;
 static int     sRealTimeSignal = 0;
 
@@ -67,7 +96,8 @@ static void microTimerHandler(int aSignal, siginfo_t *aSignalInfo, void *aUserCo
     OT_UNUSED_VARIABLE(aSignalInfo);
     OT_UNUSED_VARIABLE(aUserContext);
 }
-#endif // OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE && !OPENTHREAD_POSIX_VIRTUAL_TIME
+#endif // OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE && !OPENTHREAD_POSIX_VIRTUAL_TIME &&
+       // !OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
 #endif // __linux__
 
 #ifdef CLOCK_MONOTONIC_RAW
@@ -92,10 +122,175 @@ static uint64_t platformAlarmGetNow(void)
     return otPlatTimeGet() * sSpeedUpFactor;
 }
 
+#if OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+
+static void timerFdInit(AlarmTimerFd &aTimerFd)
+{
+    // timerfd does not support `CLOCK_MONOTONIC_RAW`, the timer is armed
+    // with a relative timeout computed from `OT_POSIX_CLOCK_ID` instead.
+    aTimerFd.mFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrDie(aTimerFd.mFd != -1, OT_EXIT_ERROR_ERRNO);
+
+    aTimerFd.mArmed = false;
+}
+
+static void timerFdDeinit(AlarmTimerFd &aTimerFd)
+{
+    VerifyOrExit(aTimerFd.mFd != -1);
+
+    close(aTimerFd.mFd);
+    aTimerFd.mFd = -1;
+
+exit:
+    return;
+}
+
+static void timerFdSet(AlarmTimerFd &aTimerFd, uint64_t aTimeout)
+{
+    // A zero `aTimeout` disarms the timer.
+
+    struct itimerspec its;
+
+    its.it_value.tv_sec     = static_cast<time_t>(aTimeout / US_PER_S);
+    its.it_value.tv_nsec    = static_cast<long>((aTimeout % US_PER_S) * NS_PER_US);
+    its.it_interval.tv_sec  = 0;
+    its.it_interval.tv_nsec = 0;
+
+    if (timerfd_settime(aTimerFd.mFd, 0, &its, nullptr) == -1)
+    {
+        otLogWarnPlat("Failed to update %s alarm timer: %s", aTimerFd.mName, strerror(errno));
+    }
+
+    aTimerFd.mArmed = (aTimeout != 0);
+}
+
+static void timerFdUpdate(AlarmTimerFd &  aTimerFd,
+                          bool            aIsRunning,
+                          uint32_t        aAlarm,
+                          int64_t         aRemaining,
+                          uint32_t        aSlack,
+                          fd_set *        aReadFdSet,
+                          int *           aMaxFd,
+                          struct timeval *aTimeout)
+{
+    // `aRemaining` is the time (in usec, scaled by the speed up factor)
+    // until `aAlarm` fires.
+
+    if (!aIsRunning)
+    {
+        if (aTimerFd.mArmed)
+        {
+            timerFdSet(aTimerFd, 0);
+        }
+
+        ExitNow();
+    }
+
+    if (aRemaining <= 0)
+    {
+        aTimeout->tv_sec  = 0;
+        aTimeout->tv_usec = 0;
+        ExitNow();
+    }
+
+    if (!aTimerFd.mArmed || (aTimerFd.mArmedAlarm != aAlarm))
+    {
+        uint64_t timeout = static_cast<uint64_t>(aRemaining) / sSpeedUpFactor;
+
+        if (aSlack > 1)
+        {
+            // Round the expiry time up to a multiple of the slack.
+            uint64_t now    = otPlatTimeGet();
+            uint64_t expiry = now + timeout;
+
+            expiry  = ((expiry + aSlack - 1) / aSlack) * aSlack;
+            timeout = expiry - now;
+        }
+
+        timerFdSet(aTimerFd, OT_MAX(timeout, static_cast<uint64_t>(1)));
+        aTimerFd.mArmedAlarm = aAlarm;
+    }
+
+    FD_SET(aTimerFd.mFd, aReadFdSet);
+
+    if (aMaxFd != nullptr && *aMaxFd < aTimerFd.mFd)
+    {
+        *aMaxFd = aTimerFd.mFd;
+    }
+
+exit:
+    return;
+}
+
+static bool timerFdProcess(AlarmTimerFd &aTimerFd, const fd_set *aReadFdSet)
+{
+    // Returns whether the timerfd has expired, i.e. the process was
+    // woken up by it (and not by another event).
+
+    bool     expired = false;
+    uint64_t expirations;
+
+    VerifyOrExit((aTimerFd.mFd != -1) && (aReadFdSet != nullptr) && FD_ISSET(aTimerFd.mFd, aReadFdSet));
+
+    // Reading clears the readable state. The timer is re-armed in the
+    // next `platformAlarmUpdateFdSet()` if the alarm is still pending
+    // (e.g., the timer expired early due to the clock difference).
+    expired         = (read(aTimerFd.mFd, &expirations, sizeof(expirations)) == sizeof(expirations));
+    aTimerFd.mArmed = false;
+
+exit:
+    return expired;
+}
+
+static void timerFdLogJitter(AlarmTimerFd &aTimerFd)
+{
+    VerifyOrExit(aTimerFd.mWakeups != 0);
+
+    otLogInfoPlat("Alarm %s wakeup jitter: avg %luus, max %luus over %lu wakeups", aTimerFd.mName,
+                  static_cast<unsigned long>(aTimerFd.mTotalDelay / aTimerFd.mWakeups),
+                  static_cast<unsigned long>(aTimerFd.mMaxDelay), static_cast<unsigned long>(aTimerFd.mWakeups));
+
+    aTimerFd.mWakeups    = 0;
+    aTimerFd.mTotalDelay = 0;
+    aTimerFd.mMaxDelay   = 0;
+
+exit:
+    return;
+}
+
+static void timerFdRecordJitter(AlarmTimerFd &aTimerFd, uint64_t aDelay)
+{
+    // `aDelay` is the time (in usec, scaled by the speed up factor)
+    // between the alarm fire time and its processing.
+
+    uint32_t delay = static_cast<uint32_t>(OT_MIN(aDelay / sSpeedUpFactor, static_cast<uint64_t>(UINT32_MAX)));
+
+    aTimerFd.mWakeups++;
+    aTimerFd.mTotalDelay += delay;
+    aTimerFd.mMaxDelay = OT_MAX(aTimerFd.mMaxDelay, delay);
+
+    if (aTimerFd.mWakeups >= OPENTHREAD_POSIX_CONFIG_ALARM_JITTER_LOG_INTERVAL)
+    {
+        timerFdLogJitter(aTimerFd);
+    }
+}
+
+#endif // OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+
 void platformAlarmInit(uint32_t aSpeedUpFactor, int aRealTimeSignal)
 {
     sSpeedUpFactor = aSpeedUpFactor;
 
+#if OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+    // Microsecond alarms are driven by their own timerfd, no real time
+    // signal is needed.
+    OT_UNUSED_VARIABLE(aRealTimeSignal);
+
+    timerFdInit(sMsTimerFd);
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    timerFdInit(sUsTimerFd);
+#endif
+#else
     if (aRealTimeSignal == 0)
     {
 #if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
@@ -129,6 +324,19 @@ void platformAlarmInit(uint32_t aSpeedUpFactor, int aRealTimeSignal)
     {
         DieNow(OT_EXIT_INVALID_ARGUMENTS);
     }
+#endif // OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+}
+
+void platformAlarmDeinit(void)
+{
+#if OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+    timerFdLogJitter(sMsTimerFd);
+    timerFdDeinit(sMsTimerFd);
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    timerFdLogJitter(sUsTimerFd);
+    timerFdDeinit(sUsTimerFd);
+#endif
+#endif
 }
 
 uint32_t otPlatAlarmMilliGetNow(void)
@@ -164,7 +372,7 @@ void otPlatAlarmMicroStartAt(otInstance *aInstance, uint32_t aT0, uint32_t aDt)
     sUsAlarm     = aT0 + aDt;
     sIsUsRunning = true;
 
-#ifdef __linux__
+#if defined(__linux__) && !OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
     if (sRealTimeSignal != 0)
     {
         struct itimerspec its;
@@ -190,7 +398,7 @@ void otPlatAlarmMicroStop(otInstance *aInstance)
 
     sIsUsRunning = false;
 
-#ifdef __linux__
+#if defined(__linux__) && !OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
     if (sRealTimeSignal != 0)
     {
         struct itimerspec its = {{0, 0}, {0, 0}};
@@ -254,10 +462,39 @@ exit:
     }
 }
 
-void platformAlarmProcess(otInstance *aInstance)
+#if OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+void platformAlarmUpdateFdSet(fd_set *aReadFdSet, int *aMaxFd, struct timeval *aTimeout)
+{
+    uint64_t now = platformAlarmGetNow();
+    int64_t  remaining;
+
+    assert(aReadFdSet != nullptr && aTimeout != nullptr);
+
+    remaining = (int32_t)(sMsAlarm - (uint32_t)(now / US_PER_MS));
+    remaining = remaining * US_PER_MS - static_cast<int64_t>(now % US_PER_MS);
+    timerFdUpdate(sMsTimerFd, sIsMsRunning, sMsAlarm, remaining, OPENTHREAD_POSIX_CONFIG_ALARM_MILLI_SLACK_US,
+                  aReadFdSet, aMaxFd, aTimeout);
+
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    remaining = (int32_t)(sUsAlarm - (uint32_t)now);
+    timerFdUpdate(sUsTimerFd, sIsUsRunning, sUsAlarm, remaining, /* aSlack */ 0, aReadFdSet, aMaxFd, aTimeout);
+#endif
+}
+#endif // OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+
+void platformAlarmProcess(otInstance *aInstance, const fd_set *aReadFdSet)
 {
     int32_t remaining;
 
+#if OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+    bool msWakeup = timerFdProcess(sMsTimerFd, aReadFdSet);
+#if OPENTHREAD_CONFIG_PLATFORM_USEC_TIMER_ENABLE
+    bool usWakeup = timerFdProcess(sUsTimerFd, aReadFdSet);
+#endif
+#else
+    OT_UNUSED_VARIABLE(aReadFdSet);
+#endif
+
     if (sIsMsRunning)
     {
         remaining = (int32_t)(sMsAlarm - otPlatAlarmMilliGetNow());
@@ -266,6 +503,14 @@ void platformAlarmProcess(otInstance *aInstance)
         {
             sIsMsRunning = false;
 
+#if OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+            if (msWakeup)
+            {
+                timerFdRecordJitter(sMsTimerFd, static_cast<uint64_t>(-remaining) * US_PER_MS +
+                                                    platformAlarmGetNow() % US_PER_MS);
+            }
+#endif
+
 #if OPENTHREAD_CONFIG_DIAG_ENABLE
 
             if (otPlatDiagModeGet())
@@ -290,6 +535,13 @@ void platformAlarmProcess(otInstance *aInstance)
         {
             sIsUsRunning = false;
 
+#if OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+            if (usWakeup)
+            {
+                timerFdRecordJitter(sUsTimerFd, static_cast<uint32_t>(-remaining));
+            }
+#endif
+
             otPlatAlarmMicroFired(aInstance);
         }
     }
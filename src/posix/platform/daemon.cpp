@@ -71,41 +71,195 @@ void GetFilename(Filename &aFilename, const char *aPattern)
 
 } // namespace
 
+Daemon::Daemon(void)
+{
+    for (Session &session : mSessions)
+    {
+        session.mSocket = -1;
+    }
+
+    mRequestId[0] = '\0';
+}
+
+bool Daemon::Session::HasCommand(void) const
+{
+    // In line mode a command is complete once its line terminator is
+    // received (or the input buffer is full). Clients which never
+    // terminate their command (e.g., older `ot-ctl` versions) write a
+    // single command at once, so all their received input is treated
+    // as a command.
+
+    return (mInputLength > 0) &&
+           (!mLineMode || (mInputLength == sizeof(mInput)) || (memchr(mInput, '\n', mInputLength) != nullptr) ||
+            (memchr(mInput, '\r', mInputLength) != nullptr));
+}
+
 int Daemon::OutputFormatV(const char *aFormat, va_list aArguments)
 {
-    char buf[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH + 1];
+    static constexpr size_t kOutputStringSize =
+        OT_MAX(OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH, OPENTHREAD_CONFIG_CLI_OUTPUT_BUFFER_SIZE) + 1;
+
+    char buf[kOutputStringSize];
     int  rval;
 
-    buf[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH] = '\0';
+    buf[kOutputStringSize - 1] = '\0';
 
     rval = vsnprintf(buf, sizeof(buf) - 1, aFormat, aArguments);
 
     VerifyOrExit(rval >= 0, otLogWarnPlat("Failed to format CLI output: %s", strerror(errno)));
 
-    VerifyOrExit(mSessionSocket != -1);
+    HandleOutput(buf, OT_MIN(static_cast<size_t>(rval), sizeof(buf) - 2));
+
+exit:
+    return rval;
+}
+
+void Daemon::HandleOutput(const char *aBuffer, size_t aLength)
+{
+    for (size_t i = 0; i < aLength; i++)
+    {
+        if (mOutputLineLength == sizeof(mOutputLine))
+        {
+            // The line is too long to be a command result, so we
+            // output it and continue as if it was a new line.
+            FlushOutputLine();
+            mOutputLineLength  = 0;
+            mOutputLineWritten = 0;
+        }
+
+        mOutputLine[mOutputLineLength++] = aBuffer[i];
+
+        if (aBuffer[i] == '\n')
+        {
+            HandleOutputLine();
+        }
+    }
+
+    // A partial line (e.g., the CLI prompt) is delivered right away,
+    // unless the output is tagged with a request ID, in which case
+    // only whole lines are written.
+
+    if (mRequestId[0] == '\0')
+    {
+        FlushOutputLine();
+    }
+}
+
+void Daemon::HandleOutputLine(void)
+{
+    const char *line   = mOutputLine;
+    uint16_t    length = mOutputLineLength;
+
+    if ((length >= 2) && (memcmp(line, "> ", 2) == 0))
+    {
+        line += 2;
+        length -= 2;
+    }
+
+    if (((length >= 5) && (memcmp(line, "Done", 4) == 0) && ((line[4] == '\r') || (line[4] == '\n'))) ||
+        ((length >= 6) && (memcmp(line, "Error ", 6) == 0)))
+    {
+        mCommandDone = mIsCommandActive;
+    }
+
+    FlushOutputLine();
+    mOutputLineLength  = 0;
+    mOutputLineWritten = 0;
+}
+
+void Daemon::FlushOutputLine(void)
+{
+    const char *start  = &mOutputLine[mOutputLineWritten];
+    uint16_t    length = mOutputLineLength - mOutputLineWritten;
+
+    VerifyOrExit(length > 0);
+
+    if ((mRequestId[0] != '\0') && (mOutputLineWritten == 0))
+    {
+        if ((length >= 2) && (memcmp(start, "> ", 2) == 0))
+        {
+            start += 2;
+            length -= 2;
+        }
+
+        WriteOutput("@", 1);
+        WriteOutput(mRequestId, strlen(mRequestId));
+        WriteOutput(" ", 1);
+    }
+
+    WriteOutput(start, length);
+
+exit:
+    mOutputLineWritten = mOutputLineLength;
+}
+
+void Daemon::WriteOutput(const char *aBuffer, size_t aLength)
+{
+    // The output of a command goes to the session which issued it,
+    // while any other output (e.g., logs) goes to all sessions.
+
+    if (mIsCommandActive)
+    {
+        if (mActiveSession != nullptr)
+        {
+            WriteOutput(*mActiveSession, aBuffer, aLength);
+        }
+    }
+    else
+    {
+        for (Session &session : mSessions)
+        {
+            WriteOutput(session, aBuffer, aLength);
+        }
+    }
+}
+
+void Daemon::WriteOutput(Session &aSession, const char *aBuffer, size_t aLength)
+{
+    ssize_t rval;
+
+    VerifyOrExit(aSession.IsOpen());
 
 #if defined(__linux__)
     // Don't die on SIGPIPE
-    rval = send(mSessionSocket, buf, static_cast<size_t>(rval), MSG_NOSIGNAL);
+    rval = send(aSession.mSocket, aBuffer, aLength, MSG_NOSIGNAL);
 #else
-    rval = static_cast<int>(write(mSessionSocket, buf, static_cast<size_t>(rval)));
+    rval = write(aSession.mSocket, aBuffer, aLength);
 #endif
 
     if (rval < 0)
     {
         otLogWarnPlat("Failed to write CLI output: %s", strerror(errno));
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        CloseSession(aSession);
     }
 
 exit:
-    return rval;
+    return;
+}
+
+void Daemon::CloseSession(Session &aSession)
+{
+    VerifyOrExit(aSession.IsOpen());
+
+    close(aSession.mSocket);
+    aSession.mSocket      = -1;
+    aSession.mInputLength = 0;
+
+    if (mActiveSession == &aSession)
+    {
+        // The output of the command in progress is discarded.
+        mActiveSession = nullptr;
+    }
+
+exit:
+    return;
 }
 
 void Daemon::InitializeSessionSocket(void)
 {
-    int newSessionSocket;
-    int rval;
+    Session *session = nullptr;
+    int      newSessionSocket;
+    int      rval;
 
     VerifyOrExit((newSessionSocket = accept(mListenSocket, nullptr, nullptr)) != -1, rval = -1);
 
@@ -128,11 +282,28 @@ void Daemon::InitializeSessionSocket(void)
 #endif
 #endif // __linux__
 
-    if (mSessionSocket != -1)
+    // Use a free session, or replace the oldest one if all are in use.
+
+    for (Session &candidate : mSessions)
     {
-        close(mSessionSocket);
+        if (!candidate.IsOpen())
+        {
+            session = &candidate;
+            break;
+        }
+
+        if ((session == nullptr) || (candidate.mConnectId < session->mConnectId))
+        {
+            session = &candidate;
+        }
     }
-    mSessionSocket = newSessionSocket;
+
+    CloseSession(*session);
+
+    session->mSocket      = newSessionSocket;
+    session->mConnectId   = ++mConnectCount;
+    session->mInputLength = 0;
+    session->mLineMode    = false;
 
 exit:
     if (rval == -1)
@@ -227,10 +398,7 @@ void Daemon::SetUp(void)
         DieNowWithMessage("bind", OT_EXIT_ERROR_ERRNO);
     }
 
-    //
-    // only accept 1 connection.
-    //
-    ret = listen(mListenSocket, 1);
+    ret = listen(mListenSocket, kMaxSessions);
     if (ret == -1)
     {
         DieNowWithMessage("listen", OT_EXIT_ERROR_ERRNO);
@@ -253,12 +421,15 @@ void Daemon::TearDown(void)
 {
     Mainloop::Manager::Get().Remove(*this);
 
-    if (mSessionSocket != -1)
+    for (Session &session : mSessions)
     {
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        CloseSession(session);
     }
 
+    FinishCommand();
+    mOutputLineLength  = 0;
+    mOutputLineWritten = 0;
+
     if (mListenSocket != -1)
     {
         close(mListenSocket);
@@ -295,24 +466,39 @@ void Daemon::Update(otSysMainloopContext &aContext)
         }
     }
 
-    if (mSessionSocket != -1)
+    for (Session &session : mSessions)
     {
-        FD_SET(mSessionSocket, &aContext.mReadFdSet);
-        FD_SET(mSessionSocket, &aContext.mErrorFdSet);
+        if (!session.IsOpen())
+        {
+            continue;
+        }
+
+        // Stop reading from a client whose input buffer is full, until
+        // its queued commands are processed.
+        if (session.mInputLength < sizeof(session.mInput))
+        {
+            FD_SET(session.mSocket, &aContext.mReadFdSet);
+        }
+
+        FD_SET(session.mSocket, &aContext.mErrorFdSet);
 
-        if (aContext.mMaxFd < mSessionSocket)
+        if (aContext.mMaxFd < session.mSocket)
         {
-            aContext.mMaxFd = mSessionSocket;
+            aContext.mMaxFd = session.mSocket;
         }
     }
 
-    return;
+    if (mCommandDone)
+    {
+        // A pending command completed (e.g., from a timer), so the
+        // next queued command can be processed right away.
+        aContext.mTimeout.tv_sec  = 0;
+        aContext.mTimeout.tv_usec = 0;
+    }
 }
 
 void Daemon::Process(const otSysMainloopContext &aContext)
 {
-    ssize_t rval;
-
     VerifyOrExit(mListenSocket != -1);
 
     if (FD_ISSET(mListenSocket, &aContext.mErrorFdSet))
@@ -324,34 +510,91 @@ void Daemon::Process(const otSysMainloopContext &aContext)
         InitializeSessionSocket();
     }
 
-    VerifyOrExit(mSessionSocket != -1);
-
-    if (FD_ISSET(mSessionSocket, &aContext.mErrorFdSet))
+    for (Session &session : mSessions)
     {
-        close(mSessionSocket);
-        mSessionSocket = -1;
+        if (!session.IsOpen())
+        {
+            continue;
+        }
+
+        if (FD_ISSET(session.mSocket, &aContext.mErrorFdSet))
+        {
+            CloseSession(session);
+        }
+        else if (FD_ISSET(session.mSocket, &aContext.mReadFdSet))
+        {
+            ReceiveInput(session);
+        }
     }
-    else if (FD_ISSET(mSessionSocket, &aContext.mReadFdSet))
-    {
-        uint8_t buffer[OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH];
 
-        // leave 1 byte for the null terminator
-        rval = read(mSessionSocket, buffer, sizeof(buffer) - 1);
+    ProcessCommands();
+
+exit:
+    return;
+}
+
+void Daemon::ReceiveInput(Session &aSession)
+{
+    char *  input = &aSession.mInput[aSession.mInputLength];
+    ssize_t rval;
+
+    rval = read(aSession.mSocket, input, sizeof(aSession.mInput) - aSession.mInputLength);
 
-        if (rval > 0)
+    if (rval > 0)
+    {
+        if ((memchr(input, '\n', static_cast<size_t>(rval)) != nullptr) ||
+            (memchr(input, '\r', static_cast<size_t>(rval)) != nullptr))
         {
-            buffer[rval] = '\0';
-            otLogInfoPlat("> %s", reinterpret_cast<const char *>(buffer));
-            otCliInputLine(reinterpret_cast<char *>(buffer));
+            aSession.mLineMode = true;
         }
-        else
+
+        aSession.mInputLength += static_cast<uint16_t>(rval);
+    }
+    else
+    {
+        if (rval < 0)
         {
-            if (rval < 0)
+            otLogWarnPlat("Daemon read: %s", strerror(errno));
+        }
+
+        CloseSession(aSession);
+    }
+}
+
+void Daemon::ProcessCommands(void)
+{
+    if (mCommandDone)
+    {
+        FinishCommand();
+    }
+
+    // Commands are processed one at a time, taking the next queued
+    // command from each session in turn.
+
+    while (!mIsCommandActive)
+    {
+        Session *session = nullptr;
+
+        for (uint8_t i = 0; i < kMaxSessions; i++)
+        {
+            Session &candidate = mSessions[(mNextSession + i) % kMaxSessions];
+
+            if (candidate.IsOpen() && candidate.HasCommand())
             {
-                otLogWarnPlat("Daemon read: %s", strerror(errno));
+                session = &candidate;
+                break;
             }
-            close(mSessionSocket);
-            mSessionSocket = -1;
+        }
+
+        VerifyOrExit(session != nullptr);
+
+        mNextSession = static_cast<uint8_t>((session - mSessions + 1) % kMaxSessions);
+
+        ProcessCommand(*session);
+
+        if (mCommandDone)
+        {
+            FinishCommand();
         }
     }
 
@@ -359,6 +602,99 @@ exit:
     return;
 }
 
+void Daemon::ProcessCommand(Session &aSession)
+{
+    char     line[kMaxLineLength];
+    char *   command = line;
+    uint16_t length  = 0;
+    uint16_t consumed;
+    bool     isEmpty = true;
+
+    while ((length < aSession.mInputLength) && (aSession.mInput[length] != '\r') && (aSession.mInput[length] != '\n'))
+    {
+        length++;
+    }
+
+    consumed = length;
+
+    if (consumed < aSession.mInputLength)
+    {
+        // Consume the line terminator ("\r", "\n" or "\r\n").
+        if ((aSession.mInput[consumed++] == '\r') && (consumed < aSession.mInputLength) &&
+            (aSession.mInput[consumed] == '\n'))
+        {
+            consumed++;
+        }
+    }
+
+    length = OT_MIN(length, static_cast<uint16_t>(sizeof(line) - 1));
+    memcpy(line, aSession.mInput, length);
+    line[length] = '\0';
+
+    aSession.mInputLength -= consumed;
+    memmove(aSession.mInput, &aSession.mInput[consumed], aSession.mInputLength);
+
+    // A command prefixed with "@<id> " is pipelined with a request ID.
+    // Each line of its output is then prefixed with "@<id> " as well
+    // (and the prompt is omitted).
+
+    mRequestId[0] = '\0';
+
+    if (line[0] == '@')
+    {
+        char * separator = strchr(line, ' ');
+        size_t idLength  = (separator != nullptr) ? static_cast<size_t>(separator - line - 1) : 0;
+
+        if ((idLength > 0) && (idLength < sizeof(mRequestId)))
+        {
+            memcpy(mRequestId, &line[1], idLength);
+            mRequestId[idLength] = '\0';
+            command              = separator + 1;
+        }
+    }
+
+    for (const char *c = command; *c != '\0'; c++)
+    {
+        if ((*c != ' ') && (*c != '\t'))
+        {
+            isEmpty = false;
+            break;
+        }
+    }
+
+    otLogInfoPlat("> %s", line);
+
+    if ((mOutputLineWritten == mOutputLineLength) ||
+        ((mOutputLineLength == 2) && (mOutputLineWritten == 0) && (memcmp(mOutputLine, "> ", 2) == 0)))
+    {
+        // Start the command output on a new line. Any partial line
+        // was already written, or it is the prompt following a command
+        // with a request ID (which is omitted).
+        mOutputLineLength  = 0;
+        mOutputLineWritten = 0;
+    }
+
+    mIsCommandActive = true;
+    mActiveSession   = &aSession;
+    mCommandDone     = false;
+
+    otCliInputLine(command);
+
+    if (isEmpty)
+    {
+        // An empty command line gives no result.
+        mCommandDone = true;
+    }
+}
+
+void Daemon::FinishCommand(void)
+{
+    mIsCommandActive = false;
+    mActiveSession   = nullptr;
+    mCommandDone     = false;
+    mRequestId[0]    = '\0';
+}
+
 Daemon &Daemon::Get(void)
 {
     static Daemon sInstance;
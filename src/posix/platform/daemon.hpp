@@ -30,6 +30,11 @@
 
 #include "openthread-posix-config.h"
 
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "cli/cli_config.h"
 #include "core/common/non_copyable.hpp"
 #include "posix/platform/mainloop.hpp"
 
@@ -47,12 +52,55 @@ public:
     void Process(const otSysMainloopContext &aContext) override;
 
 private:
+    static constexpr uint8_t  kMaxSessions      = OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS;
+    static constexpr uint16_t kInputBufferSize  = OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_INPUT_BUFFER_SIZE;
+    static constexpr uint16_t kMaxLineLength    = OPENTHREAD_CONFIG_CLI_MAX_LINE_LENGTH;
+    static constexpr uint8_t  kMaxRequestIdSize = 16; // Including the null char.
+
+    static_assert(kInputBufferSize >= kMaxLineLength, "Session input buffer is smaller than a command line");
+
+    Daemon(void);
+
+    // A client session. Command lines received from the client are
+    // queued in `mInput` and processed one at a time (across all
+    // sessions), so a client can pipeline multiple commands.
+    struct Session
+    {
+        bool IsOpen(void) const { return mSocket != -1; }
+        bool HasCommand(void) const;
+
+        int      mSocket;
+        uint32_t mConnectId;
+        uint16_t mInputLength;
+        bool     mLineMode;
+        char     mInput[kInputBufferSize];
+    };
+
     int  OutputFormatV(const char *aFormat, va_list aArguments);
     void InitializeSessionSocket(void);
+    void ReceiveInput(Session &aSession);
+    void ProcessCommands(void);
+    void ProcessCommand(Session &aSession);
+    void FinishCommand(void);
+    void HandleOutput(const char *aBuffer, size_t aLength);
+    void HandleOutputLine(void);
+    void FlushOutputLine(void);
+    void WriteOutput(const char *aBuffer, size_t aLength);
+    void WriteOutput(Session &aSession, const char *aBuffer, size_t aLength);
+    void CloseSession(Session &aSession);
 
-    int mListenSocket  = -1;
-    int mDaemonLock    = -1;
-    int mSessionSocket = -1;
+    int      mListenSocket = -1;
+    int      mDaemonLock   = -1;
+    Session  mSessions[kMaxSessions];
+    uint32_t mConnectCount  = 0;
+    uint8_t  mNextSession   = 0;
+    Session *mActiveSession   = nullptr;
+    bool     mIsCommandActive = false;
+    bool     mCommandDone     = false;
+    char     mRequestId[kMaxRequestIdSize];
+    char     mOutputLine[kMaxLineLength];
+    uint16_t mOutputLineLength  = 0;
+    uint16_t mOutputLineWritten = 0;
 };
 
 } // namespace Posix
@@ -36,10 +36,22 @@
 
 #include <string.h>
 
+#if defined(__linux__) && OPENTHREAD_POSIX_CONFIG_FIREWALL_ENABLE
+#include <assert.h>
+#include <errno.h>
+#include <linux/netfilter/ipset/ip_set.h>
+#include <linux/netfilter/nfnetlink.h>
+#include <linux/netlink.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
 #include <openthread/logging.h>
 #include <openthread/netdata.h>
+#include <openthread/platform/time.h>
 
 #include "common/code_utils.hpp"
+#include "posix/platform/platform-posix.h"
 #include "posix/platform/utils.hpp"
 
 namespace ot {
@@ -57,37 +69,279 @@ static const char kIngressDenySrcSwapIpSet[]  = "otbr-ingress-deny-src-swap";
 static const char kIngressAllowDstIpSet[]     = "otbr-ingress-allow-dst";
 static const char kIngressAllowDstSwapIpSet[] = "otbr-ingress-allow-dst-swap";
 
+/**
+ * This class updates ipsets.
+ *
+ * The ipset requests are sent to the kernel directly over a netfilter netlink socket. Requests are queued and sent
+ * together by `Commit()`, which waits for all of them to be acknowledged. If the netlink socket cannot be opened, the
+ * requests are executed right away with the `ipset` command instead.
+ *
+ */
 class IpSetManager
 {
 public:
+    IpSetManager(void);
+    ~IpSetManager(void);
+
     otError FlushIpSet(const char *aName);
-    otError AddToIpSet(const char *aSetName, const char *aAddress);
+    otError AddToIpSet(const char *aSetName, const otIp6Prefix &aPrefix);
     otError SwapIpSets(const char *aSetName1, const char *aSetName2);
+    otError Commit(void);
+
+private:
+    static constexpr size_t  kBufferSize     = 4096;
+    static constexpr size_t  kMaxMessageSize = 160; // Large enough for any request built below.
+    static constexpr uint8_t kIpSetProtocol  = 6;   // Accepted by all kernel versions.
+
+    otError          ReserveMessage(void);
+    struct nlmsghdr *BeginMessage(uint8_t aCommand);
+    void             EndMessage(struct nlmsghdr *aHeader);
+    void             AddAttr(struct nlmsghdr *aHeader, uint16_t aType, const void *aData, uint16_t aLength);
+    struct nlattr *  BeginNestedAttr(struct nlmsghdr *aHeader, uint16_t aType);
+    void             EndNestedAttr(struct nlmsghdr *aHeader, struct nlattr *aAttr);
+
+    int      mFd;
+    uint32_t mSequence;
+    uint16_t mPendingCount;
+    size_t   mLength;
+
+    union
+    {
+        struct nlmsghdr mHeader;
+        char            mData[kBufferSize];
+    } mBuffer;
 };
 
-inline otError IpSetManager::FlushIpSet(const char *aName)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-align"
+
+IpSetManager::IpSetManager(void)
+    : mFd(SocketWithCloseExec(AF_NETLINK, SOCK_RAW, NETLINK_NETFILTER, kSocketNonBlock))
+    , mSequence(0)
+    , mPendingCount(0)
+    , mLength(0)
 {
-    return ExecuteCommand("%s flush %s", kIpsetCommand, aName);
+    if (mFd < 0)
+    {
+        otLogWarnPlat("Failed to open netfilter netlink socket, fall back to `%s`: %s", kIpsetCommand,
+                      strerror(errno));
+    }
 }
 
-inline otError IpSetManager::AddToIpSet(const char *aSetName, const char *aAddress)
+IpSetManager::~IpSetManager(void)
 {
-    return ExecuteCommand("%s add %s %s -exist", kIpsetCommand, aSetName, aAddress);
+    if (mFd >= 0)
+    {
+        close(mFd);
+    }
 }
 
-inline otError IpSetManager::SwapIpSets(const char *aSetName1, const char *aSetName2)
+otError IpSetManager::ReserveMessage(void)
 {
-    return ExecuteCommand("%s swap %s %s", kIpsetCommand, aSetName1, aSetName2);
+    otError error = OT_ERROR_NONE;
+
+    if (kBufferSize - mLength < kMaxMessageSize)
+    {
+        error = Commit();
+    }
+
+    return error;
 }
 
+struct nlmsghdr *IpSetManager::BeginMessage(uint8_t aCommand)
+{
+    struct nlmsghdr *header   = reinterpret_cast<struct nlmsghdr *>(mBuffer.mData + mLength);
+    uint8_t          protocol = kIpSetProtocol;
+    struct nfgenmsg *genMsg;
+
+    memset(header, 0, NLMSG_LENGTH(sizeof(struct nfgenmsg)));
+
+    header->nlmsg_len   = NLMSG_LENGTH(sizeof(struct nfgenmsg));
+    header->nlmsg_type  = (NFNL_SUBSYS_IPSET << 8) | aCommand;
+    header->nlmsg_flags = NLM_F_REQUEST | NLM_F_ACK; // No `NLM_F_EXCL`, same as `-exist`.
+    header->nlmsg_seq   = ++mSequence;
+
+    genMsg               = reinterpret_cast<struct nfgenmsg *>(NLMSG_DATA(header));
+    genMsg->nfgen_family = AF_INET6;
+    genMsg->version      = NFNETLINK_V0;
+    genMsg->res_id       = 0;
+
+    AddAttr(header, IPSET_ATTR_PROTOCOL, &protocol, sizeof(protocol));
+
+    return header;
+}
+
+void IpSetManager::EndMessage(struct nlmsghdr *aHeader)
+{
+    assert(aHeader->nlmsg_len <= kMaxMessageSize);
+
+    mLength += NLMSG_ALIGN(aHeader->nlmsg_len);
+    mPendingCount++;
+}
+
+void IpSetManager::AddAttr(struct nlmsghdr *aHeader, uint16_t aType, const void *aData, uint16_t aLength)
+{
+    struct nlattr *attr = reinterpret_cast<struct nlattr *>(reinterpret_cast<char *>(aHeader) +
+                                                            NLMSG_ALIGN(aHeader->nlmsg_len));
+
+    attr->nla_type = aType;
+    attr->nla_len  = static_cast<uint16_t>(NLA_HDRLEN + aLength);
+    memcpy(reinterpret_cast<char *>(attr) + NLA_HDRLEN, aData, aLength);
+
+    aHeader->nlmsg_len = NLMSG_ALIGN(aHeader->nlmsg_len) + NLA_ALIGN(attr->nla_len);
+}
+
+struct nlattr *IpSetManager::BeginNestedAttr(struct nlmsghdr *aHeader, uint16_t aType)
+{
+    struct nlattr *attr = reinterpret_cast<struct nlattr *>(reinterpret_cast<char *>(aHeader) +
+                                                            NLMSG_ALIGN(aHeader->nlmsg_len));
+
+    AddAttr(aHeader, static_cast<uint16_t>(aType | NLA_F_NESTED), nullptr, 0);
+
+    return attr;
+}
+
+void IpSetManager::EndNestedAttr(struct nlmsghdr *aHeader, struct nlattr *aAttr)
+{
+    aAttr->nla_len = static_cast<uint16_t>(reinterpret_cast<char *>(aHeader) + aHeader->nlmsg_len -
+                                           reinterpret_cast<char *>(aAttr));
+}
+
+otError IpSetManager::FlushIpSet(const char *aName)
+{
+    otError          error = OT_ERROR_NONE;
+    struct nlmsghdr *header;
+
+    VerifyOrExit(mFd >= 0, error = ExecuteCommand("%s flush %s", kIpsetCommand, aName));
+
+    SuccessOrExit(error = ReserveMessage());
+
+    header = BeginMessage(IPSET_CMD_FLUSH);
+    AddAttr(header, IPSET_ATTR_SETNAME, aName, static_cast<uint16_t>(strlen(aName) + 1));
+    EndMessage(header);
+
+exit:
+    return error;
+}
+
+otError IpSetManager::AddToIpSet(const char *aSetName, const otIp6Prefix &aPrefix)
+{
+    otError          error = OT_ERROR_NONE;
+    struct nlmsghdr *header;
+    struct nlattr *  data;
+    struct nlattr *  ip;
+
+    if (mFd < 0)
+    {
+        char prefixBuf[OT_IP6_PREFIX_STRING_SIZE];
+
+        otIp6PrefixToString(&aPrefix, prefixBuf, sizeof(prefixBuf));
+        ExitNow(error = ExecuteCommand("%s add %s %s -exist", kIpsetCommand, aSetName, prefixBuf));
+    }
+
+    SuccessOrExit(error = ReserveMessage());
+
+    header = BeginMessage(IPSET_CMD_ADD);
+    AddAttr(header, IPSET_ATTR_SETNAME, aSetName, static_cast<uint16_t>(strlen(aSetName) + 1));
+
+    data = BeginNestedAttr(header, IPSET_ATTR_DATA);
+    ip   = BeginNestedAttr(header, IPSET_ATTR_IP);
+    AddAttr(header, static_cast<uint16_t>(IPSET_ATTR_IPADDR_IPV6 | NLA_F_NET_BYTEORDER), aPrefix.mPrefix.mFields.m8,
+            sizeof(aPrefix.mPrefix.mFields.m8));
+    EndNestedAttr(header, ip);
+    AddAttr(header, IPSET_ATTR_CIDR, &aPrefix.mLength, sizeof(aPrefix.mLength));
+    EndNestedAttr(header, data);
+
+    EndMessage(header);
+
+exit:
+    return error;
+}
+
+otError IpSetManager::SwapIpSets(const char *aSetName1, const char *aSetName2)
+{
+    otError          error = OT_ERROR_NONE;
+    struct nlmsghdr *header;
+
+    VerifyOrExit(mFd >= 0, error = ExecuteCommand("%s swap %s %s", kIpsetCommand, aSetName1, aSetName2));
+
+    SuccessOrExit(error = ReserveMessage());
+
+    header = BeginMessage(IPSET_CMD_SWAP);
+    AddAttr(header, IPSET_ATTR_SETNAME, aSetName1, static_cast<uint16_t>(strlen(aSetName1) + 1));
+    AddAttr(header, IPSET_ATTR_SETNAME2, aSetName2, static_cast<uint16_t>(strlen(aSetName2) + 1));
+    EndMessage(header);
+
+exit:
+    return error;
+}
+
+otError IpSetManager::Commit(void)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mLength > 0);
+
+    if (send(mFd, mBuffer.mData, mLength, 0) < 0)
+    {
+        otLogWarnPlat("Failed to send %u ipset requests: %s", mPendingCount, strerror(errno));
+        ExitNow(error = OT_ERROR_FAILED);
+    }
+
+    // The kernel processes the requests (and queues the acks) while
+    // sending, so the acks can be read without blocking.
+    while (mPendingCount > 0)
+    {
+        union
+        {
+            struct nlmsghdr header;
+            char            data[kBufferSize];
+        } buffer;
+        ssize_t length = recv(mFd, buffer.data, sizeof(buffer.data), 0);
+
+        if (length <= 0)
+        {
+            otLogWarnPlat("Failed to receive %u ipset acks: %s", mPendingCount, strerror(errno));
+            ExitNow(error = OT_ERROR_FAILED);
+        }
+
+        for (struct nlmsghdr *msg = &buffer.header; NLMSG_OK(msg, static_cast<size_t>(length));
+             msg                  = NLMSG_NEXT(msg, length))
+        {
+            const struct nlmsgerr *ack;
+
+            if (msg->nlmsg_type != NLMSG_ERROR)
+            {
+                continue;
+            }
+
+            ack = reinterpret_cast<const struct nlmsgerr *>(NLMSG_DATA(msg));
+            mPendingCount--;
+
+            if (ack->error != 0)
+            {
+                otLogWarnPlat("Failed to process ipset request#%u: %s", ack->msg.nlmsg_seq, strerror(-ack->error));
+                error = OT_ERROR_FAILED;
+            }
+        }
+    }
+
+exit:
+    mLength       = 0;
+    mPendingCount = 0;
+    return error;
+}
+
+#pragma GCC diagnostic pop
+
 void UpdateIpSets(otInstance *aInstance)
 {
     otError               error    = OT_ERROR_NONE;
     otNetworkDataIterator iterator = OT_NETWORK_DATA_ITERATOR_INIT;
     otBorderRouterConfig  config;
     otIp6Prefix           prefix;
-    char                  prefixBuf[OT_IP6_PREFIX_STRING_SIZE];
     IpSetManager          ipSetManager;
+    uint64_t              startTime = otPlatTimeGet();
 
     // 1. Flush the '*-swap' ipsets
     SuccessOrExit(error = ipSetManager.FlushIpSet(kIngressAllowDstSwapIpSet));
@@ -100,26 +354,29 @@ void UpdateIpSets(otInstance *aInstance)
         {
             continue;
         }
-        otIp6PrefixToString(&config.mPrefix, prefixBuf, sizeof(prefixBuf));
-        SuccessOrExit(error = ipSetManager.AddToIpSet(kIngressDenySrcSwapIpSet, prefixBuf));
+        SuccessOrExit(error = ipSetManager.AddToIpSet(kIngressDenySrcSwapIpSet, config.mPrefix));
     }
     memcpy(prefix.mPrefix.mFields.m8, otThreadGetMeshLocalPrefix(aInstance)->m8,
            sizeof(otThreadGetMeshLocalPrefix(aInstance)->m8));
     prefix.mLength = OT_IP6_PREFIX_BITSIZE;
-    otIp6PrefixToString(&prefix, prefixBuf, sizeof(prefixBuf));
-    SuccessOrExit(error = ipSetManager.AddToIpSet(kIngressDenySrcSwapIpSet, prefixBuf));
+    SuccessOrExit(error = ipSetManager.AddToIpSet(kIngressDenySrcSwapIpSet, prefix));
 
     // 3. Update otbr-allow-dst-swap
     iterator = OT_NETWORK_DATA_ITERATOR_INIT;
     while (otNetDataGetNextOnMeshPrefix(aInstance, &iterator, &config) == OT_ERROR_NONE)
     {
-        otIp6PrefixToString(&config.mPrefix, prefixBuf, sizeof(prefixBuf));
-        SuccessOrExit(error = ipSetManager.AddToIpSet(kIngressAllowDstSwapIpSet, prefixBuf));
+        SuccessOrExit(error = ipSetManager.AddToIpSet(kIngressAllowDstSwapIpSet, config.mPrefix));
     }
 
+    // Make sure the '*-swap' ipsets are complete before swapping them.
+    SuccessOrExit(error = ipSetManager.Commit());
+
     // 4. Swap ipsets to let them take effect
     SuccessOrExit(error = ipSetManager.SwapIpSets(kIngressDenySrcSwapIpSet, kIngressDenySrcIpSet));
     SuccessOrExit(error = ipSetManager.SwapIpSets(kIngressAllowDstSwapIpSet, kIngressAllowDstIpSet));
+    SuccessOrExit(error = ipSetManager.Commit());
+
+    otLogInfoPlat("Updated ipsets in %luus", static_cast<unsigned long>(otPlatTimeGet() - startTime));
 
 exit:
     if (error != OT_ERROR_NONE)
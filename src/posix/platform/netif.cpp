@@ -192,6 +192,21 @@ using namespace ot::Posix::Ip6Utils;
 
 #if defined(__linux__)
 static uint32_t sNetlinkSequence = 0; ///< Netlink message sequence.
+
+// Netlink requests (address and route updates) are queued and sent
+// together in a single `send()` before the mainloop sleeps.
+static constexpr size_t kNetlinkBatchSize = 4096;
+
+static union
+{
+    struct nlmsghdr header;
+    char            buffer[kNetlinkBatchSize];
+} sNetlinkBatch;
+
+static size_t   sNetlinkBatchLength   = 0; ///< Length of the queued requests.
+static uint16_t sNetlinkBatchCount    = 0; ///< Number of the queued requests.
+static uint32_t sNetlinkBatchLastSeq  = 0; ///< Sequence of the last request in the last sent batch.
+static uint64_t sNetlinkBatchSentTime = 0; ///< The time (in usec) the last batch was sent.
 #endif
 
 #if OPENTHREAD_POSIX_CONFIG_INSTALL_OMR_ROUTES_ENABLE && __linux__
@@ -353,6 +368,46 @@ void AddRtAttrUint32(struct nlmsghdr *aHeader, uint32_t aMaxLen, uint8_t aType,
     AddRtAttr(aHeader, aMaxLen, aType, &aData, sizeof(aData));
 }
 
+static void SendNetlinkBatch(void)
+{
+    VerifyOrExit(sNetlinkBatchLength > 0);
+
+    if (send(sNetlinkFd, sNetlinkBatch.buffer, sNetlinkBatchLength, 0) < 0)
+    {
+        VerifyOrDie(errno == EAGAIN || errno == EINTR || errno == EWOULDBLOCK, OT_EXIT_ERROR_ERRNO);
+        otLogWarnPlat("[netif] Failed to send %u netlink requests: %s", sNetlinkBatchCount, strerror(errno));
+    }
+    else
+    {
+        sNetlinkBatchLastSeq  = sNetlinkSequence;
+        sNetlinkBatchSentTime = otPlatTimeGet();
+        otLogDebgPlat("[netif] Sent %u netlink requests (%u bytes)", sNetlinkBatchCount,
+                      static_cast<unsigned int>(sNetlinkBatchLength));
+    }
+
+    sNetlinkBatchLength = 0;
+    sNetlinkBatchCount  = 0;
+
+exit:
+    return;
+}
+
+static void QueueNetlinkRequest(const struct nlmsghdr &aRequest)
+{
+    size_t length = NLMSG_ALIGN(aRequest.nlmsg_len);
+
+    assert(length <= kNetlinkBatchSize);
+
+    if (sNetlinkBatchLength + length > kNetlinkBatchSize)
+    {
+        SendNetlinkBatch();
+    }
+
+    memcpy(sNetlinkBatch.buffer + sNetlinkBatchLength, &aRequest, aRequest.nlmsg_len);
+    sNetlinkBatchLength += length;
+    sNetlinkBatchCount++;
+}
+
 #if OPENTHREAD_POSIX_CONFIG_INSTALL_OMR_ROUTES_ENABLE
 static bool IsOmrAddress(otInstance *aInstance, const otIp6AddressInfo &aAddressInfo)
 {
@@ -420,16 +475,9 @@ static void UpdateUnicastLinux(otInstance *aInstance, const otIp6AddressInfo &aA
 #endif
     }
 
-    if (send(sNetlinkFd, &req, req.nh.nlmsg_len, 0) != -1)
-    {
-        otLogInfoPlat("[netif] Sent request#%u to %s %s/%u", sNetlinkSequence, (aIsAdded ? "add" : "remove"),
-                      Ip6AddressString(aAddressInfo.mAddress).AsCString(), aAddressInfo.mPrefixLength);
-    }
-    else
-    {
-        otLogWarnPlat("[netif] Failed to send request#%u to %s %s/%u", sNetlinkSequence, (aIsAdded ? "add" : "remove"),
-                      Ip6AddressString(aAddressInfo.mAddress).AsCString(), aAddressInfo.mPrefixLength);
-    }
+    QueueNetlinkRequest(req.nh);
+    otLogInfoPlat("[netif] Queued request#%u to %s %s/%u", sNetlinkSequence, (aIsAdded ? "add" : "remove"),
+                  Ip6AddressString(aAddressInfo.mAddress).AsCString(), aAddressInfo.mPrefixLength);
 }
 
 #pragma GCC diagnostic pop
@@ -607,11 +655,8 @@ static otError AddRoute(const otIp6Prefix &aPrefix, uint32_t aPriority)
     AddRtAttrUint32(&req.header, sizeof(req), RTA_PRIORITY, aPriority);
     AddRtAttrUint32(&req.header, sizeof(req), RTA_OIF, netifIdx);
 
-    if (send(sNetlinkFd, &req, sizeof(req), 0) < 0)
-    {
-        VerifyOrExit(errno == EAGAIN || errno == EINTR || errno == EWOULDBLOCK, error = OT_ERROR_BUSY);
-        DieNow(OT_EXIT_ERROR_ERRNO);
-    }
+    QueueNetlinkRequest(req.header);
+
 exit:
     return error;
 }
@@ -655,11 +700,7 @@ static otError DeleteRoute(const otIp6Prefix &aPrefix)
     AddRtAttr(reinterpret_cast<nlmsghdr *>(&req), sizeof(req), RTA_DST, data, sizeof(data));
     AddRtAttrUint32(&req.header, sizeof(req), RTA_OIF, netifIdx);
 
-    if (send(sNetlinkFd, &req, sizeof(req), 0) < 0)
-    {
-        VerifyOrExit(errno == EAGAIN || errno == EINTR || errno == EWOULDBLOCK, error = OT_ERROR_BUSY);
-        DieNow(OT_EXIT_ERROR_ERRNO);
-    }
+    QueueNetlinkRequest(req.header);
 
 exit:
     return error;
@@ -1450,6 +1491,13 @@ static void processNetlinkEvent(otInstance *aInstance)
                 otLogWarnPlat("[netif] Failed to process request#%u: %s", err->msg.nlmsg_seq, strerror(err->error));
             }
 
+            if ((sNetlinkBatchSentTime != 0) && (err->msg.nlmsg_seq == sNetlinkBatchLastSeq))
+            {
+                otLogInfoPlat("[netif] Processed netlink requests up to #%u in %luus", sNetlinkBatchLastSeq,
+                              static_cast<unsigned long>(otPlatTimeGet() - sNetlinkBatchSentTime));
+                sNetlinkBatchSentTime = 0;
+            }
+
             break;
         }
 #endif
@@ -1810,6 +1858,10 @@ void platformNetifUpdateFdSet(fd_set *aReadFdSet, fd_set *aWriteFdSet, fd_set *a
     assert(sNetlinkFd >= 0);
     assert(sIpFd >= 0);
 
+#if defined(__linux__)
+    SendNetlinkBatch();
+#endif
+
     FD_SET(sTunFd, aReadFdSet);
     FD_SET(sTunFd, aErrorFdSet);
     FD_SET(sNetlinkFd, aReadFdSet);
@@ -71,6 +71,29 @@
 #define OPENTHREAD_POSIX_CONFIG_DAEMON_ENABLE 0
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS
+ *
+ * Define the maximum number of concurrent client sessions on the POSIX daemon socket.
+ *
+ * When all sessions are in use, a new client connection replaces the oldest session.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS
+#define OPENTHREAD_POSIX_CONFIG_DAEMON_MAX_SESSIONS 4
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_INPUT_BUFFER_SIZE
+ *
+ * Define the size (in bytes) of the per-session buffer holding command lines received from a daemon client and not
+ * yet processed (pipelined commands).
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_INPUT_BUFFER_SIZE
+#define OPENTHREAD_POSIX_CONFIG_DAEMON_SESSION_INPUT_BUFFER_SIZE 2048
+#endif
+
 /**
  * RCP bus UART.
  *
@@ -232,6 +255,82 @@
 #endif
 #endif
 
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE
+ *
+ * This setting configures the maximum number of datagrams read from a platform UDP socket with one `recvmmsg()` call
+ * (Linux only).
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_UDP_RX_BUDGET
+ *
+ * This setting configures the maximum number of datagrams received from all platform UDP sockets in one mainloop
+ * iteration, so that a burst on a socket does not delay other events.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_UDP_RX_BUDGET
+#define OPENTHREAD_POSIX_CONFIG_UDP_RX_BUDGET 32
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_UDP_TX_BATCH_SIZE
+ *
+ * This setting configures the maximum number of multicast datagrams queued on a platform UDP socket and sent together
+ * with one `sendmmsg()` call (Linux only).
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_UDP_TX_BATCH_SIZE
+#define OPENTHREAD_POSIX_CONFIG_UDP_TX_BATCH_SIZE 8
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+ *
+ * Define as 1 to use timerfd (Linux only) for millisecond and microsecond alarms.
+ *
+ * Each alarm gets its own timer file descriptor which is added to the mainloop read set, instead of shortening the
+ * `select()` timeout. This allows precise microsecond alarms without a real time signal, coalescing of millisecond
+ * alarms (see `OPENTHREAD_POSIX_CONFIG_ALARM_MILLI_SLACK_US`), and measurement of the wakeup jitter.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+#define OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_ALARM_MILLI_SLACK_US
+ *
+ * This setting configures the slack (in microseconds) allowed when arming the millisecond alarm timerfd.
+ *
+ * The expiry time is rounded up to a multiple of the slack, so that millisecond alarms and other timers of the system
+ * aligned on the same boundary expire together and the process wakes up less often. Microsecond alarms are never
+ * delayed. Zero disables the rounding.
+ *
+ * Applicable only when `OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_ALARM_MILLI_SLACK_US
+#define OPENTHREAD_POSIX_CONFIG_ALARM_MILLI_SLACK_US 0
+#endif
+
+/**
+ * @def OPENTHREAD_POSIX_CONFIG_ALARM_JITTER_LOG_INTERVAL
+ *
+ * This setting configures the number of timerfd wakeups after which the alarm wakeup jitter (average and maximum
+ * delay between the alarm fire time and the time it is processed) is logged and reset.
+ *
+ * Applicable only when `OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE` is set.
+ *
+ */
+#ifndef OPENTHREAD_POSIX_CONFIG_ALARM_JITTER_LOG_INTERVAL
+#define OPENTHREAD_POSIX_CONFIG_ALARM_JITTER_LOG_INTERVAL 1000
+#endif
+
 #ifdef __APPLE__
 
 /**
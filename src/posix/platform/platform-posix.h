@@ -116,13 +116,34 @@ void platformAlarmInit(uint32_t aSpeedUpFactor, int aRealTimeSignal);
  */
 void platformAlarmUpdateTimeout(struct timeval *tv);
 
+/**
+ * This function deinitializes the alarm service used by OpenThread.
+ *
+ */
+void platformAlarmDeinit(void);
+
+#if OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+/**
+ * This function arms the alarm timer file descriptors and updates the file descriptor sets with them.
+ *
+ * This is used instead of `platformAlarmUpdateTimeout()` when timerfd alarms are enabled.
+ *
+ * @param[inout]  aReadFdSet  A pointer to the read file descriptors.
+ * @param[inout]  aMaxFd      A pointer to the max file descriptor.
+ * @param[inout]  aTimeout    A pointer to the timeout (only cleared if an alarm is already due).
+ *
+ */
+void platformAlarmUpdateFdSet(fd_set *aReadFdSet, int *aMaxFd, struct timeval *aTimeout);
+#endif
+
 /**
  * This function performs alarm driver processing.
  *
- * @param[in]  aInstance  The OpenThread instance structure.
+ * @param[in]  aInstance   The OpenThread instance structure.
+ * @param[in]  aReadFdSet  A pointer to the read file descriptors.
  *
  */
-void platformAlarmProcess(otInstance *aInstance);
+void platformAlarmProcess(otInstance *aInstance, const fd_set *aReadFdSet);
 
 /**
  * This function returns the next alarm event time.
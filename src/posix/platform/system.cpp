@@ -240,6 +240,7 @@ void platformDeinit(void)
     virtualTimeDeinit();
 #endif
     platformRadioDeinit();
+    platformAlarmDeinit();
 
     // For Dry-Run option, only the radio is initialized.
     VerifyOrExit(!gDryRun);
@@ -313,7 +314,11 @@ void otSysMainloopUpdate(otInstance *aInstance, otSysMainloopContext *aMainloop)
 {
     ot::Posix::Mainloop::Manager::Get().Update(*aMainloop);
 
+#if OPENTHREAD_POSIX_CONFIG_ALARM_TIMERFD_ENABLE
+    platformAlarmUpdateFdSet(&aMainloop->mReadFdSet, &aMainloop->mMaxFd, &aMainloop->mTimeout);
+#else
     platformAlarmUpdateTimeout(&aMainloop->mTimeout);
+#endif
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
     platformNetifUpdateFdSet(&aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet,
                              &aMainloop->mMaxFd);
@@ -390,7 +395,7 @@ void otSysMainloopProcess(otInstance *aInstance, const otSysMainloopContext *aMa
 #if OPENTHREAD_CONFIG_RADIO_LINK_TREL_ENABLE
     platformTrelProcess(aInstance, &aMainloop->mReadFdSet, &aMainloop->mWriteFdSet);
 #endif
-    platformAlarmProcess(aInstance);
+    platformAlarmProcess(aInstance, &aMainloop->mReadFdSet);
 #if OPENTHREAD_CONFIG_PLATFORM_NETIF_ENABLE
     platformNetifProcess(&aMainloop->mReadFdSet, &aMainloop->mWriteFdSet, &aMainloop->mErrorFdSet);
 #endif
@@ -85,51 +85,86 @@ bool IsMulticast(const otIp6Address &aAddress)
     return aAddress.mFields.m8[0] == 0xff;
 }
 
-otError transmitPacket(int aFd, uint8_t *aPayload, uint16_t aLength, const otMessageInfo &aMessageInfo)
-{
 #ifdef __APPLE__
-    // use fixed value for CMSG_SPACE is not a constant expression on macOS
-    constexpr size_t kBufferSize = 128;
+// use fixed value for CMSG_SPACE is not a constant expression on macOS
+constexpr size_t kControlSize = 128;
 #else
-    constexpr size_t kBufferSize = CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int));
+constexpr size_t kControlSize = CMSG_SPACE(sizeof(struct in6_pktinfo)) + CMSG_SPACE(sizeof(int));
+#endif
+
+#ifdef __linux__
+constexpr uint16_t kRxBatchSize = OPENTHREAD_POSIX_CONFIG_UDP_RX_BATCH_SIZE;
+constexpr uint16_t kTxBatchSize = OPENTHREAD_POSIX_CONFIG_UDP_TX_BATCH_SIZE;
+#else
+constexpr uint16_t kRxBatchSize = 1; // No `recvmmsg()`.
+#endif
+
+constexpr uint16_t kRxBudget        = OPENTHREAD_POSIX_CONFIG_UDP_RX_BUDGET;
+constexpr uint8_t  kMaxReadySockets = 16;
+
+struct Packet
+{
+    struct sockaddr_in6 mPeerAddr;
+    uint8_t             mControl[kControlSize];
+    uint8_t             mPayload[kMaxUdpSize];
+    struct iovec        mIov;
+};
+
+Packet sRxPackets[kRxBatchSize];
+
+#ifdef __linux__
+struct mmsghdr sRxMsgs[kRxBatchSize];
+
+// Multicast datagrams are queued and sent together with `sendmmsg()`.
+Packet         sTxPackets[kTxBatchSize];
+struct mmsghdr sTxMsgs[kTxBatchSize];
+uint16_t       sTxCount         = 0;
+int            sTxFd            = -1;
+bool           sTxMulticastLoop = false;
+#else
+struct msghdr sRxMsgs[kRxBatchSize];
 #endif
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kBufferSize];
-    size_t              controlLength = 0;
-    struct iovec        iov;
-    struct msghdr       msg;
-    struct cmsghdr *    cmsg;
-    ssize_t             rval;
-    otError             error = OT_ERROR_NONE;
 
-    memset(&peerAddr, 0, sizeof(peerAddr));
-    peerAddr.sin6_port   = htons(aMessageInfo.mPeerPort);
-    peerAddr.sin6_family = AF_INET6;
-    memcpy(&peerAddr.sin6_addr, &aMessageInfo.mPeerAddr, sizeof(peerAddr.sin6_addr));
+void setMulticastLoop(int aFd, bool aEnable)
+{
+    int value = aEnable ? 1 : 0;
+
+    VerifyOrDie(setsockopt(aFd, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &value, sizeof(value)) == 0, OT_EXIT_ERROR_ERRNO);
+}
 
-    if (IsLinkLocal(peerAddr.sin6_addr) && !aMessageInfo.mIsHostInterface)
+void prepareTxPacket(Packet &aPacket, struct msghdr &aMsg, uint16_t aLength, const otMessageInfo &aMessageInfo)
+{
+    size_t          controlLength = 0;
+    struct cmsghdr *cmsg;
+
+    memset(&aPacket.mPeerAddr, 0, sizeof(aPacket.mPeerAddr));
+    aPacket.mPeerAddr.sin6_port   = htons(aMessageInfo.mPeerPort);
+    aPacket.mPeerAddr.sin6_family = AF_INET6;
+    memcpy(&aPacket.mPeerAddr.sin6_addr, &aMessageInfo.mPeerAddr, sizeof(aPacket.mPeerAddr.sin6_addr));
+
+    if (IsLinkLocal(aPacket.mPeerAddr.sin6_addr) && !aMessageInfo.mIsHostInterface)
     {
         // sin6_scope_id only works for link local destinations
-        peerAddr.sin6_scope_id = gNetifIndex;
+        aPacket.mPeerAddr.sin6_scope_id = gNetifIndex;
     }
 
-    memset(control, 0, sizeof(control));
+    memset(aPacket.mControl, 0, sizeof(aPacket.mControl));
 
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
+    aPacket.mIov.iov_base = aPacket.mPayload;
+    aPacket.mIov.iov_len  = aLength;
 
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = static_cast<decltype(msg.msg_controllen)>(sizeof(control));
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
+    aMsg.msg_name       = &aPacket.mPeerAddr;
+    aMsg.msg_namelen    = sizeof(aPacket.mPeerAddr);
+    aMsg.msg_control    = aPacket.mControl;
+    aMsg.msg_controllen = static_cast<decltype(aMsg.msg_controllen)>(sizeof(aPacket.mControl));
+    aMsg.msg_iov        = &aPacket.mIov;
+    aMsg.msg_iovlen     = 1;
+    aMsg.msg_flags      = 0;
 
     {
         int hopLimit = (aMessageInfo.mHopLimit ? aMessageInfo.mHopLimit : OPENTHREAD_CONFIG_IP6_HOP_LIMIT_DEFAULT);
 
-        cmsg             = CMSG_FIRSTHDR(&msg);
+        cmsg             = CMSG_FIRSTHDR(&aMsg);
         cmsg->cmsg_level = IPPROTO_IPV6;
         cmsg->cmsg_type  = IPV6_HOPLIMIT;
         cmsg->cmsg_len   = CMSG_LEN(sizeof(int));
@@ -144,7 +179,7 @@ otError transmitPacket(int aFd, uint8_t *aPayload, uint16_t aLength, const otMes
     {
         struct in6_pktinfo pktinfo;
 
-        cmsg             = CMSG_NXTHDR(&msg, cmsg);
+        cmsg             = CMSG_NXTHDR(&aMsg, cmsg);
         cmsg->cmsg_level = IPPROTO_IPV6;
         cmsg->cmsg_type  = IPV6_PKTINFO;
         cmsg->cmsg_len   = CMSG_LEN(sizeof(pktinfo));
@@ -158,10 +193,19 @@ otError transmitPacket(int aFd, uint8_t *aPayload, uint16_t aLength, const otMes
     }
 
 #ifdef __APPLE__
-    msg.msg_controllen = static_cast<socklen_t>(controlLength);
+    aMsg.msg_controllen = static_cast<socklen_t>(controlLength);
 #else
-    msg.msg_controllen           = controlLength;
+    aMsg.msg_controllen          = controlLength;
 #endif
+}
+
+otError transmitPacket(int aFd, Packet &aPacket, uint16_t aLength, const otMessageInfo &aMessageInfo)
+{
+    struct msghdr msg;
+    ssize_t       rval;
+    otError       error = OT_ERROR_NONE;
+
+    prepareTxPacket(aPacket, msg, aLength, aMessageInfo);
 
     rval = sendmsg(aFd, &msg, 0);
     VerifyOrExit(rval > 0, perror("sendmsg"));
@@ -177,30 +221,23 @@ exit:
     return error;
 }
 
-otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageInfo &aMessageInfo)
+void prepareRxPacket(Packet &aPacket, struct msghdr &aMsg)
 {
-    struct sockaddr_in6 peerAddr;
-    uint8_t             control[kMaxUdpSize];
-    struct iovec        iov;
-    struct msghdr       msg;
-    ssize_t             rval;
-
-    iov.iov_base = aPayload;
-    iov.iov_len  = aLength;
-
-    msg.msg_name       = &peerAddr;
-    msg.msg_namelen    = sizeof(peerAddr);
-    msg.msg_control    = control;
-    msg.msg_controllen = sizeof(control);
-    msg.msg_iov        = &iov;
-    msg.msg_iovlen     = 1;
-    msg.msg_flags      = 0;
-
-    rval = recvmsg(aFd, &msg, 0);
-    VerifyOrExit(rval > 0, perror("recvmsg"));
-    aLength = static_cast<uint16_t>(rval);
+    aPacket.mIov.iov_base = aPacket.mPayload;
+    aPacket.mIov.iov_len  = sizeof(aPacket.mPayload);
+
+    aMsg.msg_name       = &aPacket.mPeerAddr;
+    aMsg.msg_namelen    = sizeof(aPacket.mPeerAddr);
+    aMsg.msg_control    = aPacket.mControl;
+    aMsg.msg_controllen = sizeof(aPacket.mControl);
+    aMsg.msg_iov        = &aPacket.mIov;
+    aMsg.msg_iovlen     = 1;
+    aMsg.msg_flags      = 0;
+}
 
-    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg))
+void parseRxPacket(const Packet &aPacket, struct msghdr &aMsg, otMessageInfo &aMessageInfo)
+{
+    for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&aMsg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&aMsg, cmsg))
     {
         if (cmsg->cmsg_level == IPPROTO_IPV6)
         {
@@ -223,11 +260,23 @@ otError receivePacket(int aFd, uint8_t *aPayload, uint16_t &aLength, otMessageIn
         }
     }
 
-    aMessageInfo.mPeerPort = ntohs(peerAddr.sin6_port);
-    memcpy(&aMessageInfo.mPeerAddr, &peerAddr.sin6_addr, sizeof(aMessageInfo.mPeerAddr));
+    aMessageInfo.mPeerPort = ntohs(aPacket.mPeerAddr.sin6_port);
+    memcpy(&aMessageInfo.mPeerAddr, &aPacket.mPeerAddr.sin6_addr, sizeof(aMessageInfo.mPeerAddr));
+}
 
-exit:
-    return rval > 0 ? OT_ERROR_NONE : OT_ERROR_FAILED;
+otUdpSocket *findSocket(int aFd)
+{
+    otUdpSocket *socket;
+
+    for (socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
+    {
+        if (socket->mHandle != nullptr && FdFromHandle(socket->mHandle) == aFd)
+        {
+            break;
+        }
+    }
+
+    return socket;
 }
 
 } // namespace
@@ -258,6 +307,7 @@ otError otPlatUdpClose(otUdpSocket *aUdpSocket)
     VerifyOrExit(aUdpSocket->mHandle != nullptr);
 
     fd = FdFromHandle(aUdpSocket->mHandle);
+    ot::Posix::Udp::Get().FlushTxQueue();
     VerifyOrExit(0 == close(fd), error = OT_ERROR_FAILED);
 
     aUdpSocket->mHandle = nullptr;
@@ -427,32 +477,11 @@ exit:
 
 otError otPlatUdpSend(otUdpSocket *aUdpSocket, otMessage *aMessage, const otMessageInfo *aMessageInfo)
 {
-    otError  error = OT_ERROR_NONE;
-    int      fd;
-    uint16_t len;
-    uint8_t  payload[kMaxUdpSize];
+    otError error = OT_ERROR_NONE;
 
     VerifyOrExit(aUdpSocket->mHandle != nullptr, error = OT_ERROR_INVALID_ARGS);
-    fd = FdFromHandle(aUdpSocket->mHandle);
-
-    len = otMessageGetLength(aMessage);
-    VerifyOrExit(len == otMessageRead(aMessage, 0, payload, len), error = OT_ERROR_INVALID_ARGS);
-
-    if (aMessageInfo->mMulticastLoop)
-    {
-        int value = 1;
-
-        VerifyOrDie(setsockopt(fd, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &value, sizeof(value)) == 0, OT_EXIT_ERROR_ERRNO);
-    }
 
-    error = transmitPacket(fd, payload, len, *aMessageInfo);
-
-    if (aMessageInfo->mMulticastLoop)
-    {
-        int value = 0;
-
-        VerifyOrDie(setsockopt(fd, IPPROTO_IPV6, IPV6_MULTICAST_LOOP, &value, sizeof(value)) == 0, OT_EXIT_ERROR_ERRNO);
-    }
+    error = ot::Posix::Udp::Get().Send(FdFromHandle(aUdpSocket->mHandle), *aMessage, *aMessageInfo);
 
 exit:
     if (error == OT_ERROR_NONE)
@@ -548,6 +577,8 @@ namespace Posix {
 
 void Udp::Update(otSysMainloopContext &aContext)
 {
+    FlushTxQueue();
+
     VerifyOrExit(gNetifIndex != 0);
 
     for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
@@ -604,6 +635,123 @@ void Udp::TearDown(void)
 void Udp::Deinit(void)
 {
     // TODO All platform sockets should be closed
+    FlushTxQueue();
+
+    otLogInfoPlat("[udp] Rx: %lu datagrams in %lu batches, %lu dropped, budget used up %lu times",
+                  static_cast<unsigned long>(mCounters.mRxDatagrams), static_cast<unsigned long>(mCounters.mRxBatches),
+                  static_cast<unsigned long>(mCounters.mRxDropped),
+                  static_cast<unsigned long>(mCounters.mRxBudgetExhausted));
+    otLogInfoPlat("[udp] Tx: %lu datagrams in %lu batches, %lu failed",
+                  static_cast<unsigned long>(mCounters.mTxDatagrams), static_cast<unsigned long>(mCounters.mTxBatches),
+                  static_cast<unsigned long>(mCounters.mTxFailed));
+}
+
+otError Udp::Send(int aFd, otMessage &aMessage, const otMessageInfo &aMessageInfo)
+{
+    otError  error  = OT_ERROR_NONE;
+    uint16_t length = otMessageGetLength(&aMessage);
+    Packet   packet;
+
+    VerifyOrExit(length <= sizeof(packet.mPayload), error = OT_ERROR_INVALID_ARGS);
+
+#ifdef __linux__
+    if (IsMulticast(aMessageInfo.mPeerAddr))
+    {
+        Packet *txPacket;
+
+        if ((sTxCount == kTxBatchSize) ||
+            ((sTxCount > 0) && (sTxFd != aFd || sTxMulticastLoop != aMessageInfo.mMulticastLoop)))
+        {
+            FlushTxQueue();
+        }
+
+        txPacket = &sTxPackets[sTxCount];
+        otMessageRead(&aMessage, 0, txPacket->mPayload, length);
+        prepareTxPacket(*txPacket, sTxMsgs[sTxCount].msg_hdr, length, aMessageInfo);
+
+        sTxFd            = aFd;
+        sTxMulticastLoop = aMessageInfo.mMulticastLoop;
+        sTxCount++;
+
+        ExitNow();
+    }
+
+    if (sTxFd == aFd)
+    {
+        // Keep the order of datagrams sent on the same socket.
+        FlushTxQueue();
+    }
+#endif
+
+    otMessageRead(&aMessage, 0, packet.mPayload, length);
+
+    if (aMessageInfo.mMulticastLoop)
+    {
+        setMulticastLoop(aFd, true);
+    }
+
+    error = transmitPacket(aFd, packet, length, aMessageInfo);
+
+    if (aMessageInfo.mMulticastLoop)
+    {
+        setMulticastLoop(aFd, false);
+    }
+
+    mCounters.mTxBatches++;
+
+    if (error == OT_ERROR_NONE)
+    {
+        mCounters.mTxDatagrams++;
+    }
+    else
+    {
+        mCounters.mTxFailed++;
+    }
+
+exit:
+    return error;
+}
+
+void Udp::FlushTxQueue(void)
+{
+#ifdef __linux__
+    uint16_t sent = 0;
+
+    VerifyOrExit(sTxCount > 0);
+
+    if (sTxMulticastLoop)
+    {
+        setMulticastLoop(sTxFd, true);
+    }
+
+    while (sent < sTxCount)
+    {
+        int rval = sendmmsg(sTxFd, &sTxMsgs[sent], sTxCount - sent, 0);
+
+        mCounters.mTxBatches++;
+
+        if (rval <= 0)
+        {
+            otLogWarnPlat("[udp] Failed to send %u datagrams: %s", sTxCount - sent, strerror(errno));
+            mCounters.mTxFailed += sTxCount - sent;
+            break;
+        }
+
+        sent += static_cast<uint16_t>(rval);
+        mCounters.mTxDatagrams += static_cast<uint32_t>(rval);
+    }
+
+    if (sTxMulticastLoop)
+    {
+        setMulticastLoop(sTxFd, false);
+    }
+
+    sTxCount = 0;
+    sTxFd    = -1;
+
+exit:
+#endif
+    return;
 }
 
 Udp &Udp::Get(void)
@@ -615,48 +763,121 @@ Udp &Udp::Get(void)
 
 void Udp::Process(const otSysMainloopContext &aContext)
 {
-    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
-
-    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr; socket = socket->mNext)
+    int      readyFds[kMaxReadySockets];
+    uint8_t  numReadyFds = 0;
+    uint16_t budget      = kRxBudget;
+
+    // The socket handlers may open or close sockets, so collect the
+    // ready sockets first.
+    for (otUdpSocket *socket = otUdpGetSockets(gInstance); socket != nullptr && numReadyFds < kMaxReadySockets;
+         socket             = socket->mNext)
     {
         int fd = FdFromHandle(socket->mHandle);
 
         if (fd > 0 && FD_ISSET(fd, &aContext.mReadFdSet))
         {
-            otMessageInfo messageInfo;
-            otMessage *   message = nullptr;
-            uint8_t       payload[kMaxUdpSize];
-            uint16_t      length = sizeof(payload);
+            readyFds[numReadyFds++] = fd;
+        }
+    }
 
-            memset(&messageInfo, 0, sizeof(messageInfo));
-            messageInfo.mSockPort = socket->mSockName.mPort;
+    for (uint8_t i = 0; i < numReadyFds && budget > 0; i++)
+    {
+        budget -= Receive(readyFds[i], budget);
+    }
 
-            if (OT_ERROR_NONE != receivePacket(fd, payload, length, messageInfo))
-            {
-                continue;
-            }
+    if (budget == 0)
+    {
+        // The remaining datagrams are received in the next iteration.
+        mCounters.mRxBudgetExhausted++;
+    }
+}
 
-            message = otUdpNewMessage(gInstance, &msgSettings);
+uint16_t Udp::Receive(int aFd, uint16_t aMaxCount)
+{
+    otMessageSettings msgSettings = {false, OT_MESSAGE_PRIORITY_NORMAL};
+    otUdpSocket *     socket      = findSocket(aFd);
+    uint16_t          count       = OT_MIN(aMaxCount, kRxBatchSize);
+    int               received;
 
-            if (message == nullptr)
-            {
-                continue;
-            }
+    VerifyOrExit(socket != nullptr, received = 0);
 
-            if (otMessageAppend(message, payload, length) != OT_ERROR_NONE)
-            {
-                otMessageFree(message);
-                continue;
-            }
+    for (uint16_t i = 0; i < count; i++)
+    {
+#ifdef __linux__
+        prepareRxPacket(sRxPackets[i], sRxMsgs[i].msg_hdr);
+#else
+        prepareRxPacket(sRxPackets[i], sRxMsgs[i]);
+#endif
+    }
 
-            socket->mHandler(socket->mContext, message, &messageInfo);
-            otMessageFree(message);
-            // only process one socket a time
+#ifdef __linux__
+    received = recvmmsg(aFd, sRxMsgs, count, MSG_DONTWAIT, nullptr);
+#else
+    {
+        ssize_t rval = recvmsg(aFd, &sRxMsgs[0], 0);
+
+        received = (rval >= 0) ? 1 : -1;
+        sRxPackets[0].mIov.iov_len = (rval >= 0) ? static_cast<size_t>(rval) : 0;
+    }
+#endif
+
+    if (received < 0)
+    {
+        if (errno != EAGAIN && errno != EWOULDBLOCK)
+        {
+            perror("recvmmsg");
+        }
+
+        ExitNow(received = 0);
+    }
+
+    mCounters.mRxBatches++;
+    mCounters.mRxDatagrams += static_cast<uint32_t>(received);
+
+    for (int i = 0; i < received; i++)
+    {
+        otMessageInfo  messageInfo;
+        otMessage *    message;
+#ifdef __linux__
+        struct msghdr &msg    = sRxMsgs[i].msg_hdr;
+        uint16_t       length = static_cast<uint16_t>(sRxMsgs[i].msg_len);
+#else
+        struct msghdr &msg    = sRxMsgs[i];
+        uint16_t       length = static_cast<uint16_t>(sRxPackets[i].mIov.iov_len);
+#endif
+
+        if (findSocket(aFd) != socket)
+        {
+            // The socket was closed by a handler.
+            mCounters.mRxDropped += static_cast<uint32_t>(received - i);
             break;
         }
+
+        memset(&messageInfo, 0, sizeof(messageInfo));
+        messageInfo.mSockPort = socket->mSockName.mPort;
+        parseRxPacket(sRxPackets[i], msg, messageInfo);
+
+        message = otUdpNewMessage(gInstance, &msgSettings);
+
+        if (message == nullptr)
+        {
+            mCounters.mRxDropped++;
+            continue;
+        }
+
+        if (otMessageAppend(message, sRxPackets[i].mPayload, length) != OT_ERROR_NONE)
+        {
+            otMessageFree(message);
+            mCounters.mRxDropped++;
+            continue;
+        }
+
+        socket->mHandler(socket->mContext, message, &messageInfo);
+        otMessageFree(message);
     }
 
-    return;
+exit:
+    return static_cast<uint16_t>(received);
 }
 
 } // namespace Posix
@@ -28,6 +28,9 @@
 #ifndef OT_POSIX_PLATFORM_UDP_HPP_
 #define OT_POSIX_PLATFORM_UDP_HPP_
 
+#include <openthread/message.h>
+#include <openthread/udp.h>
+
 #include "core/common/non_copyable.hpp"
 #include "posix/platform/mainloop.hpp"
 
@@ -37,6 +40,17 @@ namespace Posix {
 class Udp : public Mainloop::Source, private NonCopyable
 {
 public:
+    struct Counters
+    {
+        uint32_t mRxDatagrams;       ///< Number of received datagrams.
+        uint32_t mRxBatches;         ///< Number of receive calls which returned datagrams.
+        uint32_t mRxDropped;         ///< Number of received datagrams dropped (no buffer or socket closed).
+        uint32_t mRxBudgetExhausted; ///< Number of mainloop iterations which used up the receive budget.
+        uint32_t mTxDatagrams;       ///< Number of sent datagrams.
+        uint32_t mTxBatches;         ///< Number of send calls.
+        uint32_t mTxFailed;          ///< Number of datagrams which failed to be sent.
+    };
+
     static Udp &Get(void);
 
     void Init(const char *aIfName);
@@ -45,6 +59,15 @@ public:
     void Deinit(void);
     void Update(otSysMainloopContext &aContext) override;
     void Process(const otSysMainloopContext &aContext) override;
+
+    otError         Send(int aFd, otMessage &aMessage, const otMessageInfo &aMessageInfo);
+    void            FlushTxQueue(void);
+    const Counters &GetCounters(void) const { return mCounters; }
+
+private:
+    uint16_t Receive(int aFd, uint16_t aMaxCount);
+
+    Counters mCounters;
 };
 
 } // namespace Posix
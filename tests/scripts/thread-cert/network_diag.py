@@ -54,6 +54,12 @@ class TlvType(IntEnum):
     CHANNEL_PAGES = 17
     TYPE_LIST = 18
     MAX_CHILD_TIMEOUT = 19
+    AGGREGATED_QUERY = 240
+    CHILD_DIAGNOSTIC = 241
+    CHILD_LINK_QUALITY = 242
+    CHILD_VERSION = 243
+    CHILD_SUPERVISION = 244
+    CHILD_INFO_AGE = 245
 
 
 class Ipv6AddressList:
@@ -1552,6 +1552,14 @@ class NodeImpl:
         self.send_command('partitionid')
         return self._expect_result(r'\d+')
 
+    def get_leader_data(self):
+        self.send_command('leaderdata')
+        leader_data = {}
+        for line in self._expect_command_output():
+            key, value = line.split(':')
+            leader_data[key.strip()] = int(value)
+        return leader_data
+
     def get_preferred_partition_id(self):
         self.send_command('partitionid preferred')
         return self._expect_result(r'\d+')
@@ -2092,6 +2100,22 @@ class NodeImpl:
 
         self._expect_done(timeout=timeout)
 
+    def send_network_diag_aggregate(self, addr, tlv_types):
+        """Send an aggregated network diagnostic query and return the answers as a list of (source, payload) tuples."""
+        self.send_command('networkdiagnostic aggregate %s %s' % (addr, ' '.join([str(t.value) for t in tlv_types])))
+
+        if isinstance(self.simulator, simulator.VirtualTime):
+            self.simulator.go(8)
+
+        answers = []
+
+        for line in self._expect_command_output():
+            match = re.search(r'DIAG_GET\.rsp/ans from (\S+): ([0-9a-f]*)', line)
+            if match:
+                answers.append((match.group(1), match.group(2)))
+
+        return answers
+
     def send_network_diag_reset(self, addr, tlv_types):
         self.send_command('networkdiagnostic reset %s %s' % (addr, ' '.join([str(t.value) for t in tlv_types])))
 
@@ -2166,10 +2190,24 @@ class NodeImpl:
             })
         return rssi_list
 
-    def ping(self, ipaddr, num_responses=1, size=8, timeout=5, count=1, interval=1, hoplimit=64, interface=None):
+    def ping(self,
+             ipaddr,
+             num_responses=1,
+             size=8,
+             timeout=5,
+             count=1,
+             interval=1,
+             hoplimit=64,
+             interface=None,
+             max_outstanding=None,
+             pattern=None):
         args = f'{ipaddr} {size} {count} {interval} {hoplimit} {timeout}'
         if interface is not None:
             args = f'-I {interface} {args}'
+        if max_outstanding is not None:
+            args = f'-l {max_outstanding} {args}'
+        if pattern is not None:
+            args = f'-p {pattern} {args}'
         cmd = f'ping {args}'
 
         self.send_command(cmd)
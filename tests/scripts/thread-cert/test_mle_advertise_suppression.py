@@ -0,0 +1,117 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2022, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+
+import unittest
+
+import config
+import mle
+import thread_cert
+
+ROUTER_COUNT = 32
+
+# Time (in seconds) the MLE Advertisements are counted.
+MEASURE_TIME = 600
+
+# Upper bound of the airtime (in msec) of one MLE Advertisement: a max
+# size 802.15.4 PPDU (133 octets) at 32 usec per octet.
+MAX_ADVERTISEMENT_AIRTIME = 4.256
+
+# Test description:
+#
+#   Verify that MLE Advertisements are suppressed and the max advertise
+#   interval is extended in a network of 32 routers all in range of
+#   each other, while every router keeps its links to all others.
+#
+# Topology:
+#
+#   32 routers, full mesh.
+#
+
+
+class TestMleAdvertiseSuppression(thread_cert.TestCase):
+    SUPPORT_NCP = False
+
+    TOPOLOGY = {
+        i: {
+            'mode': 'rdn',
+            'router_downgrade_threshold': ROUTER_COUNT,
+            'router_upgrade_threshold': ROUTER_COUNT
+        } for i in range(1, ROUTER_COUNT + 1)
+    }
+
+    def test(self):
+        self.nodes[1].start()
+        self.simulator.go(5)
+        self.assertEqual(self.nodes[1].get_state(), 'leader')
+
+        for i in range(2, ROUTER_COUNT + 1):
+            self.nodes[i].start()
+            self.simulator.go(config.ROUTER_STARTUP_DELAY)
+            self.assertEqual(self.nodes[i].get_state(), 'router')
+
+        # Let the advertise trickle timers of all routers reach their
+        # max interval before counting.
+        self.simulator.go(300)
+
+        for i in self.nodes:
+            self.simulator.get_messages_sent_by(i)
+
+        self.simulator.go(MEASURE_TIME)
+
+        adv_counts = {}
+
+        for i in self.nodes:
+            messages = self.simulator.get_messages_sent_by(i)
+            adv_counts[i] = 0
+
+            while messages.next_mle_message(mle.CommandType.ADVERTISEMENT, assert_enabled=False):
+                adv_counts[i] += 1
+
+        total = sum(adv_counts.values())
+        airtime = total * MAX_ADVERTISEMENT_AIRTIME / (MEASURE_TIME * 1000)
+
+        print(f'MLE Advertisements in {MEASURE_TIME}s: total {total}, per router min {min(adv_counts.values())} '
+              f'max {max(adv_counts.values())}, airtime <= {airtime:.3%}')
+
+        # Without suppression every router sends one Advertisement per
+        # max advertise interval.
+        self.assertLess(total, ROUTER_COUNT * MEASURE_TIME / config.MAX_ADVERTISEMENT_INTERVAL * 0.8)
+
+        # Every router still advertises and keeps a link to all others.
+        for i, node in self.nodes.items():
+            self.assertEqual(node.get_state(), 'leader' if i == 1 else 'router')
+            self.assertGreater(adv_counts[i], 0)
+
+            router_table = node.router_table()
+            self.assertEqual(len(router_table), ROUTER_COUNT)
+            self.assertEqual(sum(1 for entry in router_table.values() if entry['link']), ROUTER_COUNT - 1)
+
+
+if __name__ == '__main__':
+    unittest.main()
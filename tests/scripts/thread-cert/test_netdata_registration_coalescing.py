@@ -0,0 +1,159 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2022, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+
+import unittest
+
+import config
+import message
+import mle
+import thread_cert
+
+# Test description:
+#   This test verifies that the Leader coalesces the Network Data changes from Server Data registrations sent by many
+#   routers at (almost) the same time, e.g., as happens after a partition merge. It measures the Network Data version
+#   churn and the MLE Data Response traffic caused by the registrations.
+#
+#   The simulation platform enables `OPENTHREAD_CONFIG_TMF_NETDATA_REGISTRATION_COALESCE_WINDOW`.
+#
+# Topology:
+#
+#   1 leader and 6 routers all connected.
+#
+
+LEADER = 1
+ROUTERS = [2, 3, 4, 5, 6, 7]
+
+WAIT_TIME = 10
+
+
+class NetDataRegistrationCoalescing(thread_cert.TestCase):
+    SUPPORT_NCP = False
+
+    TOPOLOGY = {
+        LEADER: {
+            'name': 'LEADER',
+            'mode': 'rdn',
+        },
+        2: {
+            'name': 'ROUTER_1',
+            'mode': 'rdn',
+        },
+        3: {
+            'name': 'ROUTER_2',
+            'mode': 'rdn',
+        },
+        4: {
+            'name': 'ROUTER_3',
+            'mode': 'rdn',
+        },
+        5: {
+            'name': 'ROUTER_4',
+            'mode': 'rdn',
+        },
+        6: {
+            'name': 'ROUTER_5',
+            'mode': 'rdn',
+        },
+        7: {
+            'name': 'ROUTER_6',
+            'mode': 'rdn',
+        },
+    }
+
+    def _get_data_versions(self):
+        leader_data = self.nodes[LEADER].get_leader_data()
+        return leader_data['Data Version'], leader_data['Stable Data Version']
+
+    def _count_data_responses(self):
+        count = 0
+        for node in [LEADER] + ROUTERS:
+            for msg in self.simulator.get_messages_sent_by(node).messages:
+                if msg.type == message.MessageType.MLE and msg.mle.command.type == mle.CommandType.DATA_RESPONSE:
+                    count += 1
+        return count
+
+    def test(self):
+        leader = self.nodes[LEADER]
+
+        leader.start()
+        self.simulator.go(5)
+        self.assertEqual(leader.get_state(), 'leader')
+
+        for router in ROUTERS:
+            self.nodes[router].start()
+            self.simulator.go(config.ROUTER_STARTUP_DELAY)
+            self.assertEqual(self.nodes[router].get_state(), 'router')
+
+        self.simulator.go(WAIT_TIME)
+
+        # Discard the messages exchanged so far.
+        self._count_data_responses()
+
+        version, stable_version = self._get_data_versions()
+
+        # Have all routers register a stable on-mesh prefix and a
+        # (non-stable) external route at the same time.
+
+        for index, router in enumerate(ROUTERS):
+            self.nodes[router].add_prefix(f'fd00:{index + 1}::/64', 'paros')
+            self.nodes[router].add_route(f'fd00:abc{index + 1}::/64')
+
+        for router in ROUTERS:
+            self.nodes[router].register_netdata()
+
+        self.simulator.go(WAIT_TIME)
+
+        new_version, new_stable_version = self._get_data_versions()
+        version_churn = (new_version - version) % 256
+        stable_version_churn = (new_stable_version - stable_version) % 256
+        num_data_responses = self._count_data_responses()
+
+        print(f'{len(ROUTERS)} registrations -> version churn: {version_churn}, stable version churn: '
+              f'{stable_version_churn}, MLE Data Responses: {num_data_responses}')
+
+        # Verify that all entries are present in the Network Data on
+        # all nodes.
+
+        for node in [LEADER] + ROUTERS:
+            netdata = self.nodes[node].get_netdata()
+            self.assertEqual(len(netdata['Prefixes']), len(ROUTERS))
+            self.assertEqual(len(netdata['Routes']), len(ROUTERS))
+
+        # Verify that the registrations are published with a single
+        # version increment (allowing for one straggler that lands
+        # after the coalescing window).
+
+        self.assertGreaterEqual(version_churn, 1)
+        self.assertLessEqual(version_churn, 2)
+        self.assertGreaterEqual(stable_version_churn, 1)
+        self.assertLessEqual(stable_version_churn, version_churn)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2022, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+
+import unittest
+
+import config
+import message
+import thread_cert
+from network_diag import TlvType
+
+# Test description:
+#   This test verifies aggregated network diagnostic queries. Routers answer for themselves and on behalf of their
+#   children, so that children do not answer. The requester reports every device as a separate answer. It also
+#   compares the number of answer messages with a regular (non-aggregated) multicast query, and verifies that the
+#   routers report the cached info of their children (link quality, version) along with its age.
+#
+#   The build needs `OPENTHREAD_CONFIG_TMF_NETWORK_DIAG_AGGREGATION_ENABLE` (`-DOT_NETDIAG_AGGREGATION=ON`).
+#
+# Topology:
+#
+#   LEADER ---- ROUTER_1 ------------- ROUTER_2
+#              /   |    \\            /    |    \\
+#          MED_1 SED_1 MED_3       MED_2 SED_2 MED_4
+#
+
+LEADER = 1
+ROUTER_1 = 2
+ROUTER_2 = 3
+MED_1 = 4
+SED_1 = 5
+MED_3 = 6
+MED_2 = 7
+SED_2 = 8
+MED_4 = 9
+
+ROUTERS = [LEADER, ROUTER_1, ROUTER_2]
+CHILDREN = [MED_1, SED_1, MED_3, MED_2, SED_2, MED_4]
+
+
+class NetDiagAggregation(thread_cert.TestCase):
+    SUPPORT_NCP = False
+
+    TOPOLOGY = {
+        LEADER: {
+            'name': 'LEADER',
+            'mode': 'rdn',
+            'allowlist': [ROUTER_1],
+        },
+        ROUTER_1: {
+            'name': 'ROUTER_1',
+            'mode': 'rdn',
+            'allowlist': [LEADER, ROUTER_2, MED_1, SED_1, MED_3],
+        },
+        ROUTER_2: {
+            'name': 'ROUTER_2',
+            'mode': 'rdn',
+            'allowlist': [ROUTER_1, MED_2, SED_2, MED_4],
+        },
+        MED_1: {
+            'name': 'MED_1',
+            'mode': 'rn',
+            'allowlist': [ROUTER_1],
+        },
+        SED_1: {
+            'name': 'SED_1',
+            'mode': 'n',
+            'allowlist': [ROUTER_1],
+        },
+        MED_3: {
+            'name': 'MED_3',
+            'mode': 'rn',
+            'allowlist': [ROUTER_1],
+        },
+        MED_2: {
+            'name': 'MED_2',
+            'mode': 'rn',
+            'allowlist': [ROUTER_2],
+        },
+        SED_2: {
+            'name': 'SED_2',
+            'mode': 'n',
+            'allowlist': [ROUTER_2],
+        },
+        MED_4: {
+            'name': 'MED_4',
+            'mode': 'rn',
+            'allowlist': [ROUTER_2],
+        },
+    }
+
+    def _count_answers_sent_by(self, nodeids):
+        count = 0
+        for nodeid in nodeids:
+            for msg in self.simulator.get_messages_sent_by(nodeid).messages:
+                if msg.type == message.MessageType.COAP and msg.coap.uri_path == '/d/da':
+                    count += 1
+        return count
+
+    def _parse_tlvs(self, payload):
+        data = bytes.fromhex(payload)
+        tlvs = {}
+        offset = 0
+        while offset + 2 <= len(data):
+            tlv_type, length = data[offset], data[offset + 1]
+            tlvs[tlv_type] = data[offset + 2:offset + 2 + length]
+            offset += 2 + length
+        return tlvs
+
+    def _get_rloc16(self, payload):
+        return int.from_bytes(self._parse_tlvs(payload)[TlvType.ADDRESS16], 'big')
+
+    def test(self):
+        self.nodes[LEADER].start()
+        self.simulator.go(5)
+        self.assertEqual(self.nodes[LEADER].get_state(), 'leader')
+
+        for router in [ROUTER_1, ROUTER_2]:
+            self.nodes[router].start()
+            self.simulator.go(config.ROUTER_STARTUP_DELAY)
+            self.assertEqual(self.nodes[router].get_state(), 'router')
+
+        for child in CHILDREN:
+            self.nodes[child].start()
+            self.simulator.go(5)
+            self.assertEqual(self.nodes[child].get_state(), 'child')
+
+        self.simulator.go(10)
+
+        expected_rloc16s = sorted(self.nodes[node].get_addr16() for node in ROUTERS + CHILDREN)
+
+        # Discard the messages exchanged so far.
+        self._count_answers_sent_by(ROUTERS + CHILDREN)
+
+        # Regular multicast query: every device sends its own answer.
+
+        self.nodes[LEADER].send_network_diag_get(config.REALM_LOCAL_ALL_NODES_ADDRESS,
+                                                 [TlvType.EXT_ADDRESS, TlvType.ADDRESS16])
+        self.simulator.go(10)
+
+        children_answers = self._count_answers_sent_by(CHILDREN)
+        routers_answers = self._count_answers_sent_by(ROUTERS)
+        print(f'Regular query: {routers_answers} router answers, {children_answers} child answers')
+        self.assertGreater(children_answers, 0)
+
+        # Aggregated query: only the routers answer, every device is
+        # reported as a separate answer.
+
+        answers = self.nodes[LEADER].send_network_diag_aggregate(
+            config.REALM_LOCAL_ALL_NODES_ADDRESS, [TlvType.EXT_ADDRESS, TlvType.ADDRESS16, TlvType.MODE])
+        self.simulator.go(10)
+
+        children_answers = self._count_answers_sent_by(CHILDREN)
+        routers_answers = self._count_answers_sent_by(ROUTERS)
+        print(f'Aggregated query: {routers_answers} router answers, {children_answers} child answers, '
+              f'{len(answers)} devices reported')
+
+        self.assertEqual(children_answers, 0)
+        self.assertEqual(sorted(self._get_rloc16(payload) for _, payload in answers), expected_rloc16s)
+
+        for source, payload in answers:
+            self.assertEqual(int(source.split(':')[-1], 16), self._get_rloc16(payload))
+
+        # Cached child info: the routers report the link quality and the
+        # version of their children along with the age of the info.
+
+        answers = self.nodes[LEADER].send_network_diag_aggregate(config.REALM_LOCAL_ALL_NODES_ADDRESS, [
+            TlvType.EXT_ADDRESS, TlvType.ADDRESS16, TlvType.CHILD_LINK_QUALITY, TlvType.CHILD_VERSION,
+            TlvType.CHILD_INFO_AGE
+        ])
+        self.simulator.go(10)
+
+        self.assertEqual(sorted(self._get_rloc16(payload) for _, payload in answers), expected_rloc16s)
+
+        child_rloc16s = [self.nodes[child].get_addr16() for child in CHILDREN]
+
+        for _, payload in answers:
+            tlvs = self._parse_tlvs(payload)
+
+            if self._get_rloc16(payload) not in child_rloc16s:
+                self.assertNotIn(TlvType.CHILD_INFO_AGE, tlvs)
+                continue
+
+            self.assertIn(TlvType.CHILD_LINK_QUALITY, tlvs)
+            self.assertIn(TlvType.CHILD_VERSION, tlvs)
+            self.assertIn(TlvType.CHILD_INFO_AGE, tlvs)
+
+            seconds_since_last_heard = int.from_bytes(tlvs[TlvType.CHILD_INFO_AGE][0:4], 'big')
+            seconds_since_info_update = int.from_bytes(tlvs[TlvType.CHILD_INFO_AGE][4:8], 'big')
+            self.assertLessEqual(seconds_since_last_heard, seconds_since_info_update)
+            self.assertLess(seconds_since_info_update, 300)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -115,6 +115,21 @@ class TestPing(thread_cert.TestCase):
         # ping command should be rejected by CLI.
         self.assertFalse(router2.ping(router3.get_ip6_address(config.ADDRESS_TYPE.RLOC), interface='1::1'))
 
+        # 8. ROUTER_2 pings ROUTER_3 in high-rate mode with a payload
+        # pattern, keeping up to 4 requests outstanding.
+        self.assertTrue(
+            router2.ping(router3.get_ip6_address(config.ADDRESS_TYPE.RLOC),
+                         count=20,
+                         size=64,
+                         max_outstanding=4,
+                         pattern='a55a'))
+
+        # 9. ROUTER_2 pings ROUTER_3 with a payload requiring 6LoWPAN
+        # fragmentation. Every fragment is forwarded by ROUTER_1 as a
+        # Mesh Header frame.
+        self.assertTrue(
+            router2.ping(router3.get_ip6_address(config.ADDRESS_TYPE.RLOC), count=10, size=500, max_outstanding=2))
+
         self.collect_ipaddrs()
         self.collect_rloc16s()
         self.collect_rlocs()
@@ -194,6 +209,28 @@ class TestPing(thread_cert.TestCase):
             .filter_ping_request() \
             .must_next()
 
+        # 8. Router_2 pings Router_3 in high-rate mode. All 20 requests
+        # are answered. Several requests are outstanding at a time, so
+        # requests and replies are checked independently.
+        _pkt = pkts.filter_wpan_src64(vars['Router_2']) \
+            .filter_ipv6_src_dst(vars['Router_2_RLOC'], vars['Router_3_RLOC']) \
+            .filter_ping_request() \
+            .must_next()
+
+        requests = pkts.copy() \
+            .filter_wpan_src64(vars['Router_2']) \
+            .filter_ping_request(identifier=_pkt.icmpv6.echo.identifier)
+        replies = pkts.copy() \
+            .filter_wpan_src64(vars['Router_3']) \
+            .filter_ipv6_dst(_pkt.ipv6.src) \
+            .filter_ping_reply(identifier=_pkt.icmpv6.echo.identifier)
+
+        for i in range(19):
+            requests.must_next()
+
+        for i in range(20):
+            replies.must_next()
+
 
 if __name__ == '__main__':
     unittest.main()
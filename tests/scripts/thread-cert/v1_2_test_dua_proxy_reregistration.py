@@ -0,0 +1,155 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2022, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS 'AS IS'
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+# This script measures how long a Thread 1.2 router takes to re-register the
+# Domain Unicast Addresses of its MTD children (on their behalf) after the
+# Primary Backbone Router requests re-registration.
+#
+
+import unittest
+
+import config
+import thread_cert
+
+BBR_1 = 1  # Collapsed with Leader Role
+ROUTER = 2
+MED_FIRST = 3
+NUM_MEDS = 16
+MEDS = list(range(MED_FIRST, MED_FIRST + NUM_MEDS))
+
+WAIT_ATTACH = 5
+WAIT_REDUNDANCE = 3
+BBR_REGISTRATION_JITTER = 5
+REG_DELAY = 5
+STEP = 0.1
+"""
+ Topology
+
+  BBR_1 (Leader)
+     |
+  ROUTER
+  /  |  \\
+ MED MED ... MED (NUM_MEDS)
+"""
+
+
+class TestDuaProxyReregistration(thread_cert.TestCase):
+    TOPOLOGY = {
+        BBR_1: {
+            'version': '1.2',
+            'allowlist': [ROUTER],
+            'is_bbr': True
+        },
+        ROUTER: {
+            'version': '1.2',
+            'allowlist': [BBR_1] + MEDS,
+        },
+    }
+
+    for med in MEDS:
+        TOPOLOGY[med] = {
+            'version': '1.2',
+            'allowlist': [ROUTER],
+            'mode': 'rn',
+        }
+
+    def _count_dua_registrations(self, nodeid):
+        messages = self.simulator.get_messages_sent_by(nodeid)
+        count = 0
+
+        while messages.next_coap_message('0.02', '/n/dr', False) is not None:
+            count += 1
+
+        return count
+
+    def test(self):
+        self.simulator.set_lowpan_context(1, config.DOMAIN_PREFIX)
+
+        # 1) Bring up BBR_1, BBR_1 becomes Leader and Primary Backbone Router, with Domain Prefix.
+        self.nodes[BBR_1].set_bbr_registration_jitter(BBR_REGISTRATION_JITTER)
+        self.nodes[BBR_1].set_backbone_router(seqno=1, reg_delay=REG_DELAY)
+        self.nodes[BBR_1].start()
+
+        self.simulator.go(WAIT_ATTACH + config.DEFAULT_ROUTER_SELECTION_JITTER)
+        self.assertEqual(self.nodes[BBR_1].get_state(), 'leader')
+        self.nodes[BBR_1].enable_backbone_router()
+        self.simulator.go(BBR_REGISTRATION_JITTER + WAIT_REDUNDANCE)
+        self.assertEqual(self.nodes[BBR_1].get_backbone_router_state(), 'Primary')
+
+        self.nodes[BBR_1].set_domain_prefix(config.DOMAIN_PREFIX, 'prosD')
+        self.simulator.go(WAIT_REDUNDANCE)
+
+        # 2) Bring up ROUTER and its MED children. ROUTER registers its own DUA and
+        #    the DUAs of all its MED children.
+        self.nodes[ROUTER].start()
+        self.simulator.go(WAIT_ATTACH + REG_DELAY + WAIT_REDUNDANCE)
+        self.assertEqual(self.nodes[ROUTER].get_state(), 'router')
+
+        for med in MEDS:
+            self.nodes[med].start()
+
+        self.simulator.go(WAIT_ATTACH * 2 + config.PARENT_AGGREGATIOIN_DELAY + REG_DELAY + WAIT_REDUNDANCE)
+
+        for med in MEDS:
+            self.assertEqual(self.nodes[med].get_state(), 'child')
+            self.assertIsNotNone(self.nodes[med].get_addr(config.DOMAIN_PREFIX))
+
+        self.simulator.go(REG_DELAY + WAIT_REDUNDANCE)
+
+        # 3) Request re-registration by increasing the BBR sequence number. Measure the
+        #    time from the first to the last DUA.req sent by ROUTER, all DUAs (its own and
+        #    the ones of its children) should be re-registered within REG_DELAY.
+        self.flush_all()
+        self.nodes[BBR_1].set_backbone_router(seqno=2)
+
+        elapsed = 0
+        first = None
+        last = None
+        total = 0
+
+        while elapsed < REG_DELAY + WAIT_REDUNDANCE + config.PARENT_AGGREGATIOIN_DELAY:
+            self.simulator.go(STEP)
+            elapsed += STEP
+
+            count = self._count_dua_registrations(ROUTER)
+
+            if count > 0:
+                first = elapsed if first is None else first
+                last = elapsed
+                total += count
+
+        self.assertEqual(total, NUM_MEDS + 1)
+        print('Re-registered %d DUAs in %.2f seconds' % (total, last - first))
+        self.assertLessEqual(last - first, REG_DELAY)
+
+        for med in MEDS:
+            self.assertTrue(self.nodes[BBR_1].ping(self.nodes[med].get_addr(config.DOMAIN_PREFIX)))
+
+
+if __name__ == '__main__':
+    unittest.main()
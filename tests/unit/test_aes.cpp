@@ -26,10 +26,13 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <time.h>
+
 #include <openthread/config.h>
 
 #include "common/debug.hpp"
 #include "crypto/aes_ccm.hpp"
+#include "mac/mac_types.hpp"
 
 #include "test_platform.h"
 #include "test_util.hpp"
@@ -253,11 +256,126 @@ void TestInPlaceAesCcmProcessing(void)
     testFreeInstance(instance);
 }
 
+static void SecureFrame(const ot::Mac::KeyMaterial &aKey, bool aUseCachedSchedule, uint8_t *aFrame, uint16_t aLength)
+{
+    static constexpr uint8_t kHeaderLength = 23;
+    static constexpr uint8_t kTagLength    = 4;
+
+    static const uint8_t kNonce[] = {
+        0xAC, 0xDE, 0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x05,
+    };
+
+    ot::Crypto::AesCcm aesCcm;
+
+    if (aUseCachedSchedule)
+    {
+        aesCcm.SetKey(static_cast<const ot::Mac::CachedKeyMaterial &>(aKey));
+    }
+    else
+    {
+        aesCcm.SetKey(aKey);
+    }
+
+    aesCcm.Init(kHeaderLength, aLength - kHeaderLength - kTagLength, kTagLength, kNonce, sizeof(kNonce));
+    aesCcm.Header(aFrame, kHeaderLength);
+    aesCcm.Payload(aFrame + kHeaderLength, aFrame + kHeaderLength, aLength - kHeaderLength - kTagLength,
+                   ot::Crypto::AesCcm::kEncrypt);
+    aesCcm.Finalize(aFrame + aLength - kTagLength);
+}
+
+/**
+ * Verifies that a cached AES key schedule gives the same result as expanding the key for every frame, that it follows
+ * changes of the key material, and reports the time spent per secured frame with and without it.
+ */
+void TestCachedKeySchedule(void)
+{
+    static constexpr uint16_t kFrameLength = 127;
+    static constexpr uint16_t kNumFrames   = 2000;
+
+    otInstance *               instance = testInitInstance();
+    ot::Mac::Key               key1;
+    ot::Mac::Key               key2;
+    ot::Mac::KeyMaterial       plainKey;
+    ot::Mac::CachedKeyMaterial cachedKey;
+    uint8_t                    frame[kFrameLength];
+    uint8_t                    cachedFrame[kFrameLength];
+    clock_t                    start;
+    double                     plainTime;
+    double                     cachedTime;
+
+    VerifyOrQuit(instance != nullptr);
+
+    for (uint8_t i = 0; i < ot::Mac::Key::kSize; i++)
+    {
+        key1.m8[i] = 0xc0 + i;
+        key2.m8[i] = 0x40 + i;
+    }
+
+    for (uint16_t i = 0; i < kFrameLength; i++)
+    {
+        frame[i] = static_cast<uint8_t>(i);
+    }
+
+    // The cached key schedule must secure a frame exactly as a
+    // freshly expanded key does, across multiple frames.
+
+    plainKey.SetFrom(key1);
+    cachedKey.SetFrom(key1);
+
+    for (uint8_t iter = 0; iter < 3; iter++)
+    {
+        memcpy(cachedFrame, frame, sizeof(frame));
+        SecureFrame(plainKey, /* aUseCachedSchedule */ false, frame, kFrameLength);
+        SecureFrame(cachedKey, /* aUseCachedSchedule */ true, cachedFrame, kFrameLength);
+        VerifyOrQuit(memcmp(frame, cachedFrame, sizeof(frame)) == 0);
+    }
+
+    // Changing the key material (`SetFrom()` or assignment) must
+    // invalidate the cached key schedule.
+
+    plainKey.SetFrom(key2);
+    cachedKey.SetFrom(key2);
+    memcpy(cachedFrame, frame, sizeof(frame));
+    SecureFrame(plainKey, /* aUseCachedSchedule */ false, frame, kFrameLength);
+    SecureFrame(cachedKey, /* aUseCachedSchedule */ true, cachedFrame, kFrameLength);
+    VerifyOrQuit(memcmp(frame, cachedFrame, sizeof(frame)) == 0);
+
+    plainKey.SetFrom(key1);
+    cachedKey = plainKey;
+    memcpy(cachedFrame, frame, sizeof(frame));
+    SecureFrame(plainKey, /* aUseCachedSchedule */ false, frame, kFrameLength);
+    SecureFrame(cachedKey, /* aUseCachedSchedule */ true, cachedFrame, kFrameLength);
+    VerifyOrQuit(memcmp(frame, cachedFrame, sizeof(frame)) == 0);
+
+    start = clock();
+
+    for (uint16_t i = 0; i < kNumFrames; i++)
+    {
+        SecureFrame(plainKey, /* aUseCachedSchedule */ false, frame, kFrameLength);
+    }
+
+    plainTime = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+    start     = clock();
+
+    for (uint16_t i = 0; i < kNumFrames; i++)
+    {
+        SecureFrame(cachedKey, /* aUseCachedSchedule */ true, frame, kFrameLength);
+    }
+
+    cachedTime = static_cast<double>(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("Secured %u frames of %u bytes: %.0f ns/frame expanding the key, %.0f ns/frame with cached key schedule\n",
+           kNumFrames, kFrameLength, plainTime * 1e9 / kNumFrames, cachedTime * 1e9 / kNumFrames);
+
+    testFreeInstance(instance);
+}
+
 int main(void)
 {
     TestMacBeaconFrame();
     TestMacCommandFrame();
     TestInPlaceAesCcmProcessing();
+    TestCachedKeySchedule();
     printf("All tests passed\n");
     return 0;
 }
@@ -0,0 +1,313 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#include "common/code_utils.hpp"
+#include "mac/data_poll_sender.hpp"
+
+namespace ot {
+
+static constexpr uint32_t kMinPeriod     = 250;
+static constexpr uint32_t kPendingPeriod = 1000;
+static constexpr uint32_t kMaxPeriod     = 30000;
+
+void TestAdaptivePollPeriod(void)
+{
+    AdaptivePollPeriod adaptive(kMinPeriod, kPendingPeriod);
+    TimeMilli          now(0);
+    uint32_t           period;
+
+    printf("\nTestAdaptivePollPeriod");
+
+    // No frame received, default period is used.
+
+    adaptive.HandlePollTx(now, kMaxPeriod);
+    VerifyOrQuit(adaptive.GetPeriod() == AdaptivePollPeriod::kNone);
+
+    // A poll retrieves a frame, period should be divided by four on each
+    // following poll with a frame down to the minimum period.
+
+    period = kMaxPeriod;
+
+    while (period > kMinPeriod)
+    {
+        adaptive.HandleRxFrame(now, kMaxPeriod);
+        adaptive.HandlePollTx(now, kMaxPeriod);
+        period = OT_MAX(period / 4, kMinPeriod);
+        VerifyOrQuit(adaptive.GetPeriod() == period);
+        now += 10;
+    }
+
+    // Polls with no frame grow the period back to the default one.
+
+    for (uint8_t i = 0; i < 20; i++)
+    {
+        now += adaptive.GetPeriod();
+        adaptive.HandlePollTx(now, kMaxPeriod);
+
+        if (adaptive.GetPeriod() == AdaptivePollPeriod::kNone)
+        {
+            break;
+        }
+
+        VerifyOrQuit(adaptive.GetPeriod() > period);
+        period = adaptive.GetPeriod();
+    }
+
+    VerifyOrQuit(adaptive.GetPeriod() == AdaptivePollPeriod::kNone);
+
+    // Outstanding requests bound the period.
+
+    adaptive.AddPendingRequest();
+    VerifyOrQuit(adaptive.GetPeriod() == kPendingPeriod);
+    adaptive.AddPendingRequest();
+    adaptive.RemovePendingRequest();
+    VerifyOrQuit(adaptive.GetPeriod() == kPendingPeriod);
+    adaptive.RemovePendingRequest();
+    VerifyOrQuit(adaptive.GetPeriod() == AdaptivePollPeriod::kNone);
+
+    // Periodic frames every 5 seconds. The learned inter-arrival time
+    // bounds the period.
+
+    adaptive.Reset();
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        now += 5000;
+        adaptive.HandleRxFrame(now, kMaxPeriod);
+        adaptive.HandlePollTx(now, kMaxPeriod);
+    }
+
+    VerifyOrQuit(adaptive.GetRxInterval() == 5000);
+
+    // Polls with no frame (within a few expected intervals) do not
+    // grow the period beyond the learned inter-arrival time.
+
+    for (uint8_t i = 0; i < 3; i++)
+    {
+        now += adaptive.GetPeriod();
+        adaptive.HandlePollTx(now, kMaxPeriod);
+        VerifyOrQuit(adaptive.GetPeriod() != AdaptivePollPeriod::kNone);
+        VerifyOrQuit(adaptive.GetPeriod() <= 5000);
+    }
+
+    // When frames stop, the learned inter-arrival time becomes stale
+    // and the default period is used again.
+
+    for (uint8_t i = 0; i < 20; i++)
+    {
+        now += 5000;
+        adaptive.HandlePollTx(now, kMaxPeriod);
+    }
+
+    VerifyOrQuit(adaptive.GetRxInterval() == 0);
+    VerifyOrQuit(adaptive.GetPeriod() == AdaptivePollPeriod::kNone);
+
+    printf(" -- PASS\n");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Simulation of downlink latency and number of polls with different poll policies
+
+enum PollPolicy : uint8_t
+{
+    kFixedDefault,
+    kFixedFast,
+    kAdaptive,
+};
+
+struct SimResult
+{
+    uint32_t mNumPolls;
+    uint32_t mNumFrames;
+    uint64_t mTotalLatency;
+    uint32_t mMaxLatency;
+
+    uint32_t GetAverageLatency(void) const { return static_cast<uint32_t>(mTotalLatency / mNumFrames); }
+};
+
+// Downlink traffic: frames of a burst (e.g., OTA image blocks or CoAP
+// responses) arrive `aFrameInterval` apart, bursts start every
+// `aBurstInterval` with the first one at `aFirstFrame`. The parent
+// queues the frames, a poll retrieves all queued frames.
+
+void Simulate(PollPolicy aPolicy,
+              uint32_t   aBurstInterval,
+              uint8_t    aFramesPerBurst,
+              uint32_t   aFrameInterval,
+              uint32_t   aFirstFrame,
+              uint32_t   aDuration,
+              SimResult &aResult)
+{
+    static constexpr uint8_t kMaxQueued = 64;
+
+    AdaptivePollPeriod adaptive(kMinPeriod, kPendingPeriod);
+    TimeMilli          queue[kMaxQueued];
+    uint8_t            numQueued = 0;
+    uint32_t           nextPoll  = 0;
+    uint32_t           nextFrame = aFirstFrame;
+    uint8_t            frameInBurst = 0;
+
+    for (uint32_t now = 0; now < aDuration; now++)
+    {
+        if (now == nextFrame)
+        {
+            VerifyOrQuit(numQueued < kMaxQueued);
+            queue[numQueued++] = TimeMilli(now);
+
+            if (++frameInBurst < aFramesPerBurst)
+            {
+                nextFrame += aFrameInterval;
+            }
+            else
+            {
+                frameInBurst = 0;
+                nextFrame += aBurstInterval - (aFramesPerBurst - 1) * aFrameInterval;
+            }
+        }
+
+        if (now != nextPoll)
+        {
+            continue;
+        }
+
+        aResult.mNumPolls++;
+
+        switch (aPolicy)
+        {
+        case kFixedDefault:
+            nextPoll = now + kMaxPeriod;
+            break;
+
+        case kFixedFast:
+            nextPoll = now + kMinPeriod;
+            break;
+
+        case kAdaptive:
+            adaptive.HandlePollTx(TimeMilli(now), kMaxPeriod);
+            break;
+        }
+
+        for (uint8_t i = 0; i < numQueued; i++)
+        {
+            uint32_t latency = TimeMilli(now) - queue[i];
+
+            aResult.mNumFrames++;
+            aResult.mTotalLatency += latency;
+            aResult.mMaxLatency = OT_MAX(aResult.mMaxLatency, latency);
+
+            if (aPolicy == kAdaptive)
+            {
+                adaptive.HandleRxFrame(TimeMilli(now), kMaxPeriod);
+            }
+        }
+
+        numQueued = 0;
+
+        if (aPolicy == kAdaptive)
+        {
+            // Mirrors `DataPollSender`: the next poll is scheduled
+            // using the period updated by the poll and received frames.
+            nextPoll = now + ((adaptive.GetPeriod() != AdaptivePollPeriod::kNone) ? adaptive.GetPeriod() : kMaxPeriod);
+        }
+    }
+}
+
+void TestAdaptivePollSimulation(void)
+{
+    struct Traffic
+    {
+        const char *mName;
+        uint32_t    mBurstInterval;
+        uint8_t     mFramesPerBurst;
+        uint32_t    mFrameInterval;
+    };
+
+    static const Traffic kTraffics[] = {
+        {"bursts (10 frames, 2 sec apart, every 2 min)", 120000, 10, 2000},
+        {"periodic (1 frame every 5 sec)", 5000, 1, 0},
+        {"sparse (1 frame every 10 min)", 600000, 1, 0},
+    };
+
+    static const char *const kPolicyNames[] = {"fixed default", "fixed fast", "adaptive"};
+
+    static constexpr uint32_t kDuration  = 3600 * 1000;
+    static constexpr uint8_t  kNumPhases = 10;
+
+    printf("\nTestAdaptivePollSimulation (default period %u ms, min period %u ms, duration 1 hour, %u phases)\n",
+           kMaxPeriod, kMinPeriod, kNumPhases);
+
+    for (const Traffic &traffic : kTraffics)
+    {
+        SimResult results[GetArrayLength(kPolicyNames)];
+
+        printf("\n  %s\n", traffic.mName);
+        printf("  %-14s | %8s | %12s | %12s\n", "policy", "polls", "avg latency", "max latency");
+
+        for (uint8_t policy = kFixedDefault; policy <= kAdaptive; policy++)
+        {
+            SimResult &result = results[policy];
+
+            memset(&result, 0, sizeof(result));
+
+            // Traffic is simulated with its first frame at different
+            // offsets (phases) relative to the first poll.
+
+            for (uint8_t phase = 0; phase < kNumPhases; phase++)
+            {
+                Simulate(static_cast<PollPolicy>(policy), traffic.mBurstInterval, traffic.mFramesPerBurst,
+                         traffic.mFrameInterval, 1 + phase * (kMaxPeriod / kNumPhases), kDuration, result);
+            }
+
+            printf("  %-14s | %8u | %9u ms | %9u ms\n", kPolicyNames[policy], result.mNumPolls,
+                   result.GetAverageLatency(), result.mMaxLatency);
+        }
+
+        // Adaptive polling should never be worse than the default period
+        // in latency, and use far fewer polls than always polling fast.
+
+        VerifyOrQuit(results[kAdaptive].GetAverageLatency() <= results[kFixedDefault].GetAverageLatency());
+        VerifyOrQuit(results[kAdaptive].mNumPolls < results[kFixedFast].mNumPolls / 4);
+    }
+
+    printf("\n -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestAdaptivePollPeriod();
+    ot::TestAdaptivePollSimulation();
+    printf("\nAll tests passed\n");
+    return 0;
+}
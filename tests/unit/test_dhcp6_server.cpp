@@ -0,0 +1,397 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include "common/array.hpp"
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "common/settings.hpp"
+#include "net/dhcp6_server.hpp"
+
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_ENABLE
+
+namespace ot {
+namespace Dhcp6 {
+
+static constexpr uint16_t kMaxLeases  = LeaseTable::kMaxLeases;
+static constexpr uint16_t kNumClients = 3 * kMaxLeases;
+
+// A simple model of the lease table used to verify `LeaseTable`.
+struct TestClient
+{
+    Mac::ExtAddress mExtAddress;
+    uint32_t        mIaid;
+    TimeMilli       mExpireTime;
+    bool            mHasLease;
+};
+
+static TestClient sClients[kNumClients];
+static uint16_t   sNumLeases;
+static uint32_t   sRandomSeed = 1;
+
+static uint32_t GetRandom(uint32_t aMax)
+{
+    // Deterministic linear congruential generator so that a failing
+    // run can be reproduced.
+    sRandomSeed = sRandomSeed * 1103515245u + 12345u;
+
+    return (sRandomSeed >> 8) % aMax;
+}
+
+static TestClient *FindEarliestClient(void)
+{
+    TestClient *earliest = nullptr;
+
+    for (TestClient &client : sClients)
+    {
+        if (client.mHasLease && ((earliest == nullptr) || (client.mExpireTime < earliest->mExpireTime)))
+        {
+            earliest = &client;
+        }
+    }
+
+    return earliest;
+}
+
+static void VerifyLeaseTable(LeaseTable &aTable)
+{
+    Lease *earliest = aTable.GetEarliest();
+
+    VerifyOrQuit(aTable.GetNumLeases() == sNumLeases);
+    VerifyOrQuit(aTable.IsFull() == (sNumLeases == kMaxLeases));
+
+    for (TestClient &client : sClients)
+    {
+        Lease *lease = aTable.Find(client.mExtAddress);
+
+        if (!client.mHasLease)
+        {
+            VerifyOrQuit(lease == nullptr, "Find() returned a removed lease");
+            continue;
+        }
+
+        VerifyOrQuit(lease != nullptr, "Find() failed");
+        VerifyOrQuit(lease->GetClientAddress() == client.mExtAddress);
+        VerifyOrQuit(lease->GetIaid() == client.mIaid);
+        VerifyOrQuit(lease->GetExpireTime() == client.mExpireTime);
+    }
+
+    if (sNumLeases == 0)
+    {
+        VerifyOrQuit(earliest == nullptr);
+    }
+    else
+    {
+        // Leases may share the same expire time, so only the time of
+        // the earliest lease is compared.
+        VerifyOrQuit(earliest != nullptr);
+        VerifyOrQuit(earliest->GetExpireTime() == FindEarliestClient()->mExpireTime, "GetEarliest() is incorrect");
+    }
+}
+
+void TestLeaseTableChurn(void)
+{
+    static constexpr uint32_t kNumIterations = 20000;
+    static constexpr uint32_t kMaxLeaseTime  = 10000;
+
+    LeaseTable *table = new LeaseTable();
+    TimeMilli   now(0);
+    uint32_t    numAdded   = 0;
+    uint32_t    numRenewed = 0;
+    uint32_t    numRemoved = 0;
+    uint32_t    numEvicted = 0;
+    uint32_t    numExpired = 0;
+
+    printf("TestLeaseTableChurn");
+
+    for (uint16_t i = 0; i < kNumClients; i++)
+    {
+        memset(&sClients[i], 0, sizeof(TestClient));
+        sClients[i].mExtAddress.m8[0] = 0x12;
+        sClients[i].mExtAddress.m8[6] = static_cast<uint8_t>(i >> 8);
+        sClients[i].mExtAddress.m8[7] = static_cast<uint8_t>(i & 0xff);
+    }
+
+    sNumLeases = 0;
+    VerifyLeaseTable(*table);
+
+    for (uint32_t iteration = 0; iteration < kNumIterations; iteration++)
+    {
+        TestClient &client = sClients[GetRandom(kNumClients)];
+        TimeMilli   expireTime(now + 1 + GetRandom(kMaxLeaseTime));
+        Lease *     lease;
+
+        if (!client.mHasLease)
+        {
+            if (table->IsFull())
+            {
+                TestClient *evicted;
+
+                VerifyOrQuit(table->Add(client.mExtAddress, 0, expireTime) == nullptr, "Add() succeeded on full table");
+
+                lease   = table->GetEarliest();
+                evicted = FindEarliestClient();
+                VerifyOrQuit(lease->GetExpireTime() == evicted->mExpireTime);
+
+                for (TestClient &other : sClients)
+                {
+                    if (other.mHasLease && (other.mExtAddress == lease->GetClientAddress()))
+                    {
+                        other.mHasLease = false;
+                    }
+                }
+
+                table->Remove(*lease);
+                sNumLeases--;
+                numEvicted++;
+            }
+
+            client.mIaid       = GetRandom(0xffff);
+            client.mExpireTime = expireTime;
+            client.mHasLease   = true;
+
+            lease = table->Add(client.mExtAddress, client.mIaid, client.mExpireTime);
+            VerifyOrQuit(lease != nullptr, "Add() failed");
+            sNumLeases++;
+            numAdded++;
+        }
+        else if (GetRandom(4) != 0)
+        {
+            client.mExpireTime = expireTime;
+            table->UpdateExpireTime(*table->Find(client.mExtAddress), expireTime);
+            numRenewed++;
+        }
+        else
+        {
+            table->Remove(*table->Find(client.mExtAddress));
+            client.mHasLease = false;
+            sNumLeases--;
+            numRemoved++;
+        }
+
+        VerifyLeaseTable(*table);
+
+        // Advance the time and remove the expired leases in the same
+        // way the `Server` does when its lease timer fires.
+
+        now += GetRandom(kMaxLeaseTime / 40);
+
+        while (((lease = table->GetEarliest()) != nullptr) && (lease->GetExpireTime() <= now))
+        {
+            for (TestClient &other : sClients)
+            {
+                if (other.mHasLease && (other.mExtAddress == lease->GetClientAddress()))
+                {
+                    VerifyOrQuit(other.mExpireTime <= now);
+                    other.mHasLease = false;
+                }
+            }
+
+            table->Remove(*lease);
+            sNumLeases--;
+            numExpired++;
+        }
+
+        VerifyLeaseTable(*table);
+    }
+
+    printf("\n  added:%u, renewed:%u, removed:%u, evicted:%u, expired:%u", numAdded, numRenewed, numRemoved,
+           numEvicted, numExpired);
+
+    VerifyOrQuit(numEvicted > 0);
+    VerifyOrQuit(numExpired > 0);
+
+    table->Clear();
+    sNumLeases = 0;
+
+    for (TestClient &client : sClients)
+    {
+        client.mHasLease = false;
+    }
+
+    VerifyLeaseTable(*table);
+
+    // After `Clear()` all entries are available again.
+
+    for (uint16_t i = 0; i < kMaxLeases; i++)
+    {
+        VerifyOrQuit(table->Add(sClients[i].mExtAddress, 0, now + i) != nullptr);
+    }
+
+    VerifyOrQuit(table->IsFull());
+
+    delete table;
+
+    printf(" -- PASS\n");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Settings
+
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+
+static uint8_t  sSettingsValue[1024];
+static uint16_t sSettingsLength;
+static bool     sSettingsHasValue = false;
+
+extern "C" {
+
+otError otPlatSettingsGet(otInstance *, uint16_t aKey, int aIndex, uint8_t *aValue, uint16_t *aValueLength)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit((aKey == SettingsBase::kKeyDhcp6ServerLeases) && (aIndex == 0) && sSettingsHasValue,
+                 error = OT_ERROR_NOT_FOUND);
+
+    if (aValue != nullptr)
+    {
+        memcpy(aValue, sSettingsValue, OT_MIN(*aValueLength, sSettingsLength));
+    }
+
+    *aValueLength = sSettingsLength;
+
+exit:
+    return error;
+}
+
+otError otPlatSettingsSet(otInstance *, uint16_t aKey, const uint8_t *aValue, uint16_t aValueLength)
+{
+    if (aKey == SettingsBase::kKeyDhcp6ServerLeases)
+    {
+        VerifyOrQuit(aValueLength <= sizeof(sSettingsValue));
+        memcpy(sSettingsValue, aValue, aValueLength);
+        sSettingsLength   = aValueLength;
+        sSettingsHasValue = true;
+    }
+
+    return OT_ERROR_NONE;
+}
+
+otError otPlatSettingsDelete(otInstance *, uint16_t aKey, int)
+{
+    if (aKey == SettingsBase::kKeyDhcp6ServerLeases)
+    {
+        sSettingsHasValue = false;
+    }
+
+    return OT_ERROR_NONE;
+}
+
+} // extern "C"
+
+void TestLeaseSettings(void)
+{
+    static constexpr uint16_t kNumSaved = 5;
+
+    Instance *                 instance = testInitInstance();
+    Settings::Dhcp6ServerLease saved[kNumSaved];
+    Settings::Dhcp6ServerLease read[kNumSaved + 2];
+    uint16_t                   numRead;
+
+    printf("TestLeaseSettings");
+
+    VerifyOrQuit(instance != nullptr);
+
+    numRead = GetArrayLength(read);
+    VerifyOrQuit(instance->Get<Settings>().ReadDhcp6ServerLeases(read, numRead) == kErrorNotFound);
+    VerifyOrQuit(numRead == 0);
+
+    for (uint16_t i = 0; i < kNumSaved; i++)
+    {
+        Mac::ExtAddress extAddress;
+
+        memset(&extAddress, i + 1, sizeof(extAddress));
+
+        saved[i].Init();
+        saved[i].SetClientAddress(extAddress);
+        saved[i].SetIaid(0x10000 + i);
+        saved[i].SetRemainingTime(100 * i);
+    }
+
+    SuccessOrQuit(instance->Get<Settings>().SaveDhcp6ServerLeases(saved, kNumSaved));
+
+    numRead = GetArrayLength(read);
+    SuccessOrQuit(instance->Get<Settings>().ReadDhcp6ServerLeases(read, numRead));
+    VerifyOrQuit(numRead == kNumSaved);
+
+    for (uint16_t i = 0; i < kNumSaved; i++)
+    {
+        VerifyOrQuit(read[i].GetClientAddress() == saved[i].GetClientAddress());
+        VerifyOrQuit(read[i].GetIaid() == 0x10000 + i);
+        VerifyOrQuit(read[i].GetRemainingTime() == 100u * i);
+    }
+
+    // Read into a smaller array (e.g., after the lease table size is
+    // reduced): only the entries that fit are read.
+
+    numRead = 2;
+    SuccessOrQuit(instance->Get<Settings>().ReadDhcp6ServerLeases(read, numRead));
+    VerifyOrQuit(numRead == 2);
+    VerifyOrQuit(read[1].GetClientAddress() == saved[1].GetClientAddress());
+
+    // Saving an empty table deletes the saved value.
+
+    SuccessOrQuit(instance->Get<Settings>().SaveDhcp6ServerLeases(saved, 0));
+
+    numRead = GetArrayLength(read);
+    VerifyOrQuit(instance->Get<Settings>().ReadDhcp6ServerLeases(read, numRead) == kErrorNotFound);
+    VerifyOrQuit(numRead == 0);
+
+    testFreeInstance(instance);
+
+    printf(" -- PASS\n");
+}
+
+#endif // OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+
+} // namespace Dhcp6
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_DHCP6_SERVER_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_ENABLE
+    ot::Dhcp6::TestLeaseTableChurn();
+#if OPENTHREAD_CONFIG_DHCP6_SERVER_PERSIST_LEASES_ENABLE
+    ot::Dhcp6::TestLeaseSettings();
+#endif
+    printf("\nAll tests passed.\n");
+#else
+    printf("DHCPv6 server feature is not enabled\n");
+#endif
+
+    return 0;
+}
@@ -26,6 +26,8 @@
  *  POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <chrono>
+
 #include <string.h>
 
 #include <openthread/config.h>
@@ -768,6 +770,323 @@ void TestDnsCompressedName(void)
     testFreeInstance(instance);
 }
 
+void TestDnsNameCompressor(void)
+{
+    enum
+    {
+        kHeaderOffset   = 10,
+        kGuardBlockSize = 20,
+    };
+
+    struct TestName
+    {
+        const char *mLabel;
+        const char *mName;
+        uint16_t    mEncodedSize;
+    };
+
+    // A typical DNS-SD response/SRP update carrying multiple
+    // service types, instances, sub-types and hosts.
+
+    static const TestName kTestNames[] = {
+        {nullptr, "_hap._tcp.default.service.arpa.", 32},                   // Full name (nothing to compress).
+        {nullptr, "_matter._tcp.default.service.arpa.", 8 + 2},             // "_matter" + pointer to "_tcp..."
+        {"Living Room Lamp", "_hap._tcp.default.service.arpa.", 17 + 2},    // Instance label + pointer.
+        {"Kitchen.Light", "_matter._tcp.default.service.arpa.", 14 + 2},    // Instance label with dot + pointer.
+        {nullptr, "lamp-1.default.service.arpa.", 7 + 2},                   // Host label + pointer to domain.
+        {nullptr, "_hap._tcp.default.service.arpa.", 2},                    // Pointer.
+        {"Living Room Lamp", "_hap._tcp.default.service.arpa.", 2},         // Pointer.
+        {nullptr, "LAMP-1.DEFAULT.service.arpa", 2},                        // Pointer (case-insensitive match).
+        {"_kitchen", "_sub._matter._tcp.default.service.arpa.", 9 + 5 + 2}, // Sub-type + "_sub" + pointer.
+        {"_bedroom", "_sub._matter._tcp.default.service.arpa.", 9 + 2},     // Sub-type + pointer to "_sub...".
+        {nullptr, "lamp-2.default.service.arpa.", 7 + 2},                   // Host label + pointer to domain.
+        {nullptr, "example.com", 13},                                       // Full name (nothing to compress).
+    };
+
+    Instance *          instance;
+    MessagePool *       messagePool;
+    Message *           message;
+    Message *           message2;
+    Dns::NameCompressor compressor;
+    uint16_t            offsets[GetArrayLength(kTestNames)];
+    uint16_t            offset;
+    uint16_t            compressedSize;
+    uint16_t            uncompressedSize;
+    uint16_t            expectedSize = 0;
+    char                name[Dns::Name::kMaxNameSize];
+
+    printf("================================================================\n");
+    printf("TestDnsNameCompressor()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    messagePool = &instance->Get<MessagePool>();
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+    VerifyOrQuit((message2 = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+
+    for (uint8_t index = 0; index < kHeaderOffset + kGuardBlockSize; index++)
+    {
+        SuccessOrQuit(message->Append(index));
+    }
+
+    message->SetOffset(kHeaderOffset);
+
+    for (uint16_t index = 0; index < GetArrayLength(kTestNames); index++)
+    {
+        const TestName &testName = kTestNames[index];
+
+        offsets[index] = message->GetLength();
+
+        if (testName.mLabel != nullptr)
+        {
+            SuccessOrQuit(compressor.AppendName(testName.mLabel, testName.mName, *message));
+            SuccessOrQuit(Dns::Name::AppendLabel(testName.mLabel, *message2));
+        }
+        else
+        {
+            SuccessOrQuit(compressor.AppendName(testName.mName, *message));
+        }
+
+        SuccessOrQuit(Dns::Name::AppendName(testName.mName, *message2));
+
+        printf("%-18s %-42s -> %u bytes\n", testName.mLabel != nullptr ? testName.mLabel : "", testName.mName,
+               message->GetLength() - offsets[index]);
+
+        VerifyOrQuit(message->GetLength() - offsets[index] == testName.mEncodedSize,
+                     "NameCompressor::AppendName() encoded size is incorrect");
+
+        expectedSize += testName.mEncodedSize;
+    }
+
+    compressedSize   = message->GetLength() - (kHeaderOffset + kGuardBlockSize);
+    uncompressedSize = message2->GetLength();
+
+    printf("Compressed size: %u, uncompressed size: %u\n", compressedSize, uncompressedSize);
+
+    VerifyOrQuit(compressedSize == expectedSize);
+    VerifyOrQuit(compressedSize < uncompressedSize / 2);
+
+    // Verify that all the names can be parsed and match the original names.
+
+    for (uint16_t index = 0; index < GetArrayLength(kTestNames); index++)
+    {
+        const TestName &testName = kTestNames[index];
+
+        offset = offsets[index];
+        SuccessOrQuit(Dns::Name::ParseName(*message, offset));
+        VerifyOrQuit(offset == offsets[index] + testName.mEncodedSize, "Name::ParseName() returned incorrect offset");
+
+        offset = offsets[index];
+
+        if (testName.mLabel != nullptr)
+        {
+            SuccessOrQuit(Dns::Name::CompareLabel(*message, offset, testName.mLabel));
+        }
+
+        SuccessOrQuit(Dns::Name::CompareName(*message, offset, testName.mName));
+    }
+
+    offset = offsets[7];
+    SuccessOrQuit(Dns::Name::ReadName(*message, offset, name, sizeof(name)));
+    printf("Read name = \"%s\"\n", name);
+    VerifyOrQuit(strcmp(name, "lamp-1.default.service.arpa.") == 0);
+
+    // Truncate the message (removing the first host name and all the
+    // names after it) and check that the stale dictionary entries are
+    // not used.
+
+    SuccessOrQuit(message->SetLength(offsets[4]));
+    SuccessOrQuit(compressor.AppendName("lamp-1.default.service.arpa.", *message));
+    VerifyOrQuit(message->GetLength() - offsets[4] == 7 + 2);
+
+    offset = offsets[4];
+    SuccessOrQuit(Dns::Name::CompareName(*message, offset, "lamp-1.default.service.arpa"));
+
+    // Invalid names must be rejected.
+
+    VerifyOrQuit(compressor.AppendName("bad..name", *message) == kErrorInvalidArgs);
+    VerifyOrQuit(compressor.AppendName("", "name", *message) == kErrorInvalidArgs);
+
+    message->Free();
+    message2->Free();
+    testFreeInstance(instance);
+}
+
+void TestDnsNameHash(void)
+{
+    enum
+    {
+        kNumRecords    = 100,
+        kNumIterations = 200,
+        kTtl           = 300,
+    };
+
+    const char kDomainName[] = "default.service.arpa.";
+
+    Instance *          instance;
+    MessagePool *       messagePool;
+    Message *           message;
+    Dns::Header         header;
+    Dns::NameCompressor compressor;
+    Dns::AaaaRecord     aaaaRecord;
+    Ip6::Address        address;
+    uint16_t            offset;
+    uint16_t            offset2;
+    uint16_t            recordsOffset;
+    uint16_t            nameOffsets[kNumRecords];
+    uint32_t            hash;
+    char                name[Dns::Name::kMaxNameSize];
+    char                name2[Dns::Name::kMaxNameSize];
+
+    printf("================================================================\n");
+    printf("TestDnsNameHash()\n");
+
+    instance = static_cast<Instance *>(testInitInstance());
+    VerifyOrQuit(instance != nullptr, "Null OpenThread instance");
+
+    messagePool = &instance->Get<MessagePool>();
+    VerifyOrQuit((message = messagePool->Allocate(Message::kTypeIp6)) != nullptr);
+
+    // Hash of equivalent name strings.
+
+    VerifyOrQuit(Dns::Name::CalculateHash("") == Dns::Name::CalculateHash("."));
+    VerifyOrQuit(Dns::Name::CalculateHash("example.com") == Dns::Name::CalculateHash("example.com."));
+    VerifyOrQuit(Dns::Name::CalculateHash("example.com") == Dns::Name::CalculateHash("EXAMPLE.Com"));
+    VerifyOrQuit(Dns::Name::CalculateHash("example.com") != Dns::Name::CalculateHash("example.co"));
+    VerifyOrQuit(Dns::Name::CalculateHash("example.com") != Dns::Name::CalculateHash("examplec.om"));
+    VerifyOrQuit(Dns::Name::CalculateHash("example.com") != Dns::Name::CalculateHash("com.example"));
+
+    // Prepare a response with `kNumRecords` AAAA records, each with a
+    // different host name (sharing the domain suffix which is
+    // compressed).
+
+    header.Clear();
+    header.SetType(Dns::Header::kTypeResponse);
+    header.SetAnswerCount(kNumRecords);
+    SuccessOrQuit(message->Append(header));
+    message->SetOffset(0);
+
+    recordsOffset = message->GetLength();
+
+    for (uint16_t index = 0; index < kNumRecords; index++)
+    {
+        snprintf(name, sizeof(name), "Host-%u.%s", index, kDomainName);
+
+        nameOffsets[index] = message->GetLength();
+        SuccessOrQuit(compressor.AppendName(name, *message));
+
+        SuccessOrQuit(address.FromString("fd00::1"));
+        address.mFields.m16[7] = Encoding::BigEndian::HostSwap16(index);
+
+        aaaaRecord.Init();
+        aaaaRecord.SetTtl(kTtl);
+        aaaaRecord.SetAddress(address);
+        SuccessOrQuit(message->Append(aaaaRecord));
+    }
+
+    printf("Message length with %u records: %u\n", kNumRecords, message->GetLength());
+
+    // Verify that the hash calculated while parsing each (compressed)
+    // name matches the hash of the name string (using different case)
+    // and that the names can be read and compared. The message spans
+    // multiple buffers, so some labels are not contiguous.
+
+    offset = recordsOffset;
+
+    for (uint16_t index = 0; index < kNumRecords; index++)
+    {
+        VerifyOrQuit(offset == nameOffsets[index]);
+
+        snprintf(name, sizeof(name), "HOST-%u.Default.Service.Arpa", index);
+
+        SuccessOrQuit(Dns::Name::ParseName(*message, offset, hash));
+        VerifyOrQuit(hash == Dns::Name::CalculateHash(name));
+        VerifyOrQuit(hash != Dns::Name::CalculateHash(kDomainName));
+
+        offset2 = nameOffsets[index];
+        SuccessOrQuit(Dns::Name::ReadName(*message, offset2, name2, sizeof(name2)));
+        VerifyOrQuit(offset2 == offset);
+        VerifyOrQuit(hash == Dns::Name::CalculateHash(name2));
+
+        offset2 = nameOffsets[index];
+        SuccessOrQuit(Dns::Name::CompareName(*message, offset2, name));
+        VerifyOrQuit(offset2 == offset);
+
+        offset2 = recordsOffset;
+        VerifyOrQuit(Dns::Name::CompareName(*message, offset2, *message, nameOffsets[index]) ==
+                     ((index == 0) ? kErrorNone : kErrorNotFound));
+
+        offset += sizeof(Dns::AaaaRecord);
+    }
+
+    // Find every record by its name (from string and from message).
+
+    for (uint16_t index = 0; index < kNumRecords; index++)
+    {
+        snprintf(name, sizeof(name), "host-%u.DEFAULT.service.arpa.", index);
+
+        offset = recordsOffset;
+        SuccessOrQuit(Dns::ResourceRecord::FindRecord(*message, offset, kNumRecords, /* aIndex */ 0, Dns::Name(name),
+                                                      aaaaRecord));
+        VerifyOrQuit(aaaaRecord.GetAddress().mFields.m16[7] == Encoding::BigEndian::HostSwap16(index));
+
+        offset = recordsOffset;
+        SuccessOrQuit(Dns::ResourceRecord::FindRecord(*message, offset, kNumRecords, /* aIndex */ 0,
+                                                      Dns::Name(*message, nameOffsets[index]), aaaaRecord));
+        VerifyOrQuit(aaaaRecord.GetAddress().mFields.m16[7] == Encoding::BigEndian::HostSwap16(index));
+
+        offset = recordsOffset;
+        VerifyOrQuit(Dns::ResourceRecord::FindRecord(*message, offset, kNumRecords, /* aIndex */ 1, Dns::Name(name),
+                                                     aaaaRecord) == kErrorNotFound);
+    }
+
+    snprintf(name, sizeof(name), "host-%u.%s", kNumRecords, kDomainName);
+    offset = recordsOffset;
+    VerifyOrQuit(Dns::ResourceRecord::FindRecord(*message, offset, kNumRecords, /* aIndex */ 0, Dns::Name(name),
+                                                 aaaaRecord) == kErrorNotFound);
+
+    // Benchmark parsing all the records and finding the last record.
+
+    snprintf(name, sizeof(name), "host-%u.%s", kNumRecords - 1, kDomainName);
+
+    {
+        std::chrono::steady_clock::time_point start;
+        uint32_t                              parseDuration;
+        uint32_t                              findDuration;
+
+        start = std::chrono::steady_clock::now();
+
+        for (uint16_t iteration = 0; iteration < kNumIterations; iteration++)
+        {
+            offset = recordsOffset;
+            SuccessOrQuit(Dns::ResourceRecord::ParseRecords(*message, offset, kNumRecords));
+            VerifyOrQuit(offset == message->GetLength());
+        }
+
+        parseDuration = static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+        start = std::chrono::steady_clock::now();
+
+        for (uint16_t iteration = 0; iteration < kNumIterations; iteration++)
+        {
+            offset = recordsOffset;
+            SuccessOrQuit(Dns::ResourceRecord::FindRecord(*message, offset, kNumRecords, /* aIndex */ 0,
+                                                          Dns::Name(name), aaaaRecord));
+        }
+
+        findDuration = static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+        printf("%u records, %u iterations: ParseRecords() %u usec, FindRecord() of last record %u usec\n",
+               kNumRecords, kNumIterations, parseDuration, findDuration);
+    }
+
+    message->Free();
+    testFreeInstance(instance);
+}
+
 void TestHeaderAndResourceRecords(void)
 {
     enum
@@ -1376,6 +1695,8 @@ int main(void)
 {
     ot::TestDnsName();
     ot::TestDnsCompressedName();
+    ot::TestDnsNameCompressor();
+    ot::TestDnsNameHash();
     ot::TestHeaderAndResourceRecords();
     ot::TestDnsTxtEntry();
 
@@ -0,0 +1,589 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include <openthread/ip6.h>
+#include <openthread/platform/radio.h>
+#include <openthread/srp_client.h>
+#include <openthread/srp_server.h>
+#include <openthread/tasklet.h>
+#include <openthread/thread.h>
+#include <openthread/thread_ftd.h>
+
+#include "common/arg_macros.hpp"
+#include "common/as_core_type.hpp"
+#include "common/instance.hpp"
+#include "net/dns_dso.hpp"
+#include "net/dns_types.hpp"
+#include "net/dnssd_server.hpp"
+#include "net/srp_client.hpp"
+
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE && OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE && \
+    !OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+
+extern "C" {
+
+static uint32_t    sNow = 0;
+static uint32_t    sAlarmTime;
+static bool        sAlarmOn = false;
+static otInstance *sInstance;
+
+// Radio frames sent by the device are dropped (device is the only
+// one in the network). Tx done is signalled from `ProcessTasklets()`.
+static uint8_t       sRadioTxPsdu[OT_RADIO_FRAME_MAX_SIZE];
+static otRadioIeInfo sRadioTxIeInfo;
+static otRadioFrame  sRadioTxFrame;
+static bool          sRadioTxOngoing = false;
+
+// Logs a message and adds current time (sNow) as "<hours>:<min>:<secs>.<msec>"
+#define Log(...)                                                                                          \
+    printf("%02u:%02u:%02u.%03u " OT_FIRST_ARG(__VA_ARGS__) "\n", (sNow / 36000000), (sNow / 60000) % 60, \
+           (sNow / 1000) % 60, sNow % 1000 OT_REST_ARGS(__VA_ARGS__))
+
+void otPlatAlarmMilliStop(otInstance *)
+{
+    sAlarmOn = false;
+}
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void)
+{
+    return sNow;
+}
+
+otRadioFrame *otPlatRadioGetTransmitBuffer(otInstance *)
+{
+    sRadioTxFrame.mPsdu                 = sRadioTxPsdu;
+    sRadioTxFrame.mInfo.mTxInfo.mIeInfo = &sRadioTxIeInfo;
+    return &sRadioTxFrame;
+}
+
+otError otPlatRadioTransmit(otInstance *, otRadioFrame *)
+{
+    sRadioTxOngoing = true;
+    return OT_ERROR_NONE;
+}
+
+} // extern "C"
+
+void ProcessTasklets(void)
+{
+    do
+    {
+        if (sRadioTxOngoing)
+        {
+            sRadioTxOngoing = false;
+            otPlatRadioTxDone(sInstance, &sRadioTxFrame, nullptr, OT_ERROR_NONE);
+        }
+
+        while (otTaskletsArePending(sInstance))
+        {
+            otTaskletsProcess(sInstance);
+        }
+    } while (sRadioTxOngoing);
+}
+
+void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    Log(" AdvanceTime for %u.%03u", aDuration / 1000, aDuration % 1000);
+
+    ProcessTasklets();
+
+    while (sAlarmOn && (sAlarmTime <= time))
+    {
+        sNow = sAlarmTime;
+        otPlatAlarmMilliFired(sInstance);
+        ProcessTasklets();
+    }
+
+    sNow = time;
+}
+
+namespace ot {
+namespace Dns {
+
+static constexpr uint16_t kDsoPort         = 853;
+static constexpr uint16_t kMaxPushRecords  = 16;
+static constexpr uint32_t kPushRemoveTtl   = 0xffffffff;
+static constexpr uint8_t  kMaxSubscription = OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_MAX_SUBSCRIPTIONS;
+
+// DNS Push client connection. It records the response code of the
+// last SUBSCRIBE request and the records in the last PUSH message.
+
+class PushClient : public Dso::Connection
+{
+public:
+    struct Record
+    {
+        char     mName[Name::kMaxNameSize];
+        uint16_t mType;
+        uint32_t mTtl;
+    };
+
+    PushClient(Instance &aInstance, const Ip6::SockAddr &aLocalSockAddr, const Ip6::SockAddr &aPeerSockAddr)
+        : Dso::Connection(aInstance, aPeerSockAddr, sCallbacks)
+        , mLocalSockAddr(aLocalSockAddr)
+        , mPushCount(0)
+        , mNumRecords(0)
+        , mDidGetResponse(false)
+        , mDidGetDisconnectSignal(false)
+    {
+    }
+
+    const Ip6::SockAddr &GetLocalSockAddr(void) const { return mLocalSockAddr; }
+
+    MessageId Subscribe(const char *aName, uint16_t aType)
+    {
+        Message * message = NewMessage();
+        Dso::Tlv  tlv;
+        MessageId messageId;
+
+        Log(" Subscribe(%s, type:%u)", aName, aType);
+
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->Append(tlv));
+        SuccessOrQuit(Name::AppendName(aName, *message));
+        SuccessOrQuit(message->Append(Question(aType)));
+        tlv.Init(Dso::Tlv::kSubscribeType, message->GetLength() - sizeof(tlv));
+        message->Write(0, tlv);
+
+        mDidGetResponse = false;
+        SuccessOrQuit(SendRequestMessage(*message, messageId));
+
+        return messageId;
+    }
+
+    void Unsubscribe(MessageId aMessageId)
+    {
+        Message *message = NewMessage();
+        Dso::Tlv tlv;
+
+        Log(" Unsubscribe(id:%u)", aMessageId);
+
+        VerifyOrQuit(message != nullptr);
+        tlv.Init(Dso::Tlv::kUnsubscribeType, sizeof(uint16_t));
+        SuccessOrQuit(message->Append(tlv));
+        SuccessOrQuit(message->Append<uint16_t>(HostSwap16(aMessageId)));
+        SuccessOrQuit(SendUnidirectionalMessage(*message));
+    }
+
+    void ClearPush(void)
+    {
+        mPushCount  = 0;
+        mNumRecords = 0;
+    }
+
+    bool                  DidGetResponse(void) const { return mDidGetResponse; }
+    Dns::Header::Response GetLastResponseCode(void) const { return mLastResponseCode; }
+    bool                  DidGetDisconnectSignal(void) const { return mDidGetDisconnectSignal; }
+    uint16_t              GetPushCount(void) const { return mPushCount; }
+    uint16_t              GetNumRecords(void) const { return mNumRecords; }
+    const Record &        GetRecord(uint16_t aIndex) const { return mRecords[aIndex]; }
+
+    void VerifyRecord(uint16_t aIndex, const char *aName, uint16_t aType, bool aIsRemove) const
+    {
+        const Record &record = mRecords[aIndex];
+
+        VerifyOrQuit(aIndex < mNumRecords);
+        VerifyOrQuit(StringMatch(record.mName, aName, kStringCaseInsensitiveMatch));
+        VerifyOrQuit(record.mType == aType);
+        VerifyOrQuit(aIsRemove ? (record.mTtl == kPushRemoveTtl) : (record.mTtl > 0 && record.mTtl < kPushRemoveTtl));
+    }
+
+private:
+    void HandleDisconnected(void) { mDidGetDisconnectSignal = true; }
+
+    Error ProcessUnidirectionalMessage(const Message &aMessage, Dso::Tlv::Type aPrimaryTlvType)
+    {
+        uint16_t offset = aMessage.GetOffset();
+        uint16_t endOffset;
+        Dso::Tlv tlv;
+
+        Log(" Received PUSH message");
+
+        VerifyOrQuit(aPrimaryTlvType == Dso::Tlv::kPushType);
+        SuccessOrQuit(aMessage.Read(offset, tlv));
+        offset += sizeof(tlv);
+        endOffset = offset + tlv.GetLength();
+
+        mPushCount++;
+
+        while (offset < endOffset)
+        {
+            Record &       record = mRecords[mNumRecords];
+            ResourceRecord resourceRecord;
+
+            VerifyOrQuit(mNumRecords < kMaxPushRecords);
+
+            SuccessOrQuit(Name::ReadName(aMessage, offset, record.mName, sizeof(record.mName)));
+            SuccessOrQuit(aMessage.Read(offset, resourceRecord));
+            VerifyOrQuit(resourceRecord.GetClass() == ResourceRecord::kClassInternet);
+            record.mType = resourceRecord.GetType();
+            record.mTtl  = resourceRecord.GetTtl();
+            offset += resourceRecord.GetSize();
+
+            Log("   %s type:%u ttl:%u", record.mName, record.mType, record.mTtl);
+            mNumRecords++;
+        }
+
+        VerifyOrQuit(offset == endOffset);
+
+        return kErrorNone;
+    }
+
+    Error ProcessResponseMessage(const Dns::Header &aHeader)
+    {
+        mDidGetResponse   = true;
+        mLastResponseCode = aHeader.GetResponseCode();
+        Log(" Received response, response-code:%u", mLastResponseCode);
+
+        return kErrorNone;
+    }
+
+    static void HandleConnected(Dso::Connection &) {}
+    static void HandleSessionEstablished(Dso::Connection &) {}
+
+    static void HandleDisconnected(Dso::Connection &aConnection)
+    {
+        static_cast<PushClient &>(aConnection).HandleDisconnected();
+    }
+
+    static Error ProcessRequestMessage(Dso::Connection &, MessageId, const Message &, Dso::Tlv::Type)
+    {
+        return kErrorNotFound;
+    }
+
+    static Error ProcessUnidirectionalMessage(Dso::Connection &aConnection,
+                                              const Message &  aMessage,
+                                              Dso::Tlv::Type   aPrimaryTlvType)
+    {
+        return static_cast<PushClient &>(aConnection).ProcessUnidirectionalMessage(aMessage, aPrimaryTlvType);
+    }
+
+    static Error ProcessResponseMessage(Dso::Connection &  aConnection,
+                                        const Dns::Header &aHeader,
+                                        const Message &,
+                                        Dso::Tlv::Type,
+                                        Dso::Tlv::Type)
+    {
+        return static_cast<PushClient &>(aConnection).ProcessResponseMessage(aHeader);
+    }
+
+    Ip6::SockAddr         mLocalSockAddr;
+    uint16_t              mPushCount;
+    uint16_t              mNumRecords;
+    Record                mRecords[kMaxPushRecords];
+    bool                  mDidGetResponse;
+    bool                  mDidGetDisconnectSignal;
+    Dns::Header::Response mLastResponseCode;
+
+    static Callbacks sCallbacks;
+};
+
+Dso::Connection::Callbacks PushClient::sCallbacks(PushClient::HandleConnected,
+                                                  PushClient::HandleSessionEstablished,
+                                                  PushClient::HandleDisconnected,
+                                                  PushClient::ProcessRequestMessage,
+                                                  PushClient::ProcessUnidirectionalMessage,
+                                                  PushClient::ProcessResponseMessage);
+
+//---------------------------------------------------------------------------------------------------------------------
+// Fake DSO transport between the `PushClient` and the session
+// accepted by the DNS-SD server.
+
+static PushClient *         sClient;
+static otPlatDsoConnection *sServerSession;
+static bool                 sDsoListening = false;
+
+extern "C" {
+
+void otPlatDsoEnableListening(otInstance *, bool aEnable)
+{
+    Log(" otPlatDsoEnableListening(%s)", aEnable ? "true" : "false");
+    sDsoListening = aEnable;
+}
+
+void otPlatDsoConnect(otPlatDsoConnection *aConnection, const otSockAddr *aPeerSockAddr)
+{
+    OT_UNUSED_VARIABLE(aPeerSockAddr);
+
+    Log(" otPlatDsoConnect()");
+
+    VerifyOrQuit(aConnection == sClient);
+    VerifyOrExit(sDsoListening);
+
+    sServerSession = otPlatDsoAccept(sInstance, &sClient->GetLocalSockAddr());
+    VerifyOrExit(sServerSession != nullptr);
+
+    otPlatDsoHandleConnected(sServerSession);
+    otPlatDsoHandleConnected(aConnection);
+
+exit:
+    return;
+}
+
+void otPlatDsoSend(otPlatDsoConnection *aConnection, otMessage *aMessage)
+{
+    if (aConnection == sClient)
+    {
+        VerifyOrQuit(sServerSession != nullptr);
+        otPlatDsoHandleReceive(sServerSession, aMessage);
+    }
+    else
+    {
+        VerifyOrQuit(aConnection == sServerSession);
+        otPlatDsoHandleReceive(sClient, aMessage);
+    }
+}
+
+void otPlatDsoDisconnect(otPlatDsoConnection *aConnection, otPlatDsoDisconnectMode aMode)
+{
+    otPlatDsoConnection *peer = (aConnection == sClient) ? sServerSession : sClient;
+
+    Log(" otPlatDsoDisconnect(%s)", (aConnection == sClient) ? "client" : "server");
+
+    sServerSession = nullptr;
+
+    if (peer != nullptr)
+    {
+        otPlatDsoHandleDisconnected(peer, aMode);
+    }
+}
+
+} // extern "C"
+
+//---------------------------------------------------------------------------------------------------------------------
+
+static void InitService(otSrpClientService &aService, const char *aInstanceName)
+{
+    memset(&aService, 0, sizeof(aService));
+    aService.mName         = "_test._udp";
+    aService.mInstanceName = aInstanceName;
+    aService.mPort         = 1234;
+}
+
+void TestDnssdPush(void)
+{
+    static const char kServiceName[]   = "_test._udp.default.service.arpa.";
+    static const char kInstance1Name[] = "ins1._test._udp.default.service.arpa.";
+    static const char kHostName[]      = "push-host.default.service.arpa.";
+
+    Instance &                 instance = *static_cast<Instance *>(testInitInstance());
+    Ip6::SockAddr              clientSockAddr;
+    Ip6::SockAddr              serverSockAddr;
+    Ip6::Address               hostAddress;
+    otSrpClientService         service1;
+    otSrpClientService         service2;
+    otSrpClientService         service3;
+    Dso::Connection::MessageId ptrSubscriptionId;
+
+    sNow      = 0;
+    sInstance = &instance;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestDnssdPush");
+
+    // Start Thread as leader and enable the SRP server.
+
+    SuccessOrQuit(otIp6SetEnabled(sInstance, true));
+    SuccessOrQuit(otThreadSetEnabled(sInstance, true));
+    SuccessOrQuit(otThreadBecomeLeader(sInstance));
+    otSrpServerSetEnabled(sInstance, true);
+    AdvanceTime(30 * 1000);
+
+    VerifyOrQuit(otThreadGetDeviceRole(sInstance) == OT_DEVICE_ROLE_LEADER);
+    VerifyOrQuit(otSrpServerGetState(sInstance) == OT_SRP_SERVER_STATE_RUNNING);
+    VerifyOrQuit(sDsoListening);
+
+    // Register a host with one service using the SRP client.
+
+    hostAddress = AsCoreType(otThreadGetMeshLocalEid(sInstance));
+    serverSockAddr.SetAddress(hostAddress);
+    serverSockAddr.SetPort(otSrpServerGetPort(sInstance));
+
+    InitService(service1, "ins1");
+    InitService(service2, "ins2");
+    InitService(service3, "ins3");
+
+    SuccessOrQuit(otSrpClientSetHostName(sInstance, "push-host"));
+    SuccessOrQuit(otSrpClientSetHostAddresses(sInstance, &hostAddress, 1));
+    SuccessOrQuit(otSrpClientAddService(sInstance, &service1));
+    SuccessOrQuit(otSrpClientStart(sInstance, &serverSockAddr));
+    AdvanceTime(2000);
+
+    VerifyOrQuit(service1.mState == OT_SRP_CLIENT_ITEM_STATE_REGISTERED);
+
+    // Connect a DNS Push client.
+
+    clientSockAddr.SetAddress(hostAddress);
+    clientSockAddr.SetPort(49152);
+    serverSockAddr.SetPort(kDsoPort);
+
+    PushClient client(instance, clientSockAddr, serverSockAddr);
+
+    sClient = &client;
+    sClient->Connect();
+    VerifyOrQuit(sServerSession != nullptr);
+    VerifyOrQuit(sClient->GetState() == Dso::Connection::kStateConnectedButSessionless);
+
+    Log("Subscribe to PTR, SRV, and AAAA and check initial PUSH of existing records");
+
+    ptrSubscriptionId = sClient->Subscribe(kServiceName, ResourceRecord::kTypePtr);
+    VerifyOrQuit(sClient->DidGetResponse());
+    VerifyOrQuit(sClient->GetLastResponseCode() == Header::kResponseSuccess);
+    VerifyOrQuit(sClient->GetState() == Dso::Connection::kStateSessionEstablished);
+    VerifyOrQuit(sClient->GetPushCount() == 1);
+    VerifyOrQuit(sClient->GetNumRecords() == 1);
+    sClient->VerifyRecord(0, kServiceName, ResourceRecord::kTypePtr, /* aIsRemove */ false);
+
+    sClient->ClearPush();
+    IgnoreReturnValue(sClient->Subscribe(kInstance1Name, ResourceRecord::kTypeSrv));
+    VerifyOrQuit(sClient->GetLastResponseCode() == Header::kResponseSuccess);
+    VerifyOrQuit(sClient->GetNumRecords() == 1);
+    sClient->VerifyRecord(0, kInstance1Name, ResourceRecord::kTypeSrv, /* aIsRemove */ false);
+
+    sClient->ClearPush();
+    IgnoreReturnValue(sClient->Subscribe(kHostName, ResourceRecord::kTypeAaaa));
+    VerifyOrQuit(sClient->GetLastResponseCode() == Header::kResponseSuccess);
+    VerifyOrQuit(sClient->GetNumRecords() == 1);
+    sClient->VerifyRecord(0, kHostName, ResourceRecord::kTypeAaaa, /* aIsRemove */ false);
+
+    Log("Check invalid subscriptions are rejected");
+
+    sClient->ClearPush();
+    IgnoreReturnValue(sClient->Subscribe(kServiceName, ResourceRecord::kTypePtr));
+    VerifyOrQuit(sClient->GetLastResponseCode() == Header::kResponseRefused);
+    IgnoreReturnValue(sClient->Subscribe(kServiceName, ResourceRecord::kTypeAaaa));
+    VerifyOrQuit(sClient->GetLastResponseCode() == Header::kResponseRefused);
+    IgnoreReturnValue(sClient->Subscribe("host.example.com.", ResourceRecord::kTypeAaaa));
+    VerifyOrQuit(sClient->GetLastResponseCode() == Header::kResponseNotAuth);
+    IgnoreReturnValue(sClient->Subscribe(kHostName, ResourceRecord::kTypeA));
+    VerifyOrQuit(sClient->GetLastResponseCode() == Header::kResponseNotImplemented);
+    VerifyOrQuit(sClient->GetPushCount() == 0);
+    VerifyOrQuit(sClient->GetState() == Dso::Connection::kStateSessionEstablished);
+
+    Log("Register a new service and check it is pushed");
+
+    sClient->ClearPush();
+    SuccessOrQuit(otSrpClientAddService(sInstance, &service2));
+    AdvanceTime(2000);
+    VerifyOrQuit(service2.mState == OT_SRP_CLIENT_ITEM_STATE_REGISTERED);
+
+    VerifyOrQuit(sClient->GetPushCount() == 1);
+    VerifyOrQuit(sClient->GetNumRecords() == 1);
+    sClient->VerifyRecord(0, kServiceName, ResourceRecord::kTypePtr, /* aIsRemove */ false);
+
+    Log("Remove the service and check its removal is pushed");
+
+    sClient->ClearPush();
+    SuccessOrQuit(otSrpClientRemoveService(sInstance, &service2));
+    AdvanceTime(2000);
+
+    VerifyOrQuit(sClient->GetPushCount() == 1);
+    VerifyOrQuit(sClient->GetNumRecords() == 1);
+    sClient->VerifyRecord(0, kServiceName, ResourceRecord::kTypePtr, /* aIsRemove */ true);
+
+    Log("Unsubscribe from PTR and check no change is pushed for a new service");
+
+    sClient->Unsubscribe(ptrSubscriptionId);
+    sClient->ClearPush();
+    SuccessOrQuit(otSrpClientAddService(sInstance, &service3));
+    AdvanceTime(2000);
+    VerifyOrQuit(service3.mState == OT_SRP_CLIENT_ITEM_STATE_REGISTERED);
+    VerifyOrQuit(sClient->GetPushCount() == 0);
+
+    Log("Check subscriptions beyond the limit are refused");
+
+    for (uint8_t i = 0; i < kMaxSubscription; i++)
+    {
+        char name[Name::kMaxNameSize];
+
+        snprintf(name, sizeof(name), "host%u.default.service.arpa.", i);
+        IgnoreReturnValue(sClient->Subscribe(name, ResourceRecord::kTypeAaaa));
+
+        // Two subscriptions (SRV and AAAA) are already in use.
+        VerifyOrQuit(sClient->GetLastResponseCode() ==
+                     ((i + 2 < kMaxSubscription) ? Header::kResponseSuccess : Header::kResponseRefused));
+    }
+
+    Log("Remove the host and check removal of host and service is pushed");
+
+    sClient->ClearPush();
+    SuccessOrQuit(otSrpClientRemoveHostAndServices(sInstance, /* aRemoveKeyLease */ false,
+                                                   /* aSendUnregToServer */ true));
+    AdvanceTime(2000);
+
+    // Host and service removals are pushed in separate messages.
+    VerifyOrQuit(sClient->GetPushCount() == 2);
+    VerifyOrQuit(sClient->GetNumRecords() == 2);
+    sClient->VerifyRecord(0, kHostName, ResourceRecord::kTypeAaaa, /* aIsRemove */ false);
+    VerifyOrQuit(sClient->GetRecord(0).mTtl == 0xfffffffe);
+    sClient->VerifyRecord(1, kInstance1Name, ResourceRecord::kTypeSrv, /* aIsRemove */ false);
+    VerifyOrQuit(sClient->GetRecord(1).mTtl == 0xfffffffe);
+
+    Log("Disconnect the client");
+
+    sClient->Disconnect(Dso::Connection::kGracefullyClose, Dso::Connection::kReasonUnknown);
+    VerifyOrQuit(sServerSession == nullptr);
+
+    Log("End of TestDnssdPush");
+
+    testFreeInstance(&instance);
+}
+
+} // namespace Dns
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE && OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_DNSSD_DNS_PUSH_ENABLE && OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE && \
+    !OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+    ot::Dns::TestDnssdPush();
+    printf("All tests passed\n");
+#else
+    printf("DNS Push feature is not enabled\n");
+#endif
+
+    return 0;
+}
@@ -28,13 +28,19 @@
 
 #include <openthread/config.h>
 
+#include <chrono>
+#include <stdio.h>
+
 #include "test_platform.h"
 #include "test_util.hpp"
 
+#include <openthread/tasklet.h>
+
 #include "common/arg_macros.hpp"
 #include "common/array.hpp"
 #include "common/as_core_type.hpp"
 #include "common/instance.hpp"
+#include "common/new.hpp"
 #include "net/dns_dso.hpp"
 
 #if OPENTHREAD_CONFIG_DNS_DSO_ENABLE
@@ -46,6 +52,10 @@ static uint32_t    sAlarmTime;
 static bool        sAlarmOn = false;
 static otInstance *sInstance;
 
+// This test flag indicates whether to log each sent or processed
+// message (it is disabled while measuring throughput).
+static bool sTestDsoLogSend = true;
+
 // Logs a message and adds current time (sNow) as "<hours>:<min>:<secs>.<msec>"
 #define Log(...)                                                                                          \
     printf("%02u:%02u:%02u.%03u " OT_FIRST_ARG(__VA_ARGS__) "\n", (sNow / 36000000), (sNow / 60000) % 60, \
@@ -72,16 +82,27 @@ uint32_t otPlatAlarmMilliGetNow(void)
 
 } // extern "C"
 
+void ProcessTasklets(void)
+{
+    while (otTaskletsArePending(sInstance))
+    {
+        otTaskletsProcess(sInstance);
+    }
+}
+
 void AdvanceTime(uint32_t aDuration)
 {
     uint32_t time = sNow + aDuration;
 
     Log(" AdvanceTime for %u.%03u", aDuration / 1000, aDuration % 1000);
 
-    while (sAlarmTime <= time)
+    ProcessTasklets();
+
+    while (sAlarmOn && (sAlarmTime <= time))
     {
         sNow = sAlarmTime;
         otPlatAlarmMilliFired(sInstance);
+        ProcessTasklets();
     }
 
     sNow = time;
@@ -120,8 +141,10 @@ public:
     explicit Connection(Instance &           aInstance,
                         const char *         aName,
                         const Ip6::SockAddr &aLocalSockAddr,
-                        const Ip6::SockAddr &aPeerSockAddr)
-        : Dso::Connection(aInstance, aPeerSockAddr, sCallbacks)
+                        const Ip6::SockAddr &aPeerSockAddr,
+                        uint32_t             aInactivityTimeout = Dso::kDefaultTimeout,
+                        uint32_t             aKeepAliveInterval = Dso::kDefaultTimeout)
+        : Dso::Connection(aInstance, aPeerSockAddr, sCallbacks, aInactivityTimeout, aKeepAliveInterval)
         , mName(aName)
         , mLocalSockAddr(aLocalSockAddr)
     {
@@ -234,7 +257,11 @@ private:
 
     Error ProcessUnidirectionalMessage(const Message &aMessage, Dso::Tlv::Type aPrimaryTlvType)
     {
-        Log(" ProcessUnidirectionalMessage(primaryTlv:0x%04x) on %s", aPrimaryTlvType, mName);
+        if (sTestDsoLogSend)
+        {
+            Log(" ProcessUnidirectionalMessage(primaryTlv:0x%04x) on %s", aPrimaryTlvType, mName);
+        }
+
         mDidProcessUnidirectional = true;
 
         if (aPrimaryTlvType == TestTlv::kType)
@@ -335,7 +362,7 @@ Dso::Connection::Callbacks Connection::sCallbacks(Connection::HandleConnected,
                                                   Connection::ProcessUnidirectionalMessage,
                                                   Connection::ProcessResponseMessage);
 
-static constexpr uint16_t kMaxConnections = 5;
+static constexpr uint16_t kMaxConnections = 80;
 
 static Array<Connection *, kMaxConnections> sConnections;
 
@@ -415,12 +442,20 @@ exit:
     return;
 }
 
+// Number of `otPlatDsoSend()` calls (i.e., transport writes).
+static uint32_t sDsoSendCount = 0;
+
 void otPlatDsoSend(otPlatDsoConnection *aConnection, otMessage *aMessage)
 {
     Connection &conn     = *static_cast<Connection *>(aConnection);
     Connection *peerConn = nullptr;
 
-    Log(" otPlatDsoSend(%s), message-len:%u", conn.GetName(), AsCoreType(aMessage).GetLength());
+    sDsoSendCount++;
+
+    if (sTestDsoLogSend)
+    {
+        Log(" otPlatDsoSend(%s), message-len:%u", conn.GetName(), AsCoreType(aMessage).GetLength());
+    }
 
     VerifyOrQuit(conn.GetState() != Connection::kStateDisconnected);
     VerifyOrQuit(conn.GetState() != Connection::kStateConnecting);
@@ -434,7 +469,10 @@ void otPlatDsoSend(otPlatDsoConnection *aConnection, otMessage *aMessage)
         VerifyOrQuit(peerConn->GetState() != Connection::kStateDisconnected);
         VerifyOrQuit(peerConn->GetState() != Connection::kStateConnecting);
 
-        Log("   Sending the message to peer connection (%s)", peerConn->GetName());
+        if (sTestDsoLogSend)
+        {
+            Log("   Sending the message to peer connection (%s)", peerConn->GetName());
+        }
 
         peerConn->mDidReceiveMessage = true;
         otPlatDsoHandleReceive(peerConn, aMessage);
@@ -445,6 +483,42 @@ void otPlatDsoSend(otPlatDsoConnection *aConnection, otMessage *aMessage)
     }
 }
 
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+
+void otPlatDsoSendBatch(otPlatDsoConnection *aConnection, otMessage *aMessage)
+{
+    // Split the batch into individual DNS messages (each prefixed
+    // with its length field) and pass them one by one through the
+    // `otPlatDsoSend()` stand-in, which delivers them to the peer.
+
+    Message &batch  = AsCoreType(aMessage);
+    uint16_t offset = 0;
+
+    while (offset < batch.GetLength())
+    {
+        uint16_t length;
+        Message *message;
+
+        SuccessOrQuit(batch.Read(offset, length));
+        length = Encoding::BigEndian::HostSwap16(length);
+        offset += sizeof(uint16_t);
+
+        message = AsCoreType(sInstance).Get<MessagePool>().Allocate(Message::kTypeOther);
+        VerifyOrQuit(message != nullptr);
+        SuccessOrQuit(message->AppendBytesFromMessage(batch, offset, length));
+        offset += length;
+
+        otPlatDsoSend(aConnection, message);
+        sDsoSendCount--;
+    }
+
+    VerifyOrQuit(offset == batch.GetLength());
+    batch.Free();
+    sDsoSendCount++;
+}
+
+#endif
+
 void otPlatDsoDisconnect(otPlatDsoConnection *aConnection, otPlatDsoDisconnectMode aMode)
 {
     Connection &conn     = *static_cast<Connection *>(aConnection);
@@ -1222,6 +1296,200 @@ void TestDso(void)
     testFreeInstance(&instance);
 }
 
+void TestDsoManyConnections(void)
+{
+    static constexpr uint16_t kNumPairs           = 32;
+    static constexpr uint16_t kClientBasePort     = 0x1000;
+    static constexpr uint16_t kServerBasePort     = 0x8000;
+    static constexpr uint32_t kKeepAliveStep      = 100;
+    static constexpr uint16_t kLookupIterations   = 1000;
+    static constexpr uint16_t kNumTestRounds      = 32;
+    static constexpr uint16_t kMessagesPerRound   = 4;
+    static constexpr uint16_t kConnectionBufWords = (sizeof(Connection) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    static uint64_t sClientBufs[kNumPairs][kConnectionBufWords];
+    static uint64_t sServerBufs[kNumPairs][kConnectionBufWords];
+    static char     sClientNames[kNumPairs][8];
+    static char     sServerNames[kNumPairs][8];
+
+    Instance &                                     instance = *static_cast<Instance *>(testInitInstance());
+    Connection *                                   clients[kNumPairs];
+    Connection *                                   servers[kNumPairs];
+    Ip6::SockAddr                                  clientSockAddrs[kNumPairs];
+    Ip6::SockAddr                                  serverSockAddrs[kNumPairs];
+    TimeMilli                                      startTime;
+    uint32_t                                       sendCount;
+    std::chrono::high_resolution_clock::time_point start;
+    std::chrono::microseconds                      duration;
+
+    sNow      = 0;
+    sInstance = &instance;
+    sConnections.Clear();
+
+    Log("-------------------------------------------------------------------------------------------");
+    Log("TestDsoManyConnections");
+
+    // Each client/server pair uses a different Keep Alive interval
+    // (and no inactivity timeout) so that the Keep Alive timers of all
+    // connections expire at different times.
+
+    for (uint16_t i = 0; i < kNumPairs; i++)
+    {
+        uint32_t keepAlive = Dso::kMinKeepAliveInterval + i * kKeepAliveStep;
+
+        clientSockAddrs[i].SetPort(kClientBasePort + i);
+        serverSockAddrs[i].SetPort(kServerBasePort + i);
+        snprintf(sClientNames[i], sizeof(sClientNames[i]), "cli%u", i);
+        snprintf(sServerNames[i], sizeof(sServerNames[i]), "srv%u", i);
+
+        clients[i] = new (sClientBufs[i]) Connection(instance, sClientNames[i], clientSockAddrs[i], serverSockAddrs[i],
+                                                     Dso::kInfiniteTimeout, keepAlive);
+        servers[i] = new (sServerBufs[i]) Connection(instance, sServerNames[i], serverSockAddrs[i], clientSockAddrs[i],
+                                                     Dso::kInfiniteTimeout, keepAlive);
+
+        SuccessOrQuit(sConnections.PushBack(clients[i]));
+        SuccessOrQuit(sConnections.PushBack(servers[i]));
+    }
+
+    instance.Get<Dso>().StartListening(AcceptConnection);
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Connect all clients and establish sessions");
+
+    for (uint16_t i = 0; i < kNumPairs; i++)
+    {
+        clients[i]->Connect();
+        SuccessOrQuit(clients[i]->SendKeepAliveMessage());
+        ProcessTasklets();
+
+        VerifyOrQuit(clients[i]->GetState() == Connection::kStateSessionEstablished);
+        VerifyOrQuit(servers[i]->GetState() == Connection::kStateSessionEstablished);
+    }
+
+    startTime = TimerMilli::GetNow();
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Look up connections by peer address");
+
+    start = std::chrono::high_resolution_clock::now();
+
+    for (uint16_t n = 0; n < kLookupIterations; n++)
+    {
+        for (uint16_t i = 0; i < kNumPairs; i++)
+        {
+            VerifyOrQuit(instance.Get<Dso>().FindClientConnection(serverSockAddrs[i]) == clients[i]);
+            VerifyOrQuit(instance.Get<Dso>().FindServerConnection(clientSockAddrs[i]) == servers[i]);
+            VerifyOrQuit(instance.Get<Dso>().FindServerConnection(serverSockAddrs[i]) == nullptr);
+        }
+    }
+
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+    printf("\n%u lookups among %u connections: %u usec\n", kLookupIterations * kNumPairs * 3, kNumPairs * 2,
+           static_cast<uint32_t>(duration.count()));
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Verify Keep Alive timers fire in order of their expiration");
+
+    for (uint16_t i = 0; i < kNumPairs; i++)
+    {
+        clients[i]->ClearTestFlags();
+    }
+
+    for (uint16_t i = 0; i < kNumPairs; i++)
+    {
+        uint32_t keepAlive = Dso::kMinKeepAliveInterval + i * kKeepAliveStep;
+
+        AdvanceTime(startTime + keepAlive - 1 - TimerMilli::GetNow());
+        VerifyOrQuit(!clients[i]->DidSendMessage());
+
+        AdvanceTime(1);
+
+        for (uint16_t j = 0; j < kNumPairs; j++)
+        {
+            VerifyOrQuit(clients[j]->DidSendMessage() == (j <= i));
+        }
+    }
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Disconnect half of connections and verify remaining timers");
+
+    for (uint16_t i = 0; i < kNumPairs; i += 2)
+    {
+        clients[i]->Disconnect(Connection::kGracefullyClose, Connection::kReasonUnknown);
+        VerifyOrQuit(clients[i]->GetState() == Connection::kStateDisconnected);
+        VerifyOrQuit(servers[i]->GetState() == Connection::kStateDisconnected);
+        VerifyOrQuit(instance.Get<Dso>().FindClientConnection(serverSockAddrs[i]) == nullptr);
+        VerifyOrQuit(instance.Get<Dso>().FindServerConnection(clientSockAddrs[i]) == nullptr);
+    }
+
+    for (uint16_t i = 0; i < kNumPairs; i++)
+    {
+        clients[i]->ClearTestFlags();
+        servers[i]->ClearTestFlags();
+    }
+
+    AdvanceTime(Dso::kMinKeepAliveInterval + kNumPairs * kKeepAliveStep);
+
+    for (uint16_t i = 0; i < kNumPairs; i++)
+    {
+        bool isConnected = ((i % 2) != 0);
+
+        VerifyOrQuit(clients[i]->DidSendMessage() == isConnected);
+        VerifyOrQuit(servers[i]->DidReceiveMessage() == isConnected);
+        VerifyOrQuit((clients[i]->GetState() == Connection::kStateSessionEstablished) == isConnected);
+        VerifyOrQuit((servers[i]->GetState() == Connection::kStateSessionEstablished) == isConnected);
+    }
+
+    Log("- - - - - - - - - - - - - - - - - - - - - - - - - - - - - -");
+    Log("Send many small unidirectional messages over remaining connections");
+
+    sTestDsoLogSend = false;
+    sendCount       = sDsoSendCount;
+    start           = std::chrono::high_resolution_clock::now();
+
+    // In each round, a number of messages are sent on every
+    // connection before the tasklets are processed.
+
+    for (uint16_t round = 0; round < kNumTestRounds; round++)
+    {
+        for (uint16_t n = 0; n < kMessagesPerRound; n++)
+        {
+            for (uint16_t i = 1; i < kNumPairs; i += 2)
+            {
+                servers[i]->SendTestUnidirectionalMessage(static_cast<uint8_t>(n));
+            }
+        }
+
+        ProcessTasklets();
+    }
+
+    duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+    sendCount       = sDsoSendCount - sendCount;
+    sTestDsoLogSend = true;
+
+    printf("\n%u messages over %u connections: %u transport writes, %u usec\n",
+           kNumTestRounds * kMessagesPerRound * kNumPairs / 2, kNumPairs / 2, sendCount,
+           static_cast<uint32_t>(duration.count()));
+
+#if OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+    // All messages sent on a connection within a round are passed
+    // to platform in one batch.
+    VerifyOrQuit(sendCount == kNumTestRounds * kNumPairs / 2);
+#else
+    VerifyOrQuit(sendCount == kNumTestRounds * kMessagesPerRound * kNumPairs / 2);
+#endif
+
+    for (uint16_t i = 1; i < kNumPairs; i += 2)
+    {
+        VerifyOrQuit(clients[i]->DidProcessUnidirectional());
+        clients[i]->Disconnect(Connection::kGracefullyClose, Connection::kReasonUnknown);
+    }
+
+    Log("End of test");
+
+    testFreeInstance(&instance);
+}
+
 } // namespace Dns
 } // namespace ot
 
@@ -1230,7 +1498,12 @@ void TestDso(void)
 int main(void)
 {
 #if OPENTHREAD_CONFIG_DNS_DSO_ENABLE
+#if !OPENTHREAD_CONFIG_DNS_DSO_TX_BATCH_ENABLE
+    // `TestDso()` expects each message to be delivered as soon as it
+    // is sent (no tx batching).
     ot::Dns::TestDso();
+#endif
+    ot::Dns::TestDsoManyConnections();
     printf("All tests passed\n");
 #else
     printf("DSO feature is not enabled\n");
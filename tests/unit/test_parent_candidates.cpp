@@ -0,0 +1,355 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#include "common/code_utils.hpp"
+#include "thread/link_quality.hpp"
+#include "thread/mle_types.hpp"
+#include "thread/parent_candidates.hpp"
+
+namespace ot {
+
+using Mle::ParentCandidateTable;
+
+typedef ParentCandidateTable::Candidate Candidate;
+
+static constexpr uint32_t kMaxAge = 600 * 1000;
+
+void PrepareCandidate(Candidate &aCandidate, uint8_t aId, uint8_t aLinkMarginIn, uint8_t aLinkMarginOut)
+{
+    aCandidate.Clear();
+    aCandidate.mExtAddress.m8[7] = aId;
+    aCandidate.mRloc16           = static_cast<uint16_t>(aId << 10);
+    aCandidate.mLinkMarginIn     = aLinkMarginIn;
+    aCandidate.mLinkMarginOut    = aLinkMarginOut;
+    aCandidate.mVersion          = OT_THREAD_VERSION_1_2;
+    aCandidate.mLastUpdate       = TimeMilli(0);
+}
+
+void TestParentCandidateScore(void)
+{
+    Candidate candidate;
+    Candidate other;
+
+    printf("\nTestParentCandidateScore");
+
+    // The two-way link margin is the minimum of both directions.
+
+    PrepareCandidate(candidate, 1, 30, 10);
+    PrepareCandidate(other, 2, 15, 15);
+    VerifyOrQuit(candidate.GetTwoWayLinkMargin() == 10);
+    VerifyOrQuit(other.CalculateScore() > candidate.CalculateScore());
+
+    // Link margin beyond the cap does not matter.
+
+    PrepareCandidate(candidate, 1, 60, 60);
+    PrepareCandidate(other, 2, 80, 80);
+    VerifyOrQuit(other.CalculateScore() == candidate.CalculateScore());
+
+    // An active router is preferred over a REED.
+
+    PrepareCandidate(candidate, 1, 30, 30);
+    PrepareCandidate(other, 2, 30, 30);
+    other.mRloc16 |= 1;
+    VerifyOrQuit(candidate.CalculateScore() > other.CalculateScore());
+
+    // Parent priority, then links to neighbors.
+
+    PrepareCandidate(other, 2, 30, 30);
+    other.mParentPriority = 1;
+    VerifyOrQuit(other.CalculateScore() > candidate.CalculateScore());
+
+    PrepareCandidate(other, 2, 30, 30);
+    other.mLinkQuality3 = 2;
+    VerifyOrQuit(other.CalculateScore() > candidate.CalculateScore());
+
+    // Better CSL accuracy is preferred.
+
+    PrepareCandidate(other, 2, 30, 30);
+    other.mCslClockAccuracy = 40;
+    VerifyOrQuit(candidate.CalculateScore() > other.CalculateScore());
+
+    printf(" -- PASS\n");
+}
+
+void TestParentCandidateTable(void)
+{
+    ParentCandidateTable table;
+    Candidate            candidate;
+    const Candidate *    best;
+    Mac::ExtAddress      none;
+
+    printf("TestParentCandidateTable");
+
+    none.Clear();
+    VerifyOrQuit(table.IsEmpty());
+    VerifyOrQuit(table.FindBest(none, TimeMilli(0), kMaxAge) == nullptr);
+
+    // Fill the table with candidates of increasing link margin.
+
+    for (uint8_t id = 1; id <= ParentCandidateTable::kMaxCandidates; id++)
+    {
+        PrepareCandidate(candidate, id, 10 + id, 10 + id);
+        table.Update(candidate);
+    }
+
+    VerifyOrQuit(table.GetLength() == ParentCandidateTable::kMaxCandidates);
+
+    best = table.FindBest(none, TimeMilli(0), kMaxAge);
+    VerifyOrQuit(best != nullptr);
+    VerifyOrQuit(best->mExtAddress.m8[7] == ParentCandidateTable::kMaxCandidates);
+
+    // A new candidate scoring below all others is not added.
+
+    PrepareCandidate(candidate, 100, 5, 5);
+    table.Update(candidate);
+    VerifyOrQuit(table.GetLength() == ParentCandidateTable::kMaxCandidates);
+    VerifyOrQuit(table.Find(candidate.mExtAddress) == nullptr);
+
+    // A better one evicts the lowest scoring candidate (id 1).
+
+    PrepareCandidate(candidate, 100, 40, 40);
+    table.Update(candidate);
+    VerifyOrQuit(table.GetLength() == ParentCandidateTable::kMaxCandidates);
+    VerifyOrQuit(table.Find(candidate.mExtAddress) != nullptr);
+
+    PrepareCandidate(candidate, 1, 0, 0);
+    VerifyOrQuit(table.Find(candidate.mExtAddress) == nullptr);
+
+    // Updating an existing candidate does not add an entry.
+
+    PrepareCandidate(candidate, 100, 35, 35);
+    table.Update(candidate);
+    VerifyOrQuit(table.GetLength() == ParentCandidateTable::kMaxCandidates);
+    VerifyOrQuit(table.Find(candidate.mExtAddress)->mLinkMarginIn == 35);
+
+    // The runner-up is the best candidate excluding the parent.
+
+    best = table.FindBest(none, TimeMilli(0), kMaxAge);
+    VerifyOrQuit(best->mExtAddress == candidate.mExtAddress);
+
+    best = table.FindBest(candidate.mExtAddress, TimeMilli(0), kMaxAge);
+    VerifyOrQuit(best != nullptr);
+    VerifyOrQuit(best->mExtAddress.m8[7] == ParentCandidateTable::kMaxCandidates);
+
+    // Link margin updates change the ranking.
+
+    table.UpdateLinkMarginOut(best->mExtAddress, 5, TimeMilli(0));
+    best = table.FindBest(candidate.mExtAddress, TimeMilli(0), kMaxAge);
+    VerifyOrQuit(best->mExtAddress.m8[7] == ParentCandidateTable::kMaxCandidates - 1);
+
+    table.UpdateLinkMarginIn(best->mExtAddress, 1, TimeMilli(0));
+    VerifyOrQuit(best->mLinkMarginIn == (10 + ParentCandidateTable::kMaxCandidates - 1 + 1) / 2);
+
+    // Stale candidates are not used, unless refreshed.
+
+    VerifyOrQuit(table.FindBest(candidate.mExtAddress, TimeMilli(kMaxAge + 1), kMaxAge) == nullptr);
+
+    table.UpdateLinkMarginIn(best->mExtAddress, 30, TimeMilli(kMaxAge));
+    VerifyOrQuit(table.FindBest(candidate.mExtAddress, TimeMilli(kMaxAge + 1), kMaxAge) == best);
+
+    table.Remove(candidate.mExtAddress);
+    VerifyOrQuit(table.Find(candidate.mExtAddress) == nullptr);
+    VerifyOrQuit(table.GetLength() == ParentCandidateTable::kMaxCandidates - 1);
+
+    table.Clear();
+    VerifyOrQuit(table.IsEmpty());
+
+    printf(" -- PASS\n");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Simulation of re-attach time after the link to the parent fails
+//
+// The attach timing mirrors `Mle`: a regular attach starts after the
+// attach backoff, sends a Parent Request to routers and waits for
+// responses, and if no candidate with two-way link quality 3 is found
+// sends a Parent Request to routers and REEDs and waits again. A fast
+// re-parent sends a unicast Parent Request to the runner-up and
+// attaches as soon as it responds, falling back to a regular attach
+// if it does not respond.
+
+static constexpr uint16_t kNumTrials            = 1000;
+static constexpr uint8_t  kMaxRouters           = 6;
+static constexpr uint8_t  kRunnerUpDownPercent  = 20;
+static constexpr uint32_t kChildIdExchangeTime  = 50;
+static constexpr uint32_t kAttachBackoffMinTime = OPENTHREAD_CONFIG_MLE_ATTACH_BACKOFF_MINIMUM_INTERVAL;
+
+static uint32_t sRandomState = 1;
+
+uint32_t GetRandom(uint32_t aMin, uint32_t aMax)
+{
+    // Deterministic LCG, so that results are reproducible.
+    sRandomState = sRandomState * 1103515245 + 12345;
+
+    return aMin + (sRandomState >> 8) % (aMax - aMin + 1);
+}
+
+struct SimResult
+{
+    void Add(uint32_t aTime)
+    {
+        mTotalTime += aTime;
+        mMaxTime = OT_MAX(mMaxTime, aTime);
+        mNumTrials++;
+    }
+
+    uint32_t GetAverageTime(void) const { return mTotalTime / mNumTrials; }
+
+    uint32_t mTotalTime;
+    uint32_t mMaxTime;
+    uint32_t mNumTrials;
+};
+
+uint32_t CalculateAttachPhasesTime(bool aHasLinkQuality3Candidate)
+{
+    uint32_t time = Mle::kParentRequestRouterTimeout;
+
+    if (!aHasLinkQuality3Candidate)
+    {
+        time += Mle::kParentRequestReedTimeout;
+    }
+
+    return time + kChildIdExchangeTime;
+}
+
+void TestReattachSimulation(void)
+{
+    SimResult regular;
+    SimResult fast;
+    uint16_t  numFallbacks = 0;
+
+    memset(&regular, 0, sizeof(regular));
+    memset(&fast, 0, sizeof(fast));
+
+    printf("\nTestReattachSimulation (%u trials, up to %u routers, runner-up down in %u%% of trials)\n", kNumTrials,
+           kMaxRouters, kRunnerUpDownPercent);
+
+    for (uint16_t trial = 0; trial < kNumTrials; trial++)
+    {
+        ParentCandidateTable table;
+        Candidate            routers[kMaxRouters];
+        uint8_t              numRouters = static_cast<uint8_t>(GetRandom(2, kMaxRouters));
+        Mac::ExtAddress      parent;
+        Mac::ExtAddress      runnerUp;
+        Mac::ExtAddress      none;
+        bool                 isRunnerUpDown;
+        bool                 hasLinkQuality3 = false;
+        bool                 hasAvailable    = false;
+        uint32_t             time;
+
+        none.Clear();
+
+        // Each router responded to the Parent Request of the initial attach.
+
+        for (uint8_t i = 0; i < numRouters; i++)
+        {
+            uint8_t margin = static_cast<uint8_t>(GetRandom(5, 45));
+
+            PrepareCandidate(routers[i], i + 1, margin, static_cast<uint8_t>(margin + GetRandom(0, 10) - 5));
+            routers[i].mLinkQuality3 = static_cast<uint8_t>(GetRandom(0, 8));
+            table.Update(routers[i]);
+        }
+
+        parent   = table.FindBest(none, TimeMilli(0), kMaxAge)->mExtAddress;
+        runnerUp = table.FindBest(parent, TimeMilli(0), kMaxAge)->mExtAddress;
+
+        // The link to the parent fails. The runner-up may be down as well.
+
+        isRunnerUpDown = (GetRandom(1, 100) <= kRunnerUpDownPercent);
+
+        for (const Candidate &router : routers)
+        {
+            if ((&router - routers >= numRouters) || (router.mExtAddress == parent) ||
+                (isRunnerUpDown && (router.mExtAddress == runnerUp)))
+            {
+                continue;
+            }
+
+            hasAvailable = true;
+
+            if (LinkQualityInfo::ConvertLinkMarginToLinkQuality(router.GetTwoWayLinkMargin()) == kLinkQuality3)
+            {
+                hasLinkQuality3 = true;
+            }
+        }
+
+        if (!hasAvailable)
+        {
+            continue;
+        }
+
+        // Regular attach.
+
+        time = kAttachBackoffMinTime + GetRandom(0, Mle::kAttachStartJitter);
+        time += CalculateAttachPhasesTime(hasLinkQuality3);
+        regular.Add(time);
+
+        // Fast re-parent.
+
+        time = 1;
+
+        if (!isRunnerUpDown)
+        {
+            time += 1 + GetRandom(0, Mle::kParentResponseMaxDelayRouters) + kChildIdExchangeTime;
+        }
+        else
+        {
+            time += Mle::kParentRequestReedTimeout + 1 + CalculateAttachPhasesTime(hasLinkQuality3);
+            numFallbacks++;
+        }
+
+        fast.Add(time);
+    }
+
+    printf("  %-14s | %12s | %12s\n", "re-attach", "avg time", "max time");
+    printf("  %-14s | %9u ms | %9u ms\n", "regular", regular.GetAverageTime(), regular.mMaxTime);
+    printf("  %-14s | %9u ms | %9u ms\n", "fast re-parent", fast.GetAverageTime(), fast.mMaxTime);
+    printf("  fast re-parent fell back to regular attach in %u of %u trials\n", numFallbacks, fast.mNumTrials);
+
+    VerifyOrQuit(fast.mNumTrials == regular.mNumTrials);
+    VerifyOrQuit(fast.GetAverageTime() < regular.GetAverageTime());
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+int main(void)
+{
+    ot::TestParentCandidateScore();
+    ot::TestParentCandidateTable();
+    ot::TestReattachSimulation();
+    printf("\nAll tests passed\n");
+    return 0;
+}
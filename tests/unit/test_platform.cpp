@@ -570,6 +570,12 @@ OT_TOOL_WEAK void otPlatDsoSend(otPlatDsoConnection *aConnection, otMessage *aMe
     OT_UNUSED_VARIABLE(aMessage);
 }
 
+OT_TOOL_WEAK void otPlatDsoSendBatch(otPlatDsoConnection *aConnection, otMessage *aMessage)
+{
+    OT_UNUSED_VARIABLE(aConnection);
+    OT_UNUSED_VARIABLE(aMessage);
+}
+
 OT_TOOL_WEAK void otPlatDsoDisconnect(otPlatDsoConnection *aConnection, otPlatDsoDisconnectMode aMode)
 {
     OT_UNUSED_VARIABLE(aConnection);
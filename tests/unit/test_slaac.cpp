@@ -0,0 +1,371 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <openthread/config.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include <openthread/ip6.h>
+#include <openthread/tasklet.h>
+
+#include "common/code_utils.hpp"
+#include "common/instance.hpp"
+#include "thread/mle_tlvs.hpp"
+#include "thread/network_data_leader.hpp"
+#include "thread/network_data_tlvs.hpp"
+#include "utils/slaac_address.hpp"
+
+#if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
+
+namespace ot {
+
+// Test prefixes are `fd00:0:0:<index>::/64` (index 0-7).
+static constexpr uint8_t  kNumPrefixes      = 8;
+static constexpr uint8_t  kNumChurnPrefixes = 6;
+static constexpr uint8_t  kUserPrefix       = 6;
+static constexpr uint8_t  kNonSlaacPrefix   = 7;
+static constexpr uint16_t kNumAddresses     = OPENTHREAD_CONFIG_IP6_SLAAC_NUM_ADDRESSES;
+
+static Instance *sInstance;
+static uint32_t  sNumAdded;
+static uint32_t  sNumRemoved;
+static bool      sHasIid[kNumPrefixes];
+static uint8_t   sIids[kNumPrefixes][Ip6::InterfaceIdentifier::kSize];
+static uint32_t  sRandomSeed = 1;
+
+static uint32_t GetRandom(uint32_t aMax)
+{
+    sRandomSeed = sRandomSeed * 1103515245u + 12345u;
+
+    return (sRandomSeed >> 8) % aMax;
+}
+
+static void ProcessTasklets(void)
+{
+    while (otTaskletsArePending(sInstance))
+    {
+        otTaskletsProcess(sInstance);
+    }
+}
+
+static bool ParseTestPrefixIndex(const Ip6::Address &aAddress, uint8_t &aIndex)
+{
+    static const uint8_t kPrefixStart[] = {0xfd, 0, 0, 0, 0, 0, 0};
+
+    aIndex = aAddress.GetBytes()[7];
+
+    return (memcmp(aAddress.GetBytes(), kPrefixStart, sizeof(kPrefixStart)) == 0) && (aIndex < kNumPrefixes);
+}
+
+static void HandleAddressChange(const otIp6AddressInfo *aAddressInfo, bool aIsAdded, void *aContext)
+{
+    const Ip6::Address &address = AsCoreType(aAddressInfo->mAddress);
+    uint8_t             index;
+
+    OT_UNUSED_VARIABLE(aContext);
+
+    VerifyOrExit((aAddressInfo->mPrefixLength == 64) && ParseTestPrefixIndex(address, index));
+
+    if (!aIsAdded)
+    {
+        sNumRemoved++;
+        ExitNow();
+    }
+
+    sNumAdded++;
+
+    // The IID for a prefix must be the same every time an address is
+    // added for it (whether generated or read from the IID cache).
+
+    if (!sHasIid[index])
+    {
+        memcpy(sIids[index], address.GetIid().GetBytes(), sizeof(sIids[index]));
+        sHasIid[index] = true;
+    }
+    else
+    {
+        VerifyOrQuit(memcmp(sIids[index], address.GetIid().GetBytes(), sizeof(sIids[index])) == 0,
+                     "SLAAC IID changed for a re-added prefix");
+    }
+
+exit:
+    return;
+}
+
+static uint8_t AppendPrefixTlv(uint8_t *aBuffer, uint8_t aIndex, uint16_t aFlags)
+{
+    uint8_t *cur = aBuffer;
+
+    *cur++ = (NetworkData::NetworkDataTlv::kTypePrefix << 1) | 1; // Stable
+    *cur++ = 16;
+    *cur++ = 0;  // Domain ID
+    *cur++ = 64; // Prefix length
+    *cur++ = 0xfd;
+    memset(cur, 0, 6);
+    cur += 6;
+    *cur++ = aIndex;
+
+    *cur++ = (NetworkData::NetworkDataTlv::kTypeBorderRouter << 1) | 1; // Stable
+    *cur++ = 4;
+    *cur++ = 0x64; // RLOC16 0x6400
+    *cur++ = 0x00;
+    *cur++ = static_cast<uint8_t>(aFlags >> 8);
+    *cur++ = static_cast<uint8_t>(aFlags & 0xff);
+
+    return static_cast<uint8_t>(cur - aBuffer);
+}
+
+// Sets the leader network data to include the SLAAC prefixes in
+// `aPrefixMask` (bit per prefix index) and processes the resulting
+// notifier events.
+static void SetNetworkData(uint8_t aPrefixMask, bool aIncludeNonSlaacPrefix)
+{
+    static constexpr uint16_t kOnMeshFlag = 1 << 8;
+    static constexpr uint16_t kSlaacFlags = (1 << 13) | (1 << 12) | kOnMeshFlag; // Preferred, SLAAC, on-mesh
+
+    static uint8_t sVersion = 0;
+
+    uint8_t  netData[kNumPrefixes * 20];
+    uint8_t  length = 0;
+    Mle::Tlv tlv;
+    Message *message;
+
+    for (uint8_t index = 0; index < kNumPrefixes; index++)
+    {
+        if (aPrefixMask & (1 << index))
+        {
+            length += AppendPrefixTlv(&netData[length], index, kSlaacFlags);
+        }
+    }
+
+    if (aIncludeNonSlaacPrefix)
+    {
+        length += AppendPrefixTlv(&netData[length], kNonSlaacPrefix, kOnMeshFlag);
+    }
+
+    message = sInstance->Get<MessagePool>().Allocate(Message::kTypeIp6);
+    VerifyOrQuit(message != nullptr);
+
+    tlv.SetType(Mle::Tlv::kNetworkData);
+    tlv.SetLength(length);
+    SuccessOrQuit(message->Append(tlv));
+    SuccessOrQuit(message->AppendBytes(netData, length));
+
+    sVersion++;
+    SuccessOrQuit(sInstance->Get<NetworkData::Leader>().SetNetworkData(sVersion, sVersion, NetworkData::kFullSet,
+                                                                        *message, 0));
+    message->Free();
+
+    ProcessTasklets();
+}
+
+static uint8_t CountBits(uint8_t aMask)
+{
+    uint8_t count = 0;
+
+    for (; aMask != 0; aMask >>= 1)
+    {
+        count += (aMask & 1);
+    }
+
+    return count;
+}
+
+static void VerifyNotifications(uint32_t aExpectedAdded, uint32_t aExpectedRemoved)
+{
+    VerifyOrQuit(sNumAdded == aExpectedAdded, "Unexpected number of address added notifications");
+    VerifyOrQuit(sNumRemoved == aExpectedRemoved, "Unexpected number of address removed notifications");
+    sNumAdded   = 0;
+    sNumRemoved = 0;
+}
+
+void TestSlaacPrefixChurn(void)
+{
+    static constexpr uint16_t kNumIterations = 500;
+
+    uint8_t  mask;
+    uint32_t totalAdded    = 0;
+    uint32_t totalRemoved  = 0;
+    uint32_t totalUpdates  = 0;
+    uint32_t totalPrefixes = 0;
+
+    printf("TestSlaacPrefixChurn");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    otIp6SetAddressCallback(sInstance, HandleAddressChange, nullptr);
+    ProcessTasklets();
+
+    VerifyOrQuit(sInstance->Get<Utils::Slaac>().IsEnabled());
+
+    // Initial prefixes.
+
+    SetNetworkData(0x07, false);
+    VerifyNotifications(3, 0);
+
+    // New network data version, with an unrelated (non-SLAAC) prefix
+    // added and removed. The SLAAC addresses are not touched.
+
+    SetNetworkData(0x07, true);
+    VerifyNotifications(0, 0);
+    SetNetworkData(0x07, false);
+    VerifyNotifications(0, 0);
+
+    // One prefix replaced with another.
+
+    SetNetworkData(0x0b, false);
+    VerifyNotifications(1, 1);
+
+    // Random churn. The number of notifications must match the number
+    // of prefixes that actually changed.
+
+    mask = 0x0b;
+
+    for (uint16_t iteration = 0; iteration < kNumIterations; iteration++)
+    {
+        uint8_t newMask;
+
+        do
+        {
+            newMask = mask ^ static_cast<uint8_t>(1 << GetRandom(kNumChurnPrefixes));
+
+            if (GetRandom(2) == 0)
+            {
+                newMask ^= static_cast<uint8_t>(1 << GetRandom(kNumChurnPrefixes));
+            }
+        } while (CountBits(newMask) > kNumAddresses);
+
+        totalAdded += CountBits(newMask & ~mask);
+        totalRemoved += CountBits(mask & ~newMask);
+        totalUpdates++;
+        totalPrefixes += CountBits(newMask);
+
+        SetNetworkData(newMask, (GetRandom(3) == 0));
+        VerifyNotifications(CountBits(newMask & ~mask), CountBits(mask & ~newMask));
+
+        mask = newMask;
+    }
+
+    printf("\n  %u netdata updates (%u SLAAC prefixes): %u added, %u removed notifications", totalUpdates,
+           totalPrefixes, totalAdded, totalRemoved);
+
+    // Disabling removes all addresses, enabling adds them back with
+    // the same IIDs.
+
+    sInstance->Get<Utils::Slaac>().Disable();
+    ProcessTasklets();
+    VerifyNotifications(0, CountBits(mask));
+
+    sInstance->Get<Utils::Slaac>().Enable();
+    ProcessTasklets();
+    VerifyNotifications(CountBits(mask), 0);
+
+    otIp6SetAddressCallback(sInstance, nullptr, nullptr);
+    testFreeInstance(sInstance);
+
+    printf(" -- PASS\n");
+}
+
+void TestSlaacUserAddress(void)
+{
+    otNetifAddress userAddress;
+    uint8_t        mask = 0x01;
+
+    printf("TestSlaacUserAddress");
+
+    sInstance = testInitInstance();
+    VerifyOrQuit(sInstance != nullptr);
+
+    memset(sHasIid, 0, sizeof(sHasIid));
+    sNumAdded   = 0;
+    sNumRemoved = 0;
+
+    otIp6SetAddressCallback(sInstance, HandleAddressChange, nullptr);
+    ProcessTasklets();
+
+    SetNetworkData(mask, false);
+    VerifyNotifications(1, 0);
+
+    // User adds an address with a prefix before it is in network data.
+    // No SLAAC address is added for that prefix. Note that the address
+    // callback is not invoked for external (user) addresses.
+
+    memset(&userAddress, 0, sizeof(userAddress));
+    SuccessOrQuit(AsCoreType(&userAddress.mAddress).FromString("fd00:0:0:6::1234"));
+    userAddress.mPrefixLength = 64;
+    userAddress.mPreferred    = true;
+    userAddress.mValid        = true;
+
+    SuccessOrQuit(otIp6AddUnicastAddress(sInstance, &userAddress));
+    ProcessTasklets();
+    VerifyNotifications(0, 0);
+
+    mask |= (1 << kUserPrefix);
+    SetNetworkData(mask, false);
+    VerifyNotifications(0, 0);
+
+    // Removing the user address causes a SLAAC address to be added.
+
+    SuccessOrQuit(otIp6RemoveUnicastAddress(sInstance, &userAddress.mAddress));
+    ProcessTasklets();
+    VerifyNotifications(1, 0);
+
+    // Removing the prefix now removes the SLAAC address (and the
+    // resulting address removed event does not add it back).
+
+    mask &= ~(1 << kUserPrefix);
+    SetNetworkData(mask, false);
+    VerifyNotifications(0, 1);
+
+    otIp6SetAddressCallback(sInstance, nullptr, nullptr);
+    testFreeInstance(sInstance);
+
+    printf(" -- PASS\n");
+}
+
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_IP6_SLAAC_ENABLE
+    ot::TestSlaacPrefixChurn();
+    ot::TestSlaacUserAddress();
+    printf("\nAll tests passed.\n");
+#else
+    printf("SLAAC feature is not enabled\n");
+#endif
+
+    return 0;
+}
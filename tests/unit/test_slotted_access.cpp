@@ -0,0 +1,407 @@
+/*
+ *  Copyright (c) 2022, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+
+#include "test_platform.h"
+#include "test_util.h"
+
+#include <openthread/config.h>
+
+#include "mac/slotted_access.hpp"
+
+namespace ot {
+
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+
+using Mac::SlottedAccess;
+
+void TestSlottedAccessSchedule(void)
+{
+    static constexpr uint32_t kSlotframe     = SlottedAccess::kSlotframeDuration;
+    static constexpr uint8_t  kNumWindows[]  = {1, 2, 3, 7, 16, 32};
+    static constexpr uint64_t kTimeOffsets[] = {0, 1, 999, 12345, kSlotframe - 1, kSlotframe * 1000 + 17};
+
+    printf("\nTestSlottedAccessSchedule");
+
+    // A single window spans the whole slotframe.
+    for (uint64_t time : kTimeOffsets)
+    {
+        VerifyOrQuit(SlottedAccess::CalculateDelayToWindow(time, 0, 1) == 0);
+    }
+
+    VerifyOrQuit(SlottedAccess::CalculateDelayToWindow(0, 0, 4) == 0);
+    VerifyOrQuit(SlottedAccess::CalculateDelayToWindow(0, 1, 4) == kSlotframe / 4);
+    VerifyOrQuit(SlottedAccess::CalculateDelayToWindow(0, 3, 4) == kSlotframe / 4 * 3);
+    VerifyOrQuit(SlottedAccess::CalculateDelayToWindow(kSlotframe / 4 - 1, 0, 4) == 0);
+    VerifyOrQuit(SlottedAccess::CalculateDelayToWindow(kSlotframe / 4, 0, 4) == kSlotframe / 4 * 3);
+    VerifyOrQuit(SlottedAccess::CalculateDelayToWindow(kSlotframe / 4, 1, 4) == 0);
+    VerifyOrQuit(SlottedAccess::CalculateDelayToWindow(kSlotframe - 1, 0, 4) == 1);
+    VerifyOrQuit(SlottedAccess::CalculateDelayToWindow(kSlotframe * 7 + 1, 2, 4) == kSlotframe / 2 - 1);
+
+    for (uint8_t numWindows : kNumWindows)
+    {
+        uint32_t windowDuration = kSlotframe / numWindows;
+
+        for (uint64_t time = 0; time < 3ULL * kSlotframe; time += 125)
+        {
+            uint8_t numMatches = 0;
+
+            for (uint8_t window = 0; window < numWindows; window++)
+            {
+                uint32_t delay = SlottedAccess::CalculateDelayToWindow(time, window, numWindows);
+
+                VerifyOrQuit(delay < kSlotframe);
+                VerifyOrQuit(SlottedAccess::CalculateDelayToWindow(time + delay, window, numWindows) == 0);
+
+                if (delay == 0)
+                {
+                    VerifyOrQuit((time % kSlotframe) / windowDuration == window);
+                    numMatches++;
+                }
+            }
+
+            // Remainder of an uneven division of the slotframe belongs to no window.
+            VerifyOrQuit(numMatches == (((time % kSlotframe) < windowDuration * numWindows) ? 1 : 0));
+        }
+    }
+
+    printf(" -- PASS\n");
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+// Collision/latency benchmark
+//
+// Models a dense deployment where all routers hear each other. Time advances in units of one CSMA-CA backoff
+// period. A router does a CCA at the end of its random backoff and starts transmitting in the next unit, so two
+// routers ending their backoff in the same unit collide (the CCA cannot detect a transmission which starts after it).
+// Collided frames are retried. With slotted access, a router only starts the CSMA-CA of a new frame within its own
+// window (retries of the current frame continue, matching `Mac` handing the frame to `SubMac`).
+
+class ContentionModel
+{
+public:
+    static constexpr uint32_t kUnit            = 320;       // Backoff period (usec).
+    static constexpr uint32_t kFrameUnits      = 8;         // ~80 bytes + ack (2.56 msec).
+    static constexpr uint8_t  kMinBe           = 3;         // macMinBE
+    static constexpr uint8_t  kMaxBe           = 5;         // macMaxBE
+    static constexpr uint8_t  kMaxBackoffs     = 4;         // macMaxCSMABackoffs
+    static constexpr uint8_t  kMaxFrameRetries = 3;         // macMaxFrameRetries
+    static constexpr uint8_t  kMaxRouters      = 32;        // Max number of routers in the model.
+    static constexpr uint16_t kQueueSize       = 256;       // Max number of frames queued by a router.
+    static constexpr uint64_t kDuration        = 120000000; // Duration of the run (usec).
+
+    struct Result
+    {
+        uint32_t mGenerated;
+        uint32_t mAttempts;
+        uint32_t mCollisions;
+        uint32_t mDelivered;
+        uint32_t mDropped;
+        uint64_t mTotalLatency;
+        uint32_t mMaxLatency;
+    };
+
+    ContentionModel(uint8_t aNumRouters, uint32_t aFramesPerMinute, bool aSlotted)
+        : mNumRouters(aNumRouters)
+        , mFramesPerMinute(aFramesPerMinute)
+        , mSlotted(aSlotted)
+        , mActiveCount(0)
+        , mRandomSeed(0x1234567)
+    {
+        memset(mRouters, 0, sizeof(mRouters));
+        memset(&mResult, 0, sizeof(mResult));
+    }
+
+    const Result &Run(void)
+    {
+        uint64_t arrivalThreshold = 0xffffffffULL * mFramesPerMinute * kUnit / 60000000ULL;
+
+        for (uint64_t unit = 0; unit * kUnit < kDuration; unit++)
+        {
+            uint64_t now      = unit * kUnit;
+            uint8_t  numStart = 0;
+            uint8_t  starters[kMaxRouters];
+            bool     busy;
+
+            FinishTransmissions(unit);
+            busy = (mActiveCount > 0);
+
+            for (uint8_t id = 0; id < mNumRouters; id++)
+            {
+                Router &router = mRouters[id];
+
+                if (GetRandom() < arrivalThreshold)
+                {
+                    mResult.mGenerated++;
+
+                    if (router.mQueueLength < kQueueSize)
+                    {
+                        router.mQueue[(router.mQueueHead + router.mQueueLength++) % kQueueSize] = now;
+                    }
+                    else
+                    {
+                        mResult.mDropped++;
+                    }
+                }
+
+                switch (router.mState)
+                {
+                case kStateIdle:
+                    if ((router.mQueueLength == 0) ||
+                        (mSlotted && SlottedAccess::CalculateDelayToWindow(now, id, mNumRouters) != 0))
+                    {
+                        break;
+                    }
+
+                    router.mRetries = 0;
+                    StartCsma(router);
+                    break;
+
+                case kStateBackoff:
+                    if (router.mBackoff > 0)
+                    {
+                        router.mBackoff--;
+                        break;
+                    }
+
+                    if (!busy)
+                    {
+                        starters[numStart++] = id;
+                        break;
+                    }
+
+                    if (++router.mNumBackoffs > kMaxBackoffs)
+                    {
+                        DropFrame(router);
+                        break;
+                    }
+
+                    router.mBe      = (router.mBe < kMaxBe) ? router.mBe + 1 : kMaxBe;
+                    router.mBackoff = GetRandom() % (1U << router.mBe);
+                    break;
+
+                case kStateTransmitting:
+                    break;
+                }
+            }
+
+            for (uint8_t i = 0; i < numStart; i++)
+            {
+                Router &router = mRouters[starters[i]];
+
+                router.mState    = kStateTransmitting;
+                router.mTxEnd    = unit + kFrameUnits;
+                router.mCollided = (mActiveCount > 0) || (numStart > 1);
+
+                if (mActiveCount > 0)
+                {
+                    MarkActiveCollided();
+                }
+
+                mResult.mAttempts++;
+            }
+
+            mActiveCount += numStart;
+        }
+
+        return mResult;
+    }
+
+private:
+    enum State : uint8_t
+    {
+        kStateIdle,
+        kStateBackoff,
+        kStateTransmitting,
+    };
+
+    struct Router
+    {
+        State    mState;
+        uint8_t  mBe;
+        uint8_t  mNumBackoffs;
+        uint8_t  mRetries;
+        uint16_t mBackoff;
+        bool     mCollided;
+        uint64_t mTxEnd;
+        uint16_t mQueueHead;
+        uint16_t mQueueLength;
+        uint64_t mQueue[kQueueSize];
+    };
+
+    uint32_t GetRandom(void)
+    {
+        // xorshift32, deterministic across runs.
+        mRandomSeed ^= mRandomSeed << 13;
+        mRandomSeed ^= mRandomSeed >> 17;
+        mRandomSeed ^= mRandomSeed << 5;
+        return mRandomSeed;
+    }
+
+    void StartCsma(Router &aRouter)
+    {
+        aRouter.mState       = kStateBackoff;
+        aRouter.mBe          = kMinBe;
+        aRouter.mNumBackoffs = 0;
+        aRouter.mBackoff     = GetRandom() % (1U << kMinBe);
+    }
+
+    void DropFrame(Router &aRouter)
+    {
+        mResult.mDropped++;
+        aRouter.mQueueHead = (aRouter.mQueueHead + 1) % kQueueSize;
+        aRouter.mQueueLength--;
+        aRouter.mState = kStateIdle;
+    }
+
+    void MarkActiveCollided(void)
+    {
+        for (uint8_t id = 0; id < mNumRouters; id++)
+        {
+            if (mRouters[id].mState == kStateTransmitting)
+            {
+                mRouters[id].mCollided = true;
+            }
+        }
+    }
+
+    void FinishTransmissions(uint64_t aUnit)
+    {
+        for (uint8_t id = 0; id < mNumRouters; id++)
+        {
+            Router &router = mRouters[id];
+
+            if ((router.mState != kStateTransmitting) || (router.mTxEnd != aUnit))
+            {
+                continue;
+            }
+
+            mActiveCount--;
+
+            if (router.mCollided)
+            {
+                mResult.mCollisions++;
+
+                if (router.mRetries++ < kMaxFrameRetries)
+                {
+                    StartCsma(router);
+                }
+                else
+                {
+                    DropFrame(router);
+                }
+            }
+            else
+            {
+                uint32_t latency = static_cast<uint32_t>(aUnit * kUnit - router.mQueue[router.mQueueHead]);
+
+                mResult.mDelivered++;
+                mResult.mTotalLatency += latency;
+                mResult.mMaxLatency = (latency > mResult.mMaxLatency) ? latency : mResult.mMaxLatency;
+
+                router.mQueueHead = (router.mQueueHead + 1) % kQueueSize;
+                router.mQueueLength--;
+                router.mState = kStateIdle;
+            }
+        }
+    }
+
+    uint8_t  mNumRouters;
+    uint32_t mFramesPerMinute;
+    bool     mSlotted;
+    uint8_t  mActiveCount;
+    uint32_t mRandomSeed;
+    Result   mResult;
+    Router   mRouters[kMaxRouters];
+};
+
+void TestSlottedAccessBenchmark(void)
+{
+    struct Scenario
+    {
+        uint8_t  mNumRouters;
+        uint32_t mFramesPerMinute;
+    };
+
+    // Offered load is roughly 20% and 40% of airtime.
+    static const Scenario kScenarios[] = {{8, 600}, {16, 300}, {32, 150}, {16, 600}, {32, 300}};
+
+    printf("\nTestSlottedAccessBenchmark (slotframe %lu usec)\n",
+           static_cast<unsigned long>(SlottedAccess::kSlotframeDuration));
+    printf("routers frames/min access    attempts collision%% delivered%% avg-latency(ms) max-latency(ms)\n");
+
+    for (const Scenario &scenario : kScenarios)
+    {
+        uint32_t collisionRate[2];
+
+        for (uint8_t slotted = 0; slotted < 2; slotted++)
+        {
+            ContentionModel                model(scenario.mNumRouters, scenario.mFramesPerMinute, slotted);
+            const ContentionModel::Result &result = model.Run();
+            uint32_t                       deliveryRate;
+
+            VerifyOrQuit(result.mAttempts > 0 && result.mDelivered > 0);
+
+            // Rates are in units of 0.01%.
+            collisionRate[slotted] = static_cast<uint32_t>(10000ULL * result.mCollisions / result.mAttempts);
+            deliveryRate           = static_cast<uint32_t>(10000ULL * result.mDelivered / result.mGenerated);
+
+            printf("%7u %10lu %-9s %8lu %9lu.%02lu %9lu.%02lu %15lu %15lu\n", scenario.mNumRouters,
+                   static_cast<unsigned long>(scenario.mFramesPerMinute), slotted ? "slotted" : "unslotted",
+                   static_cast<unsigned long>(result.mAttempts),
+                   static_cast<unsigned long>(collisionRate[slotted] / 100),
+                   static_cast<unsigned long>(collisionRate[slotted] % 100),
+                   static_cast<unsigned long>(deliveryRate / 100), static_cast<unsigned long>(deliveryRate % 100),
+                   static_cast<unsigned long>(result.mTotalLatency / result.mDelivered / 1000),
+                   static_cast<unsigned long>(result.mMaxLatency / 1000));
+        }
+
+        VerifyOrQuit(collisionRate[1] < collisionRate[0], "slotted access did not reduce collisions");
+    }
+
+    printf(" -- PASS\n");
+}
+
+#endif // OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+
+} // namespace ot
+
+int main(void)
+{
+#if OPENTHREAD_FTD && OPENTHREAD_CONFIG_MAC_SLOTTED_ACCESS_ENABLE
+    ot::TestSlottedAccessSchedule();
+    ot::TestSlottedAccessBenchmark();
+    printf("All tests passed\n");
+#else
+    printf("Slotted access is not enabled\n");
+#endif
+    return 0;
+}
@@ -0,0 +1,321 @@
+/*
+ *  Copyright (c) 2021, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include <openthread/config.h>
+
+#include <chrono>
+#include <string.h>
+
+#include "test_platform.h"
+#include "test_util.hpp"
+
+#include <openthread/ip6.h>
+#include <openthread/tasklet.h>
+
+#include "common/arg_macros.hpp"
+#include "common/instance.hpp"
+#include "net/dns_types.hpp"
+#include "net/srp_client.hpp"
+#include "net/udp6.hpp"
+
+#if OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
+
+extern "C" {
+
+static uint32_t    sNow = 0;
+static uint32_t    sAlarmTime;
+static bool        sAlarmOn = false;
+static otInstance *sInstance;
+
+// Logs a message and adds current time (sNow) as "<hours>:<min>:<secs>.<msec>"
+#define Log(...)                                                                                          \
+    printf("%02u:%02u:%02u.%03u " OT_FIRST_ARG(__VA_ARGS__) "\n", (sNow / 36000000), (sNow / 60000) % 60, \
+           (sNow / 1000) % 60, sNow % 1000 OT_REST_ARGS(__VA_ARGS__))
+
+void otPlatAlarmMilliStop(otInstance *)
+{
+    sAlarmOn = false;
+}
+
+void otPlatAlarmMilliStartAt(otInstance *, uint32_t aT0, uint32_t aDt)
+{
+    sAlarmOn   = true;
+    sAlarmTime = aT0 + aDt;
+}
+
+uint32_t otPlatAlarmMilliGetNow(void)
+{
+    return sNow;
+}
+
+} // extern "C"
+
+void ProcessTasklets(void)
+{
+    while (otTaskletsArePending(sInstance))
+    {
+        otTaskletsProcess(sInstance);
+    }
+}
+
+void AdvanceTime(uint32_t aDuration)
+{
+    uint32_t time = sNow + aDuration;
+
+    Log(" AdvanceTime for %u.%03u", aDuration / 1000, aDuration % 1000);
+
+    ProcessTasklets();
+
+    while (sAlarmOn && (sAlarmTime <= time))
+    {
+        sNow = sAlarmTime;
+        otPlatAlarmMilliFired(sInstance);
+        ProcessTasklets();
+    }
+
+    sNow = time;
+}
+
+namespace ot {
+namespace Srp {
+
+static constexpr uint16_t kServerPort     = 53535;
+static constexpr uint16_t kMaxUpdateSize  = 1280;
+static constexpr uint8_t  kNumServices    = 8;
+
+// Fake SRP server: records the received update messages and (when
+// `sRespond` is set) responds to them with a success response.
+
+static Ip6::Udp::Socket *sServerSocket;
+static bool              sRespond;
+static uint16_t          sUpdateCount;
+static uint16_t          sLastUpdateLength;
+static uint16_t          sLastUpdateMessageId;
+static uint8_t           sLastUpdate[kMaxUpdateSize];
+
+void HandleServerUdpReceive(void *aContext, otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    OT_UNUSED_VARIABLE(aContext);
+
+    Message &         message = AsCoreType(aMessage);
+    Dns::UpdateHeader header;
+    Message *         response;
+
+    sUpdateCount++;
+    sLastUpdateLength = message.GetLength() - message.GetOffset();
+    VerifyOrQuit(sLastUpdateLength <= kMaxUpdateSize);
+    VerifyOrQuit(message.ReadBytes(message.GetOffset(), sLastUpdate, sLastUpdateLength) == sLastUpdateLength);
+
+    SuccessOrQuit(message.Read(message.GetOffset(), header));
+    sLastUpdateMessageId = header.GetMessageId();
+
+    Log(" Server received update, id:0x%04x, len:%u", sLastUpdateMessageId, sLastUpdateLength);
+
+    VerifyOrExit(sRespond);
+
+    header.SetType(Dns::Header::kTypeResponse);
+    header.SetResponseCode(Dns::Header::kResponseSuccess);
+    header.SetZoneRecordCount(0);
+    header.SetPrerequisiteRecordCount(0);
+    header.SetUpdateRecordCount(0);
+    header.SetAdditionalRecordCount(0);
+
+    response = sServerSocket->NewMessage(0);
+    VerifyOrQuit(response != nullptr);
+    SuccessOrQuit(response->Append(header));
+    SuccessOrQuit(sServerSocket->SendTo(*response, AsCoreType(aMessageInfo)));
+
+exit:
+    return;
+}
+
+void InitService(Client::Service &aService, const char *aInstanceName)
+{
+    memset(&aService, 0, sizeof(aService));
+    aService.mName         = "_srv._udp";
+    aService.mInstanceName = aInstanceName;
+    aService.mPort         = 1234;
+}
+
+void TestSrpClientUpdates(void)
+{
+    static const char *const kInstanceNames[kNumServices] = {"inst0", "inst1", "inst2", "inst3",
+                                                             "inst4", "inst5", "inst6", "inst7"};
+
+    Instance &                                     instance = *static_cast<Instance *>(testInitInstance());
+    Client &                                       client   = instance.Get<Client>();
+    Ip6::Udp::Socket                               serverSocket(instance);
+    Client::Service                                services[kNumServices];
+    Ip6::Address                                   hostAddress;
+    Ip6::SockAddr                                  serverSockAddr;
+    uint16_t                                       fullUpdateLength;
+    uint16_t                                       deltaUpdateLength;
+    uint8_t                                        firstTx[kMaxUpdateSize];
+    uint16_t                                       firstTxLength;
+    uint16_t                                       firstTxMessageId;
+    std::chrono::high_resolution_clock::time_point start;
+    std::chrono::microseconds                      signDuration;
+    std::chrono::microseconds                      reuseDuration;
+
+    sNow          = 0;
+    sInstance     = &instance;
+    sServerSocket = &serverSocket;
+    sRespond      = true;
+    sUpdateCount  = 0;
+
+    Log("--------------------------------------------------------------------------------------------");
+    Log("TestSrpClientUpdates");
+
+    SuccessOrQuit(otIp6SetEnabled(sInstance, true));
+    ProcessTasklets();
+
+    // Use one of the device's own addresses for both the host and the
+    // (fake) server so that update messages are delivered locally.
+
+    VerifyOrQuit(otIp6GetUnicastAddresses(sInstance) != nullptr);
+    hostAddress = AsCoreType(&otIp6GetUnicastAddresses(sInstance)->mAddress);
+    serverSockAddr.SetAddress(hostAddress);
+    serverSockAddr.SetPort(kServerPort);
+
+    SuccessOrQuit(serverSocket.Open(HandleServerUdpReceive, nullptr));
+    SuccessOrQuit(serverSocket.Bind(kServerPort));
+
+    SuccessOrQuit(client.SetHostName("host"));
+    SuccessOrQuit(client.SetHostAddresses(&hostAddress, 1));
+
+    for (uint8_t i = 0; i < kNumServices; i++)
+    {
+        InitService(services[i], kInstanceNames[i]);
+    }
+
+    // Add multiple services back-to-back and check that they are
+    // coalesced into a single update message.
+
+    for (uint8_t i = 0; i < kNumServices - 2; i++)
+    {
+        SuccessOrQuit(client.AddService(services[i]));
+    }
+
+    SuccessOrQuit(client.Start(serverSockAddr));
+    AdvanceTime(1000);
+
+    VerifyOrQuit(sUpdateCount == 1);
+    VerifyOrQuit(client.GetHostInfo().GetState() == Client::kRegistered);
+
+    for (uint8_t i = 0; i < kNumServices - 2; i++)
+    {
+        VerifyOrQuit(services[i].GetState() == Client::kRegistered);
+    }
+
+    fullUpdateLength = sLastUpdateLength;
+
+    // Add a new service and check that the update message only
+    // includes the new service along with host description.
+
+    SuccessOrQuit(client.AddService(services[kNumServices - 2]));
+    AdvanceTime(1000);
+
+    VerifyOrQuit(sUpdateCount == 2);
+    VerifyOrQuit(services[kNumServices - 2].GetState() == Client::kRegistered);
+
+    deltaUpdateLength = sLastUpdateLength;
+    VerifyOrQuit(deltaUpdateLength < fullUpdateLength);
+
+    // Stop responding, add another service and wait for the client to
+    // time out and retransmit the update. Since the content is not
+    // changed, the retransmission should reuse the same message ID and
+    // signature (i.e., be identical to the first tx).
+
+    sRespond = false;
+
+    SuccessOrQuit(client.AddService(services[kNumServices - 1]));
+
+    start = std::chrono::high_resolution_clock::now();
+    AdvanceTime(1000);
+    signDuration =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+
+    VerifyOrQuit(sUpdateCount == 3);
+    VerifyOrQuit(services[kNumServices - 1].GetState() == Client::kAdding);
+
+    memcpy(firstTx, sLastUpdate, sLastUpdateLength);
+    firstTxLength    = sLastUpdateLength;
+    firstTxMessageId = sLastUpdateMessageId;
+
+    sRespond = true;
+
+    start = std::chrono::high_resolution_clock::now();
+    AdvanceTime(OPENTHREAD_CONFIG_SRP_CLIENT_MIN_RETRY_WAIT_INTERVAL + 1000);
+    reuseDuration =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now() - start);
+
+    VerifyOrQuit(sUpdateCount == 4);
+    VerifyOrQuit(sLastUpdateMessageId == firstTxMessageId);
+    VerifyOrQuit(sLastUpdateLength == firstTxLength);
+    VerifyOrQuit(memcmp(sLastUpdate, firstTx, firstTxLength) == 0);
+    VerifyOrQuit(services[kNumServices - 1].GetState() == Client::kRegistered);
+
+    // After a response, a new update must use a new message ID.
+
+    SuccessOrQuit(client.RemoveService(services[0]));
+    AdvanceTime(1000);
+
+    VerifyOrQuit(sUpdateCount == 5);
+    VerifyOrQuit(sLastUpdateMessageId != firstTxMessageId);
+    VerifyOrQuit(services[0].GetState() == Client::kRemoved);
+
+    printf("\nUpdate message size: full %u bytes (%u services), delta %u bytes (1 service)", fullUpdateLength,
+           kNumServices - 2, deltaUpdateLength);
+    printf("\nUpdate tx: signed %u usec, retransmitted with reused signature %u usec\n",
+           static_cast<uint32_t>(signDuration.count()), static_cast<uint32_t>(reuseDuration.count()));
+
+    client.Stop();
+    SuccessOrQuit(serverSocket.Close());
+
+    Log("End of TestSrpClientUpdates");
+
+    testFreeInstance(&instance);
+}
+
+} // namespace Srp
+} // namespace ot
+
+#endif // OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
+
+int main(void)
+{
+#if OPENTHREAD_CONFIG_SRP_CLIENT_ENABLE
+    ot::Srp::TestSrpClientUpdates();
+    printf("All tests passed\n");
+#else
+    printf("SRP_CLIENT feature is not enabled\n");
+#endif
+
+    return 0;
+}